@@ -0,0 +1,737 @@
+#include "gtest/gtest.h"
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <numeric>
+
+#include "../../../../src/graph/criteria/ATR.hpp"
+#include "../../../../src/utils/parse/TGFParser.hpp"
+
+using namespace grph::graph;
+
+static std::shared_ptr<AdjacencyMatrix<random::EdgeProbability>> makeGrid(int rows, int columns) {
+    auto matrix = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(rows * columns);
+    for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < columns; ++column) {
+            const int vertex = row * columns + column;
+            if (column + 1 < columns) {
+                matrix->addEdge(vertex, vertex + 1, 0.9 - 0.01 * column);
+            }
+            if (row + 1 < rows) {
+                matrix->addEdge(vertex, vertex + columns, 0.8 + 0.01 * row);
+            }
+        }
+    }
+    return matrix;
+}
+
+/// sum over all 2^E edge states, for small graphs only
+static double bruteForceATR(const AdjacencyMatrix<random::EdgeProbability> &matrix) {
+    const int numVertexes = matrix.getDimension();
+    std::vector<std::pair<int, int>> edges;
+    for (int vertex1 = 0; vertex1 < numVertexes; ++vertex1) {
+        for (int vertex2 = vertex1 + 1; vertex2 < numVertexes; ++vertex2) {
+            if (matrix.isConnected(vertex1, vertex2)) {
+                edges.emplace_back(vertex1, vertex2);
+            }
+        }
+    }
+
+    double R = 0.;
+    for (long long state = 0; state < (1LL << edges.size()); ++state) {
+        std::vector<int> component(numVertexes);
+        std::iota(component.begin(), component.end(), 0);
+        double stateP = 1.;
+        for (int edgeIdx = 0; edgeIdx < static_cast<int>(edges.size()); ++edgeIdx) {
+            const auto [vertex1, vertex2] = edges[edgeIdx];
+            const double p = matrix.at(vertex1, vertex2);
+            if (!(state >> edgeIdx & 1)) {
+                stateP *= 1 - p;
+                continue;
+            }
+            stateP *= p;
+            const int oldComponent = component[vertex2];
+            for (auto &vertexComponent: component) {
+                if (vertexComponent == oldComponent) {
+                    vertexComponent = component[vertex1];
+                }
+            }
+        }
+        if (std::all_of(component.begin(), component.end(), [&](int c) { return c == component[0]; })) {
+            R += stateP;
+        }
+    }
+    return R;
+}
+
+TEST(ATRTest, ExampleFromManual) {
+    const auto matrix = grph::utils::TGFParser::parseFile(
+            "../../Google_tests/integration_tests/test_graphs/example_from_manual.tgf"
+    );
+    ASSERT_NEAR(0.790784208, random::ATR::calculateATR(*matrix), 1e-9);
+}
+
+TEST(ATRTest, ParallelMatchesSerial) {
+    const auto matrix = makeGrid(4, 5);
+
+    const double serialATR = random::ATR::calculateATR(*matrix);
+    const double parallelATR = random::ATR::calculateATR(*matrix, random::ExecutionPolicy{.threads = 4});
+    ASSERT_DOUBLE_EQ(serialATR, parallelATR);
+}
+
+TEST(ATRTest, TranspositionTableKeepsResultWithinBudget) {
+    const auto matrix = makeGrid(4, 5);
+    const size_t memoryBudget = 64 * 1024;
+
+    random::ExecutionPolicy executionPolicy;
+    executionPolicy.transpositionTable = std::make_shared<random::TranspositionTable>(memoryBudget);
+
+    ASSERT_NEAR(random::ATR::calculateATR(*matrix),
+                random::ATR::calculateATR(*matrix, executionPolicy),
+                1e-12);
+
+    const auto statistics = executionPolicy.transpositionTable->getStatistics();
+    ASSERT_GT(statistics.misses, 0);
+    ASSERT_EQ(statistics.misses, statistics.insertions);
+    ASSERT_LE(statistics.memoryUsage, memoryBudget);
+}
+
+TEST(ATRTest, BlocksAreMultiplied) {
+    const int ringSize = 7;
+    const int numRings = 3;
+    auto ring = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(ringSize);
+    auto rings = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(numRings * (ringSize - 1) + 1);
+    for (int vertex = 0; vertex < ringSize; ++vertex) {
+        for (int step = 1; step <= 2; ++step) {
+            const int neighbor = (vertex + step) % ringSize;
+            const random::EdgeProbability p = 0.9 - 0.02 * vertex - 0.01 * step;
+            ring->addEdge(vertex, neighbor, p);
+            for (int ringIdx = 0; ringIdx < numRings; ++ringIdx) { // consecutive rings share one vertex
+                rings->addEdge(ringIdx * (ringSize - 1) + vertex, ringIdx * (ringSize - 1) + neighbor, p);
+            }
+        }
+    }
+
+    const double ringATR = random::ATR::calculateATR(*ring);
+    ASSERT_NEAR(ringATR * ringATR * ringATR, random::ATR::calculateATR(*rings), 1e-12);
+    ASSERT_NEAR(ringATR * ringATR * ringATR,
+                random::ATR::calculateATR(*rings, random::ExecutionPolicy{.threads = 3, .splitDepth = 2}),
+                1e-12);
+}
+
+TEST(ATRTest, SeparationPairSplitsFactoring) {
+    // two rings of 6 with chords, joined through the routers 12 and 13
+    auto matrix = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(14);
+    for (int shift: {0, 6}) {
+        for (int vertex = 0; vertex < 6; ++vertex) {
+            matrix->addEdge(shift + vertex, shift + (vertex + 1) % 6, 0.9 - 0.01 * vertex - 0.02 * shift);
+            if (vertex < 3) {
+                matrix->addEdge(shift + vertex, shift + vertex + 3, 0.7 + 0.03 * vertex);
+            }
+        }
+        matrix->addEdge(12, shift, 0.85);
+        matrix->addEdge(12, shift + 2, 0.8);
+        matrix->addEdge(13, shift + 3, 0.75 + 0.01 * shift);
+        matrix->addEdge(13, shift + 5, 0.95);
+    }
+    matrix->addEdge(12, 13, 0.6);
+
+    const auto statistics = std::make_shared<random::FactoringStatistics>();
+    const double R = random::ATR::calculateATR(*matrix, random::ExecutionPolicy{.statistics = statistics});
+    ASSERT_GT(statistics->separations, 0);
+    ASSERT_NEAR(random::ATR::calculateATR(*matrix, random::ExecutionPolicy{
+            .engine = random::ReliabilityEngine::FRONTIER}), R, 1e-12);
+}
+
+TEST(ATRTest, SeparationPairIsUsedByEveryDriver) {
+    // two 3 x 5 grids, joined through the routers 30 and 31; big enough to be split into tasks
+    auto matrix = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(32);
+    for (int shift: {0, 15}) {
+        const auto grid = makeGrid(3, 5);
+        for (int vertex1 = 0; vertex1 < 15; ++vertex1) {
+            for (int vertex2 = vertex1 + 1; vertex2 < 15; ++vertex2) {
+                if (grid->isConnected(vertex1, vertex2)) {
+                    matrix->addEdge(shift + vertex1, shift + vertex2, grid->at(vertex1, vertex2) - 0.001 * shift);
+                }
+            }
+        }
+        matrix->addEdge(30, shift, 0.85);
+        matrix->addEdge(30, shift + 10, 0.8);
+        matrix->addEdge(31, shift + 4, 0.75);
+        matrix->addEdge(31, shift + 14, 0.95);
+    }
+
+    const auto serialStatistics = std::make_shared<random::FactoringStatistics>();
+    const double R = random::ATR::calculateATR(*matrix, random::ExecutionPolicy{.statistics = serialStatistics});
+    ASSERT_GT(serialStatistics->separations, 0);
+
+    const auto parallelStatistics = std::make_shared<random::FactoringStatistics>();
+    ASSERT_EQ(R, random::ATR::calculateATR(*matrix, random::ExecutionPolicy{.threads = 4,
+                                                                            .statistics = parallelStatistics}));
+    ASSERT_EQ(serialStatistics->factoringSteps, parallelStatistics->factoringSteps);
+    ASSERT_EQ(serialStatistics->separations, parallelStatistics->separations);
+
+    const auto path = (std::filesystem::temp_directory_path() / "grph_atr_separation_checkpoint.bin").string();
+    const auto checkpointStatistics = std::make_shared<random::FactoringStatistics>();
+    const random::CheckpointPolicy checkpointPolicy{.path = path, .splitDepth = 6};
+    ASSERT_EQ(R, random::ATR::calculateATRWithCheckpoints(*matrix, checkpointPolicy, random::ExecutionPolicy{
+            .statistics = checkpointStatistics}));
+    ASSERT_EQ(serialStatistics->factoringSteps, checkpointStatistics->factoringSteps);
+    std::filesystem::remove(path);
+}
+
+TEST(ATRTest, PolygonsAreReducedWithoutFactoring) {
+    // metro ring of 10 stations with two bypass lines 0-11-12-5 and 2-13-7 over it:
+    // the bypasses and the ring arcs between their ends form polygons
+    auto matrix = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(14);
+    for (int station = 0; station < 10; ++station) {
+        matrix->addEdge(station, (station + 1) % 10, 0.95 - 0.01 * station);
+    }
+    matrix->addEdge(0, 11, 0.9);
+    matrix->addEdge(11, 12, 0.85);
+    matrix->addEdge(12, 5, 0.9);
+    matrix->addEdge(2, 13, 0.8);
+    matrix->addEdge(13, 7, 0.75);
+    matrix->addEdge(10, 3, 0.7); // one hanging station
+
+    random::UndirectedRandomGraph graph(matrix->copy());
+    graph.reduceSeriesParallel();
+    ASSERT_LE(graph.getNumVertexes(), COMPUTABLE_DIMENSION);
+    ASSERT_NEAR(bruteForceATR(*matrix), random::ATR::calculateATR(*matrix), 1e-12);
+}
+
+TEST(ATRTest, PivotStrategiesGiveSameATR) {
+    const auto matrix = makeGrid(4, 4);
+    const double expectedATR = random::ATR::calculateATR(*matrix);
+
+    for (const auto pivotStrategy: {random::PivotStrategy::LOWEST_DEGREE,
+                                    random::PivotStrategy::MAX_DEGREE,
+                                    random::PivotStrategy::MOST_CHAINS,
+                                    random::PivotStrategy::EXTREME_PROBABILITY,
+                                    random::PivotStrategy::LOOKAHEAD}) {
+        for (const int threads: {1, 3}) {
+            random::ExecutionPolicy executionPolicy{.threads = threads, .pivotStrategy = pivotStrategy};
+            executionPolicy.statistics = std::make_shared<random::FactoringStatistics>();
+
+            ASSERT_NEAR(expectedATR, random::ATR::calculateATR(*matrix, executionPolicy), 1e-12);
+            ASSERT_GT(executionPolicy.statistics->factoringSteps, 0);
+            ASSERT_GT(executionPolicy.statistics->leaves, executionPolicy.statistics->factoringSteps);
+        }
+    }
+}
+
+TEST(ATRTest, FactoringStackIsObservable) {
+    const auto matrix = makeGrid(4, 6);
+    random::ExecutionPolicy executionPolicy;
+    executionPolicy.statistics = std::make_shared<random::FactoringStatistics>();
+    const double R = random::ATR::calculateATR(*matrix, executionPolicy);
+    ASSERT_NEAR(random::ATR::calculateATR(*matrix, random::ExecutionPolicy{.engine = random::ReliabilityEngine::FRONTIER}),
+                R, 1e-12);
+
+    const long long maxDepth = executionPolicy.statistics->maxDepth;
+    ASSERT_GT(maxDepth, 2);
+    ASSERT_LT(maxDepth, 4 * executionPolicy.statistics->factoringSteps);
+    ASSERT_GE(executionPolicy.statistics->peakStackBytes, 16 * maxDepth);
+}
+
+TEST(ATRTest, GeneratedClosedFormsMatchBruteForce) {
+    auto complete6 = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(6);
+    for (int vertex1 = 0; vertex1 < 6; ++vertex1) {
+        for (int vertex2 = vertex1 + 1; vertex2 < 6; ++vertex2) {
+            complete6->addEdge(vertex1, vertex2, 0.3 + 0.04 * vertex1 + 0.03 * vertex2);
+        }
+    }
+    ASSERT_NEAR(bruteForceATR(*complete6), random::ClosedForms::calculateCompleteGraph6ATR(*complete6), 1e-12);
+
+    // missing edges of the 7-vertex form are p = 0
+    const auto wheel7 = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(7);
+    for (int vertex = 1; vertex < 7; ++vertex) {
+        wheel7->addEdge(0, vertex, 0.6 + 0.05 * vertex);
+        wheel7->addEdge(vertex, vertex % 6 + 1, 0.9 - 0.04 * vertex);
+    }
+    ASSERT_NEAR(bruteForceATR(*wheel7), random::ClosedForms::calculateCompleteGraph7ATR(*wheel7), 1e-12);
+
+    const auto cube8 = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(8);
+    for (int vertex1 = 0; vertex1 < 8; ++vertex1) {
+        for (int bit = 1; bit < 8; bit <<= 1) {
+            if ((vertex1 & bit) == 0) {
+                cube8->addEdge(vertex1, vertex1 | bit, 0.55 + 0.05 * vertex1 - 0.02 * bit);
+            }
+        }
+    }
+    ASSERT_NEAR(bruteForceATR(*cube8), random::ClosedForms::calculateCompleteGraph8ATR(*cube8), 1e-12);
+}
+
+TEST(ATRTest, ReliabilityPolynomialMatchesATR) {
+    // K4: 16 spanning trees, every subgraph with more than 3 edges is connected
+    auto complete4 = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(4);
+    for (int vertex1 = 0; vertex1 < 4; ++vertex1) {
+        for (int vertex2 = vertex1 + 1; vertex2 < 4; ++vertex2) {
+            complete4->addEdge(vertex1, vertex2, 0.5);
+        }
+    }
+    const std::vector<double> expectedCoefficients{0, 0, 0, 16, 15, 6, 1};
+    ASSERT_EQ(expectedCoefficients, random::ATR::calculateReliabilityPolynomial(*complete4).getCoefficients());
+
+    const auto grid = makeGrid(4, 4);
+    const auto polynomial = random::ATR::calculateReliabilityPolynomial(*grid);
+    ASSERT_EQ(24, polynomial.getDegree());
+    for (double p: {0.1, 0.5, 0.9, 0.99}) {
+        auto uniformGrid = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(16);
+        for (int vertex1 = 0; vertex1 < 16; ++vertex1) {
+            for (int vertex2 = vertex1 + 1; vertex2 < 16; ++vertex2) {
+                if (grid->isConnected(vertex1, vertex2)) {
+                    uniformGrid->addEdge(vertex1, vertex2, p);
+                }
+            }
+        }
+        ASSERT_NEAR(random::ATR::calculateATR(*uniformGrid), polynomial.evaluate(p), 1e-12);
+    }
+
+    auto disconnected = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(3);
+    disconnected->addEdge(0, 1, 0.5);
+    ASSERT_TRUE(random::ATR::calculateReliabilityPolynomial(*disconnected).isZero());
+}
+
+TEST(ATRTest, CompiledCircuitMatchesATR) {
+    const auto grid = makeGrid(4, 5);
+    const auto circuit = random::ATR::compileATR(*grid);
+    ASSERT_NEAR(random::ATR::calculateATR(*grid), circuit.evaluate(*grid), 1e-12);
+
+    // more vectors than one batch, the last batch is partial
+    const int numScenarios = 2 * CIRCUIT_BATCH_SIZE + 3;
+    std::vector<std::vector<random::EdgeProbability>> scenarios(numScenarios);
+    for (int scenario = 0; scenario < numScenarios; ++scenario) {
+        for (int edgeIdx = 0; edgeIdx < static_cast<int>(circuit.getEdges().size()); ++edgeIdx) {
+            scenarios[scenario].push_back(scenario == 0 ? 1. : 0.5 + 0.01 * ((scenario * 7 + edgeIdx * 3) % 50));
+        }
+    }
+    const auto R = circuit.evaluate(scenarios);
+    ASSERT_EQ(numScenarios, R.size());
+    ASSERT_DOUBLE_EQ(1., R[0]);
+    for (int scenario = 1; scenario < numScenarios; ++scenario) {
+        auto matrix = grid->copy();
+        for (int edgeIdx = 0; edgeIdx < static_cast<int>(circuit.getEdges().size()); ++edgeIdx) {
+            const auto &edge = circuit.getEdges()[edgeIdx];
+            matrix->addEdge(edge.minVertex(), edge.maxVertex(), scenarios[scenario][edgeIdx]);
+        }
+        ASSERT_NEAR(random::ATR::calculateATR(*matrix), R[scenario], 1e-12);
+    }
+}
+
+TEST(ATRTest, ReliabilityModelFollowsProbabilityUpdates) {
+    auto grid = makeGrid(4, 5);
+    auto model = random::ATR::buildReliabilityModel(*grid);
+    ASSERT_NEAR(random::ATR::calculateATR(*grid), model.getATR(), 1e-12);
+
+    const auto edges = model.getCircuit().getEdges();
+    for (int update = 0; update < 12; ++update) {
+        const auto &edge = edges[(update * 7) % edges.size()];
+        const double p = update % 4 == 3 ? 1. : 0.55 + 0.03 * update;
+        const double R = model.updateProbability(edge.maxVertex(), edge.minVertex(), p);
+        grid->addEdge(edge.minVertex(), edge.maxVertex(), p);
+        ASSERT_DOUBLE_EQ(p, model.getProbability(edge.minVertex(), edge.maxVertex()));
+        ASSERT_EQ(model.getCircuit().evaluate(*grid), R);
+        ASSERT_NEAR(random::ATR::calculateATR(*grid), R, 1e-12);
+    }
+    ASSERT_LT(model.getNumRecomputed(), 12 * static_cast<long long>(model.getCircuit().getInstructions().size()));
+    ASSERT_THROW(model.updateProbability(0, 6, 0.5), std::runtime_error);
+}
+
+TEST(ATRTest, BatchedLeavesMatchScalarLeaves) {
+    random::LeafBatch leafBatch;
+    double expectedATR = 0.;
+    for (int leafIdx = 0; leafIdx < 3 * LEAF_BATCH_SIZE + 1; ++leafIdx) {
+        const int numVertexes = MIN_BATCHED_DIMENSION + leafIdx % (MAX_BATCHED_DIMENSION - MIN_BATCHED_DIMENSION + 1);
+        auto matrix = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(numVertexes);
+        for (int vertex = 0; vertex < numVertexes; ++vertex) {
+            matrix->addEdge(vertex, (vertex + 1) % numVertexes, 0.6 + 0.01 * leafIdx + 0.02 * vertex);
+            matrix->addEdge(vertex, (vertex + 3) % numVertexes, 0.5 + 0.03 * vertex);
+        }
+
+        double leafATR = 0.;
+        if (numVertexes == 6) {
+            leafATR = random::ClosedForms::calculateCompleteGraph6ATR(*matrix);
+        } else if (numVertexes == 7) {
+            leafATR = random::ClosedForms::calculateCompleteGraph7ATR(*matrix);
+        } else {
+            leafATR = random::ClosedForms::calculateCompleteGraph8ATR(*matrix);
+        }
+
+        const double p = 0.9 - 0.01 * leafIdx;
+        leafBatch.pushLeaf(*matrix);
+        if (leafIdx == 0) {
+            expectedATR = leafATR;
+        } else {
+            leafBatch.pushEdgeFactoring(p);
+            expectedATR = (1 - p) * expectedATR + p * leafATR;
+        }
+    }
+    ASSERT_EQ(expectedATR, leafBatch.popValue());
+}
+
+TEST(ATRTest, TaggedValueWaitsForBatchedLeaf) {
+    auto matrix = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(MIN_BATCHED_DIMENSION);
+    for (int vertex = 0; vertex < MIN_BATCHED_DIMENSION; ++vertex) {
+        matrix->addEdge(vertex, (vertex + 1) % MIN_BATCHED_DIMENSION, 0.9 - 0.05 * vertex);
+        matrix->addEdge(vertex, (vertex + 2) % MIN_BATCHED_DIMENSION, 0.6);
+    }
+    const double leafATR = random::ClosedForms::calculateCompleteGraph6ATR(*matrix);
+
+    random::LeafBatch leafBatch;
+    leafBatch.pushValue(0.5);
+    leafBatch.pushTag(1);
+    leafBatch.pushLeaf(*matrix);
+    leafBatch.pushTag(2);
+    leafBatch.pushEdgeFactoring(0.8);
+    // the leaf is not flushed for the tag, only the value is known
+    ASSERT_EQ((std::vector<std::pair<int, double>>{{1, 0.5}}), leafBatch.takeTaggedValues());
+
+    ASSERT_EQ(0.2 * 0.5 + 0.8 * leafATR, leafBatch.popValue());
+    ASSERT_EQ((std::vector<std::pair<int, double>>{{2, leafATR}}), leafBatch.takeTaggedValues());
+}
+
+TEST(ATRTest, BirnbaumImportanceIsDifferenceOfConditionalATRs) {
+    // K7 with a chain 6 - 7 - 8 - 0 reduces to a leaf of the closed forms
+    auto denseGraph = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(9);
+    for (int vertex1 = 0; vertex1 < 7; ++vertex1) {
+        for (int vertex2 = vertex1 + 1; vertex2 < 7; ++vertex2) {
+            denseGraph->addEdge(vertex1, vertex2, 0.2 + 0.1 * ((vertex1 + 2 * vertex2) % 7));
+        }
+    }
+    denseGraph->addEdge(6, 7, 0.9);
+    denseGraph->addEdge(7, 8, 0.8);
+    denseGraph->addEdge(0, 8, 0.7);
+
+    // K5 and K4 with the cut vertex 4 are factored as a product of the blocks
+    auto blocksGraph = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(8);
+    for (int vertex1 = 0; vertex1 < 8; ++vertex1) {
+        for (int vertex2 = vertex1 + 1; vertex2 < 8; ++vertex2) {
+            if (vertex2 <= 4 || vertex1 >= 4) {
+                blocksGraph->addEdge(vertex1, vertex2, 0.3 + 0.1 * ((2 * vertex1 + vertex2) % 6));
+            }
+        }
+    }
+
+    for (const auto &graph: {makeGrid(3, 4), denseGraph, blocksGraph}) {
+        const auto [R, importance] = random::ATR::calculateBirnbaumImportance(*graph);
+        ASSERT_NEAR(random::ATR::calculateATR(*graph), R, 1e-12);
+
+        // ATR is linear in the probability of each edge: dR/dp = R(p = 1) - R(p = 0)
+        for (const auto &[edge, edgeImportance]: importance) {
+            auto matrix = graph->copy();
+            matrix->addEdge(edge.minVertex(), edge.maxVertex(), 1.);
+            const double perfectEdgeATR = random::ATR::calculateATR(*matrix);
+            matrix->removeEdge(edge);
+            const double removedEdgeATR = random::ATR::calculateATR(*matrix);
+            ASSERT_NEAR(perfectEdgeATR - removedEdgeATR, edgeImportance, 1e-12);
+        }
+
+        const auto circuit = random::ATR::compileATR(*graph);
+        std::vector<random::EdgeProbability> probabilities;
+        for (const auto &edge: circuit.getEdges()) {
+            probabilities.push_back(graph->at(edge.minVertex(), edge.maxVertex()));
+        }
+        std::vector<double> gradient;
+        ASSERT_NEAR(R, circuit.evaluateGradient(probabilities, gradient), 1e-12);
+        ASSERT_EQ(circuit.getEdges().size(), importance.size());
+        for (int edgeIdx = 0; edgeIdx < static_cast<int>(gradient.size()); ++edgeIdx) {
+            const auto &edge = circuit.getEdges()[edgeIdx];
+            ASSERT_EQ(edge.minVertex(), importance[edgeIdx].first.minVertex());
+            ASSERT_EQ(edge.maxVertex(), importance[edgeIdx].first.maxVertex());
+            ASSERT_NEAR(importance[edgeIdx].second, gradient[edgeIdx], 1e-12);
+        }
+    }
+
+    // no edge matters to a disconnected graph, all of them are still listed
+    AdjacencyMatrix<random::EdgeProbability> disconnected(4);
+    disconnected.addEdge(0, 1, 0.9);
+    disconnected.addEdge(2, 3, 0.8);
+    const auto [R, importance] = random::ATR::calculateBirnbaumImportance(disconnected);
+    ASSERT_EQ(0., R);
+    ASSERT_EQ(2, importance.size());
+    for (const auto &[edge, edgeImportance]: importance) {
+        ASSERT_EQ(0., edgeImportance);
+    }
+}
+
+TEST(ATRTest, BinaryDecisionDiagramMatchesFactoring) {
+    const auto grid = makeGrid(4, 5);
+    const double expectedATR = random::ATR::calculateATR(*grid);
+
+    for (const auto edgeOrdering: {random::EdgeOrdering::BFS,
+                                   random::EdgeOrdering::DEGREE,
+                                   random::EdgeOrdering::PATH_DECOMPOSITION}) {
+        const auto bdd = random::BinaryDecisionDiagram::build(*grid, edgeOrdering);
+        ASSERT_EQ(31, bdd.getEdges().size());
+        ASSERT_NEAR(expectedATR, bdd.evaluate(*grid), 1e-12);
+
+        random::ExecutionPolicy executionPolicy{.engine = random::ReliabilityEngine::BDD, .edgeOrdering = edgeOrdering};
+        ASSERT_NEAR(expectedATR, random::ATR::calculateATR(*grid, executionPolicy), 1e-12);
+    }
+
+    // two triangles: the first one is closed while the second is on the frontier
+    auto triangles = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(6);
+    triangles->addEdge(0, 1, 0.9);
+    triangles->addEdge(1, 2, 0.9);
+    triangles->addEdge(0, 2, 0.9);
+    triangles->addEdge(3, 4, 0.9);
+    triangles->addEdge(4, 5, 0.9);
+    triangles->addEdge(3, 5, 0.9);
+    ASSERT_EQ(0., random::BinaryDecisionDiagram::build(*triangles, random::EdgeOrdering::BFS).evaluate(*triangles));
+    triangles->addEdge(2, 3, 0.5);
+    ASSERT_NEAR(bruteForceATR(*triangles),
+                random::BinaryDecisionDiagram::build(*triangles, random::EdgeOrdering::BFS).evaluate(*triangles), 1e-12);
+}
+
+TEST(ATRTest, FrontierEngineMatchesFactoringAndBDD) {
+    const auto grid = makeGrid(4, 5);
+    random::ExecutionPolicy executionPolicy{.engine = random::ReliabilityEngine::FRONTIER};
+    ASSERT_NEAR(random::ATR::calculateATR(*grid), random::ATR::calculateATR(*grid, executionPolicy), 1e-12);
+
+    // too long for the factoring
+    const auto strip = makeGrid(3, 100);
+    const double expectedATR = random::BinaryDecisionDiagram::build(
+            *strip, random::EdgeOrdering::PATH_DECOMPOSITION).evaluate(*strip);
+    for (const auto edgeOrdering: {random::EdgeOrdering::BFS,
+                                   random::EdgeOrdering::DEGREE,
+                                   random::EdgeOrdering::PATH_DECOMPOSITION}) {
+        ASSERT_NEAR(expectedATR, random::FrontierDynamicProgramming::calculate(*strip, edgeOrdering), 1e-12);
+    }
+
+    // the root of a component with the lowest degree is not the first unvisited vertex
+    AdjacencyMatrix<random::EdgeProbability> disconnected(7);
+    disconnected.addEdge(1, 2, 0.9);
+    for (const auto edgeOrdering: {random::EdgeOrdering::BFS,
+                                   random::EdgeOrdering::DEGREE,
+                                   random::EdgeOrdering::PATH_DECOMPOSITION}) {
+        auto vertexOrder = random::EdgeOrderer::orderVertexes(disconnected, edgeOrdering);
+        std::sort(vertexOrder.begin(), vertexOrder.end());
+        ASSERT_EQ(std::vector<int>({0, 1, 2, 3, 4, 5, 6}), vertexOrder);
+        ASSERT_EQ(0., random::FrontierDynamicProgramming::calculate(disconnected, edgeOrdering));
+    }
+}
+
+TEST(ATRTest, TreeDecompositionEngineMatchesOtherEngines) {
+    const auto grid = makeGrid(4, 5);
+    const double expectedATR = random::ATR::calculateATR(*grid);
+    for (const auto eliminationHeuristic: {random::EliminationHeuristic::MIN_DEGREE,
+                                           random::EliminationHeuristic::MIN_FILL}) {
+        ASSERT_EQ(4, random::TreeDecomposition::build(*grid, eliminationHeuristic).getWidth());
+        random::ExecutionPolicy executionPolicy{.engine = random::ReliabilityEngine::TREE_DECOMPOSITION,
+                                                .eliminationHeuristic = eliminationHeuristic};
+        ASSERT_NEAR(expectedATR, random::ATR::calculateATR(*grid, executionPolicy), 1e-12);
+    }
+
+    // tree of rings: each ring of 6 vertexes with a chord shares an edge with its parent ring
+    std::vector<std::pair<int, int>> edges;
+    int numVertexes = 2;
+    std::function<void(int, int, int)> addRing = [&](int vertex1, int vertex2, int depth) {
+        std::vector<int> ring{vertex1, vertex2, numVertexes, numVertexes + 1, numVertexes + 2, numVertexes + 3};
+        numVertexes += 4;
+        for (int ringIdx = 0; ringIdx < static_cast<int>(ring.size()); ++ringIdx) {
+            edges.emplace_back(ring[ringIdx], ring[(ringIdx + 1) % ring.size()]);
+        }
+        edges.emplace_back(ring[0], ring[3]);
+        if (depth > 0) {
+            addRing(ring[2], ring[3], depth - 1);
+            addRing(ring[4], ring[5], depth - 1);
+        }
+    };
+    addRing(0, 1, 2);
+    auto ringTree = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(numVertexes);
+    for (int edgeIdx = 0; edgeIdx < static_cast<int>(edges.size()); ++edgeIdx) {
+        ringTree->addEdge(edges[edgeIdx].first, edges[edgeIdx].second, 0.9 + 0.001 * (edgeIdx % 50));
+    }
+    ASSERT_NEAR(random::FrontierDynamicProgramming::calculate(*ringTree, random::EdgeOrdering::PATH_DECOMPOSITION),
+                random::TreeDecompositionDynamicProgramming::calculate(*ringTree, random::EliminationHeuristic::MIN_FILL),
+                1e-12);
+}
+
+TEST(ATRTest, MonteCarloIsReproducibleAndCoversExactATR) {
+    const auto grid = makeGrid(4, 4);
+    const double expectedATR = random::ATR::calculateATR(*grid);
+
+    const random::SamplingPolicy samplingPolicy{.seed = 1, .targetRelativeError = 0.05, .confidenceLevel = 0.99};
+    const auto estimate = random::ATR::estimateATR(*grid, samplingPolicy, random::ExecutionPolicy{.threads = 1});
+    ASSERT_LE(estimate.relativeError, 0.05);
+    ASSERT_LE(estimate.lowerBound, expectedATR);
+    ASSERT_GE(estimate.upperBound, expectedATR);
+
+    for (const int threads: {2, 3}) {
+        const auto threadsEstimate = random::ATR::estimateATR(*grid, samplingPolicy, random::ExecutionPolicy{.threads = threads});
+        ASSERT_EQ(estimate.numSamples, threadsEstimate.numSamples);
+        ASSERT_EQ(estimate.numConnectedSamples, threadsEstimate.numConnectedSamples);
+    }
+    ASSERT_NEAR(2.5758, random::MonteCarloATR::calculateZ(0.99), 1e-4);
+}
+
+TEST(ATRTest, PermutationMonteCarloKeepsRelativeErrorOfRareUnreliability) {
+    auto grid = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(12);
+    for (int vertex = 0; vertex < 12; ++vertex) {
+        if (vertex % 4 < 3) {
+            grid->addEdge(vertex, vertex + 1, 0.9999);
+        }
+        if (vertex + 4 < 12) {
+            grid->addEdge(vertex, vertex + 4, 0.9999 - 0.0001 * (vertex % 4));
+        }
+    }
+    const double expectedUnreliability = 1 - random::ATR::calculateATR(*grid);
+
+    random::SamplingPolicy samplingPolicy{.method = random::SamplingMethod::PERMUTATION, .seed = 1,
+                                          .targetRelativeError = 0.1, .confidenceLevel = 0.99};
+    const auto estimate = random::ATR::estimateATR(*grid, samplingPolicy, random::ExecutionPolicy{.threads = 1});
+    ASSERT_LE(estimate.relativeError, 0.1);
+    ASSERT_NEAR(expectedUnreliability, 1 - estimate.R, 4 * estimate.standardError);
+    ASSERT_LE(estimate.lowerBound, 1 - expectedUnreliability);
+    ASSERT_GE(estimate.upperBound, 1 - expectedUnreliability);
+    for (const int threads: {2, 3}) {
+        const auto threadsEstimate = random::ATR::estimateATR(*grid, samplingPolicy, random::ExecutionPolicy{.threads = threads});
+        ASSERT_EQ(estimate.numSamples, threadsEstimate.numSamples);
+        ASSERT_EQ(estimate.R, threadsEstimate.R);
+    }
+
+    // the same number of crude samples hardly sees a disconnected state
+    samplingPolicy.method = random::SamplingMethod::CRUDE;
+    samplingPolicy.maxSamples = estimate.numSamples;
+    ASSERT_GT(random::ATR::estimateATR(*grid, samplingPolicy).relativeError, 1.);
+}
+
+TEST(ATRTest, AnytimeBoundsContainExactATR) {
+    const auto grid = makeGrid(4, 5);
+    const double expectedATR = random::ATR::calculateATR(*grid);
+
+    const auto firstPassBounds = random::ATR::calculateATRBounds(*grid, random::AnytimePolicy{.timeBudgetSeconds = 0.});
+    ASSERT_LE(firstPassBounds.lowerBound, expectedATR);
+    ASSERT_GE(firstPassBounds.upperBound, expectedATR);
+    ASSERT_LT(firstPassBounds.exploredFraction, 1.);
+
+    const auto gapBounds = random::ATR::calculateATRBounds(*grid, random::AnytimePolicy{.targetGap = 1e-3});
+    ASSERT_LE(gapBounds.upperBound - gapBounds.lowerBound, 1e-3);
+    ASSERT_LE(gapBounds.lowerBound, expectedATR + 1e-12);
+    ASSERT_GE(gapBounds.upperBound, expectedATR - 1e-12);
+
+    const auto exactBounds = random::ATR::calculateATRBounds(*grid, random::AnytimePolicy());
+    ASSERT_NEAR(expectedATR, exactBounds.lowerBound, 1e-12);
+    ASSERT_NEAR(expectedATR, exactBounds.upperBound, 1e-12);
+    ASSERT_EQ(1., exactBounds.exploredFraction);
+
+    AdjacencyMatrix<random::EdgeProbability> disconnected(3);
+    disconnected.addEdge(0, 1, 0.9);
+    ASSERT_EQ(0., random::ATR::calculateATRBounds(disconnected, random::AnytimePolicy()).upperBound);
+}
+
+TEST(ATRTest, ApproximateATRIsWithinMaxError) {
+    auto grid = makeGrid(5, 5);
+    for (int vertex1 = 0; vertex1 < grid->getDimension(); ++vertex1) {
+        for (int vertex2 = vertex1 + 1; vertex2 < grid->getDimension(); ++vertex2) {
+            if (grid->isConnected(vertex1, vertex2)) {
+                grid->addEdge(vertex1, vertex2, 0.999 - 0.0001 * ((vertex1 + vertex2) % 5));
+            }
+        }
+    }
+    const double expectedATR = random::ATR::calculateATR(*grid);
+
+    for (const double maxError: {1e-6, 1e-9}) {
+        const auto statistics = std::make_shared<random::FactoringStatistics>();
+        const random::ExecutionPolicy executionPolicy{
+                .transpositionTable = std::make_shared<random::TranspositionTable>(1 << 20),
+                .statistics = statistics};
+        const auto bounds = random::ATR::calculateApproximateATR(*grid, maxError, executionPolicy);
+        ASSERT_LE(bounds.upperBound - bounds.lowerBound, maxError);
+        ASSERT_LE(bounds.lowerBound, expectedATR + 1e-15);
+        ASSERT_GE(bounds.upperBound, expectedATR - 1e-15);
+        ASSERT_GT(statistics->prunedBranches, 0);
+        ASSERT_LT(bounds.exploredFraction, 1.);
+    }
+
+    AdjacencyMatrix<random::EdgeProbability> disconnected(3);
+    disconnected.addEdge(0, 1, 0.9);
+    ASSERT_EQ(0., random::ATR::calculateApproximateATR(disconnected, 1e-9).upperBound);
+}
+
+TEST(ATRTest, ApproximateATRRejectsInvalidMaxError) {
+    const auto grid = makeGrid(3, 3);
+    ASSERT_THROW(random::ATR::calculateApproximateATR(*grid, -1e-9), std::runtime_error);
+    ASSERT_THROW(random::ATR::calculateApproximateATR(*grid, std::nan("")), std::runtime_error);
+
+    const double expectedATR = random::ATR::calculateATR(*grid);
+    const auto bounds = random::ATR::calculateApproximateATR(*grid, 0.);
+    ASSERT_NEAR(expectedATR, bounds.lowerBound, 1e-15);
+    ASSERT_NEAR(expectedATR, bounds.upperBound, 1e-15);
+}
+
+TEST(ATRTest, CheckpointedFactoringResumesToSameATR) {
+    const auto grid = makeGrid(4, 6);
+    const double expectedATR = random::ATR::calculateATR(*grid);
+    const auto path = (std::filesystem::temp_directory_path() / "grph_atr_checkpoint.bin").string();
+
+    const random::CheckpointPolicy checkpointPolicy{.path = path, .intervalSeconds = 0., .timeBudgetSeconds = 0.,
+                                                    .splitDepth = 6};
+    auto R = random::ATR::calculateATRWithCheckpoints(*grid, checkpointPolicy);
+    int numResumes = 0;
+    for (; !R; ++numResumes) {
+        ASSERT_FALSE(std::filesystem::exists(path + ".tmp"));
+        R = random::ATR::resumeATR(checkpointPolicy);
+    }
+    ASSERT_GT(numResumes, 0);
+    ASSERT_NEAR(expectedATR, *R, 1e-12);
+    ASSERT_EQ(*R, random::ATR::resumeATR(checkpointPolicy));
+    std::filesystem::remove(path);
+    ASSERT_THROW(random::ATR::resumeATR(checkpointPolicy), std::runtime_error);
+}
+
+TEST(ATRTest, CheckpointReadRejectsInconsistentFiles) {
+    const auto path = (std::filesystem::temp_directory_path() / "grph_atr_bad_checkpoint.bin").string();
+    const auto expectNotCheckpoint = [&path]() {
+        try {
+            random::FactoringCheckpoint::read(path);
+            FAIL() << "read " << path;
+        } catch (const std::runtime_error &error) {
+            ASSERT_NE(std::string::npos, std::string(error.what()).find("is not a checkpoint"));
+        }
+    };
+
+    // 2^32 - 1 joins claimed by a file of 20 bytes
+    {
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        const uint32_t header[] = {CHECKPOINT_MAGIC, CHECKPOINT_VERSION};
+        const double R = NAN;
+        const uint32_t numJoins = UINT32_MAX;
+        stream.write(reinterpret_cast<const char *>(header), sizeof(header));
+        stream.write(reinterpret_cast<const char *>(&R), sizeof(R));
+        stream.write(reinterpret_cast<const char *>(&numJoins), sizeof(numJoins));
+    }
+    expectNotCheckpoint();
+
+    const auto grid = makeGrid(2, 3);
+    random::FactoringCheckpoint checkpoint;
+    checkpoint.joins.push_back(random::FactoringCheckpoint::Join{.results = {0.}, .numPending = 1});
+    checkpoint.tasks.push_back(random::FactoringCheckpoint::makeTask(*grid, 0, 0, 0));
+    checkpoint.write(path);
+    ASSERT_EQ(1, random::FactoringCheckpoint::read(path).tasks.size());
+    // header, the root join, the task with its 7 edges of 12 bytes: no padding is written
+    ASSERT_EQ(20 + 37 + 4 + 20 + 7 * 12, std::filesystem::file_size(path));
+
+    for (const auto &corrupt: std::vector<std::function<void(random::FactoringCheckpoint &)>>{
+            [](auto &bad) { bad.tasks[0].join = 1; },
+            [](auto &bad) { bad.tasks[0].slot = 1; },
+            [](auto &bad) { bad.tasks[0].numVertexes = 5; },
+            [](auto &bad) { bad.joins[0].numPending = 2; },
+            [](auto &bad) {
+                // two joins waiting for each other
+                bad.joins.push_back(random::FactoringCheckpoint::Join{
+                        .kind = random::FactoringCheckpoint::JoinKind::BLOCKS, .results = {0.}, .numPending = 1,
+                        .parent = 2});
+                bad.joins.push_back(random::FactoringCheckpoint::Join{
+                        .kind = random::FactoringCheckpoint::JoinKind::BLOCKS, .results = {0.}, .numPending = 1,
+                        .parent = 1});
+            }}) {
+        auto bad = checkpoint;
+        corrupt(bad);
+        bad.write(path);
+        expectNotCheckpoint();
+    }
+    std::filesystem::remove(path);
+}
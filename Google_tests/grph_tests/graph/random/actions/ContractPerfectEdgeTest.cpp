@@ -0,0 +1,101 @@
+#include "gtest/gtest.h"
+
+#include "../../../../../src/graph/criteria/ATR.hpp"
+
+using namespace grph::graph;
+
+// prism (cubic) with the perfect rung 0-3
+static random::EdgeProbability prism[36] = {
+        0, 0.9, 0.8, 1, 0, 0,
+        0.9, 0, 0.85, 0, 0.7, 0,
+        0.8, 0.85, 0, 0, 0, 0.7,
+        1, 0, 0, 0, 0.8, 0.9,
+        0, 0.7, 0, 0.8, 0, 0.85,
+        0, 0, 0.7, 0.9, 0.85, 0
+};
+
+// the edges 3-4, 3-5 go to the vertex 0, then the vertex 5 takes the number 3
+static random::EdgeProbability matrixAfterContraction_0_3[25] = {
+        0, 0.9, 0.8, 0.9, 0.8,
+        0.9, 0, 0.85, 0, 0.7,
+        0.8, 0.85, 0, 0.7, 0,
+        0.9, 0, 0.7, 0, 0.85,
+        0.8, 0.7, 0, 0.85, 0
+};
+
+// complete graph with the perfect edge 0-1: the contraction leaves a triangle with two parallel pairs merged
+static random::EdgeProbability completeGraph[16] = {
+        0, 1, 0.9, 0.8,
+        1, 0, 0.7, 0.6,
+        0.9, 0.7, 0, 0.5,
+        0.8, 0.6, 0.5, 0
+};
+
+class ContractPerfectEdgeFixture : public ::testing::Test {
+public:
+    ContractPerfectEdgeFixture() :
+            _matrix(std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(6, prism)) {}
+
+protected:
+    void SetUp() override {
+        _graph = random::UndirectedRandomGraph(_matrix->copy());
+    }
+
+    random::UndirectedRandomGraph _graph;
+    const std::shared_ptr<AdjacencyMatrix<random::EdgeProbability>> _matrix;
+};
+
+TEST_F(ContractPerfectEdgeFixture, ContractPerfectEdge_0_3) {
+    const auto &action = _graph.reduceSeriesParallel();
+    const auto expectedMatrix = AdjacencyMatrix<random::EdgeProbability>(5, matrixAfterContraction_0_3);
+    const auto expectedDegreesVector = DegreesVector::make(expectedMatrix);
+
+    ASSERT_EQ(1, action->getNumReductions());
+    ASSERT_EQ(1., action->getReductionFactor());
+    ASSERT_EQ(5, _graph.getNumVertexes());
+    ASSERT_TRUE(_graph.getAdjacencyMatrix()->isEqual(expectedMatrix));
+    ASSERT_TRUE(_graph.getDegreesVector()->isEqual(*expectedDegreesVector));
+}
+
+TEST_F(ContractPerfectEdgeFixture, ContractPerfectEdge_rollback) {
+    const auto initialMatrix = _graph.getAdjacencyMatrix()->copy();
+    const auto initialDegreesVector = DegreesVector::make(initialMatrix);
+
+    const auto &action = _graph.reduceSeriesParallel();
+    action->rollback();
+
+    ASSERT_EQ(6, _graph.getNumVertexes());
+    ASSERT_TRUE(_graph.getAdjacencyMatrix()->isEqual(*initialMatrix));
+    ASSERT_TRUE(_graph.getDegreesVector()->isEqual(*initialDegreesVector));
+}
+
+TEST_F(ContractPerfectEdgeFixture, ContractPerfectEdge_noPerfectEdge) {
+    const auto imperfectPrism = _matrix->copy();
+    imperfectPrism->addEdge(0, 3, 0.95);
+    _graph = random::UndirectedRandomGraph(imperfectPrism);
+
+    ASSERT_EQ(0, _graph.reduceSeriesParallel()->getNumReductions());
+    ASSERT_EQ(6, _graph.getNumVertexes());
+}
+
+TEST_F(ContractPerfectEdgeFixture, ContractPerfectEdge_thenSeries) {
+    const auto matrix = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(4, completeGraph);
+    _graph = random::UndirectedRandomGraph(matrix->copy());
+
+    // the triangle 0-2-3 with 0-2 = 0.9 || 0.7 and 0-3 = 0.8 || 0.6, its ATR is ab + bc + ca - 2abc
+    const double a = 1 - 0.1 * 0.3;
+    const double b = 1 - 0.2 * 0.4;
+    const double c = 0.5;
+    const double expectedATR = a * b + b * c + c * a - 2 * a * b * c;
+
+    const auto &action = _graph.reduceSeriesParallel();
+    ASSERT_EQ(2, action->getNumReductions());
+    ASSERT_EQ(2, _graph.getNumVertexes());
+    ASSERT_NEAR(expectedATR, action->getReductionFactor() * _graph.at(0, 1), 1e-12);
+    ASSERT_NEAR(expectedATR, random::ATR::calculateATR(*matrix), 1e-12);
+
+    action->rollback();
+    ASSERT_EQ(4, _graph.getNumVertexes());
+    ASSERT_TRUE(_graph.getAdjacencyMatrix()->isEqual(*matrix));
+    ASSERT_TRUE(_graph.getDegreesVector()->isEqual(*DegreesVector::make(matrix)));
+}
@@ -0,0 +1,61 @@
+#include "gtest/gtest.h"
+
+#include "../../../../../src/graph/random/undirected_graph/UndirectedRandomGraph.hpp"
+
+using namespace grph::graph;
+
+class FindSeparationPairFixture : public ::testing::Test {
+public:
+    // two rings of 6 with chords, joined through the routers 12 and 13
+    FindSeparationPairFixture() : _matrix(std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(14)) {
+        for (int shift: {0, 6}) {
+            for (int vertex = 0; vertex < 6; ++vertex) {
+                _matrix->addEdge(shift + vertex, shift + (vertex + 1) % 6, 0.9 - 0.01 * vertex - 0.02 * shift);
+                if (vertex < 3) {
+                    _matrix->addEdge(shift + vertex, shift + vertex + 3, 0.7 + 0.03 * vertex);
+                }
+            }
+            _matrix->addEdge(12, shift, 0.85);
+            _matrix->addEdge(12, shift + 2, 0.8);
+            _matrix->addEdge(13, shift + 3, 0.75 + 0.01 * shift);
+            _matrix->addEdge(13, shift + 5, 0.95);
+        }
+        _matrix->addEdge(12, 13, 0.6);
+    }
+
+protected:
+    void SetUp() override {
+        _graph = random::UndirectedRandomGraph(_matrix->copy());
+    }
+
+    random::UndirectedRandomGraph _graph;
+    const std::shared_ptr<AdjacencyMatrix<random::EdgeProbability>> _matrix;
+};
+
+TEST_F(FindSeparationPairFixture, FindSeparationPair_routers) {
+    std::pair<int, int> separationPair;
+    std::unordered_set<int> side;
+
+    ASSERT_TRUE(_graph.findSeparationPair(separationPair, side));
+    ASSERT_EQ(std::make_pair(12, 13), separationPair);
+    ASSERT_EQ(6u, side.size());
+    ASSERT_TRUE(_graph.getAdjacencyMatrix()->isEqual(*_matrix));
+}
+
+TEST_F(FindSeparationPairFixture, FindSeparationPair_triconnectedGrid) {
+    // every vertex pair of a 3 x 3 grid leaves one part or a single vertex of degree two
+    auto grid = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(9);
+    for (int vertex = 0; vertex < 9; ++vertex) {
+        if (vertex % 3 < 2) {
+            grid->addEdge(vertex, vertex + 1, 0.9);
+        }
+        if (vertex < 6) {
+            grid->addEdge(vertex, vertex + 3, 0.8);
+        }
+    }
+    _graph = random::UndirectedRandomGraph(grid);
+    std::pair<int, int> separationPair;
+    std::unordered_set<int> side;
+
+    ASSERT_FALSE(_graph.findSeparationPair(separationPair, side));
+}
@@ -0,0 +1,52 @@
+#include "gtest/gtest.h"
+
+#include "../../../../../src/graph/random/undirected_graph/UndirectedRandomGraph.hpp"
+
+using namespace grph::graph;
+
+class IsBridgeFixture : public ::testing::Test {
+public:
+    // two 2 x 3 grids joined by the edge 5-6
+    IsBridgeFixture() : _matrix(std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(12)) {
+        for (int shift: {0, 6}) {
+            for (int vertex = 0; vertex < 6; ++vertex) {
+                if (vertex % 3 < 2) {
+                    _matrix->addEdge(shift + vertex, shift + vertex + 1, 0.9 - 0.01 * (vertex % 3));
+                }
+                if (vertex < 3) {
+                    _matrix->addEdge(shift + vertex, shift + vertex + 3, 0.8);
+                }
+            }
+        }
+        _matrix->addEdge(5, 6, 0.7);
+    }
+
+protected:
+    void SetUp() override {
+        _graph = random::UndirectedRandomGraph(_matrix->copy());
+    }
+
+    random::UndirectedRandomGraph _graph;
+    const std::shared_ptr<AdjacencyMatrix<random::EdgeProbability>> _matrix;
+};
+
+TEST_F(IsBridgeFixture, IsBridge_cycleEdge) {
+    std::vector<char> minVertexSide;
+    ASSERT_FALSE(_graph.isBridge(Edge(0, 1), minVertexSide));
+}
+
+TEST_F(IsBridgeFixture, IsBridge_5_6) {
+    std::vector<char> minVertexSide;
+    ASSERT_TRUE(_graph.isBridge(Edge(5, 6), minVertexSide));
+    ASSERT_EQ((std::vector<char>{1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0}), minVertexSide);
+}
+
+TEST_F(IsBridgeFixture, IsBridge_removedEdge) {
+    const auto &action = _graph.removeEdge(Edge(5, 6));
+    std::vector<char> minVertexSide;
+    ASSERT_TRUE(_graph.isBridge(action->getRemovedEdge(), minVertexSide));
+    ASSERT_EQ((std::vector<char>{1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0}), minVertexSide);
+
+    action->rollback();
+    ASSERT_TRUE(_graph.getAdjacencyMatrix()->isEqual(*_matrix));
+}
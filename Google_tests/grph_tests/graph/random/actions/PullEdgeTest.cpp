@@ -6,6 +6,7 @@
 #include "../../../../../src/graph/random/undirected_graph/actions_impl/PullEdgeActionURG.cpp"
 #include "../../../../../src/graph/random/undirected_graph/actions_impl/RemoveRandomEdgeActionURG.cpp"
 #include "../../../../../src/graph/random/undirected_graph/actions_impl/RemoveTrivialChainActionURG.cpp"
+#include "../../../../../src/graph/random/undirected_graph/actions_impl/ReduceSeriesParallelActionURG.cpp"
 #include "../../../../../src/utils/parse/TGFParser.hpp"
 
 using namespace grph::graph;
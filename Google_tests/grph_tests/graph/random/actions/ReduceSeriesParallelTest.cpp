@@ -0,0 +1,64 @@
+#include "gtest/gtest.h"
+
+#include "../../../../../src/graph/criteria/ATR.hpp"
+
+using namespace grph::graph;
+
+// a ladder 2 x 4 is series-parallel, so it is reduced to a single edge
+static random::EdgeProbability ladder[64] = {
+        0, 0.9, 0, 0, 0.8, 0, 0, 0,
+        0.9, 0, 0.89, 0, 0, 0.8, 0, 0,
+        0, 0.89, 0, 0.88, 0, 0, 0.8, 0,
+        0, 0, 0.88, 0, 0, 0, 0, 0.8,
+        0.8, 0, 0, 0, 0, 0.9, 0, 0,
+        0, 0.8, 0, 0, 0.9, 0, 0.89, 0,
+        0, 0, 0.8, 0, 0, 0.89, 0, 0.88,
+        0, 0, 0, 0.8, 0, 0, 0.88, 0
+};
+
+class ReduceSeriesParallelFixture : public ::testing::Test {
+public:
+    ReduceSeriesParallelFixture() :
+            _matrix(std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(8, ladder)) {}
+
+protected:
+    void SetUp() override {
+        _graph = random::UndirectedRandomGraph(_matrix->copy());
+    }
+
+    random::UndirectedRandomGraph _graph;
+    const std::shared_ptr<AdjacencyMatrix<random::EdgeProbability>> _matrix;
+};
+
+TEST_F(ReduceSeriesParallelFixture, ReduceSeriesParallel_ladder) {
+    const auto initialMatrix = _graph.getAdjacencyMatrix()->copy();
+    const auto initialDegreesVector = _graph.getDegreesVector();
+
+    const auto &action = _graph.reduceSeriesParallel();
+
+    ASSERT_EQ(2, _graph.getNumVertexes());
+    ASSERT_EQ(6, action->getNumReductions());
+    // the 8 vertexes are calculated by the closed forms, without the reductions
+    ASSERT_NEAR(random::ATR::calculateATR(*_matrix), action->getReductionFactor() * _graph.at(0, 1), 1e-12);
+
+    action->rollback();
+    ASSERT_EQ(8, _graph.getNumVertexes());
+    ASSERT_TRUE(_graph.getAdjacencyMatrix()->isEqual(*initialMatrix));
+    ASSERT_EQ(initialDegreesVector, _graph.getDegreesVector());
+}
+
+TEST_F(ReduceSeriesParallelFixture, ReduceSeriesParallel_noReductions) {
+    auto prism = std::make_shared<AdjacencyMatrix<random::EdgeProbability>>(6);
+    for (int vertex = 0; vertex < 3; ++vertex) {
+        prism->addEdge(vertex, (vertex + 1) % 3, 0.9);
+        prism->addEdge(3 + vertex, 3 + (vertex + 1) % 3, 0.8);
+        prism->addEdge(vertex, 3 + vertex, 0.7);
+    }
+    _graph = random::UndirectedRandomGraph(prism->copy());
+
+    const auto &action = _graph.reduceSeriesParallel();
+
+    ASSERT_EQ(0, action->getNumReductions());
+    ASSERT_EQ(1., action->getReductionFactor());
+    ASSERT_TRUE(_graph.getAdjacencyMatrix()->isEqual(*prism));
+}
@@ -1,6 +1,7 @@
 #ifndef GRPH_ADJACENCYMATRIX_HPP
 #define GRPH_ADJACENCYMATRIX_HPP
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 #include <set>
@@ -18,9 +19,7 @@ namespace grph::graph {
                   _curDimension(dimension) {
             this->_matrix = std::shared_ptr<VertexesRatioType[]>(new VertexesRatioType[dimension * dimension],
                                                                  std::default_delete<VertexesRatioType[]>());
-            memset(_matrix.get(),
-                   0,
-                   sizeof(VertexesRatioType) * INITIAL_DIMENSION * INITIAL_DIMENSION);
+            std::fill_n(_matrix.get(), INITIAL_DIMENSION * INITIAL_DIMENSION, VertexesRatioType());
         }
 
         explicit AdjacencyMatrix(const int dimension, const VertexesRatioType matrix[])
@@ -29,11 +28,7 @@ namespace grph::graph {
             this->_matrix = std::shared_ptr<VertexesRatioType[]>(new VertexesRatioType[dimension * dimension],
                                                                  std::default_delete<VertexesRatioType[]>());
 
-            for (int lineIdx = 0; lineIdx < INITIAL_DIMENSION; ++lineIdx) {
-                memcpy(reinterpret_cast<char *>(_matrix.get()) + calcLineFirstByteIndex(lineIdx),
-                       &matrix[lineIdx * INITIAL_DIMENSION],
-                       sizeof(VertexesRatioType) * INITIAL_DIMENSION);
-            }
+            std::copy_n(matrix, INITIAL_DIMENSION * INITIAL_DIMENSION, _matrix.get());
         }
 
         void print() const {
@@ -48,7 +43,7 @@ namespace grph::graph {
         }
 
         bool isConnected(int firstVertexNum, int secondVertexNum) const {
-            return _matrix[firstVertexNum * INITIAL_DIMENSION + secondVertexNum] != 0;
+            return _matrix[firstVertexNum * INITIAL_DIMENSION + secondVertexNum] != VertexesRatioType();
         }
 
         int getDimension() const {
@@ -104,7 +99,7 @@ namespace grph::graph {
         int findNeighborWithLowestNumFor(int vertexNum,
                                          const std::set<int> &excludedVerticesSet = std::set < int > ()) const {
             for (int columnIndex = 0; columnIndex < _curDimension; ++columnIndex) {
-                if (_matrix[vertexNum * INITIAL_DIMENSION + columnIndex] != 0
+                if (_matrix[vertexNum * INITIAL_DIMENSION + columnIndex] != VertexesRatioType()
                     && !excludedVerticesSet.contains(columnIndex)) {
                     return columnIndex;
                 }
@@ -115,7 +110,7 @@ namespace grph::graph {
         int findNeighborWithBiggestNumFor(int vertexNum,
                                           const std::set<int> &excludedVerticesSet = std::set < int > ()) const {
             for (int columnIndex = _curDimension - 1; columnIndex >= 0; --columnIndex) {
-                if (_matrix[vertexNum * INITIAL_DIMENSION + columnIndex] != EMPTY
+                if (_matrix[vertexNum * INITIAL_DIMENSION + columnIndex] != VertexesRatioType()
                     && !excludedVerticesSet.contains(columnIndex)) {
                     return columnIndex;
                 }
@@ -137,8 +132,8 @@ namespace grph::graph {
         }
 
         VertexesRatioType removeEdge(const Edge &edgeToRemove) {
-            setAt(EMPTY, edgeToRemove._from, edgeToRemove._to);
-            return setAt(EMPTY, edgeToRemove._to, edgeToRemove._from);;
+            setAt(VertexesRatioType(), edgeToRemove._from, edgeToRemove._to);
+            return setAt(VertexesRatioType(), edgeToRemove._to, edgeToRemove._from);
         }
 
         void restoreEdge(const Edge &edgeToRestore, VertexesRatioType ratioVal) {
@@ -166,14 +161,12 @@ namespace grph::graph {
         }
 
         void zeroLine(int lineIndex) {
-            memset(reinterpret_cast<char *>(_matrix.get()) + calcLineFirstByteIndex(lineIndex),
-                   EMPTY,
-                   calcCurMatrixLineLengthInBytes());
+            std::fill_n(_matrix.get() + lineIndex * INITIAL_DIMENSION, _curDimension, VertexesRatioType());
         }
 
         void zeroColumn(int columnIndex) {
             for (int lineIndex = 0; lineIndex < _curDimension; ++lineIndex) {
-                setAt(EMPTY, lineIndex, columnIndex);
+                setAt(VertexesRatioType(), lineIndex, columnIndex);
             }
         }
 
@@ -207,9 +200,7 @@ namespace grph::graph {
                     new VertexesRatioType[INITIAL_DIMENSION * INITIAL_DIMENSION],
                     std::default_delete<VertexesRatioType[]>());
 
-            memcpy(_matrix.get(),
-                   sourceMatrix.get(),
-                   INITIAL_DIMENSION * INITIAL_DIMENSION * sizeof(VertexesRatioType));
+            std::copy_n(sourceMatrix.get(), INITIAL_DIMENSION * INITIAL_DIMENSION, _matrix.get());
         }
 
         inline void decrementDimension() {
@@ -228,15 +219,6 @@ namespace grph::graph {
             }
         }
 
-        /// use with: reinterpret_cast<char *>
-        inline int calcLineFirstByteIndex(int lineIndex) const {
-            return lineIndex * INITIAL_DIMENSION * sizeof(VertexesRatioType);
-        }
-
-        inline int calcCurMatrixLineLengthInBytes() const {
-            return _curDimension * sizeof(VertexesRatioType);
-        }
-
         int findHangingVertexNeighbor(int vertexToRemove) const {
             for (int columnIndex = 0; columnIndex < _curDimension; ++columnIndex) {
                 if (isConnected(vertexToRemove, columnIndex)) {
@@ -249,24 +231,9 @@ namespace grph::graph {
 
         // TODO: переписать на использование двумерного массива
         void swapLines(int firstLineIndex, int secondLineIndex) {
-            const int lineLengthInBytes = sizeof(VertexesRatioType) * INITIAL_DIMENSION;
-
-            auto buffer = new VertexesRatioType[INITIAL_DIMENSION];
-            char *matrixBytesPtr = reinterpret_cast<char *>(_matrix.get());
-
-            memcpy(buffer,
-                   matrixBytesPtr + calcLineFirstByteIndex(firstLineIndex),
-                   lineLengthInBytes);
-
-            memcpy(matrixBytesPtr + calcLineFirstByteIndex(firstLineIndex),
-                   matrixBytesPtr + calcLineFirstByteIndex(secondLineIndex),
-                   lineLengthInBytes);
-
-            memcpy(matrixBytesPtr + calcLineFirstByteIndex(secondLineIndex),
-                   buffer,
-                   lineLengthInBytes);
-
-            delete[]buffer;
+            std::swap_ranges(_matrix.get() + firstLineIndex * INITIAL_DIMENSION,
+                             _matrix.get() + (firstLineIndex + 1) * INITIAL_DIMENSION,
+                             _matrix.get() + secondLineIndex * INITIAL_DIMENSION);
         }
 
         inline bool isOutOfBounds(int lineIndex, int columnIndex) const {
@@ -230,6 +230,7 @@ namespace grph::graph {
             int leftNode = nodeIndex - 1;
             while (leftNode >= _beginIndex && _degreesVector[cureNode].isLess(_degreesVector[leftNode])) {
                 swapNodes(cureNode, leftNode);
+                cureNode = leftNode--;
             }
         }
 
@@ -238,6 +239,7 @@ namespace grph::graph {
             int rightNode = nodeIndex + 1;
             while (rightNode <= _endIndex && _degreesVector[cureNode].isMore(_degreesVector[rightNode])) {
                 swapNodes(cureNode, rightNode);
+                cureNode = rightNode++;
             }
         }
 
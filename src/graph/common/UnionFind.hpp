@@ -0,0 +1,56 @@
+#ifndef GRPH_UNIONFIND_HPP
+#define GRPH_UNIONFIND_HPP
+
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace grph::graph {
+
+    /// disjoint sets of vertexes; reset keeps the memory, so one instance serves many samples
+    class UnionFind {
+    public:
+        void reset(int numVertexes) {
+            _parents.resize(numVertexes);
+            std::iota(_parents.begin(), _parents.end(), 0);
+            _sizes.assign(numVertexes, 1);
+            _numSets = numVertexes;
+        }
+
+        int find(int vertex) {
+            while (_parents[vertex] != vertex) {
+                _parents[vertex] = _parents[_parents[vertex]]; // path halving
+                vertex = _parents[vertex];
+            }
+            return vertex;
+        }
+
+        /// false if the vertexes are in one set already
+        bool unite(int vertex1, int vertex2) {
+            int root1 = find(vertex1);
+            int root2 = find(vertex2);
+            if (root1 == root2) {
+                return false;
+            }
+            if (_sizes[root1] < _sizes[root2]) {
+                std::swap(root1, root2);
+            }
+            _parents[root2] = root1;
+            _sizes[root1] += _sizes[root2];
+            --_numSets;
+            return true;
+        }
+
+        int getNumSets() const {
+            return _numSets;
+        }
+
+    private:
+        std::vector<int> _parents;
+        std::vector<int> _sizes;
+        int _numSets = 0;
+    };
+
+}
+
+#endif //GRPH_UNIONFIND_HPP
@@ -6,6 +6,7 @@
 #define VERTEX_NOT_FOUND (-1)
 #define TRIVIAL_CHAIN_VERTEX_LENGTH 3
 #define EMPTY 0
+#define PERFECT_EDGE 1
 
 namespace grph::graph {
 
@@ -5,6 +5,10 @@
 #include <set>
 #include <list>
 #include <queue>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <unordered_map>
 
 #include "../common/AdjacencyMatrix.hpp"
 #include "../common/EdgesList.hpp"
@@ -13,25 +17,49 @@
 #include "../common/DegreesVector.hpp"
 #include "../random/undirected_graph/UndirectedRandomGraph.hpp"
 #include "../random/IRandomGraph.hpp"
+#include "../../utils/concurrency/WorkStealingPool.hpp"
+#include "ExecutionPolicy.hpp"
+#include "ClosedForms.hpp"
+#include "ReliabilityPolynomial.hpp"
+#include "ArithmeticCircuit.hpp"
+#include "ReliabilityModel.hpp"
+#include "BirnbaumImportance.hpp"
+#include "BinaryDecisionDiagram.hpp"
+#include "FrontierDynamicProgramming.hpp"
+#include "TreeDecompositionDynamicProgramming.hpp"
+#include "MonteCarloATR.hpp"
+#include "ReliabilityBounds.hpp"
+#include "FactoringCheckpoint.hpp"
+#include "LeafBatch.hpp"
 
-#define COMPUTABLE_DIMENSION 5
+#define COMPUTABLE_DIMENSION 8
+#define MIN_PARALLEL_DIMENSION (2 * COMPUTABLE_DIMENSION)
+#define MIN_CACHED_DIMENSION 10
+#define ANYTIME_THRESHOLD_DIVISOR 16 // of the weight threshold from a pass to the next one
+#define MIN_SEPARATED_DIMENSION 12 // a smaller graph is factored without looking for a separation pair
+#define MIN_PRUNED_GAP 1e-4 // of the bounds, a branch too heavy to be pruned with it is not bounded at all
 
 namespace grph::graph::random {
 
     class ATR {
     public:
         static double calculateATR(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) {
-            IRandomGraph &&graph = UndirectedRandomGraph(adjacencyMatrix.copy());
+            return calculateATR(adjacencyMatrix, ExecutionPolicy());
+        }
 
-            if (graph.isTree()) {
-                return graph.calculateTreeATR();
-            }
+        static double calculateATR(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix,
+                                   const ExecutionPolicy &executionPolicy) {
+            IRandomGraph &&graph = UndirectedRandomGraph(adjacencyMatrix.copy());
 
             const auto &foundConnectivityComponent = findConnectivityComponent(graph);
             if (!isConnectedGraph(graph, foundConnectivityComponent)) {
                 return 0;
             }
 
+            if (graph.isTree()) {
+                return graph.calculateTreeATR();
+            }
+
             if (graph.isCycle()) {
                 return graph.calculateCycleATR();
             }
@@ -40,12 +68,128 @@ namespace grph::graph::random {
                 return calculateComputableDimensionGraph(graph);
             }
 
-            double R = prepareForReduction(graph);
+            // no vertex of degree <= 2 and no perfect edge is left
+            const double R = graph.reduceSeriesParallel()->getReductionFactor();
             if (graph.getNumVertexes() <= COMPUTABLE_DIMENSION) {
                 return R * calculateComputableDimensionGraph(graph);
             }
 
-            return R * removeEdgeATRStep(graph);
+            if (executionPolicy.engine == ReliabilityEngine::BDD) {
+                const auto &matrix = *graph.getAdjacencyMatrix();
+                return R * BinaryDecisionDiagram::build(matrix, executionPolicy.edgeOrdering).evaluate(matrix);
+            }
+            if (executionPolicy.engine == ReliabilityEngine::FRONTIER) {
+                return R * FrontierDynamicProgramming::calculate(*graph.getAdjacencyMatrix(), executionPolicy.edgeOrdering);
+            }
+            if (executionPolicy.engine == ReliabilityEngine::TREE_DECOMPOSITION) {
+                return R * TreeDecompositionDynamicProgramming::calculate(*graph.getAdjacencyMatrix(),
+                                                                          executionPolicy.eliminationHeuristic);
+            }
+            if (executionPolicy.numThreads() > 1) {
+                return R * ParallelFactoring(executionPolicy).calculateInternalATR(graph);
+            }
+            return R * IterativeFactoring(executionPolicy).calculate(graph);
+        }
+
+        /// ATR by sampling on all hardware threads, for the graphs no exact engine can take; for a highly
+        /// reliable network SamplingMethod::PERMUTATION keeps the relative error of the unreliability bounded
+        static ATREstimate estimateATR(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix,
+                                       const SamplingPolicy &samplingPolicy) {
+            return estimateATR(adjacencyMatrix, samplingPolicy, ExecutionPolicy{.threads = 0});
+        }
+
+        /// the same estimate for the seed whatever the number of threads
+        static ATREstimate estimateATR(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix,
+                                       const SamplingPolicy &samplingPolicy, const ExecutionPolicy &executionPolicy) {
+            return MonteCarloATR::estimate(adjacencyMatrix, samplingPolicy, executionPolicy);
+        }
+
+        /// bounds of ATR that tighten while the factoring goes on, returned at the time budget or the gap
+        static ATRBounds calculateATRBounds(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix,
+                                            const AnytimePolicy &anytimePolicy) {
+            return calculateATRBounds(adjacencyMatrix, anytimePolicy, ExecutionPolicy());
+        }
+
+        /// the pivot strategy and the statistics of the policy are used, see AnytimeFactoring
+        static ATRBounds calculateATRBounds(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix,
+                                            const AnytimePolicy &anytimePolicy,
+                                            const ExecutionPolicy &executionPolicy) {
+            IRandomGraph &&graph = UndirectedRandomGraph(adjacencyMatrix.copy());
+            if (!isConnectedGraph(graph, findConnectivityComponent(graph))) {
+                return ATRBounds{0., 0., 1.};
+            }
+            return AnytimeFactoring(anytimePolicy, executionPolicy).calculateBounds(graph);
+        }
+
+        /// ATR within maxError by the serial factoring that leaves the branches of a small probability mass to
+        /// ReliabilityBounds, see IterativeFactoring. A pass whose pruned errors add up over maxError is cut
+        /// and made again with the prune threshold divided. The interval is guaranteed; the pivot strategy,
+        /// the table and the statistics of the policy are used
+        static ATRBounds calculateApproximateATR(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix,
+                                                 double maxError,
+                                                 const ExecutionPolicy &executionPolicy = ExecutionPolicy()) {
+            if (std::isnan(maxError) || maxError < 0) {
+                throw std::runtime_error("ERROR(ATR): maxError must be a non-negative number");
+            }
+            IRandomGraph &&graph = UndirectedRandomGraph(adjacencyMatrix.copy());
+            if (!isConnectedGraph(graph, findConnectivityComponent(graph))) {
+                return ATRBounds{0., 0., 1.};
+            }
+            for (double pruneThreshold = maxError; ; pruneThreshold /= ANYTIME_THRESHOLD_DIVISOR) {
+                IterativeFactoring factoring(executionPolicy, pruneThreshold, maxError);
+                const double R = factoring.calculate(graph);
+                if (!std::isnan(R)) {
+                    return ATRBounds{R, std::min(R + factoring.getSpentError(), 1.), 1 - factoring.getPrunedShare()};
+                }
+                // a cut pass leaves the graph factored part way
+                const auto passMatrix = adjacencyMatrix.copy();
+                graph.setMatrixAndVector(passMatrix, DegreesVector::make(passMatrix));
+            }
+        }
+
+        /// ATR with the factoring written to the checkpoint file every interval; nullopt when the time budget
+        /// runs out first, resumeATR goes on from the file
+        static std::optional<double> calculateATRWithCheckpoints(
+                const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix,
+                const CheckpointPolicy &checkpointPolicy,
+                const ExecutionPolicy &executionPolicy = ExecutionPolicy()) {
+            IRandomGraph &&graph = UndirectedRandomGraph(adjacencyMatrix.copy());
+            if (!isConnectedGraph(graph, findConnectivityComponent(graph))) {
+                FactoringCheckpoint checkpoint;
+                checkpoint.R = 0.;
+                checkpoint.write(checkpointPolicy.path);
+                return 0.;
+            }
+            return CheckpointedFactoring(checkpointPolicy, executionPolicy).calculate(adjacencyMatrix);
+        }
+
+        /// the same ATR as calculateATRWithCheckpoints from the checkpoint at the path of the policy
+        static std::optional<double> resumeATR(const CheckpointPolicy &checkpointPolicy,
+                                               const ExecutionPolicy &executionPolicy = ExecutionPolicy()) {
+            return CheckpointedFactoring(checkpointPolicy, executionPolicy).resume();
+        }
+
+        /// ATR for the same probability p of all edges, values of the matrix are ignored
+        static ReliabilityPolynomial calculateReliabilityPolynomial(
+                const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) {
+            return ReliabilityPolynomialFactoring::calculate(adjacencyMatrix);
+        }
+
+        /// factoring done once for the topology, the circuit gives ATR for any probabilities of the edges
+        static ArithmeticCircuit compileATR(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) {
+            return ArithmeticCircuit::compile(adjacencyMatrix);
+        }
+
+        /// the circuit of compileATR with the values kept, for the updates of the probabilities of a topology
+        static ReliabilityModel buildReliabilityModel(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) {
+            return ReliabilityModel(adjacencyMatrix);
+        }
+
+        /// ATR and the Birnbaum importances dR/dp of all edges of the input, in the order of the edges of
+        /// compileATR; reverse-mode differentiation of the factoring, see BirnbaumImportance
+        static std::pair<double, std::vector<std::pair<Edge, double>>> calculateBirnbaumImportance(
+                const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) {
+            return BirnbaumImportance::calculate(adjacencyMatrix);
         }
 
         static std::unordered_set<int> findConnectivityComponent(const IRandomGraph &graph) {
@@ -61,6 +205,7 @@ namespace grph::graph::random {
             if (begin == VERTEX_NOT_FOUND) {
                 return {};
             }
+            foundChain.push_back(begin);
 
             auto prevVertex = begin;
             auto curVertex = begin;
@@ -92,55 +237,6 @@ namespace grph::graph::random {
         }
 
     private:
-        static double removeEdgeATRStep(IRandomGraph &graph) {
-            const auto &removeEdgeAction = graph.removeRandomEdge();
-
-            auto foundConnectivityComponent = findConnectivityComponent(graph);
-            bool isRemovedEdgeBridge = !isConnectedGraph(graph, foundConnectivityComponent);
-
-            double R = 0.;
-            if (isRemovedEdgeBridge) {
-                const auto &inverseComponent = graph.getInverseComponent(foundConnectivityComponent);
-                R = removeEdgeAction->getEdgeProbability()
-                    * calculateComponentATR(graph, foundConnectivityComponent)
-                    * calculateComponentATR(graph, inverseComponent);
-            } else {
-                R = (1 - removeEdgeAction->getEdgeProbability()) * calculateInternalATR(graph);
-
-                const auto &pullAction = graph.pullEdge(
-                        removeEdgeAction->getRemovedEdge().minVertex(),
-                        removeEdgeAction->getRemovedEdge().maxVertex()
-                );
-                R += removeEdgeAction->getEdgeProbability() * calculateInternalATR(graph);
-                pullAction->rollback();
-            }
-            removeEdgeAction->rollback();
-            return R;
-        }
-
-        static double prepareForReduction(IRandomGraph &graph) {
-            double R = 1;
-            R *= removeHangingVertexes(graph);
-
-            Chain foundChain;
-            while (graph.getNumVertexes() > COMPUTABLE_DIMENSION && !(foundChain = findResolvingChain(graph)).empty()) {
-                R *= graph.removeChain(foundChain);
-
-                if (graph.containsHangingVertex()) {
-                    throw std::runtime_error("ERROR: have hanging vertex");
-                }
-            }
-            return R;
-        }
-
-        static double removeHangingVertexes(IRandomGraph &graph) {
-            double R = 1;
-            while (graph.containsHangingVertex()) {
-                R *= graph.removeHangingVertexWithLowestIndex();
-            }
-            return R;
-        }
-
         static std::unordered_set<int> bfs(const std::shared_ptr<AdjacencyMatrix<EdgeProbability>> &adjacencyMatrix) {
             if (adjacencyMatrix->getDimension() == 0) {
                 return {};
@@ -166,36 +262,11 @@ namespace grph::graph::random {
             return connectivityComponent;
         }
 
-        static double calculateComponentATR(IRandomGraph &graph,
-                                            const std::unordered_set<int> &foundConnectivityComponent) {
-            const auto prevMatrix = graph.getAdjacencyMatrix();
-            const auto prevDegreesVector = graph.getDegreesVector();
-
-            const auto subgraphMatrix = graph.getSubgraphAdjacencyMatrix(foundConnectivityComponent);
-            const auto subgraphDegreesVector = DegreesVector::make(subgraphMatrix);
-
-            graph.setMatrixAndVector(subgraphMatrix, subgraphDegreesVector);
-            double R = calculateInternalATR(graph);
-            graph.setMatrixAndVector(prevMatrix, prevDegreesVector);
-
-            return R;
-        }
-
-        static double calculateInternalATR(IRandomGraph &graph) {
-            if (graph.getNumVertexes() <= COMPUTABLE_DIMENSION) {
-                return calculateComputableDimensionGraph(graph);
-            }
-
-            double R = 0.;
-            const Chain &trivialChain = findResolvingChain(graph);
-            if (!trivialChain.empty()) { // Тут не появится висячая вершина
-                const auto &removeTrivialChainAction = graph.removeTrivialChain(trivialChain);
-                R = trivialChain.getChainFactor() * calculateInternalATR(graph);
-                removeTrivialChainAction->rollback();
-            } else {
-                R = removeEdgeATRStep(graph);
+        static void countStep(const ExecutionPolicy &executionPolicy,
+                              std::atomic<long long> FactoringStatistics::*counter) {
+            if (executionPolicy.statistics) {
+                (executionPolicy.statistics.get()->*counter).fetch_add(1, std::memory_order_relaxed);
             }
-            return R;
         }
 
         static double calculateComputableDimensionGraph(const IRandomGraph &graph) {
@@ -272,15 +343,891 @@ namespace grph::graph::random {
                        - _b * _h * (_e * _u * k_3 + _d * _v * (_a * _f * k_12 + _e * _g * k_15))
                        - _c * _v * (_f * _h * k_4 + _a * _g * (_b * _u * k_10 + _e * _h * k_13))
                        - _d * _u * (_g * _v * k_5 + _a * _e * (_c * _h * k_11 + _f * _v * k_14));
+            } else if (graph.getNumVertexes() == 6) {
+                return ClosedForms::calculateCompleteGraph6ATR(*graph.getAdjacencyMatrix());
+            } else if (graph.getNumVertexes() == 7) {
+                return ClosedForms::calculateCompleteGraph7ATR(*graph.getAdjacencyMatrix());
+            } else if (graph.getNumVertexes() == 8) {
+                return ClosedForms::calculateCompleteGraph8ATR(*graph.getAdjacencyMatrix());
             } else {
                 throw std::runtime_error("ERROR: try calculate non_computable graph");
             }
         }
 
+        /// The smaller part G1 of a separation pair {a, b} leaves the other part either a and b joined by G1,
+        /// with the probability C1 = R(G1), or a and b apart with every vertex of G1 attached to one of them,
+        /// with D1 = R(G1 / ab) - C1. So G1 is exactly the edge ab of the probability C1 / R(G1 / ab) with
+        /// the factor R(G1 / ab), and the bigger part is solved once
+        struct SeparationParts {
+            std::shared_ptr<AdjacencyMatrix<EdgeProbability>> rest; // the bigger part, a and b at 0 and 1
+            std::shared_ptr<AdjacencyMatrix<EdgeProbability>> contracted; // G1 / ab
+            std::shared_ptr<AdjacencyMatrix<EdgeProbability>> joined; // G1 with the edge ab
+        };
+
+        /// the parts of a graph without blocks, the same choice for every factoring driver; none for an
+        /// approximate calculation, whose pruned G1 would make the probability of the edge wrong
+        static std::optional<SeparationParts> findSeparationParts(const IRandomGraph &graph, double pruneThreshold) {
+            std::pair<int, int> separationPair;
+            std::unordered_set<int> side;
+            if (pruneThreshold > 0 || graph.getNumVertexes() < MIN_SEPARATED_DIMENSION
+                || !graph.findSeparationPair(separationPair, side)) {
+                return std::nullopt;
+            }
+            const auto &matrix = *graph.getAdjacencyMatrix();
+            std::vector<int> sideVertexes(side.begin(), side.end());
+            std::vector<int> restVertexes;
+            for (int vertex = 0; vertex < graph.getNumVertexes(); ++vertex) {
+                if (!side.contains(vertex) && vertex != separationPair.first && vertex != separationPair.second) {
+                    restVertexes.push_back(vertex);
+                }
+            }
+            return SeparationParts{makePartMatrix(matrix, separationPair, restVertexes, false, false),
+                                   makePartMatrix(matrix, separationPair, sideVertexes, true, false),
+                                   makePartMatrix(matrix, separationPair, sideVertexes, false, true)};
+        }
+
+        /// the edge ab that replaces G1, for R(G1 / ab) > 0
+        static void addSeparationEdge(AdjacencyMatrix<EdgeProbability> &rest, double joinedR, double contractedR) {
+            rest.addEdge(0, 1, std::min(joinedR / contractedR, 1.));
+        }
+
+        /// the pair at 0 and 1, then the vertexes; a contracted pair is the vertex 0 with the edges of both
+        static std::shared_ptr<AdjacencyMatrix<EdgeProbability>> makePartMatrix(
+                const AdjacencyMatrix<EdgeProbability> &matrix, const std::pair<int, int> &separationPair,
+                const std::vector<int> &vertexes, bool isContracted, bool withPairEdge) {
+            const int shift = isContracted ? 1 : 2;
+            auto part = std::make_shared<AdjacencyMatrix<EdgeProbability>>(shift + static_cast<int>(vertexes.size()));
+            const auto [pairVertex1, pairVertex2] = separationPair;
+            if (withPairEdge && matrix.isConnected(pairVertex1, pairVertex2)) {
+                part->addEdge(0, 1, matrix.at(pairVertex1, pairVertex2));
+            }
+            for (int vertexIdx = 0; vertexIdx < static_cast<int>(vertexes.size()); ++vertexIdx) {
+                const int vertex = vertexes[vertexIdx];
+                for (const auto &[pairVertex, pairIdx]: {std::pair{pairVertex1, 0},
+                                                        std::pair{pairVertex2, isContracted ? 0 : 1}}) {
+                    if (matrix.isConnected(pairVertex, vertex)) {
+                        const double p = matrix.at(pairVertex, vertex);
+                        const double other = part->at(pairIdx, shift + vertexIdx); // the other vertex of the pair
+                        part->addEdge(pairIdx, shift + vertexIdx, 1 - (1 - other) * (1 - p));
+                    }
+                }
+                for (int neighborIdx = vertexIdx + 1; neighborIdx < static_cast<int>(vertexes.size()); ++neighborIdx) {
+                    if (matrix.isConnected(vertex, vertexes[neighborIdx])) {
+                        part->addEdge(shift + vertexIdx, shift + neighborIdx, matrix.at(vertex, vertexes[neighborIdx]));
+                    }
+                }
+            }
+            return part;
+        }
+
         static bool isConnectedGraph(const IRandomGraph &graph,
                                      const std::unordered_set<int> &foundConnectivityComponent) {
             return graph.getAdjacencyMatrix()->getDimension() == foundConnectivityComponent.size();
         }
+
+        /// Serial factoring as a state machine over an explicit stack of compact frames, so a deep factoring
+        /// tree costs heap, not the call stack. A frame knows only its stage and a number or two; the graph
+        /// changes to undo are on a stack of rollback actions, the graphs of the blocks wait on a stack of
+        /// matrices. The steps and the order of the LeafBatch operands are those of the recursive factoring,
+        /// so the result is the same to the last bit. The buffers are kept, one instance serves many graphs.
+        class IterativeFactoring {
+        public:
+            /// pruneThreshold > 0 - a branch is left to the lower bound of ReliabilityBounds when its probability
+            /// mass times the gap of the bounds is within the threshold, the result is then a lower bound of ATR.
+            /// Once the errors of the pruned branches add up over maxError the calculation is cut.
+            explicit IterativeFactoring(const ExecutionPolicy &executionPolicy, double pruneThreshold = 0.,
+                                        double maxError = INFINITY)
+                    : _executionPolicy(executionPolicy), _pruneThreshold(pruneThreshold), _maxError(maxError) {}
+
+            /// NAN when cut, the graph is then left as it was at the cut
+            double calculate(IRandomGraph &graph) {
+                _maxDepth = 0;
+                _peakStackBytes = 0;
+                _spentError = 0.;
+                _prunedShare = 0.;
+                _nextTag = 0;
+                _frames.push_back(Frame{Stage::SOLVE});
+                while (!_frames.empty()) {
+                    if (_spentError > _maxError) {
+                        reset();
+                        return NAN;
+                    }
+                    step(graph);
+                    _maxDepth = std::max(_maxDepth, static_cast<long long>(_frames.size()));
+                    _peakStackBytes = std::max(_peakStackBytes, getStackBytes());
+                }
+                if (_executionPolicy.statistics) {
+                    updateMax(_executionPolicy.statistics->maxDepth, _maxDepth);
+                    updateMax(_executionPolicy.statistics->peakStackBytes, _peakStackBytes);
+                }
+                const double R = _leafBatch.popValue();
+                insertTaggedValues();
+                return R;
+            }
+
+            /// frames of the last calculation
+            long long getMaxDepth() const {
+                return _maxDepth;
+            }
+
+            /// frames, rollback actions and waiting block matrices of the last calculation
+            long long getPeakStackBytes() const {
+                return _peakStackBytes;
+            }
+
+            /// the sum of the errors of the pruned branches, ATR is at most this above the result
+            double getSpentError() const {
+                return _spentError;
+            }
+
+            /// of the factoring tree left to the bounds by the last calculation
+            double getPrunedShare() const {
+                return _prunedShare;
+            }
+
+        private:
+            enum class Stage : uint8_t {
+                SOLVE, // the graph as it is: a leaf, a cached value or FACTOR
+                FACTOR, // reductions, blocks or the pivot edge
+                CACHE, // the value of the subtree goes to the transposition table
+                SCALE, // the reduction factor is applied, the reductions are rolled back
+                REMOVED, // R(removed) is pushed, the edge is pulled next
+                PULLED, // R(pulled) is pushed, the edge step is complete
+                BLOCKS, // the next block is solved, or the product of all of them is pushed
+                SEPARATION // the next part of the separation pair is solved, see separate
+            };
+
+            struct Frame {
+                Stage _stage;
+                int _numBlocks = 0; // of BLOCKS
+                int _nextBlock = 0;
+                double _value = 0.; // factor of SCALE, probability of the pivot edge, spent error before CACHE
+                double _weight = 1.; // probability mass of the branch, the blocks of a graph get the mass of the graph
+                double _share = 1.; // of the factoring tree, the blocks of a graph split the share of the graph
+            };
+
+            struct WaitingGraph {
+                std::shared_ptr<AdjacencyMatrix<EdgeProbability>> _matrix;
+                std::shared_ptr<DegreesVector> _degreesVector; // nullptr for a block not yet solved
+            };
+
+            void step(IRandomGraph &graph) {
+                Frame &frame = _frames.back();
+                switch (frame._stage) {
+                    case Stage::SOLVE:
+                        solve(graph);
+                        break;
+                    case Stage::FACTOR:
+                        factor(graph);
+                        break;
+                    case Stage::CACHE:
+                        // the value goes to the table once the batch calculates it, its leaves are not flushed
+                        // early; until then the same graph is calculated again when met
+                        if (_spentError == frame._value) { // a value with pruned branches is not the ATR
+                            _pendingKeys.emplace(_nextTag, std::move(_keys.back()));
+                            _leafBatch.pushTag(_nextTag++);
+                        }
+                        _keys.pop_back();
+                        _frames.pop_back();
+                        break;
+                    case Stage::SCALE:
+                        rollback();
+                        _leafBatch.pushScale(frame._value);
+                        _frames.pop_back();
+                        break;
+                    case Stage::REMOVED: {
+                        const auto &removeEdgeAction = static_cast<const RemoveRandomEdgeAction &>(*_actions.back());
+                        const Edge removedEdge = removeEdgeAction.getRemovedEdge();
+                        _actions.push_back(graph.pullEdge(removedEdge.minVertex(), removedEdge.maxVertex()));
+                        frame._stage = Stage::PULLED;
+                        pushChild(frame._value, frame._value);
+                        break;
+                    }
+                    case Stage::PULLED:
+                        rollback();
+                        _leafBatch.pushEdgeFactoring(frame._value);
+                        rollback();
+                        _frames.pop_back();
+                        break;
+                    case Stage::SEPARATION:
+                        separate(graph, frame);
+                        break;
+                    case Stage::BLOCKS:
+                        if (frame._nextBlock < frame._numBlocks) {
+                            ++frame._nextBlock;
+                            auto block = std::move(_waitingGraphs.back());
+                            _waitingGraphs.pop_back();
+                            _waitingBytes -= getMatrixBytes(*block._matrix);
+                            graph.setMatrixAndVector(block._matrix, DegreesVector::make(block._matrix));
+                            pushChild(1., 1. / frame._numBlocks);
+                        } else {
+                            const auto &previous = _waitingGraphs.back();
+                            graph.setMatrixAndVector(previous._matrix, previous._degreesVector);
+                            _waitingGraphs.pop_back();
+                            _leafBatch.pushProduct(frame._numBlocks);
+                            _frames.pop_back();
+                        }
+                        break;
+                }
+            }
+
+            void solve(IRandomGraph &graph) {
+                if (graph.getNumVertexes() <= COMPUTABLE_DIMENSION) {
+                    countStep(_executionPolicy, &FactoringStatistics::leaves);
+                    if (graph.getNumVertexes() >= MIN_BATCHED_DIMENSION) {
+                        _leafBatch.pushLeaf(*graph.getAdjacencyMatrix());
+                    } else {
+                        _leafBatch.pushValue(calculateComputableDimensionGraph(graph));
+                    }
+                    _frames.pop_back();
+                    return;
+                }
+                if (_pruneThreshold > 0 && prune(graph)) {
+                    return;
+                }
+
+                const auto &transpositionTable = _executionPolicy.transpositionTable;
+                if (!transpositionTable || graph.getNumVertexes() < MIN_CACHED_DIMENSION) {
+                    _frames.back()._stage = Stage::FACTOR;
+                    return;
+                }
+                insertTaggedValues();
+                auto key = TranspositionTable::makeKey(*graph.getAdjacencyMatrix());
+                double R = 0.;
+                if (transpositionTable->find(key, R)) {
+                    _leafBatch.pushValue(R);
+                    _frames.pop_back();
+                    return;
+                }
+                _keys.push_back(std::move(key));
+                _frames.back()._stage = Stage::CACHE;
+                _frames.back()._value = _spentError;
+                pushChild(1., 1., Stage::FACTOR);
+            }
+
+            /// the value of a branch changes ATR by at most its mass times the change, since the other factors
+            /// of the blocks and the reductions are probabilities
+            bool prune(IRandomGraph &graph) {
+                const Frame &frame = _frames.back();
+                if (frame._weight > _pruneThreshold / MIN_PRUNED_GAP) {
+                    return false;
+                }
+                const auto &matrix = *graph.getAdjacencyMatrix();
+                const double lowerBound = ReliabilityBounds::calculateLowerBound(matrix);
+                const double error = frame._weight * std::max(
+                        0., ReliabilityBounds::calculateUpperBound(matrix) - lowerBound);
+                if (error > _pruneThreshold) {
+                    return false;
+                }
+                countStep(_executionPolicy, &FactoringStatistics::prunedBranches);
+                _spentError += error;
+                _prunedShare += frame._share;
+                _leafBatch.pushValue(lowerBound);
+                _frames.pop_back();
+                return true;
+            }
+
+            /// after a cut
+            void reset() {
+                _frames.clear();
+                _actions.clear();
+                _waitingGraphs.clear();
+                _keys.clear();
+                _pendingKeys.clear();
+                _waitingBytes = 0;
+                _leafBatch = LeafBatch();
+            }
+
+            void pushChild(double weightFactor, double shareFactor, Stage stage = Stage::SOLVE) {
+                Frame child{stage};
+                child._weight = _frames.back()._weight * weightFactor;
+                child._share = _frames.back()._share * shareFactor;
+                _frames.push_back(child);
+            }
+
+            void factor(IRandomGraph &graph) {
+                auto reduceAction = graph.reduceSeriesParallel();
+                if (reduceAction->getNumReductions() > 0) {
+                    countStep(_executionPolicy, &FactoringStatistics::reductions);
+                    const double factor = reduceAction->getReductionFactor();
+                    _frames.back()._stage = Stage::SCALE;
+                    _frames.back()._value = factor;
+                    _actions.push_back(std::move(reduceAction));
+                    pushChild(factor, 1.);
+                    return;
+                }
+
+                const auto blocks = graph.findBlocks();
+                if (!blocks.empty()) { // ATR of a graph is the product of ATRs of its blocks
+                    countStep(_executionPolicy, &FactoringStatistics::blockSplits);
+                    _waitingGraphs.push_back(WaitingGraph{graph.getAdjacencyMatrix(), graph.getDegreesVector()});
+                    for (auto block = blocks.rbegin(); block != blocks.rend(); ++block) {
+                        _waitingGraphs.push_back(WaitingGraph{graph.getSubgraphAdjacencyMatrix(*block), nullptr});
+                        _waitingBytes += getMatrixBytes(*_waitingGraphs.back()._matrix);
+                    }
+                    _frames.back()._stage = Stage::BLOCKS;
+                    _frames.back()._numBlocks = static_cast<int>(blocks.size());
+                    return;
+                }
+
+                if (const auto parts = findSeparationParts(graph, _pruneThreshold)) {
+                    countStep(_executionPolicy, &FactoringStatistics::separations);
+                    _waitingGraphs.push_back(WaitingGraph{graph.getAdjacencyMatrix(), graph.getDegreesVector()});
+                    for (const auto &part: {parts->rest, parts->contracted, parts->joined}) {
+                        _waitingGraphs.push_back(WaitingGraph{part, nullptr});
+                        _waitingBytes += getMatrixBytes(*part);
+                    }
+                    _frames.back()._stage = Stage::SEPARATION;
+                    return;
+                }
+
+                // the block pass has proven that the graph has no bridges, so the removed edge can't be one
+                countStep(_executionPolicy, &FactoringStatistics::factoringSteps);
+                auto removeEdgeAction = graph.removeEdge(PivotSelector::selectPivot(graph, _executionPolicy.pivotStrategy));
+                const double p = removeEdgeAction->getEdgeProbability();
+                _frames.back()._stage = Stage::REMOVED;
+                _frames.back()._value = p;
+                _actions.push_back(std::move(removeEdgeAction));
+                pushChild(1 - p, 1 - p);
+            }
+
+            /// G1, G1 / ab, then the bigger part with the edge of G1, see SeparationParts
+            void separate(IRandomGraph &graph, Frame &frame) {
+                if (frame._nextBlock < 2) { // G1, then G1 / ab
+                    ++frame._nextBlock;
+                    auto part = std::move(_waitingGraphs.back());
+                    _waitingGraphs.pop_back();
+                    _waitingBytes -= getMatrixBytes(*part._matrix);
+                    graph.setMatrixAndVector(part._matrix, DegreesVector::make(part._matrix));
+                    pushChild(1., 1.);
+                    return;
+                }
+                if (frame._nextBlock == 2) {
+                    ++frame._nextBlock;
+                    const double contractedR = _leafBatch.popValue(); // the edge needs the values now
+                    const double joinedR = _leafBatch.popValue();
+                    auto rest = std::move(_waitingGraphs.back());
+                    _waitingGraphs.pop_back();
+                    _waitingBytes -= getMatrixBytes(*rest._matrix);
+                    frame._value = contractedR;
+                    if (contractedR > 0) {
+                        addSeparationEdge(*rest._matrix, joinedR, contractedR);
+                        graph.setMatrixAndVector(rest._matrix, DegreesVector::make(rest._matrix));
+                        pushChild(1., 1.);
+                        return;
+                    }
+                    _leafBatch.pushValue(0.); // some vertex of G1 reaches neither a nor b
+                }
+                const auto &previous = _waitingGraphs.back();
+                graph.setMatrixAndVector(previous._matrix, previous._degreesVector);
+                _waitingGraphs.pop_back();
+                _leafBatch.pushScale(frame._value);
+                _frames.pop_back();
+            }
+
+            void insertTaggedValues() {
+                for (const auto &[tag, R]: _leafBatch.takeTaggedValues()) {
+                    auto pendingKey = _pendingKeys.extract(tag);
+                    _executionPolicy.transpositionTable->insert(std::move(pendingKey.mapped()), R);
+                }
+            }
+
+            void rollback() {
+                _actions.back()->rollback();
+                _actions.pop_back();
+            }
+
+            long long getStackBytes() const {
+                return static_cast<long long>(_frames.size() * sizeof(Frame)
+                                              + _actions.size() * sizeof(std::shared_ptr<RollbackAction>)
+                                              + _waitingGraphs.size() * sizeof(WaitingGraph)) + _waitingBytes;
+            }
+
+            static long long getMatrixBytes(const AdjacencyMatrix<EdgeProbability> &matrix) {
+                return static_cast<long long>(matrix.getDimension()) * matrix.getDimension() * sizeof(EdgeProbability);
+            }
+
+            static void updateMax(std::atomic<long long> &max, long long value) {
+                long long current = max.load(std::memory_order_relaxed);
+                while (current < value && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+                }
+            }
+
+            const ExecutionPolicy &_executionPolicy;
+            const double _pruneThreshold;
+            const double _maxError;
+            double _spentError = 0.;
+            double _prunedShare = 0.;
+            LeafBatch _leafBatch;
+            std::vector<Frame> _frames;
+            std::vector<std::shared_ptr<RollbackAction>> _actions;
+            std::vector<WaitingGraph> _waitingGraphs;
+            std::vector<TranspositionTable::Key> _keys;
+            std::unordered_map<int, TranspositionTable::Key> _pendingKeys; // by the LeafBatch tags
+            int _nextTag = 0;
+            long long _waitingBytes = 0; // of the matrices of the waiting blocks
+            long long _maxDepth = 0;
+            long long _peakStackBytes = 0;
+        };
+
+        /// the separation step of the drivers made of tasks: G1 and G1 / ab are solved at once by the serial
+        /// driver, R(G1 / ab) goes to the chain factors and the graph becomes the bigger part, so the task goes
+        /// on with it. False if R(G1 / ab) = 0, the graph is then left as it was
+        static bool separateInPlace(IRandomGraph &graph, IterativeFactoring &driver, SeparationParts &parts,
+                                    std::vector<double> &chainFactors) {
+            graph.setMatrixAndVector(parts.joined, DegreesVector::make(parts.joined));
+            const double joinedR = driver.calculate(graph);
+            graph.setMatrixAndVector(parts.contracted, DegreesVector::make(parts.contracted));
+            const double contractedR = driver.calculate(graph);
+            chainFactors.push_back(contractedR);
+            if (contractedR == 0) { // some vertex of G1 reaches neither a nor b
+                return false;
+            }
+            addSeparationEdge(*parts.rest, joinedR, contractedR);
+            graph.setMatrixAndVector(parts.rest, DegreesVector::make(parts.rest));
+            return true;
+        }
+
+        /// Factoring tree split into tasks of a work-stealing pool. Every worker factors its tasks
+        /// on its own graph replica; the parts G1 of a separation pair are solved within the task. The
+        /// subresults are combined in the same order as the serial IterativeFactoring does, so the result
+        /// is the same.
+        class ParallelFactoring {
+        public:
+            explicit ParallelFactoring(const ExecutionPolicy &executionPolicy)
+                    : _executionPolicy(executionPolicy),
+                      _pool(executionPolicy.numThreads()),
+                      _splitLevels(executionPolicy.numSplitLevels()),
+                      _replicas(_pool.getNumWorkers()),
+                      _drivers(_pool.getNumWorkers(), IterativeFactoring(executionPolicy)) {}
+
+            double calculateInternalATR(const IRandomGraph &graph) {
+                double R = 0.;
+                auto rootJoin = std::make_shared<FactoringJoin>(FactoringJoin::Kind::ROOT, 1);
+                rootJoin->_rootResult = &R;
+
+                FactoringTask rootTask{graph.getAdjacencyMatrix()->copy(), rootJoin, 0, 0};
+                _pool.run(std::move(rootTask), [this](FactoringTask &task, int workerId) {
+                    processTask(task, workerId);
+                });
+                return R;
+            }
+
+        private:
+            /// waits for the results of all subproblems of a decomposition or factoring step
+            struct FactoringJoin {
+                enum class Kind {
+                    ROOT, BLOCKS, EDGE_FACTORING
+                };
+
+                FactoringJoin(Kind kind, int numResults)
+                        : _kind(kind), _results(numResults, 0.), _pendingResults(numResults) {}
+
+                const Kind _kind;
+                double _edgeProbability = 0.;
+                std::vector<double> _chainFactors; // of the reductions made before the step
+                std::vector<double> _results;
+                std::atomic<int> _pendingResults;
+                std::shared_ptr<FactoringJoin> _parent;
+                int _parentSlot = 0;
+                double *_rootResult = nullptr;
+
+                double combine() const {
+                    double R = 0.;
+                    switch (_kind) {
+                        case Kind::ROOT:
+                            return _results[0];
+                        case Kind::BLOCKS:
+                            R = 1.;
+                            for (const auto blockR: _results) {
+                                R *= blockR;
+                            }
+                            break;
+                        case Kind::EDGE_FACTORING:
+                            R = (1 - _edgeProbability) * _results[0];
+                            R += _edgeProbability * _results[1];
+                            break;
+                    }
+                    return applyChainFactors(_chainFactors, R);
+                }
+            };
+
+            struct FactoringTask {
+                std::shared_ptr<AdjacencyMatrix<EdgeProbability>> _matrix;
+                std::shared_ptr<FactoringJoin> _join;
+                int _slot = 0;
+                int _depth = 0;
+            };
+
+            static double applyChainFactors(const std::vector<double> &chainFactors, double R) {
+                for (auto factor = chainFactors.rbegin(); factor != chainFactors.rend(); ++factor) {
+                    R = *factor * R;
+                }
+                return R;
+            }
+
+            static void report(std::shared_ptr<FactoringJoin> join, int slot, double R) {
+                while (true) {
+                    join->_results[slot] = R;
+                    if (join->_pendingResults.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                        return;
+                    }
+                    R = join->combine();
+                    if (join->_kind == FactoringJoin::Kind::ROOT) {
+                        *join->_rootResult = R;
+                        return;
+                    }
+                    slot = join->_parentSlot;
+                    join = join->_parent;
+                }
+            }
+
+            std::shared_ptr<FactoringJoin> makeJoin(FactoringJoin::Kind kind,
+                                                    int numResults,
+                                                    const FactoringTask &task,
+                                                    std::vector<double> &&chainFactors) {
+                auto join = std::make_shared<FactoringJoin>(kind, numResults);
+                join->_chainFactors = std::move(chainFactors);
+                join->_parent = task._join;
+                join->_parentSlot = task._slot;
+                return join;
+            }
+
+            void processTask(FactoringTask &task, int workerId) {
+                auto &graph = _replicas[workerId];
+                graph.setMatrixAndVector(task._matrix, DegreesVector::make(task._matrix));
+
+                if (task._depth > 0
+                    && (task._depth >= _splitLevels || graph.getNumVertexes() <= MIN_PARALLEL_DIMENSION)) {
+                    report(task._join, task._slot, _drivers[workerId].calculate(graph));
+                    return;
+                }
+
+                // same steps as IterativeFactoring, the task owns its matrix so no rollback
+                std::vector<double> chainFactors;
+                while (graph.getNumVertexes() > COMPUTABLE_DIMENSION) {
+                    const auto reduceAction = graph.reduceSeriesParallel();
+                    if (reduceAction->getNumReductions() > 0) {
+                        countStep(_executionPolicy, &FactoringStatistics::reductions);
+                        chainFactors.push_back(reduceAction->getReductionFactor());
+                        continue;
+                    }
+
+                    const auto blocks = graph.findBlocks();
+                    if (!blocks.empty()) {
+                        countStep(_executionPolicy, &FactoringStatistics::blockSplits);
+                        splitOnBlocks(graph, blocks, task, std::move(chainFactors), workerId);
+                        return;
+                    }
+
+                    if (auto parts = findSeparationParts(graph, 0.)) {
+                        countStep(_executionPolicy, &FactoringStatistics::separations);
+                        if (separateInPlace(graph, _drivers[workerId], *parts, chainFactors)) {
+                            continue;
+                        }
+                        report(task._join, task._slot, applyChainFactors(chainFactors, 0.));
+                        return;
+                    }
+                    splitOnEdge(graph, task, std::move(chainFactors), workerId);
+                    return;
+                }
+                countStep(_executionPolicy, &FactoringStatistics::leaves);
+                report(task._join, task._slot,
+                       applyChainFactors(chainFactors, calculateComputableDimensionGraph(graph)));
+            }
+
+            void splitOnBlocks(IRandomGraph &graph,
+                               const std::vector<std::unordered_set<int>> &blocks,
+                               const FactoringTask &task,
+                               std::vector<double> &&chainFactors,
+                               int workerId) {
+                const int numBlocks = static_cast<int>(blocks.size());
+                auto join = makeJoin(FactoringJoin::Kind::BLOCKS, numBlocks, task, std::move(chainFactors));
+                for (int blockIdx = numBlocks - 1; blockIdx >= 0; --blockIdx) {
+                    _pool.push(workerId, FactoringTask{graph.getSubgraphAdjacencyMatrix(blocks[blockIdx]),
+                                                       join, blockIdx, task._depth + 1});
+                }
+            }
+
+            void splitOnEdge(IRandomGraph &graph,
+                             const FactoringTask &task,
+                             std::vector<double> &&chainFactors,
+                             int workerId) {
+                countStep(_executionPolicy, &FactoringStatistics::factoringSteps);
+                const auto &removeEdgeAction = graph.removeEdge(
+                        PivotSelector::selectPivot(graph, _executionPolicy.pivotStrategy));
+
+                // the task is split on its blocks first, so the removed edge is never a bridge
+                auto join = makeJoin(FactoringJoin::Kind::EDGE_FACTORING, 2, task, std::move(chainFactors));
+                join->_edgeProbability = removeEdgeAction->getEdgeProbability();
+
+                const auto removedEdgeMatrix = graph.getAdjacencyMatrix()->copy();
+                graph.pullEdge(removeEdgeAction->getRemovedEdge().minVertex(),
+                               removeEdgeAction->getRemovedEdge().maxVertex());
+                _pool.push(workerId, FactoringTask{graph.getAdjacencyMatrix()->copy(),
+                                                   join, 1, task._depth + 1});
+                _pool.push(workerId, FactoringTask{removedEdgeMatrix,
+                                                   join, 0, task._depth + 1});
+            }
+
+            const ExecutionPolicy &_executionPolicy;
+            grph::utils::WorkStealingPool<FactoringTask> _pool;
+            const int _splitLevels;
+            std::vector<UndirectedRandomGraph> _replicas;
+            std::vector<IterativeFactoring> _drivers; // of each worker, the buffers are reused by its tasks
+        };
+
+        /// Serial factoring in the tasks and joins of ParallelFactoring, held in a FactoringCheckpoint that is
+        /// written every CheckpointPolicy::intervalSeconds and once more with the result, so a resume after
+        /// the end returns at once. The levels above splitDepth are tasks, a deeper subtree and the parts G1
+        /// of a separation pair are solved at once by IterativeFactoring, so the result is the one of
+        /// the serial factoring of the same graph.
+        class CheckpointedFactoring {
+        public:
+            CheckpointedFactoring(const CheckpointPolicy &checkpointPolicy, const ExecutionPolicy &executionPolicy)
+                    : _checkpointPolicy(checkpointPolicy), _executionPolicy(executionPolicy), _driver(executionPolicy) {}
+
+            std::optional<double> calculate(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) {
+                _checkpoint = FactoringCheckpoint();
+                _checkpoint.joins.push_back(FactoringCheckpoint::Join{.results = {0.}, .numPending = 1});
+                _checkpoint.tasks.push_back(FactoringCheckpoint::makeTask(adjacencyMatrix, 0, 0, 0));
+                return run();
+            }
+
+            std::optional<double> resume() {
+                _checkpoint = FactoringCheckpoint::read(_checkpointPolicy.path);
+                return run();
+            }
+
+        private:
+            std::optional<double> run() {
+                _freeJoins.clear();
+                for (int join = 1; join < static_cast<int>(_checkpoint.joins.size()); ++join) {
+                    if (_checkpoint.joins[join].numPending == 0) {
+                        _freeJoins.push_back(join);
+                    }
+                }
+
+                const auto start = std::chrono::steady_clock::now();
+                auto lastCheckpoint = start;
+                while (!_checkpoint.tasks.empty()) {
+                    auto task = std::move(_checkpoint.tasks.back());
+                    _checkpoint.tasks.pop_back();
+                    process(task);
+
+                    const auto now = std::chrono::steady_clock::now();
+                    if (!_checkpoint.tasks.empty() && std::chrono::duration<double>(now - start).count()
+                                                      >= _checkpointPolicy.timeBudgetSeconds) {
+                        _checkpoint.write(_checkpointPolicy.path);
+                        return std::nullopt;
+                    }
+                    if (std::chrono::duration<double>(now - lastCheckpoint).count() >= _checkpointPolicy.intervalSeconds) {
+                        _checkpoint.write(_checkpointPolicy.path);
+                        lastCheckpoint = now;
+                    }
+                }
+                _checkpoint.write(_checkpointPolicy.path);
+                return _checkpoint.R;
+            }
+
+            /// same steps as ParallelFactoring::processTask
+            void process(const FactoringCheckpoint::Task &task) {
+                const auto matrix = FactoringCheckpoint::makeMatrix(task);
+                _graph.setMatrixAndVector(matrix, DegreesVector::make(matrix));
+                if (task.depth > 0
+                    && (task.depth >= _checkpointPolicy.splitDepth || _graph.getNumVertexes() <= MIN_PARALLEL_DIMENSION)) {
+                    report(task.join, task.slot, _driver.calculate(_graph));
+                    return;
+                }
+
+                std::vector<double> chainFactors;
+                while (_graph.getNumVertexes() > COMPUTABLE_DIMENSION) {
+                    const auto reduceAction = _graph.reduceSeriesParallel();
+                    if (reduceAction->getNumReductions() > 0) {
+                        countStep(_executionPolicy, &FactoringStatistics::reductions);
+                        chainFactors.push_back(reduceAction->getReductionFactor());
+                        continue;
+                    }
+
+                    const auto blocks = _graph.findBlocks();
+                    if (!blocks.empty()) {
+                        countStep(_executionPolicy, &FactoringStatistics::blockSplits);
+                        const int numBlocks = static_cast<int>(blocks.size());
+                        const int join = makeJoin(FactoringCheckpoint::JoinKind::BLOCKS, numBlocks, task,
+                                                  std::move(chainFactors), 0.);
+                        for (int blockIdx = numBlocks - 1; blockIdx >= 0; --blockIdx) {
+                            _checkpoint.tasks.push_back(FactoringCheckpoint::makeTask(
+                                    *_graph.getSubgraphAdjacencyMatrix(blocks[blockIdx]), join, blockIdx, task.depth + 1));
+                        }
+                        return;
+                    }
+
+                    if (auto parts = findSeparationParts(_graph, 0.)) {
+                        countStep(_executionPolicy, &FactoringStatistics::separations);
+                        if (separateInPlace(_graph, _driver, *parts, chainFactors)) {
+                            continue;
+                        }
+                        FactoringCheckpoint::Join disconnected{.chainFactors = std::move(chainFactors), .results = {0.}};
+                        report(task.join, task.slot, disconnected.combine());
+                        return;
+                    }
+
+                    countStep(_executionPolicy, &FactoringStatistics::factoringSteps);
+                    const auto removeEdgeAction = _graph.removeEdge(
+                            PivotSelector::selectPivot(_graph, _executionPolicy.pivotStrategy));
+                    const int join = makeJoin(FactoringCheckpoint::JoinKind::EDGE_FACTORING, 2, task,
+                                              std::move(chainFactors), removeEdgeAction->getEdgeProbability());
+                    auto removedEdgeTask = FactoringCheckpoint::makeTask(*_graph.getAdjacencyMatrix(), join, 0,
+                                                                         task.depth + 1);
+                    _graph.pullEdge(removeEdgeAction->getRemovedEdge().minVertex(),
+                                    removeEdgeAction->getRemovedEdge().maxVertex());
+                    _checkpoint.tasks.push_back(FactoringCheckpoint::makeTask(*_graph.getAdjacencyMatrix(), join, 1,
+                                                                              task.depth + 1));
+                    _checkpoint.tasks.push_back(std::move(removedEdgeTask));
+                    return;
+                }
+                countStep(_executionPolicy, &FactoringStatistics::leaves);
+                FactoringCheckpoint::Join leaf{.chainFactors = std::move(chainFactors),
+                                               .results = {calculateComputableDimensionGraph(_graph)}};
+                report(task.join, task.slot, leaf.combine());
+            }
+
+            int makeJoin(FactoringCheckpoint::JoinKind kind, int numResults, const FactoringCheckpoint::Task &task,
+                         std::vector<double> &&chainFactors, double edgeProbability) {
+                FactoringCheckpoint::Join join{kind, edgeProbability, std::move(chainFactors),
+                                               std::vector<double>(numResults, 0.), numResults, task.join, task.slot};
+                if (_freeJoins.empty()) {
+                    _checkpoint.joins.push_back(std::move(join));
+                    return static_cast<int>(_checkpoint.joins.size()) - 1;
+                }
+                const int joinIdx = _freeJoins.back();
+                _freeJoins.pop_back();
+                _checkpoint.joins[joinIdx] = std::move(join);
+                return joinIdx;
+            }
+
+            void report(int joinIdx, int slot, double R) {
+                while (true) {
+                    auto &join = _checkpoint.joins[joinIdx];
+                    join.results[slot] = R;
+                    if (--join.numPending > 0) {
+                        return;
+                    }
+                    R = join.combine();
+                    if (join.kind == FactoringCheckpoint::JoinKind::ROOT) {
+                        _checkpoint.R = R;
+                        return;
+                    }
+                    slot = join.parentSlot;
+                    const int parent = join.parent;
+                    join.chainFactors.clear();
+                    join.results.clear();
+                    _freeJoins.push_back(joinIdx);
+                    joinIdx = parent;
+                }
+            }
+
+            const CheckpointPolicy &_checkpointPolicy;
+            const ExecutionPolicy &_executionPolicy;
+            IterativeFactoring _driver;
+            UndirectedRandomGraph _graph;
+            FactoringCheckpoint _checkpoint;
+            std::vector<int> _freeJoins; // slots of the finished joins
+        };
+
+        /// Factoring in passes with a falling weight threshold. The weight of a branch is the probability of
+        /// the path to it times the reduction factors; a branch lighter than the threshold is not factored but
+        /// bounded by ReliabilityBounds, so every finished pass gives valid bounds. A bridge is contracted
+        /// only, its removal disconnects the graph. A pass cut by the time budget is dropped, the bounds of
+        /// the last finished one are returned; the first pass is never cut.
+        class AnytimeFactoring {
+        public:
+            AnytimeFactoring(const AnytimePolicy &anytimePolicy, const ExecutionPolicy &executionPolicy)
+                    : _anytimePolicy(anytimePolicy), _executionPolicy(executionPolicy) {}
+
+            ATRBounds calculateBounds(IRandomGraph &graph) {
+                const auto start = std::chrono::steady_clock::now();
+                ATRBounds bounds;
+                for (double threshold = 1.; ; threshold /= ANYTIME_THRESHOLD_DIVISOR) {
+                    _threshold = threshold;
+                    _lowerBound = 0.;
+                    _upperBound = 0.;
+                    _boundedWeight = 0.;
+                    boundBranch(graph, 1.);
+                    if (_isCut) {
+                        break;
+                    }
+                    bounds = ATRBounds{_lowerBound, std::min(_upperBound, 1.), 1 - _boundedWeight};
+                    if (_boundedWeight == 0. || bounds.upperBound - bounds.lowerBound <= _anytimePolicy.targetGap) {
+                        break;
+                    }
+                    if (!_isTimed) {
+                        _isTimed = true;
+                        _deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                std::chrono::duration<double>(std::min(_anytimePolicy.timeBudgetSeconds, 1e9)));
+                    }
+                }
+                return bounds;
+            }
+
+        private:
+            void boundBranch(IRandomGraph &graph, double weight) {
+                if (_isCut) {
+                    return;
+                }
+                if (graph.getNumVertexes() <= COMPUTABLE_DIMENSION) {
+                    countStep(_executionPolicy, &FactoringStatistics::leaves);
+                    const double R = weight * calculateComputableDimensionGraph(graph);
+                    _lowerBound += R;
+                    _upperBound += R;
+                    return;
+                }
+                if (_isTimed && std::chrono::steady_clock::now() >= _deadline) {
+                    _isCut = true;
+                    return;
+                }
+
+                const auto &reduceAction = graph.reduceSeriesParallel();
+                if (reduceAction->getNumReductions() > 0) {
+                    countStep(_executionPolicy, &FactoringStatistics::reductions);
+                    boundBranch(graph, weight * reduceAction->getReductionFactor());
+                    reduceAction->rollback();
+                    return;
+                }
+                if (weight < _threshold) {
+                    const auto &matrix = *graph.getAdjacencyMatrix();
+                    _lowerBound += weight * ReliabilityBounds::calculateLowerBound(matrix);
+                    _upperBound += weight * ReliabilityBounds::calculateUpperBound(matrix);
+                    _boundedWeight += weight;
+                    return;
+                }
+
+                countStep(_executionPolicy, &FactoringStatistics::factoringSteps);
+                const auto &removeEdgeAction = graph.removeEdge(
+                        PivotSelector::selectPivot(graph, _executionPolicy.pivotStrategy));
+                const double p = removeEdgeAction->getEdgeProbability();
+                // a bridge leaves the removed branch disconnected
+                if (!graph.isBridge(removeEdgeAction->getRemovedEdge(), _bridgeSide)) {
+                    boundBranch(graph, weight * (1 - p));
+                }
+                const auto &pullAction = graph.pullEdge(removeEdgeAction->getRemovedEdge().minVertex(),
+                                                        removeEdgeAction->getRemovedEdge().maxVertex());
+                boundBranch(graph, weight * p);
+                pullAction->rollback();
+                removeEdgeAction->rollback();
+            }
+
+            const AnytimePolicy &_anytimePolicy;
+            const ExecutionPolicy &_executionPolicy;
+            double _threshold = 1.;
+            double _lowerBound = 0.;
+            double _upperBound = 0.;
+            double _boundedWeight = 0.; // of the branches left to the bounds
+            std::vector<char> _bridgeSide; // buffer of isBridge
+            bool _isTimed = false;
+            bool _isCut = false;
+            std::chrono::steady_clock::time_point _deadline;
+        };
     };
 
 }
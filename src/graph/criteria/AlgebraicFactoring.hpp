@@ -0,0 +1,129 @@
+#ifndef GRPH_ALGEBRAICFACTORING_HPP
+#define GRPH_ALGEBRAICFACTORING_HPP
+
+#include <memory>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+
+namespace grph::graph::random {
+
+    /// value of AdjacencyMatrix for the algebraic factoring: weights of the states of an edge,
+    /// up + down is not normalized, so the series reduction needs no division
+    template<typename Value>
+    struct EdgeWeights {
+        Value up;
+        Value down;
+
+        bool operator==(const EdgeWeights &other) const = default;
+    };
+
+    /// ATR in any commutative semiring given by Algebra (zero, one, add, multiply); the same steps as
+    /// the factoring of ATR: series-parallel reduction, factoring on an edge of a vertex with the lowest degree
+    template<typename Algebra>
+    class AlgebraicFactoring {
+    public:
+        using Value = typename Algebra::Value;
+        using Weights = EdgeWeights<Value>;
+
+        explicit AlgebraicFactoring(Algebra &algebra) : _algebra(algebra) {}
+
+        /// the matrix is changed
+        Value calculate(const std::shared_ptr<AdjacencyMatrix<Weights>> &matrix) {
+            auto R = _algebra.one();
+            while (matrix->getDimension() > 1) {
+                const int vertex = findVertexWithLowestDegree(*matrix);
+                const int degree = calculateDegree(*matrix, vertex);
+                if (degree == 0) {
+                    return _algebra.zero();
+                } else if (degree == 1) { // the hanging edge must be up
+                    const int neighbor = matrix->findNeighborWithBiggestNumFor(vertex);
+                    R = _algebra.multiply(R, matrix->at(vertex, neighbor).up);
+                    removeVertex(*matrix, vertex);
+                } else if (degree == 2) {
+                    const int neighbor1 = matrix->findNeighborWithLowestNumFor(vertex);
+                    const int neighbor2 = matrix->findNeighborWithBiggestNumFor(vertex);
+                    const auto edge1 = matrix->at(vertex, neighbor1);
+                    const auto edge2 = matrix->at(vertex, neighbor2);
+                    // both down - the vertex is isolated, so that state is dropped
+                    addParallelEdge(*matrix, neighbor1, neighbor2,
+                                    Weights{_algebra.multiply(edge1.up, edge2.up),
+                                            _algebra.add(_algebra.multiply(edge1.up, edge2.down),
+                                                         _algebra.multiply(edge1.down, edge2.up))});
+                    removeVertex(*matrix, vertex);
+                } else {
+                    return _algebra.multiply(R, factorOnEdge(matrix, vertex,
+                                                             matrix->findNeighborWithBiggestNumFor(vertex)));
+                }
+            }
+            return R;
+        }
+
+    private:
+        Value factorOnEdge(const std::shared_ptr<AdjacencyMatrix<Weights>> &matrix, int vertex, int neighbor) {
+            const auto pivot = matrix->at(vertex, neighbor);
+
+            const auto contracted = matrix->copy();
+            contracted->removeEdge(Edge{vertex, neighbor});
+            for (int otherVertex = 0; otherVertex < contracted->getDimension(); ++otherVertex) {
+                if (otherVertex != vertex && contracted->isConnected(vertex, otherVertex)) {
+                    addParallelEdge(*contracted, neighbor, otherVertex, contracted->at(vertex, otherVertex));
+                }
+            }
+            removeVertex(*contracted, vertex);
+            const auto contractedR = calculate(contracted);
+
+            matrix->removeEdge(Edge{vertex, neighbor});
+            return _algebra.add(_algebra.multiply(pivot.up, contractedR),
+                                _algebra.multiply(pivot.down, calculate(matrix)));
+        }
+
+        void addParallelEdge(AdjacencyMatrix<Weights> &matrix, int vertex1, int vertex2, const Weights &edge) {
+            if (!matrix.isConnected(vertex1, vertex2)) {
+                matrix.addEdge(vertex1, vertex2, edge);
+                return;
+            }
+            const auto curEdge = matrix.at(vertex1, vertex2);
+            const auto up = _algebra.add(_algebra.multiply(curEdge.up, edge.up),
+                                         _algebra.add(_algebra.multiply(curEdge.up, edge.down),
+                                                      _algebra.multiply(curEdge.down, edge.up)));
+            matrix.addEdge(vertex1, vertex2, Weights{up, _algebra.multiply(curEdge.down, edge.down)});
+        }
+
+        static void removeVertex(AdjacencyMatrix<Weights> &matrix, int vertex) {
+            for (int otherVertex = 0; otherVertex < matrix.getDimension(); ++otherVertex) {
+                if (otherVertex != vertex && matrix.isConnected(vertex, otherVertex)) {
+                    matrix.removeEdge(Edge{vertex, otherVertex});
+                }
+            }
+            matrix.renumberPairOfVertices(vertex, matrix.getDimension() - 1);
+            matrix.removeLastVertex();
+        }
+
+        static int calculateDegree(const AdjacencyMatrix<Weights> &matrix, int vertex) {
+            int degree = 0;
+            for (int otherVertex = 0; otherVertex < matrix.getDimension(); ++otherVertex) {
+                degree += otherVertex != vertex && matrix.isConnected(vertex, otherVertex);
+            }
+            return degree;
+        }
+
+        static int findVertexWithLowestDegree(const AdjacencyMatrix<Weights> &matrix) {
+            int vertexWithLowestDegree = 0;
+            int lowestDegree = matrix.getDimension();
+            for (int vertex = 0; vertex < matrix.getDimension(); ++vertex) {
+                const int degree = calculateDegree(matrix, vertex);
+                if (degree < lowestDegree) {
+                    vertexWithLowestDegree = vertex;
+                    lowestDegree = degree;
+                }
+            }
+            return vertexWithLowestDegree;
+        }
+
+        Algebra &_algebra;
+    };
+
+}
+
+#endif //GRPH_ALGEBRAICFACTORING_HPP
@@ -0,0 +1,362 @@
+#ifndef GRPH_ARITHMETICCIRCUIT_HPP
+#define GRPH_ARITHMETICCIRCUIT_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+#include "AlgebraicFactoring.hpp"
+
+#define CIRCUIT_BATCH_SIZE 16
+
+namespace grph::graph::random {
+
+    /// ATR of a fixed topology as a straight-line program over the edge probabilities: the factoring is
+    /// done once, then the program is evaluated for any number of probability vectors. The program has
+    /// no division and no subtraction except 1 - p, so there is no cancellation.
+    class ArithmeticCircuit {
+    public:
+        enum class Operation : uint8_t {
+            CONSTANT, // operand1 - the value
+            INPUT, // operand1 - index of the edge
+            COMPLEMENT, // 1 - operand1
+            ADD,
+            MULTIPLY
+        };
+
+        struct Instruction {
+            Operation operation;
+            int result; // slot
+            int operand1;
+            int operand2;
+        };
+
+        /// values of the matrix are ignored, only its edges are used
+        static ArithmeticCircuit compile(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) {
+            ArithmeticCircuit circuit;
+            const int dimension = adjacencyMatrix.getDimension();
+            auto matrix = std::make_shared<AdjacencyMatrix<EdgeWeights<int>>>(dimension);
+            Builder builder;
+            for (int lineIdx = 0; lineIdx < dimension; ++lineIdx) {
+                for (int columnIdx = lineIdx + 1; columnIdx < dimension; ++columnIdx) {
+                    if (adjacencyMatrix.isConnected(lineIdx, columnIdx)) {
+                        const int input = builder.input(static_cast<int>(circuit._edges.size()));
+                        matrix->addEdge(lineIdx, columnIdx, EdgeWeights<int>{input, builder.complement(input)});
+                        circuit._edges.emplace_back(lineIdx, columnIdx);
+                    }
+                }
+            }
+            const int output = AlgebraicFactoring<Builder>(builder).calculate(matrix);
+            circuit.allocateSlots(builder._nodes, output);
+            return circuit;
+        }
+
+        /// inputs of the program in the order of the probability vectors
+        const std::vector<Edge> &getEdges() const {
+            return _edges;
+        }
+
+        const std::vector<Instruction> &getInstructions() const {
+            return _instructions;
+        }
+
+        /// instructions of the operands of each instruction, -1 for CONSTANT and INPUT
+        const std::vector<std::pair<int, int>> &getSources() const {
+            return _sources;
+        }
+
+        double evaluate(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) const {
+            std::vector<EdgeProbability> probabilities;
+            for (const auto &edge: _edges) {
+                probabilities.push_back(adjacencyMatrix.at(edge.minVertex(), edge.maxVertex()));
+            }
+            return evaluate(std::vector<std::vector<EdgeProbability>>{probabilities})[0];
+        }
+
+        /// ATR and its derivatives by the probabilities of getEdges() (Birnbaum importances):
+        /// one pass over the program forward and one backward
+        double evaluateGradient(const std::vector<EdgeProbability> &probabilities, std::vector<double> &gradient) const {
+            const int numInstructions = static_cast<int>(_instructions.size());
+            std::vector<double> values(numInstructions);
+            for (int instructionIdx = 0; instructionIdx < numInstructions; ++instructionIdx) {
+                const auto &instruction = _instructions[instructionIdx];
+                const auto [source1, source2] = _sources[instructionIdx];
+                switch (instruction.operation) {
+                    case Operation::CONSTANT:
+                        values[instructionIdx] = instruction.operand1;
+                        break;
+                    case Operation::INPUT:
+                        values[instructionIdx] = probabilities[instruction.operand1];
+                        break;
+                    case Operation::COMPLEMENT:
+                        values[instructionIdx] = 1 - values[source1];
+                        break;
+                    case Operation::ADD:
+                        values[instructionIdx] = values[source1] + values[source2];
+                        break;
+                    case Operation::MULTIPLY:
+                        values[instructionIdx] = values[source1] * values[source2];
+                        break;
+                }
+            }
+
+            std::vector<double> adjoints(numInstructions, 0.); // dR / d(value of the instruction)
+            adjoints.back() = 1.;
+            gradient.assign(_edges.size(), 0.);
+            for (int instructionIdx = numInstructions - 1; instructionIdx >= 0; --instructionIdx) {
+                const double adjoint = adjoints[instructionIdx];
+                const auto [source1, source2] = _sources[instructionIdx];
+                switch (_instructions[instructionIdx].operation) {
+                    case Operation::CONSTANT:
+                        break;
+                    case Operation::INPUT:
+                        gradient[_instructions[instructionIdx].operand1] += adjoint;
+                        break;
+                    case Operation::COMPLEMENT:
+                        adjoints[source1] -= adjoint;
+                        break;
+                    case Operation::ADD:
+                        adjoints[source1] += adjoint;
+                        adjoints[source2] += adjoint;
+                        break;
+                    case Operation::MULTIPLY:
+                        adjoints[source1] += adjoint * values[source2];
+                        adjoints[source2] += adjoint * values[source1];
+                        break;
+                }
+            }
+            return values.back();
+        }
+
+        /// ATR for each vector of probabilities of getEdges(); the vectors are evaluated in batches,
+        /// each instruction is a loop over the batch, which the compiler vectorizes
+        std::vector<double> evaluate(const std::vector<std::vector<EdgeProbability>> &probabilityVectors) const {
+            std::vector<double> R(probabilityVectors.size());
+            std::vector<double> slots(static_cast<size_t>(_numSlots) * CIRCUIT_BATCH_SIZE);
+            for (size_t batchBegin = 0; batchBegin < probabilityVectors.size(); batchBegin += CIRCUIT_BATCH_SIZE) {
+                const size_t batchSize = std::min<size_t>(CIRCUIT_BATCH_SIZE, probabilityVectors.size() - batchBegin);
+                for (const auto &instruction: _instructions) {
+                    // operands are slots only for the operations on values, for CONSTANT and INPUT they are not
+                    double *result = slot(slots, instruction.result);
+                    switch (instruction.operation) {
+                        case Operation::CONSTANT:
+                            std::fill_n(result, CIRCUIT_BATCH_SIZE, instruction.operand1);
+                            break;
+                        case Operation::INPUT:
+                            for (size_t lane = 0; lane < CIRCUIT_BATCH_SIZE; ++lane) {
+                                result[lane] = lane < batchSize
+                                               ? probabilityVectors[batchBegin + lane][instruction.operand1]
+                                               : 0.;
+                            }
+                            break;
+                        case Operation::COMPLEMENT: {
+                            const double *operand1 = slot(slots, instruction.operand1);
+                            for (int lane = 0; lane < CIRCUIT_BATCH_SIZE; ++lane) {
+                                result[lane] = 1 - operand1[lane];
+                            }
+                            break;
+                        }
+                        case Operation::ADD: {
+                            const double *operand1 = slot(slots, instruction.operand1);
+                            const double *operand2 = slot(slots, instruction.operand2);
+                            for (int lane = 0; lane < CIRCUIT_BATCH_SIZE; ++lane) {
+                                result[lane] = operand1[lane] + operand2[lane];
+                            }
+                            break;
+                        }
+                        case Operation::MULTIPLY: {
+                            const double *operand1 = slot(slots, instruction.operand1);
+                            const double *operand2 = slot(slots, instruction.operand2);
+                            for (int lane = 0; lane < CIRCUIT_BATCH_SIZE; ++lane) {
+                                result[lane] = operand1[lane] * operand2[lane];
+                            }
+                            break;
+                        }
+                    }
+                }
+                std::copy_n(slot(slots, _outputSlot), batchSize, &R[batchBegin]);
+            }
+            return R;
+        }
+
+    private:
+        struct Node {
+            Operation operation;
+            int operand1;
+            int operand2;
+        };
+
+        /// algebra of AlgebraicFactoring: a value is a node, equal nodes are shared
+        class Builder {
+        public:
+            using Value = int;
+
+            Builder() {
+                _nodes.push_back(Node{Operation::CONSTANT, 0, 0});
+                _nodes.push_back(Node{Operation::CONSTANT, 1, 0});
+            }
+
+            Value zero() const {
+                return ZERO_NODE;
+            }
+
+            Value one() const {
+                return ONE_NODE;
+            }
+
+            Value input(int edgeIdx) {
+                return addNode(Operation::INPUT, edgeIdx, 0);
+            }
+
+            Value complement(Value value) {
+                return addNode(Operation::COMPLEMENT, value, value);
+            }
+
+            Value add(Value value1, Value value2) {
+                if (value1 == ZERO_NODE) {
+                    return value2;
+                } else if (value2 == ZERO_NODE) {
+                    return value1;
+                }
+                return addNode(Operation::ADD, std::min(value1, value2), std::max(value1, value2));
+            }
+
+            Value multiply(Value value1, Value value2) {
+                if (value1 == ZERO_NODE || value2 == ZERO_NODE) {
+                    return ZERO_NODE;
+                } else if (value1 == ONE_NODE) {
+                    return value2;
+                } else if (value2 == ONE_NODE) {
+                    return value1;
+                }
+                return addNode(Operation::MULTIPLY, std::min(value1, value2), std::max(value1, value2));
+            }
+
+        private:
+            friend class ArithmeticCircuit;
+
+            static constexpr int ZERO_NODE = 0;
+            static constexpr int ONE_NODE = 1;
+
+            /// open addressing, the key of a node is never 0 since its operation is not CONSTANT
+            Value addNode(Operation operation, int operand1, int operand2) {
+                if (2 * _nodes.size() >= _indexKeys.size()) {
+                    rehash(std::max<size_t>(2 * _indexKeys.size(), 1024));
+                }
+                const uint64_t key = static_cast<uint64_t>(operation) << 60
+                                     | static_cast<uint64_t>(operand1) << 30
+                                     | static_cast<uint64_t>(operand2);
+                size_t position = findPosition(key);
+                if (_indexKeys[position] == 0) {
+                    _indexKeys[position] = key;
+                    _indexNodes[position] = static_cast<int>(_nodes.size());
+                    _nodes.push_back(Node{operation, operand1, operand2});
+                }
+                return _indexNodes[position];
+            }
+
+            size_t findPosition(uint64_t key) const {
+                const size_t mask = _indexKeys.size() - 1;
+                size_t position = (key * 0x9e3779b97f4a7c15ULL) >> 20 & mask;
+                while (_indexKeys[position] != 0 && _indexKeys[position] != key) {
+                    position = (position + 1) & mask;
+                }
+                return position;
+            }
+
+            void rehash(size_t size) {
+                auto keys = std::move(_indexKeys);
+                auto nodes = std::move(_indexNodes);
+                _indexKeys.assign(size, 0);
+                _indexNodes.assign(size, 0);
+                for (size_t position = 0; position < keys.size(); ++position) {
+                    if (keys[position] != 0) {
+                        const size_t newPosition = findPosition(keys[position]);
+                        _indexKeys[newPosition] = keys[position];
+                        _indexNodes[newPosition] = nodes[position];
+                    }
+                }
+            }
+
+            std::vector<Node> _nodes;
+            std::vector<uint64_t> _indexKeys; // size is a power of two
+            std::vector<int> _indexNodes;
+        };
+
+        static bool hasOperands(Operation operation) {
+            return operation == Operation::COMPLEMENT || operation == Operation::ADD
+                   || operation == Operation::MULTIPLY;
+        }
+
+        /// lanes of a slot in the batched evaluation
+        static double *slot(std::vector<double> &slots, int slotIdx) {
+            return slots.data() + static_cast<size_t>(slotIdx) * CIRCUIT_BATCH_SIZE;
+        }
+
+        /// drops the nodes the output does not depend on and gives the nodes slots, a slot is reused after
+        /// the last use of its node
+        void allocateSlots(const std::vector<Node> &nodes, int output) {
+            std::vector<bool> isUsed(nodes.size(), false);
+            isUsed[output] = true;
+            std::vector<int> lastUse(nodes.size(), -1);
+            lastUse[output] = static_cast<int>(nodes.size());
+            for (int node = output; node >= 0; --node) {
+                if (!isUsed[node] || !hasOperands(nodes[node].operation)) {
+                    continue;
+                }
+                for (int operand: {nodes[node].operand1, nodes[node].operand2}) {
+                    isUsed[operand] = true;
+                    lastUse[operand] = std::max(lastUse[operand], node);
+                }
+            }
+
+            std::vector<int> slot(nodes.size(), -1);
+            std::vector<int> instructionIdx(nodes.size(), -1);
+            std::vector<int> freeSlots;
+            for (int node = 0; node <= output; ++node) {
+                if (!isUsed[node]) {
+                    continue;
+                }
+                const auto &[operation, operand1, operand2] = nodes[node];
+                Instruction instruction{operation, 0, operand1, operand2};
+                if (hasOperands(operation)) {
+                    _sources.emplace_back(instructionIdx[operand1], instructionIdx[operand2]);
+                    instruction.operand1 = slot[operand1];
+                    instruction.operand2 = slot[operand2];
+                    for (int operand: {operand1, operand2}) {
+                        if (lastUse[operand] == node && slot[operand] >= 0) {
+                            freeSlots.push_back(slot[operand]);
+                            slot[operand] = -1;
+                        }
+                    }
+                } else {
+                    _sources.emplace_back(-1, -1);
+                }
+                if (freeSlots.empty()) {
+                    instruction.result = _numSlots++;
+                } else {
+                    instruction.result = freeSlots.back();
+                    freeSlots.pop_back();
+                }
+                slot[node] = instruction.result;
+                instructionIdx[node] = static_cast<int>(_instructions.size());
+                _instructions.push_back(instruction);
+            }
+            _outputSlot = slot[output];
+        }
+
+        std::vector<Edge> _edges;
+        std::vector<Instruction> _instructions;
+        std::vector<std::pair<int, int>> _sources; // instructions of the operands
+        int _numSlots = 0;
+        int _outputSlot = 0;
+    };
+
+}
+
+#endif //GRPH_ARITHMETICCIRCUIT_HPP
@@ -0,0 +1,148 @@
+#ifndef GRPH_BINARYDECISIONDIAGRAM_HPP
+#define GRPH_BINARYDECISIONDIAGRAM_HPP
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+#include "EdgeOrdering.hpp"
+#include "Frontier.hpp"
+
+#define BDD_FALSE 0
+#define BDD_TRUE 1
+
+namespace grph::graph::random {
+
+    /// Reduced ordered BDD of "the graph is connected" over its edges. It is built top-down level by level:
+    /// a node is a state of the Frontier, equal states of a level are one node (the computed cache of the
+    /// level is FrontierStates). Then bottom-up the nodes with equal children are dropped and equal
+    /// (edge, low, high) are merged by the unique table; the nodes are stored in that order, children first,
+    /// so ATR is one pass over the node arena. The size grows exponentially only in the frontier width.
+    class BinaryDecisionDiagram {
+    public:
+        static BinaryDecisionDiagram build(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix,
+                                           EdgeOrdering edgeOrdering) {
+            return build(adjacencyMatrix.getDimension(), EdgeOrderer::orderEdges(adjacencyMatrix, edgeOrdering));
+        }
+
+        /// the edges in the order of the levels, the first one is tested at the root
+        static BinaryDecisionDiagram build(int numVertexes, const std::vector<Edge> &edges) {
+            BinaryDecisionDiagram bdd(edges);
+            if (edges.empty()) {
+                bdd._root = numVertexes <= 1 ? BDD_TRUE : BDD_FALSE;
+                return bdd;
+            }
+
+            const Frontier frontier(numVertexes, edges);
+            const int numLevels = frontier.getNumLevels();
+            // children of the states of each level: a state of the next level or a terminal
+            std::vector<std::vector<std::pair<int, int>>> levelChildren(numLevels);
+            FrontierStates states;
+            FrontierStates nextStates;
+            std::vector<uint8_t> labels(MAX_FRONTIER_WIDTH);
+            states.reset(frontier.getWidth(0));
+            frontier.writeInitialState(labels.data());
+            states.insert(labels.data());
+            for (int level = 0; level < numLevels; ++level) {
+                nextStates.reset(frontier.getWidth(level + 1));
+                auto &children = levelChildren[level];
+                children.resize(states.size());
+                for (int state = 0; state < states.size(); ++state) {
+                    children[state].first = findChild(frontier, level, states.at(state), false, nextStates, labels);
+                    children[state].second = findChild(frontier, level, states.at(state), true, nextStates, labels);
+                }
+                std::swap(states, nextStates);
+            }
+
+            std::vector<int> nextNodes; // nodes of the states of the next level
+            std::vector<int> nodes;
+            std::unordered_map<uint64_t, int> uniqueTable;
+            for (int level = numLevels - 1; level >= 0; --level) {
+                auto &children = levelChildren[level];
+                nodes.resize(children.size());
+                uniqueTable.clear();
+                for (int state = 0; state < static_cast<int>(children.size()); ++state) {
+                    const int low = toNode(children[state].first, nextNodes);
+                    const int high = toNode(children[state].second, nextNodes);
+                    if (low == high) {
+                        nodes[state] = low;
+                        continue;
+                    }
+                    const auto key = static_cast<uint64_t>(low) << 32 | static_cast<uint32_t>(high);
+                    const auto [found, isNew] = uniqueTable.try_emplace(key, static_cast<int>(bdd._nodes.size()));
+                    if (isNew) {
+                        bdd._nodes.push_back(Node{level, low, high});
+                    }
+                    nodes[state] = found->second;
+                }
+                std::vector<std::pair<int, int>>().swap(children);
+                std::swap(nodes, nextNodes);
+            }
+            bdd._root = nextNodes[0];
+            return bdd;
+        }
+
+        const std::vector<Edge> &getEdges() const {
+            return _edges;
+        }
+
+        /// with the two terminals
+        int getNumNodes() const {
+            return static_cast<int>(_nodes.size());
+        }
+
+        /// ATR for the probabilities of the matrix, the same vertexes as the built one
+        double evaluate(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) const {
+            std::vector<double> R(_nodes.size());
+            R[BDD_TRUE] = 1.;
+            for (int nodeIdx = BDD_TRUE + 1; nodeIdx < static_cast<int>(_nodes.size()); ++nodeIdx) {
+                const auto &node = _nodes[nodeIdx];
+                const auto &edge = _edges[node.level];
+                const double p = adjacencyMatrix.at(edge.minVertex(), edge.maxVertex());
+                R[nodeIdx] = (1 - p) * R[node.low] + p * R[node.high];
+            }
+            return R[_root];
+        }
+
+    private:
+        /// the edge of the level is down in low and up in high
+        struct Node {
+            int level;
+            int low;
+            int high;
+        };
+
+        /// terminals as children of the states
+        static constexpr int FALSE_CHILD = -1 - BDD_FALSE;
+        static constexpr int TRUE_CHILD = -1 - BDD_TRUE;
+
+        explicit BinaryDecisionDiagram(const std::vector<Edge> &edges)
+                : _edges(edges), _nodes{Node{-1, BDD_FALSE, BDD_FALSE}, Node{-1, BDD_TRUE, BDD_TRUE}} {}
+
+        static int findChild(const Frontier &frontier, int level, const uint8_t *labels, bool isUp,
+                             FrontierStates &nextStates, std::vector<uint8_t> &nextLabels) {
+            switch (frontier.transition(level, labels, isUp, nextLabels.data())) {
+                case Frontier::Outcome::CONNECTED:
+                    return TRUE_CHILD;
+                case Frontier::Outcome::DISCONNECTED:
+                    return FALSE_CHILD;
+                default:
+                    return nextStates.insert(nextLabels.data()).first;
+            }
+        }
+
+        static int toNode(int child, const std::vector<int> &nextNodes) {
+            return child < 0 ? -1 - child : nextNodes[child];
+        }
+
+        std::vector<Edge> _edges;
+        std::vector<Node> _nodes; // children before parents
+        int _root = BDD_FALSE;
+    };
+
+}
+
+#endif //GRPH_BINARYDECISIONDIAGRAM_HPP
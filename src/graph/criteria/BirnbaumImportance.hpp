@@ -0,0 +1,273 @@
+#ifndef GRPH_BIRNBAUMIMPORTANCE_HPP
+#define GRPH_BIRNBAUMIMPORTANCE_HPP
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+#include "BlockDecomposition.hpp"
+#include "ClosedForms.hpp"
+
+#define MIN_GRADIENT_LEAF_DIMENSION 6
+#define MAX_GRADIENT_LEAF_DIMENSION 7
+
+namespace grph::graph::random {
+
+    /// value of AdjacencyMatrix for the differentiation: probability of the edge and its record on the tape
+    struct TracedProbability {
+        EdgeProbability p;
+        int record;
+
+        bool operator==(const TracedProbability &other) const = default;
+    };
+
+    /// ATR and dR/dp of every edge (Birnbaum importance) by reverse-mode differentiation of the factoring:
+    /// series-parallel reduction, the product of the blocks, factoring on an edge of a vertex with the lowest
+    /// degree, closed forms with the gradient for the leaves of 6..7 vertexes.
+    /// The adjoint of a subgraph, dR/dR(subgraph), is known before the subgraph is calculated (the product of
+    /// the chain factors and probabilities of the pivot edges above it), so the adjoints go down with the
+    /// recursion. A probability made by a reduction is a record on the tape; the records of a step are
+    /// propagated to their operands and popped when the step returns, so the tape is as deep as the recursion.
+    class BirnbaumImportance {
+    public:
+        /// the importance of every edge of the input, line by line as ArithmeticCircuit::getEdges()
+        static std::pair<double, std::vector<std::pair<Edge, double>>> calculate(
+                const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) {
+            const int dimension = adjacencyMatrix.getDimension();
+            BirnbaumImportance birnbaumImportance;
+            auto matrix = std::make_shared<AdjacencyMatrix<TracedProbability>>(dimension);
+            for (int vertex1 = 0; vertex1 < dimension; ++vertex1) {
+                for (int vertex2 = vertex1 + 1; vertex2 < dimension; ++vertex2) {
+                    if (adjacencyMatrix.isConnected(vertex1, vertex2)) {
+                        const int input = birnbaumImportance.record(-1, 0., -1, 0.);
+                        matrix->addEdge(vertex1, vertex2, TracedProbability{adjacencyMatrix.at(vertex1, vertex2), input});
+                    }
+                }
+            }
+
+            const double R = dimension == 0 ? 0. : birnbaumImportance.calculate(matrix, 1.);
+            // the inputs are the first records of the tape, in the order of the edges
+            std::vector<std::pair<Edge, double>> importance;
+            for (int vertex1 = 0; vertex1 < dimension; ++vertex1) {
+                for (int vertex2 = vertex1 + 1; vertex2 < dimension; ++vertex2) {
+                    if (adjacencyMatrix.isConnected(vertex1, vertex2)) {
+                        const int input = static_cast<int>(importance.size());
+                        importance.emplace_back(Edge(vertex1, vertex2), birnbaumImportance._tape[input].adjoint);
+                    }
+                }
+            }
+            return {R, importance};
+        }
+
+    private:
+        /// value = f(operand1, operand2) with the partial derivatives at the values of the operands
+        struct Record {
+            int operand1;
+            double partial1;
+            int operand2;
+            double partial2;
+            double adjoint;
+        };
+
+        struct LeafMatrix {
+            const AdjacencyMatrix<TracedProbability> &_matrix;
+
+            double at(int lineIdx, int columnIdx) const {
+                return _matrix.at(lineIdx, columnIdx).p;
+            }
+        };
+
+        /// R of the matrix, adds adjoint * dR/dp to the records of its edges; the matrix is changed
+        double calculate(const std::shared_ptr<AdjacencyMatrix<TracedProbability>> &matrix, double adjoint) {
+            const size_t tapeMark = _tape.size();
+            std::vector<TracedProbability> factors; // chain factors and hanging edges, R = product * rest
+            double factorsProduct = 1.;
+            double rest = 1.;
+            while (matrix->getDimension() > 1) {
+                const int dimension = matrix->getDimension();
+                const int vertex = findVertexWithLowestDegree(*matrix);
+                const int degree = calculateDegree(*matrix, vertex);
+                if (degree == 0) {
+                    _tape.resize(tapeMark);
+                    return 0.;
+                } else if (degree == 1) {
+                    factors.push_back(matrix->at(vertex, matrix->findNeighborWithBiggestNumFor(vertex)));
+                    factorsProduct *= factors.back().p;
+                    removeVertex(*matrix, vertex);
+                } else if (degree == 2) {
+                    const int neighbor1 = matrix->findNeighborWithLowestNumFor(vertex);
+                    const int neighbor2 = matrix->findNeighborWithBiggestNumFor(vertex);
+                    const auto [p1, record1] = matrix->at(vertex, neighbor1);
+                    const auto [p2, record2] = matrix->at(vertex, neighbor2);
+                    // the chain factor and the probability of the edge replacing the chain
+                    const double chainFactor = p1 + p2 - p1 * p2;
+                    factors.push_back(TracedProbability{chainFactor, record(record1, 1 - p2, record2, 1 - p1)});
+                    factorsProduct *= chainFactor;
+                    const double squaredFactor = chainFactor * chainFactor;
+                    const double p = p1 * p2 / chainFactor;
+                    addParallelEdge(*matrix, neighbor1, neighbor2, TracedProbability{
+                            p, record(record1, p2 * p2 / squaredFactor, record2, p1 * p1 / squaredFactor)});
+                    removeVertex(*matrix, vertex);
+                } else if (dimension >= MIN_GRADIENT_LEAF_DIMENSION && dimension <= MAX_GRADIENT_LEAF_DIMENSION) {
+                    rest = calculateLeaf(*matrix, adjoint * factorsProduct);
+                    break;
+                } else {
+                    const auto blocks = BlockDecomposition::findBlocks(*matrix);
+                    rest = blocks.empty() ? factorOnEdge(matrix, vertex, matrix->findNeighborWithBiggestNumFor(vertex),
+                                                         adjoint * factorsProduct)
+                                          : calculateBlocks(*matrix, blocks, adjoint * factorsProduct);
+                    break;
+                }
+            }
+
+            // dR/d(factor) = rest * product of the other factors
+            std::vector<double> prefixProducts(factors.size() + 1, 1.);
+            for (size_t factorIdx = 0; factorIdx < factors.size(); ++factorIdx) {
+                prefixProducts[factorIdx + 1] = prefixProducts[factorIdx] * factors[factorIdx].p;
+            }
+            double suffixProduct = rest;
+            for (size_t factorIdx = factors.size(); factorIdx-- > 0;) {
+                _tape[factors[factorIdx].record].adjoint += adjoint * prefixProducts[factorIdx] * suffixProduct;
+                suffixProduct *= factors[factorIdx].p;
+            }
+
+            for (size_t recordIdx = _tape.size(); recordIdx-- > tapeMark;) {
+                const auto &derived = _tape[recordIdx];
+                _tape[derived.operand1].adjoint += derived.adjoint * derived.partial1;
+                _tape[derived.operand2].adjoint += derived.adjoint * derived.partial2;
+            }
+            _tape.resize(tapeMark);
+            return factorsProduct * rest;
+        }
+
+        double factorOnEdge(const std::shared_ptr<AdjacencyMatrix<TracedProbability>> &matrix, int vertex,
+                            int neighbor, double adjoint) {
+            const auto [p, pivotRecord] = matrix->at(vertex, neighbor);
+
+            const auto contracted = matrix->copy();
+            contracted->removeEdge(Edge{vertex, neighbor});
+            for (int otherVertex = 0; otherVertex < contracted->getDimension(); ++otherVertex) {
+                if (otherVertex != vertex && contracted->isConnected(vertex, otherVertex)) {
+                    addParallelEdge(*contracted, neighbor, otherVertex, contracted->at(vertex, otherVertex));
+                }
+            }
+            removeVertex(*contracted, vertex);
+            const double contractedR = calculate(contracted, adjoint * p);
+
+            matrix->removeEdge(Edge{vertex, neighbor});
+            const double removedR = calculate(matrix, adjoint * (1 - p));
+            _tape[pivotRecord].adjoint += adjoint * (contractedR - removedR);
+            return p * contractedR + (1 - p) * removedR;
+        }
+
+        /// R is the product of R of the blocks and the adjoint of a block is adjoint * R of the other blocks, so
+        /// a block is calculated with the adjoint 1 first; the blocks have no common edges, so what a block adds
+        /// to the records of its edges is its own and is scaled once R of all blocks are known
+        double calculateBlocks(const AdjacencyMatrix<TracedProbability> &matrix,
+                               const std::vector<std::vector<int>> &blocks, double adjoint) {
+            const int numBlocks = static_cast<int>(blocks.size());
+            std::vector<double> blocksR(numBlocks);
+            std::vector<std::pair<int, double>> edgesAdjoints; // record of each edge and its adjoint before
+            std::vector<int> firstEdges(numBlocks + 1, 0); // of each block in edgesAdjoints
+            for (int blockIdx = 0; blockIdx < numBlocks; ++blockIdx) {
+                const auto blockMatrix = BlockDecomposition::makeBlockMatrix(matrix, blocks[blockIdx]);
+                for (int vertex1 = 0; vertex1 < blockMatrix->getDimension(); ++vertex1) {
+                    for (int vertex2 = vertex1 + 1; vertex2 < blockMatrix->getDimension(); ++vertex2) {
+                        if (blockMatrix->isConnected(vertex1, vertex2)) {
+                            const int edgeRecord = blockMatrix->at(vertex1, vertex2).record;
+                            edgesAdjoints.emplace_back(edgeRecord, _tape[edgeRecord].adjoint);
+                        }
+                    }
+                }
+                firstEdges[blockIdx + 1] = static_cast<int>(edgesAdjoints.size());
+                blocksR[blockIdx] = calculate(blockMatrix, 1.);
+            }
+
+            std::vector<double> prefixProducts(numBlocks + 1, 1.);
+            for (int blockIdx = 0; blockIdx < numBlocks; ++blockIdx) {
+                prefixProducts[blockIdx + 1] = prefixProducts[blockIdx] * blocksR[blockIdx];
+            }
+            double suffixProduct = 1.;
+            for (int blockIdx = numBlocks - 1; blockIdx >= 0; --blockIdx) {
+                const double blockAdjoint = adjoint * prefixProducts[blockIdx] * suffixProduct;
+                for (int edgeIdx = firstEdges[blockIdx]; edgeIdx < firstEdges[blockIdx + 1]; ++edgeIdx) {
+                    const auto [edgeRecord, previousAdjoint] = edgesAdjoints[edgeIdx];
+                    auto &edgeAdjoint = _tape[edgeRecord].adjoint;
+                    edgeAdjoint = previousAdjoint + blockAdjoint * (edgeAdjoint - previousAdjoint);
+                }
+                suffixProduct *= blocksR[blockIdx];
+            }
+            return prefixProducts[numBlocks];
+        }
+
+        double calculateLeaf(const AdjacencyMatrix<TracedProbability> &matrix, double adjoint) {
+            const int dimension = matrix.getDimension();
+            double gradient[MAX_GRADIENT_LEAF_DIMENSION * MAX_GRADIENT_LEAF_DIMENSION];
+            const double R = dimension == 6 ? ClosedForms::calculateCompleteGraph6ATR(LeafMatrix{matrix}, gradient)
+                                            : ClosedForms::calculateCompleteGraph7ATR(LeafMatrix{matrix}, gradient);
+            for (int vertex1 = 0; vertex1 < dimension; ++vertex1) {
+                for (int vertex2 = vertex1 + 1; vertex2 < dimension; ++vertex2) {
+                    if (matrix.isConnected(vertex1, vertex2)) {
+                        _tape[matrix.at(vertex1, vertex2).record].adjoint += adjoint * gradient[vertex1 * dimension + vertex2];
+                    }
+                }
+            }
+            return R;
+        }
+
+        void addParallelEdge(AdjacencyMatrix<TracedProbability> &matrix, int vertex1, int vertex2,
+                             const TracedProbability &edge) {
+            if (!matrix.isConnected(vertex1, vertex2)) {
+                matrix.addEdge(vertex1, vertex2, edge);
+                return;
+            }
+            const auto curEdge = matrix.at(vertex1, vertex2);
+            matrix.addEdge(vertex1, vertex2, TracedProbability{
+                    curEdge.p + edge.p - curEdge.p * edge.p,
+                    record(curEdge.record, 1 - edge.p, edge.record, 1 - curEdge.p)});
+        }
+
+        int record(int operand1, double partial1, int operand2, double partial2) {
+            _tape.push_back(Record{operand1, partial1, operand2, partial2, 0.});
+            return static_cast<int>(_tape.size()) - 1;
+        }
+
+        static void removeVertex(AdjacencyMatrix<TracedProbability> &matrix, int vertex) {
+            for (int otherVertex = 0; otherVertex < matrix.getDimension(); ++otherVertex) {
+                if (otherVertex != vertex && matrix.isConnected(vertex, otherVertex)) {
+                    matrix.removeEdge(Edge{vertex, otherVertex});
+                }
+            }
+            matrix.renumberPairOfVertices(vertex, matrix.getDimension() - 1);
+            matrix.removeLastVertex();
+        }
+
+        static int calculateDegree(const AdjacencyMatrix<TracedProbability> &matrix, int vertex) {
+            int degree = 0;
+            for (int otherVertex = 0; otherVertex < matrix.getDimension(); ++otherVertex) {
+                degree += otherVertex != vertex && matrix.isConnected(vertex, otherVertex);
+            }
+            return degree;
+        }
+
+        static int findVertexWithLowestDegree(const AdjacencyMatrix<TracedProbability> &matrix) {
+            int vertexWithLowestDegree = 0;
+            int lowestDegree = matrix.getDimension();
+            for (int vertex = 0; vertex < matrix.getDimension(); ++vertex) {
+                const int degree = calculateDegree(matrix, vertex);
+                if (degree < lowestDegree) {
+                    vertexWithLowestDegree = vertex;
+                    lowestDegree = degree;
+                }
+            }
+            return vertexWithLowestDegree;
+        }
+
+        std::vector<Record> _tape;
+    };
+
+}
+
+#endif //GRPH_BIRNBAUMIMPORTANCE_HPP
@@ -0,0 +1,168 @@
+#ifndef GRPH_BLOCKDECOMPOSITION_HPP
+#define GRPH_BLOCKDECOMPOSITION_HPP
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+
+namespace grph::graph::random {
+
+    /// Blocks (biconnected components) of an AdjacencyMatrix of any values, for the engines that factor a
+    /// matrix without an IRandomGraph; the same search as UndirectedRandomGraph::findBlocks. Two blocks share
+    /// a cut vertex at most, so a block is the subgraph induced by its vertexes and R of a connected graph is
+    /// the product of R of its blocks.
+    class BlockDecomposition {
+    public:
+        /// vertexes of the blocks, empty if the graph is biconnected or not connected
+        template<typename VertexesRatioType>
+        static std::vector<std::vector<int>> findBlocks(const AdjacencyMatrix<VertexesRatioType> &matrix) {
+            const int numVertexes = matrix.getDimension();
+            if (numVertexes <= 2 || !hasCutVertex(matrix)) {
+                return {};
+            }
+
+            // discovery time, low, next neighbor to scan and parent of every vertex
+            std::vector<int> dfsState(4 * numVertexes, -1);
+            int *discoveryTime = dfsState.data();
+            int *low = discoveryTime + numVertexes;
+            int *nextNeighbor = low + numVertexes;
+            int *parent = nextNeighbor + numVertexes;
+            std::fill(nextNeighbor, nextNeighbor + numVertexes, 0);
+
+            std::vector<int> dfsStack;
+            std::vector<std::pair<int, int>> edgesStack;
+            std::vector<std::vector<int>> blocks;
+            std::vector<char> isInBlock(numVertexes, false);
+            dfsStack.reserve(numVertexes);
+            edgesStack.reserve(numVertexes);
+
+            int time = 0;
+            discoveryTime[0] = low[0] = time++;
+            dfsStack.push_back(0);
+            while (!dfsStack.empty()) {
+                const int vertex = dfsStack.back();
+                int &neighbor = nextNeighbor[vertex];
+                while (neighbor < numVertexes && (neighbor == vertex || !matrix.isConnected(vertex, neighbor))) {
+                    ++neighbor;
+                }
+
+                if (neighbor < numVertexes) {
+                    const int child = neighbor++;
+                    if (discoveryTime[child] < 0) {
+                        parent[child] = vertex;
+                        discoveryTime[child] = low[child] = time++;
+                        edgesStack.emplace_back(vertex, child);
+                        dfsStack.push_back(child);
+                    } else if (child != parent[vertex] && discoveryTime[child] < discoveryTime[vertex]) {
+                        low[vertex] = std::min(low[vertex], discoveryTime[child]);
+                        edgesStack.emplace_back(vertex, child);
+                    }
+                    continue;
+                }
+
+                dfsStack.pop_back();
+                const int vertexParent = parent[vertex];
+                if (vertexParent < 0) {
+                    continue;
+                }
+                low[vertexParent] = std::min(low[vertexParent], low[vertex]);
+                if (low[vertex] >= discoveryTime[vertexParent]) { // vertexParent separates the block of vertex
+                    auto &block = blocks.emplace_back();
+                    std::pair<int, int> edge;
+                    do {
+                        edge = edgesStack.back();
+                        edgesStack.pop_back();
+                        for (const int edgeVertex: {edge.first, edge.second}) {
+                            if (!isInBlock[edgeVertex]) {
+                                isInBlock[edgeVertex] = true;
+                                block.push_back(edgeVertex);
+                            }
+                        }
+                    } while (edge.first != vertexParent || edge.second != vertex);
+                    for (const int blockVertex: block) {
+                        isInBlock[blockVertex] = false;
+                    }
+                }
+            }
+
+            if (blocks.size() <= 1 || time < numVertexes) {
+                return {};
+            }
+            return blocks;
+        }
+
+        /// the subgraph induced by the vertexes of the block, numbered in their order in the block
+        template<typename VertexesRatioType>
+        static std::shared_ptr<AdjacencyMatrix<VertexesRatioType>> makeBlockMatrix(
+                const AdjacencyMatrix<VertexesRatioType> &matrix, const std::vector<int> &block) {
+            const int blockDimension = static_cast<int>(block.size());
+            auto blockMatrix = std::make_shared<AdjacencyMatrix<VertexesRatioType>>(blockDimension);
+            for (int vertexIdx1 = 0; vertexIdx1 < blockDimension; ++vertexIdx1) {
+                for (int vertexIdx2 = vertexIdx1 + 1; vertexIdx2 < blockDimension; ++vertexIdx2) {
+                    if (matrix.isConnected(block[vertexIdx1], block[vertexIdx2])) {
+                        blockMatrix->addEdge(vertexIdx1, vertexIdx2, matrix.at(block[vertexIdx1], block[vertexIdx2]));
+                    }
+                }
+            }
+            return blockMatrix;
+        }
+
+    private:
+        /// the DFS of findBlocks without the blocks, it stops at the first cut vertex; most graphs in the
+        /// factoring are biconnected, so this is the only search made for them
+        template<typename VertexesRatioType>
+        static bool hasCutVertex(const AdjacencyMatrix<VertexesRatioType> &matrix) {
+            const int numVertexes = matrix.getDimension();
+            // discovery time, low, next neighbor to scan and parent of every vertex, then the DFS stack
+            std::vector<int> dfsState(5 * numVertexes, -1);
+            int *discoveryTime = dfsState.data();
+            int *low = discoveryTime + numVertexes;
+            int *nextNeighbor = low + numVertexes;
+            int *parent = nextNeighbor + numVertexes;
+            int *dfsStack = parent + numVertexes;
+            std::fill(nextNeighbor, nextNeighbor + numVertexes, 0);
+
+            int time = 0;
+            int stackSize = 0;
+            int numRootChildren = 0;
+            discoveryTime[0] = low[0] = time++;
+            dfsStack[stackSize++] = 0;
+            while (stackSize > 0) {
+                const int vertex = dfsStack[stackSize - 1];
+                int &neighbor = nextNeighbor[vertex];
+                while (neighbor < numVertexes && (neighbor == vertex || !matrix.isConnected(vertex, neighbor))) {
+                    ++neighbor;
+                }
+
+                if (neighbor < numVertexes) {
+                    const int child = neighbor++;
+                    if (discoveryTime[child] < 0) {
+                        parent[child] = vertex;
+                        discoveryTime[child] = low[child] = time++;
+                        dfsStack[stackSize++] = child;
+                        numRootChildren += vertex == 0;
+                    } else if (child != parent[vertex]) {
+                        low[vertex] = std::min(low[vertex], discoveryTime[child]);
+                    }
+                    continue;
+                }
+
+                --stackSize;
+                const int vertexParent = parent[vertex];
+                if (vertexParent > 0) {
+                    low[vertexParent] = std::min(low[vertexParent], low[vertex]);
+                    if (low[vertex] >= discoveryTime[vertexParent]) {
+                        return true;
+                    }
+                }
+            }
+            return numRootChildren > 1; // the root separates its subtrees
+        }
+    };
+
+}
+
+#endif //GRPH_BLOCKDECOMPOSITION_HPP
@@ -0,0 +1,8399 @@
+// Generated by src/utils/codegen/generate_closed_forms.cpp, do not edit.
+
+#ifndef GRPH_CLOSEDFORMS_HPP
+#define GRPH_CLOSEDFORMS_HPP
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+
+namespace grph::graph::random {
+
+    /// Matrix::at(line, column), line < column, is the probability of the edge: EdgeProbability
+    /// or a vector of them for a batch of graphs
+    class ClosedForms {
+    public:
+        template<typename Matrix>
+        static auto calculateCompleteGraph6ATR(const Matrix &matrix) {
+            const auto q_0_1 = 1 - matrix.at(0, 1);
+            const auto q_0_2 = 1 - matrix.at(0, 2);
+            const auto q_0_3 = 1 - matrix.at(0, 3);
+            const auto q_0_4 = 1 - matrix.at(0, 4);
+            const auto q_0_5 = 1 - matrix.at(0, 5);
+            const auto q_1_2 = 1 - matrix.at(1, 2);
+            const auto q_1_3 = 1 - matrix.at(1, 3);
+            const auto q_1_4 = 1 - matrix.at(1, 4);
+            const auto q_1_5 = 1 - matrix.at(1, 5);
+            const auto q_2_3 = 1 - matrix.at(2, 3);
+            const auto q_2_4 = 1 - matrix.at(2, 4);
+            const auto q_2_5 = 1 - matrix.at(2, 5);
+            const auto q_3_4 = 1 - matrix.at(3, 4);
+            const auto q_3_5 = 1 - matrix.at(3, 5);
+            const auto q_4_5 = 1 - matrix.at(4, 5);
+            const auto R_33 = 1 - q_0_5;
+            const auto Q_4_33 = q_0_4 * q_4_5;
+            const auto R_17 = 1 - q_0_4;
+            const auto Q_5_17 = q_0_5 * q_4_5;
+            const auto C_1_48 = q_0_4 * q_0_5;
+            const auto R_49 = 1 - (R_33 * Q_4_33 + R_17 * Q_5_17 + C_1_48);
+            const auto Q_3_17 = q_0_3 * q_3_4;
+            const auto Q_3_49 = Q_3_17 * q_3_5;
+            const auto Q_3_33 = q_0_3 * q_3_5;
+            const auto R_9 = 1 - q_0_3;
+            const auto Q_5_9 = q_0_5 * q_3_5;
+            const auto C_1_40 = q_0_3 * q_0_5;
+            const auto R_41 = 1 - (R_33 * Q_3_33 + R_9 * Q_5_9 + C_1_40);
+            const auto Q_4_9 = q_0_4 * q_3_4;
+            const auto Q_4_41 = Q_4_9 * q_4_5;
+            const auto C_33_24 = Q_3_33 * Q_4_33;
+            const auto C_1_24 = q_0_3 * q_0_4;
+            const auto R_25 = 1 - (R_17 * Q_3_17 + R_9 * Q_4_9 + C_1_24);
+            const auto Q_5_25 = Q_5_9 * q_4_5;
+            const auto C_17_40 = Q_3_17 * Q_5_17;
+            const auto C_9_48 = Q_4_9 * Q_5_9;
+            const auto C_1_56 = C_1_24 * q_0_5;
+            const auto R_57 = 1 - (R_49 * Q_3_49 + R_41 * Q_4_41 + R_33 * C_33_24 + R_25 * Q_5_25
+                    + R_17 * C_17_40 + R_9 * C_9_48 + C_1_56);
+            const auto Q_2_9 = q_0_2 * q_2_3;
+            const auto Q_2_25 = Q_2_9 * q_2_4;
+            const auto Q_2_57 = Q_2_25 * q_2_5;
+            const auto Q_2_17 = q_0_2 * q_2_4;
+            const auto Q_2_49 = Q_2_17 * q_2_5;
+            const auto Q_2_33 = q_0_2 * q_2_5;
+            const auto R_5 = 1 - q_0_2;
+            const auto Q_5_5 = q_0_5 * q_2_5;
+            const auto C_1_36 = q_0_2 * q_0_5;
+            const auto R_37 = 1 - (R_33 * Q_2_33 + R_5 * Q_5_5 + C_1_36);
+            const auto Q_4_5 = q_0_4 * q_2_4;
+            const auto Q_4_37 = Q_4_5 * q_4_5;
+            const auto C_33_20 = Q_2_33 * Q_4_33;
+            const auto C_1_20 = q_0_2 * q_0_4;
+            const auto R_21 = 1 - (R_17 * Q_2_17 + R_5 * Q_4_5 + C_1_20);
+            const auto Q_5_21 = Q_5_5 * q_4_5;
+            const auto C_17_36 = Q_2_17 * Q_5_17;
+            const auto C_5_48 = Q_4_5 * Q_5_5;
+            const auto C_1_52 = C_1_20 * q_0_5;
+            const auto R_53 = 1 - (R_49 * Q_2_49 + R_37 * Q_4_37 + R_33 * C_33_20 + R_21 * Q_5_21
+                    + R_17 * C_17_36 + R_5 * C_5_48 + C_1_52);
+            const auto Q_3_5 = q_0_3 * q_2_3;
+            const auto Q_3_21 = Q_3_5 * q_3_4;
+            const auto Q_3_53 = Q_3_21 * q_3_5;
+            const auto C_49_12 = Q_2_49 * Q_3_49;
+            const auto Q_2_41 = Q_2_9 * q_2_5;
+            const auto Q_3_37 = Q_3_5 * q_3_5;
+            const auto C_33_12 = Q_2_33 * Q_3_33;
+            const auto C_1_12 = q_0_2 * q_0_3;
+            const auto R_13 = 1 - (R_9 * Q_2_9 + R_5 * Q_3_5 + C_1_12);
+            const auto Q_5_13 = Q_5_5 * q_3_5;
+            const auto C_9_36 = Q_2_9 * Q_5_9;
+            const auto C_5_40 = Q_3_5 * Q_5_5;
+            const auto C_1_44 = C_1_12 * q_0_5;
+            const auto R_45 = 1 - (R_41 * Q_2_41 + R_37 * Q_3_37 + R_33 * C_33_12 + R_13 * Q_5_13
+                    + R_9 * C_9_36 + R_5 * C_5_40 + C_1_44);
+            const auto Q_4_13 = Q_4_5 * q_3_4;
+            const auto Q_4_45 = Q_4_13 * q_4_5;
+            const auto C_41_20 = Q_2_41 * Q_4_41;
+            const auto C_37_24 = Q_3_37 * Q_4_37;
+            const auto C_33_28 = C_33_12 * Q_4_33;
+            const auto C_17_12 = Q_2_17 * Q_3_17;
+            const auto C_9_20 = Q_2_9 * Q_4_9;
+            const auto C_5_24 = Q_3_5 * Q_4_5;
+            const auto C_1_28 = C_1_12 * q_0_4;
+            const auto R_29 = 1 - (R_25 * Q_2_25 + R_21 * Q_3_21 + R_17 * C_17_12 + R_13 * Q_4_13
+                    + R_9 * C_9_20 + R_5 * C_5_24 + C_1_28);
+            const auto Q_5_29 = Q_5_13 * q_4_5;
+            const auto C_25_36 = Q_2_25 * Q_5_25;
+            const auto C_21_40 = Q_3_21 * Q_5_21;
+            const auto C_17_44 = C_17_12 * Q_5_17;
+            const auto C_13_48 = Q_4_13 * Q_5_13;
+            const auto C_9_52 = C_9_20 * Q_5_9;
+            const auto C_5_56 = C_5_24 * Q_5_5;
+            const auto C_1_60 = C_1_28 * q_0_5;
+            const auto R_61 = 1 - (R_57 * Q_2_57 + R_53 * Q_3_53 + R_49 * C_49_12 + R_45 * Q_4_45
+                    + R_41 * C_41_20 + R_37 * C_37_24 + R_33 * C_33_28 + R_29 * Q_5_29
+                    + R_25 * C_25_36 + R_21 * C_21_40 + R_17 * C_17_44 + R_13 * C_13_48
+                    + R_9 * C_9_52 + R_5 * C_5_56 + C_1_60);
+            const auto Q_1_5 = q_0_1 * q_1_2;
+            const auto Q_1_13 = Q_1_5 * q_1_3;
+            const auto Q_1_29 = Q_1_13 * q_1_4;
+            const auto Q_1_61 = Q_1_29 * q_1_5;
+            const auto Q_1_9 = q_0_1 * q_1_3;
+            const auto Q_1_25 = Q_1_9 * q_1_4;
+            const auto Q_1_57 = Q_1_25 * q_1_5;
+            const auto Q_1_17 = q_0_1 * q_1_4;
+            const auto Q_1_49 = Q_1_17 * q_1_5;
+            const auto Q_1_33 = q_0_1 * q_1_5;
+            const auto R_3 = 1 - q_0_1;
+            const auto Q_5_3 = q_0_5 * q_1_5;
+            const auto C_1_34 = q_0_1 * q_0_5;
+            const auto R_35 = 1 - (R_33 * Q_1_33 + R_3 * Q_5_3 + C_1_34);
+            const auto Q_4_3 = q_0_4 * q_1_4;
+            const auto Q_4_35 = Q_4_3 * q_4_5;
+            const auto C_33_18 = Q_1_33 * Q_4_33;
+            const auto C_1_18 = q_0_1 * q_0_4;
+            const auto R_19 = 1 - (R_17 * Q_1_17 + R_3 * Q_4_3 + C_1_18);
+            const auto Q_5_19 = Q_5_3 * q_4_5;
+            const auto C_17_34 = Q_1_17 * Q_5_17;
+            const auto C_3_48 = Q_4_3 * Q_5_3;
+            const auto C_1_50 = C_1_18 * q_0_5;
+            const auto R_51 = 1 - (R_49 * Q_1_49 + R_35 * Q_4_35 + R_33 * C_33_18 + R_19 * Q_5_19
+                    + R_17 * C_17_34 + R_3 * C_3_48 + C_1_50);
+            const auto Q_3_3 = q_0_3 * q_1_3;
+            const auto Q_3_19 = Q_3_3 * q_3_4;
+            const auto Q_3_51 = Q_3_19 * q_3_5;
+            const auto C_49_10 = Q_1_49 * Q_3_49;
+            const auto Q_1_41 = Q_1_9 * q_1_5;
+            const auto Q_3_35 = Q_3_3 * q_3_5;
+            const auto C_33_10 = Q_1_33 * Q_3_33;
+            const auto C_1_10 = q_0_1 * q_0_3;
+            const auto R_11 = 1 - (R_9 * Q_1_9 + R_3 * Q_3_3 + C_1_10);
+            const auto Q_5_11 = Q_5_3 * q_3_5;
+            const auto C_9_34 = Q_1_9 * Q_5_9;
+            const auto C_3_40 = Q_3_3 * Q_5_3;
+            const auto C_1_42 = C_1_10 * q_0_5;
+            const auto R_43 = 1 - (R_41 * Q_1_41 + R_35 * Q_3_35 + R_33 * C_33_10 + R_11 * Q_5_11
+                    + R_9 * C_9_34 + R_3 * C_3_40 + C_1_42);
+            const auto Q_4_11 = Q_4_3 * q_3_4;
+            const auto Q_4_43 = Q_4_11 * q_4_5;
+            const auto C_41_18 = Q_1_41 * Q_4_41;
+            const auto C_35_24 = Q_3_35 * Q_4_35;
+            const auto C_33_26 = C_33_10 * Q_4_33;
+            const auto C_17_10 = Q_1_17 * Q_3_17;
+            const auto C_9_18 = Q_1_9 * Q_4_9;
+            const auto C_3_24 = Q_3_3 * Q_4_3;
+            const auto C_1_26 = C_1_10 * q_0_4;
+            const auto R_27 = 1 - (R_25 * Q_1_25 + R_19 * Q_3_19 + R_17 * C_17_10 + R_11 * Q_4_11
+                    + R_9 * C_9_18 + R_3 * C_3_24 + C_1_26);
+            const auto Q_5_27 = Q_5_11 * q_4_5;
+            const auto C_25_34 = Q_1_25 * Q_5_25;
+            const auto C_19_40 = Q_3_19 * Q_5_19;
+            const auto C_17_42 = C_17_10 * Q_5_17;
+            const auto C_11_48 = Q_4_11 * Q_5_11;
+            const auto C_9_50 = C_9_18 * Q_5_9;
+            const auto C_3_56 = C_3_24 * Q_5_3;
+            const auto C_1_58 = C_1_26 * q_0_5;
+            const auto R_59 = 1 - (R_57 * Q_1_57 + R_51 * Q_3_51 + R_49 * C_49_10 + R_43 * Q_4_43
+                    + R_41 * C_41_18 + R_35 * C_35_24 + R_33 * C_33_26 + R_27 * Q_5_27
+                    + R_25 * C_25_34 + R_19 * C_19_40 + R_17 * C_17_42 + R_11 * C_11_48
+                    + R_9 * C_9_50 + R_3 * C_3_56 + C_1_58);
+            const auto Q_2_3 = q_0_2 * q_1_2;
+            const auto Q_2_11 = Q_2_3 * q_2_3;
+            const auto Q_2_27 = Q_2_11 * q_2_4;
+            const auto Q_2_59 = Q_2_27 * q_2_5;
+            const auto C_57_6 = Q_1_57 * Q_2_57;
+            const auto Q_1_21 = Q_1_5 * q_1_4;
+            const auto Q_1_53 = Q_1_21 * q_1_5;
+            const auto Q_2_19 = Q_2_3 * q_2_4;
+            const auto Q_2_51 = Q_2_19 * q_2_5;
+            const auto C_49_6 = Q_1_49 * Q_2_49;
+            const auto Q_1_37 = Q_1_5 * q_1_5;
+            const auto Q_2_35 = Q_2_3 * q_2_5;
+            const auto C_33_6 = Q_1_33 * Q_2_33;
+            const auto C_1_6 = q_0_1 * q_0_2;
+            const auto R_7 = 1 - (R_5 * Q_1_5 + R_3 * Q_2_3 + C_1_6);
+            const auto Q_5_7 = Q_5_3 * q_2_5;
+            const auto C_5_34 = Q_1_5 * Q_5_5;
+            const auto C_3_36 = Q_2_3 * Q_5_3;
+            const auto C_1_38 = C_1_6 * q_0_5;
+            const auto R_39 = 1 - (R_37 * Q_1_37 + R_35 * Q_2_35 + R_33 * C_33_6 + R_7 * Q_5_7
+                    + R_5 * C_5_34 + R_3 * C_3_36 + C_1_38);
+            const auto Q_4_7 = Q_4_3 * q_2_4;
+            const auto Q_4_39 = Q_4_7 * q_4_5;
+            const auto C_37_18 = Q_1_37 * Q_4_37;
+            const auto C_35_20 = Q_2_35 * Q_4_35;
+            const auto C_33_22 = C_33_6 * Q_4_33;
+            const auto C_17_6 = Q_1_17 * Q_2_17;
+            const auto C_5_18 = Q_1_5 * Q_4_5;
+            const auto C_3_20 = Q_2_3 * Q_4_3;
+            const auto C_1_22 = C_1_6 * q_0_4;
+            const auto R_23 = 1 - (R_21 * Q_1_21 + R_19 * Q_2_19 + R_17 * C_17_6 + R_7 * Q_4_7
+                    + R_5 * C_5_18 + R_3 * C_3_20 + C_1_22);
+            const auto Q_5_23 = Q_5_7 * q_4_5;
+            const auto C_21_34 = Q_1_21 * Q_5_21;
+            const auto C_19_36 = Q_2_19 * Q_5_19;
+            const auto C_17_38 = C_17_6 * Q_5_17;
+            const auto C_7_48 = Q_4_7 * Q_5_7;
+            const auto C_5_50 = C_5_18 * Q_5_5;
+            const auto C_3_52 = C_3_20 * Q_5_3;
+            const auto C_1_54 = C_1_22 * q_0_5;
+            const auto R_55 = 1 - (R_53 * Q_1_53 + R_51 * Q_2_51 + R_49 * C_49_6 + R_39 * Q_4_39
+                    + R_37 * C_37_18 + R_35 * C_35_20 + R_33 * C_33_22 + R_23 * Q_5_23
+                    + R_21 * C_21_34 + R_19 * C_19_36 + R_17 * C_17_38 + R_7 * C_7_48
+                    + R_5 * C_5_50 + R_3 * C_3_52 + C_1_54);
+            const auto Q_3_7 = Q_3_3 * q_2_3;
+            const auto Q_3_23 = Q_3_7 * q_3_4;
+            const auto Q_3_55 = Q_3_23 * q_3_5;
+            const auto C_53_10 = Q_1_53 * Q_3_53;
+            const auto C_51_12 = Q_2_51 * Q_3_51;
+            const auto C_49_14 = C_49_6 * Q_3_49;
+            const auto Q_1_45 = Q_1_13 * q_1_5;
+            const auto Q_2_43 = Q_2_11 * q_2_5;
+            const auto C_41_6 = Q_1_41 * Q_2_41;
+            const auto Q_3_39 = Q_3_7 * q_3_5;
+            const auto C_37_10 = Q_1_37 * Q_3_37;
+            const auto C_35_12 = Q_2_35 * Q_3_35;
+            const auto C_33_14 = C_33_6 * Q_3_33;
+            const auto C_9_6 = Q_1_9 * Q_2_9;
+            const auto C_5_10 = Q_1_5 * Q_3_5;
+            const auto C_3_12 = Q_2_3 * Q_3_3;
+            const auto C_1_14 = C_1_6 * q_0_3;
+            const auto R_15 = 1 - (R_13 * Q_1_13 + R_11 * Q_2_11 + R_9 * C_9_6 + R_7 * Q_3_7
+                    + R_5 * C_5_10 + R_3 * C_3_12 + C_1_14);
+            const auto Q_5_15 = Q_5_7 * q_3_5;
+            const auto C_13_34 = Q_1_13 * Q_5_13;
+            const auto C_11_36 = Q_2_11 * Q_5_11;
+            const auto C_9_38 = C_9_6 * Q_5_9;
+            const auto C_7_40 = Q_3_7 * Q_5_7;
+            const auto C_5_42 = C_5_10 * Q_5_5;
+            const auto C_3_44 = C_3_12 * Q_5_3;
+            const auto C_1_46 = C_1_14 * q_0_5;
+            const auto R_47 = 1 - (R_45 * Q_1_45 + R_43 * Q_2_43 + R_41 * C_41_6 + R_39 * Q_3_39
+                    + R_37 * C_37_10 + R_35 * C_35_12 + R_33 * C_33_14 + R_15 * Q_5_15
+                    + R_13 * C_13_34 + R_11 * C_11_36 + R_9 * C_9_38 + R_7 * C_7_40
+                    + R_5 * C_5_42 + R_3 * C_3_44 + C_1_46);
+            const auto Q_4_15 = Q_4_7 * q_3_4;
+            const auto Q_4_47 = Q_4_15 * q_4_5;
+            const auto C_45_18 = Q_1_45 * Q_4_45;
+            const auto C_43_20 = Q_2_43 * Q_4_43;
+            const auto C_41_22 = C_41_6 * Q_4_41;
+            const auto C_39_24 = Q_3_39 * Q_4_39;
+            const auto C_37_26 = C_37_10 * Q_4_37;
+            const auto C_35_28 = C_35_12 * Q_4_35;
+            const auto C_33_30 = C_33_14 * Q_4_33;
+            const auto C_25_6 = Q_1_25 * Q_2_25;
+            const auto C_21_10 = Q_1_21 * Q_3_21;
+            const auto C_19_12 = Q_2_19 * Q_3_19;
+            const auto C_17_14 = C_17_6 * Q_3_17;
+            const auto C_13_18 = Q_1_13 * Q_4_13;
+            const auto C_11_20 = Q_2_11 * Q_4_11;
+            const auto C_9_22 = C_9_6 * Q_4_9;
+            const auto C_7_24 = Q_3_7 * Q_4_7;
+            const auto C_5_26 = C_5_10 * Q_4_5;
+            const auto C_3_28 = C_3_12 * Q_4_3;
+            const auto C_1_30 = C_1_14 * q_0_4;
+            const auto R_31 = 1 - (R_29 * Q_1_29 + R_27 * Q_2_27 + R_25 * C_25_6 + R_23 * Q_3_23
+                    + R_21 * C_21_10 + R_19 * C_19_12 + R_17 * C_17_14 + R_15 * Q_4_15
+                    + R_13 * C_13_18 + R_11 * C_11_20 + R_9 * C_9_22 + R_7 * C_7_24
+                    + R_5 * C_5_26 + R_3 * C_3_28 + C_1_30);
+            const auto Q_5_31 = Q_5_15 * q_4_5;
+            const auto C_29_34 = Q_1_29 * Q_5_29;
+            const auto C_27_36 = Q_2_27 * Q_5_27;
+            const auto C_25_38 = C_25_6 * Q_5_25;
+            const auto C_23_40 = Q_3_23 * Q_5_23;
+            const auto C_21_42 = C_21_10 * Q_5_21;
+            const auto C_19_44 = C_19_12 * Q_5_19;
+            const auto C_17_46 = C_17_14 * Q_5_17;
+            const auto C_15_48 = Q_4_15 * Q_5_15;
+            const auto C_13_50 = C_13_18 * Q_5_13;
+            const auto C_11_52 = C_11_20 * Q_5_11;
+            const auto C_9_54 = C_9_22 * Q_5_9;
+            const auto C_7_56 = C_7_24 * Q_5_7;
+            const auto C_5_58 = C_5_26 * Q_5_5;
+            const auto C_3_60 = C_3_28 * Q_5_3;
+            const auto C_1_62 = C_1_30 * q_0_5;
+            const auto R_63 = 1 - (R_61 * Q_1_61 + R_59 * Q_2_59 + R_57 * C_57_6 + R_55 * Q_3_55
+                    + R_53 * C_53_10 + R_51 * C_51_12 + R_49 * C_49_14 + R_47 * Q_4_47
+                    + R_45 * C_45_18 + R_43 * C_43_20 + R_41 * C_41_22 + R_39 * C_39_24
+                    + R_37 * C_37_26 + R_35 * C_35_28 + R_33 * C_33_30 + R_31 * Q_5_31
+                    + R_29 * C_29_34 + R_27 * C_27_36 + R_25 * C_25_38 + R_23 * C_23_40
+                    + R_21 * C_21_42 + R_19 * C_19_44 + R_17 * C_17_46 + R_15 * C_15_48
+                    + R_13 * C_13_50 + R_11 * C_11_52 + R_9 * C_9_54 + R_7 * C_7_56
+                    + R_5 * C_5_58 + R_3 * C_3_60 + C_1_62);
+            return R_63;
+        }
+
+        /// gradient[line * 6 + column], line < column: dR / dp of the edge
+        template<typename Matrix>
+        static double calculateCompleteGraph6ATR(const Matrix &matrix, double *gradient) {
+            const double q_0_1 = 1 - matrix.at(0, 1);
+            const double q_0_2 = 1 - matrix.at(0, 2);
+            const double q_0_3 = 1 - matrix.at(0, 3);
+            const double q_0_4 = 1 - matrix.at(0, 4);
+            const double q_0_5 = 1 - matrix.at(0, 5);
+            const double q_1_2 = 1 - matrix.at(1, 2);
+            const double q_1_3 = 1 - matrix.at(1, 3);
+            const double q_1_4 = 1 - matrix.at(1, 4);
+            const double q_1_5 = 1 - matrix.at(1, 5);
+            const double q_2_3 = 1 - matrix.at(2, 3);
+            const double q_2_4 = 1 - matrix.at(2, 4);
+            const double q_2_5 = 1 - matrix.at(2, 5);
+            const double q_3_4 = 1 - matrix.at(3, 4);
+            const double q_3_5 = 1 - matrix.at(3, 5);
+            const double q_4_5 = 1 - matrix.at(4, 5);
+            const double R_33 = 1 - q_0_5;
+            const double Q_4_33 = q_0_4 * q_4_5;
+            const double R_17 = 1 - q_0_4;
+            const double Q_5_17 = q_0_5 * q_4_5;
+            const double C_1_48 = q_0_4 * q_0_5;
+            const double R_49 = 1 - (R_33 * Q_4_33 + R_17 * Q_5_17 + C_1_48);
+            const double Q_3_17 = q_0_3 * q_3_4;
+            const double Q_3_49 = Q_3_17 * q_3_5;
+            const double Q_3_33 = q_0_3 * q_3_5;
+            const double R_9 = 1 - q_0_3;
+            const double Q_5_9 = q_0_5 * q_3_5;
+            const double C_1_40 = q_0_3 * q_0_5;
+            const double R_41 = 1 - (R_33 * Q_3_33 + R_9 * Q_5_9 + C_1_40);
+            const double Q_4_9 = q_0_4 * q_3_4;
+            const double Q_4_41 = Q_4_9 * q_4_5;
+            const double C_33_24 = Q_3_33 * Q_4_33;
+            const double C_1_24 = q_0_3 * q_0_4;
+            const double R_25 = 1 - (R_17 * Q_3_17 + R_9 * Q_4_9 + C_1_24);
+            const double Q_5_25 = Q_5_9 * q_4_5;
+            const double C_17_40 = Q_3_17 * Q_5_17;
+            const double C_9_48 = Q_4_9 * Q_5_9;
+            const double C_1_56 = C_1_24 * q_0_5;
+            const double R_57 = 1 - (R_49 * Q_3_49 + R_41 * Q_4_41 + R_33 * C_33_24 + R_25 * Q_5_25
+                    + R_17 * C_17_40 + R_9 * C_9_48 + C_1_56);
+            const double Q_2_9 = q_0_2 * q_2_3;
+            const double Q_2_25 = Q_2_9 * q_2_4;
+            const double Q_2_57 = Q_2_25 * q_2_5;
+            const double Q_2_17 = q_0_2 * q_2_4;
+            const double Q_2_49 = Q_2_17 * q_2_5;
+            const double Q_2_33 = q_0_2 * q_2_5;
+            const double R_5 = 1 - q_0_2;
+            const double Q_5_5 = q_0_5 * q_2_5;
+            const double C_1_36 = q_0_2 * q_0_5;
+            const double R_37 = 1 - (R_33 * Q_2_33 + R_5 * Q_5_5 + C_1_36);
+            const double Q_4_5 = q_0_4 * q_2_4;
+            const double Q_4_37 = Q_4_5 * q_4_5;
+            const double C_33_20 = Q_2_33 * Q_4_33;
+            const double C_1_20 = q_0_2 * q_0_4;
+            const double R_21 = 1 - (R_17 * Q_2_17 + R_5 * Q_4_5 + C_1_20);
+            const double Q_5_21 = Q_5_5 * q_4_5;
+            const double C_17_36 = Q_2_17 * Q_5_17;
+            const double C_5_48 = Q_4_5 * Q_5_5;
+            const double C_1_52 = C_1_20 * q_0_5;
+            const double R_53 = 1 - (R_49 * Q_2_49 + R_37 * Q_4_37 + R_33 * C_33_20 + R_21 * Q_5_21
+                    + R_17 * C_17_36 + R_5 * C_5_48 + C_1_52);
+            const double Q_3_5 = q_0_3 * q_2_3;
+            const double Q_3_21 = Q_3_5 * q_3_4;
+            const double Q_3_53 = Q_3_21 * q_3_5;
+            const double C_49_12 = Q_2_49 * Q_3_49;
+            const double Q_2_41 = Q_2_9 * q_2_5;
+            const double Q_3_37 = Q_3_5 * q_3_5;
+            const double C_33_12 = Q_2_33 * Q_3_33;
+            const double C_1_12 = q_0_2 * q_0_3;
+            const double R_13 = 1 - (R_9 * Q_2_9 + R_5 * Q_3_5 + C_1_12);
+            const double Q_5_13 = Q_5_5 * q_3_5;
+            const double C_9_36 = Q_2_9 * Q_5_9;
+            const double C_5_40 = Q_3_5 * Q_5_5;
+            const double C_1_44 = C_1_12 * q_0_5;
+            const double R_45 = 1 - (R_41 * Q_2_41 + R_37 * Q_3_37 + R_33 * C_33_12 + R_13 * Q_5_13
+                    + R_9 * C_9_36 + R_5 * C_5_40 + C_1_44);
+            const double Q_4_13 = Q_4_5 * q_3_4;
+            const double Q_4_45 = Q_4_13 * q_4_5;
+            const double C_41_20 = Q_2_41 * Q_4_41;
+            const double C_37_24 = Q_3_37 * Q_4_37;
+            const double C_33_28 = C_33_12 * Q_4_33;
+            const double C_17_12 = Q_2_17 * Q_3_17;
+            const double C_9_20 = Q_2_9 * Q_4_9;
+            const double C_5_24 = Q_3_5 * Q_4_5;
+            const double C_1_28 = C_1_12 * q_0_4;
+            const double R_29 = 1 - (R_25 * Q_2_25 + R_21 * Q_3_21 + R_17 * C_17_12 + R_13 * Q_4_13
+                    + R_9 * C_9_20 + R_5 * C_5_24 + C_1_28);
+            const double Q_5_29 = Q_5_13 * q_4_5;
+            const double C_25_36 = Q_2_25 * Q_5_25;
+            const double C_21_40 = Q_3_21 * Q_5_21;
+            const double C_17_44 = C_17_12 * Q_5_17;
+            const double C_13_48 = Q_4_13 * Q_5_13;
+            const double C_9_52 = C_9_20 * Q_5_9;
+            const double C_5_56 = C_5_24 * Q_5_5;
+            const double C_1_60 = C_1_28 * q_0_5;
+            const double R_61 = 1 - (R_57 * Q_2_57 + R_53 * Q_3_53 + R_49 * C_49_12 + R_45 * Q_4_45
+                    + R_41 * C_41_20 + R_37 * C_37_24 + R_33 * C_33_28 + R_29 * Q_5_29
+                    + R_25 * C_25_36 + R_21 * C_21_40 + R_17 * C_17_44 + R_13 * C_13_48
+                    + R_9 * C_9_52 + R_5 * C_5_56 + C_1_60);
+            const double Q_1_5 = q_0_1 * q_1_2;
+            const double Q_1_13 = Q_1_5 * q_1_3;
+            const double Q_1_29 = Q_1_13 * q_1_4;
+            const double Q_1_61 = Q_1_29 * q_1_5;
+            const double Q_1_9 = q_0_1 * q_1_3;
+            const double Q_1_25 = Q_1_9 * q_1_4;
+            const double Q_1_57 = Q_1_25 * q_1_5;
+            const double Q_1_17 = q_0_1 * q_1_4;
+            const double Q_1_49 = Q_1_17 * q_1_5;
+            const double Q_1_33 = q_0_1 * q_1_5;
+            const double R_3 = 1 - q_0_1;
+            const double Q_5_3 = q_0_5 * q_1_5;
+            const double C_1_34 = q_0_1 * q_0_5;
+            const double R_35 = 1 - (R_33 * Q_1_33 + R_3 * Q_5_3 + C_1_34);
+            const double Q_4_3 = q_0_4 * q_1_4;
+            const double Q_4_35 = Q_4_3 * q_4_5;
+            const double C_33_18 = Q_1_33 * Q_4_33;
+            const double C_1_18 = q_0_1 * q_0_4;
+            const double R_19 = 1 - (R_17 * Q_1_17 + R_3 * Q_4_3 + C_1_18);
+            const double Q_5_19 = Q_5_3 * q_4_5;
+            const double C_17_34 = Q_1_17 * Q_5_17;
+            const double C_3_48 = Q_4_3 * Q_5_3;
+            const double C_1_50 = C_1_18 * q_0_5;
+            const double R_51 = 1 - (R_49 * Q_1_49 + R_35 * Q_4_35 + R_33 * C_33_18 + R_19 * Q_5_19
+                    + R_17 * C_17_34 + R_3 * C_3_48 + C_1_50);
+            const double Q_3_3 = q_0_3 * q_1_3;
+            const double Q_3_19 = Q_3_3 * q_3_4;
+            const double Q_3_51 = Q_3_19 * q_3_5;
+            const double C_49_10 = Q_1_49 * Q_3_49;
+            const double Q_1_41 = Q_1_9 * q_1_5;
+            const double Q_3_35 = Q_3_3 * q_3_5;
+            const double C_33_10 = Q_1_33 * Q_3_33;
+            const double C_1_10 = q_0_1 * q_0_3;
+            const double R_11 = 1 - (R_9 * Q_1_9 + R_3 * Q_3_3 + C_1_10);
+            const double Q_5_11 = Q_5_3 * q_3_5;
+            const double C_9_34 = Q_1_9 * Q_5_9;
+            const double C_3_40 = Q_3_3 * Q_5_3;
+            const double C_1_42 = C_1_10 * q_0_5;
+            const double R_43 = 1 - (R_41 * Q_1_41 + R_35 * Q_3_35 + R_33 * C_33_10 + R_11 * Q_5_11
+                    + R_9 * C_9_34 + R_3 * C_3_40 + C_1_42);
+            const double Q_4_11 = Q_4_3 * q_3_4;
+            const double Q_4_43 = Q_4_11 * q_4_5;
+            const double C_41_18 = Q_1_41 * Q_4_41;
+            const double C_35_24 = Q_3_35 * Q_4_35;
+            const double C_33_26 = C_33_10 * Q_4_33;
+            const double C_17_10 = Q_1_17 * Q_3_17;
+            const double C_9_18 = Q_1_9 * Q_4_9;
+            const double C_3_24 = Q_3_3 * Q_4_3;
+            const double C_1_26 = C_1_10 * q_0_4;
+            const double R_27 = 1 - (R_25 * Q_1_25 + R_19 * Q_3_19 + R_17 * C_17_10 + R_11 * Q_4_11
+                    + R_9 * C_9_18 + R_3 * C_3_24 + C_1_26);
+            const double Q_5_27 = Q_5_11 * q_4_5;
+            const double C_25_34 = Q_1_25 * Q_5_25;
+            const double C_19_40 = Q_3_19 * Q_5_19;
+            const double C_17_42 = C_17_10 * Q_5_17;
+            const double C_11_48 = Q_4_11 * Q_5_11;
+            const double C_9_50 = C_9_18 * Q_5_9;
+            const double C_3_56 = C_3_24 * Q_5_3;
+            const double C_1_58 = C_1_26 * q_0_5;
+            const double R_59 = 1 - (R_57 * Q_1_57 + R_51 * Q_3_51 + R_49 * C_49_10 + R_43 * Q_4_43
+                    + R_41 * C_41_18 + R_35 * C_35_24 + R_33 * C_33_26 + R_27 * Q_5_27
+                    + R_25 * C_25_34 + R_19 * C_19_40 + R_17 * C_17_42 + R_11 * C_11_48
+                    + R_9 * C_9_50 + R_3 * C_3_56 + C_1_58);
+            const double Q_2_3 = q_0_2 * q_1_2;
+            const double Q_2_11 = Q_2_3 * q_2_3;
+            const double Q_2_27 = Q_2_11 * q_2_4;
+            const double Q_2_59 = Q_2_27 * q_2_5;
+            const double C_57_6 = Q_1_57 * Q_2_57;
+            const double Q_1_21 = Q_1_5 * q_1_4;
+            const double Q_1_53 = Q_1_21 * q_1_5;
+            const double Q_2_19 = Q_2_3 * q_2_4;
+            const double Q_2_51 = Q_2_19 * q_2_5;
+            const double C_49_6 = Q_1_49 * Q_2_49;
+            const double Q_1_37 = Q_1_5 * q_1_5;
+            const double Q_2_35 = Q_2_3 * q_2_5;
+            const double C_33_6 = Q_1_33 * Q_2_33;
+            const double C_1_6 = q_0_1 * q_0_2;
+            const double R_7 = 1 - (R_5 * Q_1_5 + R_3 * Q_2_3 + C_1_6);
+            const double Q_5_7 = Q_5_3 * q_2_5;
+            const double C_5_34 = Q_1_5 * Q_5_5;
+            const double C_3_36 = Q_2_3 * Q_5_3;
+            const double C_1_38 = C_1_6 * q_0_5;
+            const double R_39 = 1 - (R_37 * Q_1_37 + R_35 * Q_2_35 + R_33 * C_33_6 + R_7 * Q_5_7
+                    + R_5 * C_5_34 + R_3 * C_3_36 + C_1_38);
+            const double Q_4_7 = Q_4_3 * q_2_4;
+            const double Q_4_39 = Q_4_7 * q_4_5;
+            const double C_37_18 = Q_1_37 * Q_4_37;
+            const double C_35_20 = Q_2_35 * Q_4_35;
+            const double C_33_22 = C_33_6 * Q_4_33;
+            const double C_17_6 = Q_1_17 * Q_2_17;
+            const double C_5_18 = Q_1_5 * Q_4_5;
+            const double C_3_20 = Q_2_3 * Q_4_3;
+            const double C_1_22 = C_1_6 * q_0_4;
+            const double R_23 = 1 - (R_21 * Q_1_21 + R_19 * Q_2_19 + R_17 * C_17_6 + R_7 * Q_4_7
+                    + R_5 * C_5_18 + R_3 * C_3_20 + C_1_22);
+            const double Q_5_23 = Q_5_7 * q_4_5;
+            const double C_21_34 = Q_1_21 * Q_5_21;
+            const double C_19_36 = Q_2_19 * Q_5_19;
+            const double C_17_38 = C_17_6 * Q_5_17;
+            const double C_7_48 = Q_4_7 * Q_5_7;
+            const double C_5_50 = C_5_18 * Q_5_5;
+            const double C_3_52 = C_3_20 * Q_5_3;
+            const double C_1_54 = C_1_22 * q_0_5;
+            const double R_55 = 1 - (R_53 * Q_1_53 + R_51 * Q_2_51 + R_49 * C_49_6 + R_39 * Q_4_39
+                    + R_37 * C_37_18 + R_35 * C_35_20 + R_33 * C_33_22 + R_23 * Q_5_23
+                    + R_21 * C_21_34 + R_19 * C_19_36 + R_17 * C_17_38 + R_7 * C_7_48
+                    + R_5 * C_5_50 + R_3 * C_3_52 + C_1_54);
+            const double Q_3_7 = Q_3_3 * q_2_3;
+            const double Q_3_23 = Q_3_7 * q_3_4;
+            const double Q_3_55 = Q_3_23 * q_3_5;
+            const double C_53_10 = Q_1_53 * Q_3_53;
+            const double C_51_12 = Q_2_51 * Q_3_51;
+            const double C_49_14 = C_49_6 * Q_3_49;
+            const double Q_1_45 = Q_1_13 * q_1_5;
+            const double Q_2_43 = Q_2_11 * q_2_5;
+            const double C_41_6 = Q_1_41 * Q_2_41;
+            const double Q_3_39 = Q_3_7 * q_3_5;
+            const double C_37_10 = Q_1_37 * Q_3_37;
+            const double C_35_12 = Q_2_35 * Q_3_35;
+            const double C_33_14 = C_33_6 * Q_3_33;
+            const double C_9_6 = Q_1_9 * Q_2_9;
+            const double C_5_10 = Q_1_5 * Q_3_5;
+            const double C_3_12 = Q_2_3 * Q_3_3;
+            const double C_1_14 = C_1_6 * q_0_3;
+            const double R_15 = 1 - (R_13 * Q_1_13 + R_11 * Q_2_11 + R_9 * C_9_6 + R_7 * Q_3_7
+                    + R_5 * C_5_10 + R_3 * C_3_12 + C_1_14);
+            const double Q_5_15 = Q_5_7 * q_3_5;
+            const double C_13_34 = Q_1_13 * Q_5_13;
+            const double C_11_36 = Q_2_11 * Q_5_11;
+            const double C_9_38 = C_9_6 * Q_5_9;
+            const double C_7_40 = Q_3_7 * Q_5_7;
+            const double C_5_42 = C_5_10 * Q_5_5;
+            const double C_3_44 = C_3_12 * Q_5_3;
+            const double C_1_46 = C_1_14 * q_0_5;
+            const double R_47 = 1 - (R_45 * Q_1_45 + R_43 * Q_2_43 + R_41 * C_41_6 + R_39 * Q_3_39
+                    + R_37 * C_37_10 + R_35 * C_35_12 + R_33 * C_33_14 + R_15 * Q_5_15
+                    + R_13 * C_13_34 + R_11 * C_11_36 + R_9 * C_9_38 + R_7 * C_7_40
+                    + R_5 * C_5_42 + R_3 * C_3_44 + C_1_46);
+            const double Q_4_15 = Q_4_7 * q_3_4;
+            const double Q_4_47 = Q_4_15 * q_4_5;
+            const double C_45_18 = Q_1_45 * Q_4_45;
+            const double C_43_20 = Q_2_43 * Q_4_43;
+            const double C_41_22 = C_41_6 * Q_4_41;
+            const double C_39_24 = Q_3_39 * Q_4_39;
+            const double C_37_26 = C_37_10 * Q_4_37;
+            const double C_35_28 = C_35_12 * Q_4_35;
+            const double C_33_30 = C_33_14 * Q_4_33;
+            const double C_25_6 = Q_1_25 * Q_2_25;
+            const double C_21_10 = Q_1_21 * Q_3_21;
+            const double C_19_12 = Q_2_19 * Q_3_19;
+            const double C_17_14 = C_17_6 * Q_3_17;
+            const double C_13_18 = Q_1_13 * Q_4_13;
+            const double C_11_20 = Q_2_11 * Q_4_11;
+            const double C_9_22 = C_9_6 * Q_4_9;
+            const double C_7_24 = Q_3_7 * Q_4_7;
+            const double C_5_26 = C_5_10 * Q_4_5;
+            const double C_3_28 = C_3_12 * Q_4_3;
+            const double C_1_30 = C_1_14 * q_0_4;
+            const double R_31 = 1 - (R_29 * Q_1_29 + R_27 * Q_2_27 + R_25 * C_25_6 + R_23 * Q_3_23
+                    + R_21 * C_21_10 + R_19 * C_19_12 + R_17 * C_17_14 + R_15 * Q_4_15
+                    + R_13 * C_13_18 + R_11 * C_11_20 + R_9 * C_9_22 + R_7 * C_7_24
+                    + R_5 * C_5_26 + R_3 * C_3_28 + C_1_30);
+            const double Q_5_31 = Q_5_15 * q_4_5;
+            const double C_29_34 = Q_1_29 * Q_5_29;
+            const double C_27_36 = Q_2_27 * Q_5_27;
+            const double C_25_38 = C_25_6 * Q_5_25;
+            const double C_23_40 = Q_3_23 * Q_5_23;
+            const double C_21_42 = C_21_10 * Q_5_21;
+            const double C_19_44 = C_19_12 * Q_5_19;
+            const double C_17_46 = C_17_14 * Q_5_17;
+            const double C_15_48 = Q_4_15 * Q_5_15;
+            const double C_13_50 = C_13_18 * Q_5_13;
+            const double C_11_52 = C_11_20 * Q_5_11;
+            const double C_9_54 = C_9_22 * Q_5_9;
+            const double C_7_56 = C_7_24 * Q_5_7;
+            const double C_5_58 = C_5_26 * Q_5_5;
+            const double C_3_60 = C_3_28 * Q_5_3;
+            const double C_1_62 = C_1_30 * q_0_5;
+            const double R_63 = 1 - (R_61 * Q_1_61 + R_59 * Q_2_59 + R_57 * C_57_6 + R_55 * Q_3_55
+                    + R_53 * C_53_10 + R_51 * C_51_12 + R_49 * C_49_14 + R_47 * Q_4_47
+                    + R_45 * C_45_18 + R_43 * C_43_20 + R_41 * C_41_22 + R_39 * C_39_24
+                    + R_37 * C_37_26 + R_35 * C_35_28 + R_33 * C_33_30 + R_31 * Q_5_31
+                    + R_29 * C_29_34 + R_27 * C_27_36 + R_25 * C_25_38 + R_23 * C_23_40
+                    + R_21 * C_21_42 + R_19 * C_19_44 + R_17 * C_17_46 + R_15 * C_15_48
+                    + R_13 * C_13_50 + R_11 * C_11_52 + R_9 * C_9_54 + R_7 * C_7_56
+                    + R_5 * C_5_58 + R_3 * C_3_60 + C_1_62);
+            double d_R_63 = 1.;
+            double d_R_61 = -d_R_63 * Q_1_61;
+            double d_Q_1_61 = -d_R_63 * R_61;
+            double d_R_59 = -d_R_63 * Q_2_59;
+            double d_Q_2_59 = -d_R_63 * R_59;
+            double d_R_57 = -d_R_63 * C_57_6;
+            double d_C_57_6 = -d_R_63 * R_57;
+            double d_R_55 = -d_R_63 * Q_3_55;
+            double d_Q_3_55 = -d_R_63 * R_55;
+            double d_R_53 = -d_R_63 * C_53_10;
+            double d_C_53_10 = -d_R_63 * R_53;
+            double d_R_51 = -d_R_63 * C_51_12;
+            double d_C_51_12 = -d_R_63 * R_51;
+            double d_R_49 = -d_R_63 * C_49_14;
+            double d_C_49_14 = -d_R_63 * R_49;
+            double d_R_47 = -d_R_63 * Q_4_47;
+            double d_Q_4_47 = -d_R_63 * R_47;
+            double d_R_45 = -d_R_63 * C_45_18;
+            double d_C_45_18 = -d_R_63 * R_45;
+            double d_R_43 = -d_R_63 * C_43_20;
+            double d_C_43_20 = -d_R_63 * R_43;
+            double d_R_41 = -d_R_63 * C_41_22;
+            double d_C_41_22 = -d_R_63 * R_41;
+            double d_R_39 = -d_R_63 * C_39_24;
+            double d_C_39_24 = -d_R_63 * R_39;
+            double d_R_37 = -d_R_63 * C_37_26;
+            double d_C_37_26 = -d_R_63 * R_37;
+            double d_R_35 = -d_R_63 * C_35_28;
+            double d_C_35_28 = -d_R_63 * R_35;
+            double d_R_33 = -d_R_63 * C_33_30;
+            double d_C_33_30 = -d_R_63 * R_33;
+            double d_R_31 = -d_R_63 * Q_5_31;
+            double d_Q_5_31 = -d_R_63 * R_31;
+            double d_R_29 = -d_R_63 * C_29_34;
+            double d_C_29_34 = -d_R_63 * R_29;
+            double d_R_27 = -d_R_63 * C_27_36;
+            double d_C_27_36 = -d_R_63 * R_27;
+            double d_R_25 = -d_R_63 * C_25_38;
+            double d_C_25_38 = -d_R_63 * R_25;
+            double d_R_23 = -d_R_63 * C_23_40;
+            double d_C_23_40 = -d_R_63 * R_23;
+            double d_R_21 = -d_R_63 * C_21_42;
+            double d_C_21_42 = -d_R_63 * R_21;
+            double d_R_19 = -d_R_63 * C_19_44;
+            double d_C_19_44 = -d_R_63 * R_19;
+            double d_R_17 = -d_R_63 * C_17_46;
+            double d_C_17_46 = -d_R_63 * R_17;
+            double d_R_15 = -d_R_63 * C_15_48;
+            double d_C_15_48 = -d_R_63 * R_15;
+            double d_R_13 = -d_R_63 * C_13_50;
+            double d_C_13_50 = -d_R_63 * R_13;
+            double d_R_11 = -d_R_63 * C_11_52;
+            double d_C_11_52 = -d_R_63 * R_11;
+            double d_R_9 = -d_R_63 * C_9_54;
+            double d_C_9_54 = -d_R_63 * R_9;
+            double d_R_7 = -d_R_63 * C_7_56;
+            double d_C_7_56 = -d_R_63 * R_7;
+            double d_R_5 = -d_R_63 * C_5_58;
+            double d_C_5_58 = -d_R_63 * R_5;
+            double d_R_3 = -d_R_63 * C_3_60;
+            double d_C_3_60 = -d_R_63 * R_3;
+            double d_C_1_62 = -d_R_63;
+            double d_C_1_30 = d_C_1_62 * q_0_5;
+            double d_q_0_5 = d_C_1_62 * C_1_30;
+            double d_C_3_28 = d_C_3_60 * Q_5_3;
+            double d_Q_5_3 = d_C_3_60 * C_3_28;
+            double d_C_5_26 = d_C_5_58 * Q_5_5;
+            double d_Q_5_5 = d_C_5_58 * C_5_26;
+            double d_C_7_24 = d_C_7_56 * Q_5_7;
+            double d_Q_5_7 = d_C_7_56 * C_7_24;
+            double d_C_9_22 = d_C_9_54 * Q_5_9;
+            double d_Q_5_9 = d_C_9_54 * C_9_22;
+            double d_C_11_20 = d_C_11_52 * Q_5_11;
+            double d_Q_5_11 = d_C_11_52 * C_11_20;
+            double d_C_13_18 = d_C_13_50 * Q_5_13;
+            double d_Q_5_13 = d_C_13_50 * C_13_18;
+            double d_Q_4_15 = d_C_15_48 * Q_5_15;
+            double d_Q_5_15 = d_C_15_48 * Q_4_15;
+            double d_C_17_14 = d_C_17_46 * Q_5_17;
+            double d_Q_5_17 = d_C_17_46 * C_17_14;
+            double d_C_19_12 = d_C_19_44 * Q_5_19;
+            double d_Q_5_19 = d_C_19_44 * C_19_12;
+            double d_C_21_10 = d_C_21_42 * Q_5_21;
+            double d_Q_5_21 = d_C_21_42 * C_21_10;
+            double d_Q_3_23 = d_C_23_40 * Q_5_23;
+            double d_Q_5_23 = d_C_23_40 * Q_3_23;
+            double d_C_25_6 = d_C_25_38 * Q_5_25;
+            double d_Q_5_25 = d_C_25_38 * C_25_6;
+            double d_Q_2_27 = d_C_27_36 * Q_5_27;
+            double d_Q_5_27 = d_C_27_36 * Q_2_27;
+            double d_Q_1_29 = d_C_29_34 * Q_5_29;
+            double d_Q_5_29 = d_C_29_34 * Q_1_29;
+            d_Q_5_15 += d_Q_5_31 * q_4_5;
+            double d_q_4_5 = d_Q_5_31 * Q_5_15;
+            d_R_29 += -d_R_31 * Q_1_29;
+            d_Q_1_29 += -d_R_31 * R_29;
+            d_R_27 += -d_R_31 * Q_2_27;
+            d_Q_2_27 += -d_R_31 * R_27;
+            d_R_25 += -d_R_31 * C_25_6;
+            d_C_25_6 += -d_R_31 * R_25;
+            d_R_23 += -d_R_31 * Q_3_23;
+            d_Q_3_23 += -d_R_31 * R_23;
+            d_R_21 += -d_R_31 * C_21_10;
+            d_C_21_10 += -d_R_31 * R_21;
+            d_R_19 += -d_R_31 * C_19_12;
+            d_C_19_12 += -d_R_31 * R_19;
+            d_R_17 += -d_R_31 * C_17_14;
+            d_C_17_14 += -d_R_31 * R_17;
+            d_R_15 += -d_R_31 * Q_4_15;
+            d_Q_4_15 += -d_R_31 * R_15;
+            d_R_13 += -d_R_31 * C_13_18;
+            d_C_13_18 += -d_R_31 * R_13;
+            d_R_11 += -d_R_31 * C_11_20;
+            d_C_11_20 += -d_R_31 * R_11;
+            d_R_9 += -d_R_31 * C_9_22;
+            d_C_9_22 += -d_R_31 * R_9;
+            d_R_7 += -d_R_31 * C_7_24;
+            d_C_7_24 += -d_R_31 * R_7;
+            d_R_5 += -d_R_31 * C_5_26;
+            d_C_5_26 += -d_R_31 * R_5;
+            d_R_3 += -d_R_31 * C_3_28;
+            d_C_3_28 += -d_R_31 * R_3;
+            d_C_1_30 += -d_R_31;
+            double d_C_1_14 = d_C_1_30 * q_0_4;
+            double d_q_0_4 = d_C_1_30 * C_1_14;
+            double d_C_3_12 = d_C_3_28 * Q_4_3;
+            double d_Q_4_3 = d_C_3_28 * C_3_12;
+            double d_C_5_10 = d_C_5_26 * Q_4_5;
+            double d_Q_4_5 = d_C_5_26 * C_5_10;
+            double d_Q_3_7 = d_C_7_24 * Q_4_7;
+            double d_Q_4_7 = d_C_7_24 * Q_3_7;
+            double d_C_9_6 = d_C_9_22 * Q_4_9;
+            double d_Q_4_9 = d_C_9_22 * C_9_6;
+            double d_Q_2_11 = d_C_11_20 * Q_4_11;
+            double d_Q_4_11 = d_C_11_20 * Q_2_11;
+            double d_Q_1_13 = d_C_13_18 * Q_4_13;
+            double d_Q_4_13 = d_C_13_18 * Q_1_13;
+            double d_C_17_6 = d_C_17_14 * Q_3_17;
+            double d_Q_3_17 = d_C_17_14 * C_17_6;
+            double d_Q_2_19 = d_C_19_12 * Q_3_19;
+            double d_Q_3_19 = d_C_19_12 * Q_2_19;
+            double d_Q_1_21 = d_C_21_10 * Q_3_21;
+            double d_Q_3_21 = d_C_21_10 * Q_1_21;
+            double d_Q_1_25 = d_C_25_6 * Q_2_25;
+            double d_Q_2_25 = d_C_25_6 * Q_1_25;
+            double d_C_33_14 = d_C_33_30 * Q_4_33;
+            double d_Q_4_33 = d_C_33_30 * C_33_14;
+            double d_C_35_12 = d_C_35_28 * Q_4_35;
+            double d_Q_4_35 = d_C_35_28 * C_35_12;
+            double d_C_37_10 = d_C_37_26 * Q_4_37;
+            double d_Q_4_37 = d_C_37_26 * C_37_10;
+            double d_Q_3_39 = d_C_39_24 * Q_4_39;
+            double d_Q_4_39 = d_C_39_24 * Q_3_39;
+            double d_C_41_6 = d_C_41_22 * Q_4_41;
+            double d_Q_4_41 = d_C_41_22 * C_41_6;
+            double d_Q_2_43 = d_C_43_20 * Q_4_43;
+            double d_Q_4_43 = d_C_43_20 * Q_2_43;
+            double d_Q_1_45 = d_C_45_18 * Q_4_45;
+            double d_Q_4_45 = d_C_45_18 * Q_1_45;
+            d_Q_4_15 += d_Q_4_47 * q_4_5;
+            d_q_4_5 += d_Q_4_47 * Q_4_15;
+            d_Q_4_7 += d_Q_4_15 * q_3_4;
+            double d_q_3_4 = d_Q_4_15 * Q_4_7;
+            d_R_45 += -d_R_47 * Q_1_45;
+            d_Q_1_45 += -d_R_47 * R_45;
+            d_R_43 += -d_R_47 * Q_2_43;
+            d_Q_2_43 += -d_R_47 * R_43;
+            d_R_41 += -d_R_47 * C_41_6;
+            d_C_41_6 += -d_R_47 * R_41;
+            d_R_39 += -d_R_47 * Q_3_39;
+            d_Q_3_39 += -d_R_47 * R_39;
+            d_R_37 += -d_R_47 * C_37_10;
+            d_C_37_10 += -d_R_47 * R_37;
+            d_R_35 += -d_R_47 * C_35_12;
+            d_C_35_12 += -d_R_47 * R_35;
+            d_R_33 += -d_R_47 * C_33_14;
+            d_C_33_14 += -d_R_47 * R_33;
+            d_R_15 += -d_R_47 * Q_5_15;
+            d_Q_5_15 += -d_R_47 * R_15;
+            d_R_13 += -d_R_47 * C_13_34;
+            double d_C_13_34 = -d_R_47 * R_13;
+            d_R_11 += -d_R_47 * C_11_36;
+            double d_C_11_36 = -d_R_47 * R_11;
+            d_R_9 += -d_R_47 * C_9_38;
+            double d_C_9_38 = -d_R_47 * R_9;
+            d_R_7 += -d_R_47 * C_7_40;
+            double d_C_7_40 = -d_R_47 * R_7;
+            d_R_5 += -d_R_47 * C_5_42;
+            double d_C_5_42 = -d_R_47 * R_5;
+            d_R_3 += -d_R_47 * C_3_44;
+            double d_C_3_44 = -d_R_47 * R_3;
+            double d_C_1_46 = -d_R_47;
+            d_C_1_14 += d_C_1_46 * q_0_5;
+            d_q_0_5 += d_C_1_46 * C_1_14;
+            d_C_3_12 += d_C_3_44 * Q_5_3;
+            d_Q_5_3 += d_C_3_44 * C_3_12;
+            d_C_5_10 += d_C_5_42 * Q_5_5;
+            d_Q_5_5 += d_C_5_42 * C_5_10;
+            d_Q_3_7 += d_C_7_40 * Q_5_7;
+            d_Q_5_7 += d_C_7_40 * Q_3_7;
+            d_C_9_6 += d_C_9_38 * Q_5_9;
+            d_Q_5_9 += d_C_9_38 * C_9_6;
+            d_Q_2_11 += d_C_11_36 * Q_5_11;
+            d_Q_5_11 += d_C_11_36 * Q_2_11;
+            d_Q_1_13 += d_C_13_34 * Q_5_13;
+            d_Q_5_13 += d_C_13_34 * Q_1_13;
+            d_Q_5_7 += d_Q_5_15 * q_3_5;
+            double d_q_3_5 = d_Q_5_15 * Q_5_7;
+            d_R_13 += -d_R_15 * Q_1_13;
+            d_Q_1_13 += -d_R_15 * R_13;
+            d_R_11 += -d_R_15 * Q_2_11;
+            d_Q_2_11 += -d_R_15 * R_11;
+            d_R_9 += -d_R_15 * C_9_6;
+            d_C_9_6 += -d_R_15 * R_9;
+            d_R_7 += -d_R_15 * Q_3_7;
+            d_Q_3_7 += -d_R_15 * R_7;
+            d_R_5 += -d_R_15 * C_5_10;
+            d_C_5_10 += -d_R_15 * R_5;
+            d_R_3 += -d_R_15 * C_3_12;
+            d_C_3_12 += -d_R_15 * R_3;
+            d_C_1_14 += -d_R_15;
+            double d_C_1_6 = d_C_1_14 * q_0_3;
+            double d_q_0_3 = d_C_1_14 * C_1_6;
+            double d_Q_2_3 = d_C_3_12 * Q_3_3;
+            double d_Q_3_3 = d_C_3_12 * Q_2_3;
+            double d_Q_1_5 = d_C_5_10 * Q_3_5;
+            double d_Q_3_5 = d_C_5_10 * Q_1_5;
+            double d_Q_1_9 = d_C_9_6 * Q_2_9;
+            double d_Q_2_9 = d_C_9_6 * Q_1_9;
+            double d_C_33_6 = d_C_33_14 * Q_3_33;
+            double d_Q_3_33 = d_C_33_14 * C_33_6;
+            double d_Q_2_35 = d_C_35_12 * Q_3_35;
+            double d_Q_3_35 = d_C_35_12 * Q_2_35;
+            double d_Q_1_37 = d_C_37_10 * Q_3_37;
+            double d_Q_3_37 = d_C_37_10 * Q_1_37;
+            d_Q_3_7 += d_Q_3_39 * q_3_5;
+            d_q_3_5 += d_Q_3_39 * Q_3_7;
+            double d_Q_1_41 = d_C_41_6 * Q_2_41;
+            double d_Q_2_41 = d_C_41_6 * Q_1_41;
+            d_Q_2_11 += d_Q_2_43 * q_2_5;
+            double d_q_2_5 = d_Q_2_43 * Q_2_11;
+            d_Q_1_13 += d_Q_1_45 * q_1_5;
+            double d_q_1_5 = d_Q_1_45 * Q_1_13;
+            double d_C_49_6 = d_C_49_14 * Q_3_49;
+            double d_Q_3_49 = d_C_49_14 * C_49_6;
+            double d_Q_2_51 = d_C_51_12 * Q_3_51;
+            double d_Q_3_51 = d_C_51_12 * Q_2_51;
+            double d_Q_1_53 = d_C_53_10 * Q_3_53;
+            double d_Q_3_53 = d_C_53_10 * Q_1_53;
+            d_Q_3_23 += d_Q_3_55 * q_3_5;
+            d_q_3_5 += d_Q_3_55 * Q_3_23;
+            d_Q_3_7 += d_Q_3_23 * q_3_4;
+            d_q_3_4 += d_Q_3_23 * Q_3_7;
+            d_Q_3_3 += d_Q_3_7 * q_2_3;
+            double d_q_2_3 = d_Q_3_7 * Q_3_3;
+            d_R_53 += -d_R_55 * Q_1_53;
+            d_Q_1_53 += -d_R_55 * R_53;
+            d_R_51 += -d_R_55 * Q_2_51;
+            d_Q_2_51 += -d_R_55 * R_51;
+            d_R_49 += -d_R_55 * C_49_6;
+            d_C_49_6 += -d_R_55 * R_49;
+            d_R_39 += -d_R_55 * Q_4_39;
+            d_Q_4_39 += -d_R_55 * R_39;
+            d_R_37 += -d_R_55 * C_37_18;
+            double d_C_37_18 = -d_R_55 * R_37;
+            d_R_35 += -d_R_55 * C_35_20;
+            double d_C_35_20 = -d_R_55 * R_35;
+            d_R_33 += -d_R_55 * C_33_22;
+            double d_C_33_22 = -d_R_55 * R_33;
+            d_R_23 += -d_R_55 * Q_5_23;
+            d_Q_5_23 += -d_R_55 * R_23;
+            d_R_21 += -d_R_55 * C_21_34;
+            double d_C_21_34 = -d_R_55 * R_21;
+            d_R_19 += -d_R_55 * C_19_36;
+            double d_C_19_36 = -d_R_55 * R_19;
+            d_R_17 += -d_R_55 * C_17_38;
+            double d_C_17_38 = -d_R_55 * R_17;
+            d_R_7 += -d_R_55 * C_7_48;
+            double d_C_7_48 = -d_R_55 * R_7;
+            d_R_5 += -d_R_55 * C_5_50;
+            double d_C_5_50 = -d_R_55 * R_5;
+            d_R_3 += -d_R_55 * C_3_52;
+            double d_C_3_52 = -d_R_55 * R_3;
+            double d_C_1_54 = -d_R_55;
+            double d_C_1_22 = d_C_1_54 * q_0_5;
+            d_q_0_5 += d_C_1_54 * C_1_22;
+            double d_C_3_20 = d_C_3_52 * Q_5_3;
+            d_Q_5_3 += d_C_3_52 * C_3_20;
+            double d_C_5_18 = d_C_5_50 * Q_5_5;
+            d_Q_5_5 += d_C_5_50 * C_5_18;
+            d_Q_4_7 += d_C_7_48 * Q_5_7;
+            d_Q_5_7 += d_C_7_48 * Q_4_7;
+            d_C_17_6 += d_C_17_38 * Q_5_17;
+            d_Q_5_17 += d_C_17_38 * C_17_6;
+            d_Q_2_19 += d_C_19_36 * Q_5_19;
+            d_Q_5_19 += d_C_19_36 * Q_2_19;
+            d_Q_1_21 += d_C_21_34 * Q_5_21;
+            d_Q_5_21 += d_C_21_34 * Q_1_21;
+            d_Q_5_7 += d_Q_5_23 * q_4_5;
+            d_q_4_5 += d_Q_5_23 * Q_5_7;
+            d_R_21 += -d_R_23 * Q_1_21;
+            d_Q_1_21 += -d_R_23 * R_21;
+            d_R_19 += -d_R_23 * Q_2_19;
+            d_Q_2_19 += -d_R_23 * R_19;
+            d_R_17 += -d_R_23 * C_17_6;
+            d_C_17_6 += -d_R_23 * R_17;
+            d_R_7 += -d_R_23 * Q_4_7;
+            d_Q_4_7 += -d_R_23 * R_7;
+            d_R_5 += -d_R_23 * C_5_18;
+            d_C_5_18 += -d_R_23 * R_5;
+            d_R_3 += -d_R_23 * C_3_20;
+            d_C_3_20 += -d_R_23 * R_3;
+            d_C_1_22 += -d_R_23;
+            d_C_1_6 += d_C_1_22 * q_0_4;
+            d_q_0_4 += d_C_1_22 * C_1_6;
+            d_Q_2_3 += d_C_3_20 * Q_4_3;
+            d_Q_4_3 += d_C_3_20 * Q_2_3;
+            d_Q_1_5 += d_C_5_18 * Q_4_5;
+            d_Q_4_5 += d_C_5_18 * Q_1_5;
+            double d_Q_1_17 = d_C_17_6 * Q_2_17;
+            double d_Q_2_17 = d_C_17_6 * Q_1_17;
+            d_C_33_6 += d_C_33_22 * Q_4_33;
+            d_Q_4_33 += d_C_33_22 * C_33_6;
+            d_Q_2_35 += d_C_35_20 * Q_4_35;
+            d_Q_4_35 += d_C_35_20 * Q_2_35;
+            d_Q_1_37 += d_C_37_18 * Q_4_37;
+            d_Q_4_37 += d_C_37_18 * Q_1_37;
+            d_Q_4_7 += d_Q_4_39 * q_4_5;
+            d_q_4_5 += d_Q_4_39 * Q_4_7;
+            d_Q_4_3 += d_Q_4_7 * q_2_4;
+            double d_q_2_4 = d_Q_4_7 * Q_4_3;
+            d_R_37 += -d_R_39 * Q_1_37;
+            d_Q_1_37 += -d_R_39 * R_37;
+            d_R_35 += -d_R_39 * Q_2_35;
+            d_Q_2_35 += -d_R_39 * R_35;
+            d_R_33 += -d_R_39 * C_33_6;
+            d_C_33_6 += -d_R_39 * R_33;
+            d_R_7 += -d_R_39 * Q_5_7;
+            d_Q_5_7 += -d_R_39 * R_7;
+            d_R_5 += -d_R_39 * C_5_34;
+            double d_C_5_34 = -d_R_39 * R_5;
+            d_R_3 += -d_R_39 * C_3_36;
+            double d_C_3_36 = -d_R_39 * R_3;
+            double d_C_1_38 = -d_R_39;
+            d_C_1_6 += d_C_1_38 * q_0_5;
+            d_q_0_5 += d_C_1_38 * C_1_6;
+            d_Q_2_3 += d_C_3_36 * Q_5_3;
+            d_Q_5_3 += d_C_3_36 * Q_2_3;
+            d_Q_1_5 += d_C_5_34 * Q_5_5;
+            d_Q_5_5 += d_C_5_34 * Q_1_5;
+            d_Q_5_3 += d_Q_5_7 * q_2_5;
+            d_q_2_5 += d_Q_5_7 * Q_5_3;
+            d_R_5 += -d_R_7 * Q_1_5;
+            d_Q_1_5 += -d_R_7 * R_5;
+            d_R_3 += -d_R_7 * Q_2_3;
+            d_Q_2_3 += -d_R_7 * R_3;
+            d_C_1_6 += -d_R_7;
+            double d_q_0_1 = d_C_1_6 * q_0_2;
+            double d_q_0_2 = d_C_1_6 * q_0_1;
+            double d_Q_1_33 = d_C_33_6 * Q_2_33;
+            double d_Q_2_33 = d_C_33_6 * Q_1_33;
+            d_Q_2_3 += d_Q_2_35 * q_2_5;
+            d_q_2_5 += d_Q_2_35 * Q_2_3;
+            d_Q_1_5 += d_Q_1_37 * q_1_5;
+            d_q_1_5 += d_Q_1_37 * Q_1_5;
+            double d_Q_1_49 = d_C_49_6 * Q_2_49;
+            double d_Q_2_49 = d_C_49_6 * Q_1_49;
+            d_Q_2_19 += d_Q_2_51 * q_2_5;
+            d_q_2_5 += d_Q_2_51 * Q_2_19;
+            d_Q_2_3 += d_Q_2_19 * q_2_4;
+            d_q_2_4 += d_Q_2_19 * Q_2_3;
+            d_Q_1_21 += d_Q_1_53 * q_1_5;
+            d_q_1_5 += d_Q_1_53 * Q_1_21;
+            d_Q_1_5 += d_Q_1_21 * q_1_4;
+            double d_q_1_4 = d_Q_1_21 * Q_1_5;
+            double d_Q_1_57 = d_C_57_6 * Q_2_57;
+            double d_Q_2_57 = d_C_57_6 * Q_1_57;
+            d_Q_2_27 += d_Q_2_59 * q_2_5;
+            d_q_2_5 += d_Q_2_59 * Q_2_27;
+            d_Q_2_11 += d_Q_2_27 * q_2_4;
+            d_q_2_4 += d_Q_2_27 * Q_2_11;
+            d_Q_2_3 += d_Q_2_11 * q_2_3;
+            d_q_2_3 += d_Q_2_11 * Q_2_3;
+            d_q_0_2 += d_Q_2_3 * q_1_2;
+            double d_q_1_2 = d_Q_2_3 * q_0_2;
+            d_R_57 += -d_R_59 * Q_1_57;
+            d_Q_1_57 += -d_R_59 * R_57;
+            d_R_51 += -d_R_59 * Q_3_51;
+            d_Q_3_51 += -d_R_59 * R_51;
+            d_R_49 += -d_R_59 * C_49_10;
+            double d_C_49_10 = -d_R_59 * R_49;
+            d_R_43 += -d_R_59 * Q_4_43;
+            d_Q_4_43 += -d_R_59 * R_43;
+            d_R_41 += -d_R_59 * C_41_18;
+            double d_C_41_18 = -d_R_59 * R_41;
+            d_R_35 += -d_R_59 * C_35_24;
+            double d_C_35_24 = -d_R_59 * R_35;
+            d_R_33 += -d_R_59 * C_33_26;
+            double d_C_33_26 = -d_R_59 * R_33;
+            d_R_27 += -d_R_59 * Q_5_27;
+            d_Q_5_27 += -d_R_59 * R_27;
+            d_R_25 += -d_R_59 * C_25_34;
+            double d_C_25_34 = -d_R_59 * R_25;
+            d_R_19 += -d_R_59 * C_19_40;
+            double d_C_19_40 = -d_R_59 * R_19;
+            d_R_17 += -d_R_59 * C_17_42;
+            double d_C_17_42 = -d_R_59 * R_17;
+            d_R_11 += -d_R_59 * C_11_48;
+            double d_C_11_48 = -d_R_59 * R_11;
+            d_R_9 += -d_R_59 * C_9_50;
+            double d_C_9_50 = -d_R_59 * R_9;
+            d_R_3 += -d_R_59 * C_3_56;
+            double d_C_3_56 = -d_R_59 * R_3;
+            double d_C_1_58 = -d_R_59;
+            double d_C_1_26 = d_C_1_58 * q_0_5;
+            d_q_0_5 += d_C_1_58 * C_1_26;
+            double d_C_3_24 = d_C_3_56 * Q_5_3;
+            d_Q_5_3 += d_C_3_56 * C_3_24;
+            double d_C_9_18 = d_C_9_50 * Q_5_9;
+            d_Q_5_9 += d_C_9_50 * C_9_18;
+            d_Q_4_11 += d_C_11_48 * Q_5_11;
+            d_Q_5_11 += d_C_11_48 * Q_4_11;
+            double d_C_17_10 = d_C_17_42 * Q_5_17;
+            d_Q_5_17 += d_C_17_42 * C_17_10;
+            d_Q_3_19 += d_C_19_40 * Q_5_19;
+            d_Q_5_19 += d_C_19_40 * Q_3_19;
+            d_Q_1_25 += d_C_25_34 * Q_5_25;
+            d_Q_5_25 += d_C_25_34 * Q_1_25;
+            d_Q_5_11 += d_Q_5_27 * q_4_5;
+            d_q_4_5 += d_Q_5_27 * Q_5_11;
+            d_R_25 += -d_R_27 * Q_1_25;
+            d_Q_1_25 += -d_R_27 * R_25;
+            d_R_19 += -d_R_27 * Q_3_19;
+            d_Q_3_19 += -d_R_27 * R_19;
+            d_R_17 += -d_R_27 * C_17_10;
+            d_C_17_10 += -d_R_27 * R_17;
+            d_R_11 += -d_R_27 * Q_4_11;
+            d_Q_4_11 += -d_R_27 * R_11;
+            d_R_9 += -d_R_27 * C_9_18;
+            d_C_9_18 += -d_R_27 * R_9;
+            d_R_3 += -d_R_27 * C_3_24;
+            d_C_3_24 += -d_R_27 * R_3;
+            d_C_1_26 += -d_R_27;
+            double d_C_1_10 = d_C_1_26 * q_0_4;
+            d_q_0_4 += d_C_1_26 * C_1_10;
+            d_Q_3_3 += d_C_3_24 * Q_4_3;
+            d_Q_4_3 += d_C_3_24 * Q_3_3;
+            d_Q_1_9 += d_C_9_18 * Q_4_9;
+            d_Q_4_9 += d_C_9_18 * Q_1_9;
+            d_Q_1_17 += d_C_17_10 * Q_3_17;
+            d_Q_3_17 += d_C_17_10 * Q_1_17;
+            double d_C_33_10 = d_C_33_26 * Q_4_33;
+            d_Q_4_33 += d_C_33_26 * C_33_10;
+            d_Q_3_35 += d_C_35_24 * Q_4_35;
+            d_Q_4_35 += d_C_35_24 * Q_3_35;
+            d_Q_1_41 += d_C_41_18 * Q_4_41;
+            d_Q_4_41 += d_C_41_18 * Q_1_41;
+            d_Q_4_11 += d_Q_4_43 * q_4_5;
+            d_q_4_5 += d_Q_4_43 * Q_4_11;
+            d_Q_4_3 += d_Q_4_11 * q_3_4;
+            d_q_3_4 += d_Q_4_11 * Q_4_3;
+            d_R_41 += -d_R_43 * Q_1_41;
+            d_Q_1_41 += -d_R_43 * R_41;
+            d_R_35 += -d_R_43 * Q_3_35;
+            d_Q_3_35 += -d_R_43 * R_35;
+            d_R_33 += -d_R_43 * C_33_10;
+            d_C_33_10 += -d_R_43 * R_33;
+            d_R_11 += -d_R_43 * Q_5_11;
+            d_Q_5_11 += -d_R_43 * R_11;
+            d_R_9 += -d_R_43 * C_9_34;
+            double d_C_9_34 = -d_R_43 * R_9;
+            d_R_3 += -d_R_43 * C_3_40;
+            double d_C_3_40 = -d_R_43 * R_3;
+            double d_C_1_42 = -d_R_43;
+            d_C_1_10 += d_C_1_42 * q_0_5;
+            d_q_0_5 += d_C_1_42 * C_1_10;
+            d_Q_3_3 += d_C_3_40 * Q_5_3;
+            d_Q_5_3 += d_C_3_40 * Q_3_3;
+            d_Q_1_9 += d_C_9_34 * Q_5_9;
+            d_Q_5_9 += d_C_9_34 * Q_1_9;
+            d_Q_5_3 += d_Q_5_11 * q_3_5;
+            d_q_3_5 += d_Q_5_11 * Q_5_3;
+            d_R_9 += -d_R_11 * Q_1_9;
+            d_Q_1_9 += -d_R_11 * R_9;
+            d_R_3 += -d_R_11 * Q_3_3;
+            d_Q_3_3 += -d_R_11 * R_3;
+            d_C_1_10 += -d_R_11;
+            d_q_0_1 += d_C_1_10 * q_0_3;
+            d_q_0_3 += d_C_1_10 * q_0_1;
+            d_Q_1_33 += d_C_33_10 * Q_3_33;
+            d_Q_3_33 += d_C_33_10 * Q_1_33;
+            d_Q_3_3 += d_Q_3_35 * q_3_5;
+            d_q_3_5 += d_Q_3_35 * Q_3_3;
+            d_Q_1_9 += d_Q_1_41 * q_1_5;
+            d_q_1_5 += d_Q_1_41 * Q_1_9;
+            d_Q_1_49 += d_C_49_10 * Q_3_49;
+            d_Q_3_49 += d_C_49_10 * Q_1_49;
+            d_Q_3_19 += d_Q_3_51 * q_3_5;
+            d_q_3_5 += d_Q_3_51 * Q_3_19;
+            d_Q_3_3 += d_Q_3_19 * q_3_4;
+            d_q_3_4 += d_Q_3_19 * Q_3_3;
+            d_q_0_3 += d_Q_3_3 * q_1_3;
+            double d_q_1_3 = d_Q_3_3 * q_0_3;
+            d_R_49 += -d_R_51 * Q_1_49;
+            d_Q_1_49 += -d_R_51 * R_49;
+            d_R_35 += -d_R_51 * Q_4_35;
+            d_Q_4_35 += -d_R_51 * R_35;
+            d_R_33 += -d_R_51 * C_33_18;
+            double d_C_33_18 = -d_R_51 * R_33;
+            d_R_19 += -d_R_51 * Q_5_19;
+            d_Q_5_19 += -d_R_51 * R_19;
+            d_R_17 += -d_R_51 * C_17_34;
+            double d_C_17_34 = -d_R_51 * R_17;
+            d_R_3 += -d_R_51 * C_3_48;
+            double d_C_3_48 = -d_R_51 * R_3;
+            double d_C_1_50 = -d_R_51;
+            double d_C_1_18 = d_C_1_50 * q_0_5;
+            d_q_0_5 += d_C_1_50 * C_1_18;
+            d_Q_4_3 += d_C_3_48 * Q_5_3;
+            d_Q_5_3 += d_C_3_48 * Q_4_3;
+            d_Q_1_17 += d_C_17_34 * Q_5_17;
+            d_Q_5_17 += d_C_17_34 * Q_1_17;
+            d_Q_5_3 += d_Q_5_19 * q_4_5;
+            d_q_4_5 += d_Q_5_19 * Q_5_3;
+            d_R_17 += -d_R_19 * Q_1_17;
+            d_Q_1_17 += -d_R_19 * R_17;
+            d_R_3 += -d_R_19 * Q_4_3;
+            d_Q_4_3 += -d_R_19 * R_3;
+            d_C_1_18 += -d_R_19;
+            d_q_0_1 += d_C_1_18 * q_0_4;
+            d_q_0_4 += d_C_1_18 * q_0_1;
+            d_Q_1_33 += d_C_33_18 * Q_4_33;
+            d_Q_4_33 += d_C_33_18 * Q_1_33;
+            d_Q_4_3 += d_Q_4_35 * q_4_5;
+            d_q_4_5 += d_Q_4_35 * Q_4_3;
+            d_q_0_4 += d_Q_4_3 * q_1_4;
+            d_q_1_4 += d_Q_4_3 * q_0_4;
+            d_R_33 += -d_R_35 * Q_1_33;
+            d_Q_1_33 += -d_R_35 * R_33;
+            d_R_3 += -d_R_35 * Q_5_3;
+            d_Q_5_3 += -d_R_35 * R_3;
+            double d_C_1_34 = -d_R_35;
+            d_q_0_1 += d_C_1_34 * q_0_5;
+            d_q_0_5 += d_C_1_34 * q_0_1;
+            d_q_0_5 += d_Q_5_3 * q_1_5;
+            d_q_1_5 += d_Q_5_3 * q_0_5;
+            d_q_0_1 += -d_R_3;
+            d_q_0_1 += d_Q_1_33 * q_1_5;
+            d_q_1_5 += d_Q_1_33 * q_0_1;
+            d_Q_1_17 += d_Q_1_49 * q_1_5;
+            d_q_1_5 += d_Q_1_49 * Q_1_17;
+            d_q_0_1 += d_Q_1_17 * q_1_4;
+            d_q_1_4 += d_Q_1_17 * q_0_1;
+            d_Q_1_25 += d_Q_1_57 * q_1_5;
+            d_q_1_5 += d_Q_1_57 * Q_1_25;
+            d_Q_1_9 += d_Q_1_25 * q_1_4;
+            d_q_1_4 += d_Q_1_25 * Q_1_9;
+            d_q_0_1 += d_Q_1_9 * q_1_3;
+            d_q_1_3 += d_Q_1_9 * q_0_1;
+            d_Q_1_29 += d_Q_1_61 * q_1_5;
+            d_q_1_5 += d_Q_1_61 * Q_1_29;
+            d_Q_1_13 += d_Q_1_29 * q_1_4;
+            d_q_1_4 += d_Q_1_29 * Q_1_13;
+            d_Q_1_5 += d_Q_1_13 * q_1_3;
+            d_q_1_3 += d_Q_1_13 * Q_1_5;
+            d_q_0_1 += d_Q_1_5 * q_1_2;
+            d_q_1_2 += d_Q_1_5 * q_0_1;
+            d_R_57 += -d_R_61 * Q_2_57;
+            d_Q_2_57 += -d_R_61 * R_57;
+            d_R_53 += -d_R_61 * Q_3_53;
+            d_Q_3_53 += -d_R_61 * R_53;
+            d_R_49 += -d_R_61 * C_49_12;
+            double d_C_49_12 = -d_R_61 * R_49;
+            d_R_45 += -d_R_61 * Q_4_45;
+            d_Q_4_45 += -d_R_61 * R_45;
+            d_R_41 += -d_R_61 * C_41_20;
+            double d_C_41_20 = -d_R_61 * R_41;
+            d_R_37 += -d_R_61 * C_37_24;
+            double d_C_37_24 = -d_R_61 * R_37;
+            d_R_33 += -d_R_61 * C_33_28;
+            double d_C_33_28 = -d_R_61 * R_33;
+            d_R_29 += -d_R_61 * Q_5_29;
+            d_Q_5_29 += -d_R_61 * R_29;
+            d_R_25 += -d_R_61 * C_25_36;
+            double d_C_25_36 = -d_R_61 * R_25;
+            d_R_21 += -d_R_61 * C_21_40;
+            double d_C_21_40 = -d_R_61 * R_21;
+            d_R_17 += -d_R_61 * C_17_44;
+            double d_C_17_44 = -d_R_61 * R_17;
+            d_R_13 += -d_R_61 * C_13_48;
+            double d_C_13_48 = -d_R_61 * R_13;
+            d_R_9 += -d_R_61 * C_9_52;
+            double d_C_9_52 = -d_R_61 * R_9;
+            d_R_5 += -d_R_61 * C_5_56;
+            double d_C_5_56 = -d_R_61 * R_5;
+            double d_C_1_60 = -d_R_61;
+            double d_C_1_28 = d_C_1_60 * q_0_5;
+            d_q_0_5 += d_C_1_60 * C_1_28;
+            double d_C_5_24 = d_C_5_56 * Q_5_5;
+            d_Q_5_5 += d_C_5_56 * C_5_24;
+            double d_C_9_20 = d_C_9_52 * Q_5_9;
+            d_Q_5_9 += d_C_9_52 * C_9_20;
+            d_Q_4_13 += d_C_13_48 * Q_5_13;
+            d_Q_5_13 += d_C_13_48 * Q_4_13;
+            double d_C_17_12 = d_C_17_44 * Q_5_17;
+            d_Q_5_17 += d_C_17_44 * C_17_12;
+            d_Q_3_21 += d_C_21_40 * Q_5_21;
+            d_Q_5_21 += d_C_21_40 * Q_3_21;
+            d_Q_2_25 += d_C_25_36 * Q_5_25;
+            d_Q_5_25 += d_C_25_36 * Q_2_25;
+            d_Q_5_13 += d_Q_5_29 * q_4_5;
+            d_q_4_5 += d_Q_5_29 * Q_5_13;
+            d_R_25 += -d_R_29 * Q_2_25;
+            d_Q_2_25 += -d_R_29 * R_25;
+            d_R_21 += -d_R_29 * Q_3_21;
+            d_Q_3_21 += -d_R_29 * R_21;
+            d_R_17 += -d_R_29 * C_17_12;
+            d_C_17_12 += -d_R_29 * R_17;
+            d_R_13 += -d_R_29 * Q_4_13;
+            d_Q_4_13 += -d_R_29 * R_13;
+            d_R_9 += -d_R_29 * C_9_20;
+            d_C_9_20 += -d_R_29 * R_9;
+            d_R_5 += -d_R_29 * C_5_24;
+            d_C_5_24 += -d_R_29 * R_5;
+            d_C_1_28 += -d_R_29;
+            double d_C_1_12 = d_C_1_28 * q_0_4;
+            d_q_0_4 += d_C_1_28 * C_1_12;
+            d_Q_3_5 += d_C_5_24 * Q_4_5;
+            d_Q_4_5 += d_C_5_24 * Q_3_5;
+            d_Q_2_9 += d_C_9_20 * Q_4_9;
+            d_Q_4_9 += d_C_9_20 * Q_2_9;
+            d_Q_2_17 += d_C_17_12 * Q_3_17;
+            d_Q_3_17 += d_C_17_12 * Q_2_17;
+            double d_C_33_12 = d_C_33_28 * Q_4_33;
+            d_Q_4_33 += d_C_33_28 * C_33_12;
+            d_Q_3_37 += d_C_37_24 * Q_4_37;
+            d_Q_4_37 += d_C_37_24 * Q_3_37;
+            d_Q_2_41 += d_C_41_20 * Q_4_41;
+            d_Q_4_41 += d_C_41_20 * Q_2_41;
+            d_Q_4_13 += d_Q_4_45 * q_4_5;
+            d_q_4_5 += d_Q_4_45 * Q_4_13;
+            d_Q_4_5 += d_Q_4_13 * q_3_4;
+            d_q_3_4 += d_Q_4_13 * Q_4_5;
+            d_R_41 += -d_R_45 * Q_2_41;
+            d_Q_2_41 += -d_R_45 * R_41;
+            d_R_37 += -d_R_45 * Q_3_37;
+            d_Q_3_37 += -d_R_45 * R_37;
+            d_R_33 += -d_R_45 * C_33_12;
+            d_C_33_12 += -d_R_45 * R_33;
+            d_R_13 += -d_R_45 * Q_5_13;
+            d_Q_5_13 += -d_R_45 * R_13;
+            d_R_9 += -d_R_45 * C_9_36;
+            double d_C_9_36 = -d_R_45 * R_9;
+            d_R_5 += -d_R_45 * C_5_40;
+            double d_C_5_40 = -d_R_45 * R_5;
+            double d_C_1_44 = -d_R_45;
+            d_C_1_12 += d_C_1_44 * q_0_5;
+            d_q_0_5 += d_C_1_44 * C_1_12;
+            d_Q_3_5 += d_C_5_40 * Q_5_5;
+            d_Q_5_5 += d_C_5_40 * Q_3_5;
+            d_Q_2_9 += d_C_9_36 * Q_5_9;
+            d_Q_5_9 += d_C_9_36 * Q_2_9;
+            d_Q_5_5 += d_Q_5_13 * q_3_5;
+            d_q_3_5 += d_Q_5_13 * Q_5_5;
+            d_R_9 += -d_R_13 * Q_2_9;
+            d_Q_2_9 += -d_R_13 * R_9;
+            d_R_5 += -d_R_13 * Q_3_5;
+            d_Q_3_5 += -d_R_13 * R_5;
+            d_C_1_12 += -d_R_13;
+            d_q_0_2 += d_C_1_12 * q_0_3;
+            d_q_0_3 += d_C_1_12 * q_0_2;
+            d_Q_2_33 += d_C_33_12 * Q_3_33;
+            d_Q_3_33 += d_C_33_12 * Q_2_33;
+            d_Q_3_5 += d_Q_3_37 * q_3_5;
+            d_q_3_5 += d_Q_3_37 * Q_3_5;
+            d_Q_2_9 += d_Q_2_41 * q_2_5;
+            d_q_2_5 += d_Q_2_41 * Q_2_9;
+            d_Q_2_49 += d_C_49_12 * Q_3_49;
+            d_Q_3_49 += d_C_49_12 * Q_2_49;
+            d_Q_3_21 += d_Q_3_53 * q_3_5;
+            d_q_3_5 += d_Q_3_53 * Q_3_21;
+            d_Q_3_5 += d_Q_3_21 * q_3_4;
+            d_q_3_4 += d_Q_3_21 * Q_3_5;
+            d_q_0_3 += d_Q_3_5 * q_2_3;
+            d_q_2_3 += d_Q_3_5 * q_0_3;
+            d_R_49 += -d_R_53 * Q_2_49;
+            d_Q_2_49 += -d_R_53 * R_49;
+            d_R_37 += -d_R_53 * Q_4_37;
+            d_Q_4_37 += -d_R_53 * R_37;
+            d_R_33 += -d_R_53 * C_33_20;
+            double d_C_33_20 = -d_R_53 * R_33;
+            d_R_21 += -d_R_53 * Q_5_21;
+            d_Q_5_21 += -d_R_53 * R_21;
+            d_R_17 += -d_R_53 * C_17_36;
+            double d_C_17_36 = -d_R_53 * R_17;
+            d_R_5 += -d_R_53 * C_5_48;
+            double d_C_5_48 = -d_R_53 * R_5;
+            double d_C_1_52 = -d_R_53;
+            double d_C_1_20 = d_C_1_52 * q_0_5;
+            d_q_0_5 += d_C_1_52 * C_1_20;
+            d_Q_4_5 += d_C_5_48 * Q_5_5;
+            d_Q_5_5 += d_C_5_48 * Q_4_5;
+            d_Q_2_17 += d_C_17_36 * Q_5_17;
+            d_Q_5_17 += d_C_17_36 * Q_2_17;
+            d_Q_5_5 += d_Q_5_21 * q_4_5;
+            d_q_4_5 += d_Q_5_21 * Q_5_5;
+            d_R_17 += -d_R_21 * Q_2_17;
+            d_Q_2_17 += -d_R_21 * R_17;
+            d_R_5 += -d_R_21 * Q_4_5;
+            d_Q_4_5 += -d_R_21 * R_5;
+            d_C_1_20 += -d_R_21;
+            d_q_0_2 += d_C_1_20 * q_0_4;
+            d_q_0_4 += d_C_1_20 * q_0_2;
+            d_Q_2_33 += d_C_33_20 * Q_4_33;
+            d_Q_4_33 += d_C_33_20 * Q_2_33;
+            d_Q_4_5 += d_Q_4_37 * q_4_5;
+            d_q_4_5 += d_Q_4_37 * Q_4_5;
+            d_q_0_4 += d_Q_4_5 * q_2_4;
+            d_q_2_4 += d_Q_4_5 * q_0_4;
+            d_R_33 += -d_R_37 * Q_2_33;
+            d_Q_2_33 += -d_R_37 * R_33;
+            d_R_5 += -d_R_37 * Q_5_5;
+            d_Q_5_5 += -d_R_37 * R_5;
+            double d_C_1_36 = -d_R_37;
+            d_q_0_2 += d_C_1_36 * q_0_5;
+            d_q_0_5 += d_C_1_36 * q_0_2;
+            d_q_0_5 += d_Q_5_5 * q_2_5;
+            d_q_2_5 += d_Q_5_5 * q_0_5;
+            d_q_0_2 += -d_R_5;
+            d_q_0_2 += d_Q_2_33 * q_2_5;
+            d_q_2_5 += d_Q_2_33 * q_0_2;
+            d_Q_2_17 += d_Q_2_49 * q_2_5;
+            d_q_2_5 += d_Q_2_49 * Q_2_17;
+            d_q_0_2 += d_Q_2_17 * q_2_4;
+            d_q_2_4 += d_Q_2_17 * q_0_2;
+            d_Q_2_25 += d_Q_2_57 * q_2_5;
+            d_q_2_5 += d_Q_2_57 * Q_2_25;
+            d_Q_2_9 += d_Q_2_25 * q_2_4;
+            d_q_2_4 += d_Q_2_25 * Q_2_9;
+            d_q_0_2 += d_Q_2_9 * q_2_3;
+            d_q_2_3 += d_Q_2_9 * q_0_2;
+            d_R_49 += -d_R_57 * Q_3_49;
+            d_Q_3_49 += -d_R_57 * R_49;
+            d_R_41 += -d_R_57 * Q_4_41;
+            d_Q_4_41 += -d_R_57 * R_41;
+            d_R_33 += -d_R_57 * C_33_24;
+            double d_C_33_24 = -d_R_57 * R_33;
+            d_R_25 += -d_R_57 * Q_5_25;
+            d_Q_5_25 += -d_R_57 * R_25;
+            d_R_17 += -d_R_57 * C_17_40;
+            double d_C_17_40 = -d_R_57 * R_17;
+            d_R_9 += -d_R_57 * C_9_48;
+            double d_C_9_48 = -d_R_57 * R_9;
+            double d_C_1_56 = -d_R_57;
+            double d_C_1_24 = d_C_1_56 * q_0_5;
+            d_q_0_5 += d_C_1_56 * C_1_24;
+            d_Q_4_9 += d_C_9_48 * Q_5_9;
+            d_Q_5_9 += d_C_9_48 * Q_4_9;
+            d_Q_3_17 += d_C_17_40 * Q_5_17;
+            d_Q_5_17 += d_C_17_40 * Q_3_17;
+            d_Q_5_9 += d_Q_5_25 * q_4_5;
+            d_q_4_5 += d_Q_5_25 * Q_5_9;
+            d_R_17 += -d_R_25 * Q_3_17;
+            d_Q_3_17 += -d_R_25 * R_17;
+            d_R_9 += -d_R_25 * Q_4_9;
+            d_Q_4_9 += -d_R_25 * R_9;
+            d_C_1_24 += -d_R_25;
+            d_q_0_3 += d_C_1_24 * q_0_4;
+            d_q_0_4 += d_C_1_24 * q_0_3;
+            d_Q_3_33 += d_C_33_24 * Q_4_33;
+            d_Q_4_33 += d_C_33_24 * Q_3_33;
+            d_Q_4_9 += d_Q_4_41 * q_4_5;
+            d_q_4_5 += d_Q_4_41 * Q_4_9;
+            d_q_0_4 += d_Q_4_9 * q_3_4;
+            d_q_3_4 += d_Q_4_9 * q_0_4;
+            d_R_33 += -d_R_41 * Q_3_33;
+            d_Q_3_33 += -d_R_41 * R_33;
+            d_R_9 += -d_R_41 * Q_5_9;
+            d_Q_5_9 += -d_R_41 * R_9;
+            double d_C_1_40 = -d_R_41;
+            d_q_0_3 += d_C_1_40 * q_0_5;
+            d_q_0_5 += d_C_1_40 * q_0_3;
+            d_q_0_5 += d_Q_5_9 * q_3_5;
+            d_q_3_5 += d_Q_5_9 * q_0_5;
+            d_q_0_3 += -d_R_9;
+            d_q_0_3 += d_Q_3_33 * q_3_5;
+            d_q_3_5 += d_Q_3_33 * q_0_3;
+            d_Q_3_17 += d_Q_3_49 * q_3_5;
+            d_q_3_5 += d_Q_3_49 * Q_3_17;
+            d_q_0_3 += d_Q_3_17 * q_3_4;
+            d_q_3_4 += d_Q_3_17 * q_0_3;
+            d_R_33 += -d_R_49 * Q_4_33;
+            d_Q_4_33 += -d_R_49 * R_33;
+            d_R_17 += -d_R_49 * Q_5_17;
+            d_Q_5_17 += -d_R_49 * R_17;
+            double d_C_1_48 = -d_R_49;
+            d_q_0_4 += d_C_1_48 * q_0_5;
+            d_q_0_5 += d_C_1_48 * q_0_4;
+            d_q_0_5 += d_Q_5_17 * q_4_5;
+            d_q_4_5 += d_Q_5_17 * q_0_5;
+            d_q_0_4 += -d_R_17;
+            d_q_0_4 += d_Q_4_33 * q_4_5;
+            d_q_4_5 += d_Q_4_33 * q_0_4;
+            d_q_0_5 += -d_R_33;
+            gradient[29] = -d_q_4_5;
+            gradient[23] = -d_q_3_5;
+            gradient[22] = -d_q_3_4;
+            gradient[17] = -d_q_2_5;
+            gradient[16] = -d_q_2_4;
+            gradient[15] = -d_q_2_3;
+            gradient[11] = -d_q_1_5;
+            gradient[10] = -d_q_1_4;
+            gradient[9] = -d_q_1_3;
+            gradient[8] = -d_q_1_2;
+            gradient[5] = -d_q_0_5;
+            gradient[4] = -d_q_0_4;
+            gradient[3] = -d_q_0_3;
+            gradient[2] = -d_q_0_2;
+            gradient[1] = -d_q_0_1;
+            return R_63;
+        }
+
+        template<typename Matrix>
+        static auto calculateCompleteGraph7ATR(const Matrix &matrix) {
+            const auto q_0_1 = 1 - matrix.at(0, 1);
+            const auto q_0_2 = 1 - matrix.at(0, 2);
+            const auto q_0_3 = 1 - matrix.at(0, 3);
+            const auto q_0_4 = 1 - matrix.at(0, 4);
+            const auto q_0_5 = 1 - matrix.at(0, 5);
+            const auto q_0_6 = 1 - matrix.at(0, 6);
+            const auto q_1_2 = 1 - matrix.at(1, 2);
+            const auto q_1_3 = 1 - matrix.at(1, 3);
+            const auto q_1_4 = 1 - matrix.at(1, 4);
+            const auto q_1_5 = 1 - matrix.at(1, 5);
+            const auto q_1_6 = 1 - matrix.at(1, 6);
+            const auto q_2_3 = 1 - matrix.at(2, 3);
+            const auto q_2_4 = 1 - matrix.at(2, 4);
+            const auto q_2_5 = 1 - matrix.at(2, 5);
+            const auto q_2_6 = 1 - matrix.at(2, 6);
+            const auto q_3_4 = 1 - matrix.at(3, 4);
+            const auto q_3_5 = 1 - matrix.at(3, 5);
+            const auto q_3_6 = 1 - matrix.at(3, 6);
+            const auto q_4_5 = 1 - matrix.at(4, 5);
+            const auto q_4_6 = 1 - matrix.at(4, 6);
+            const auto q_5_6 = 1 - matrix.at(5, 6);
+            const auto R_65 = 1 - q_0_6;
+            const auto Q_5_65 = q_0_5 * q_5_6;
+            const auto R_33 = 1 - q_0_5;
+            const auto Q_6_33 = q_0_6 * q_5_6;
+            const auto C_1_96 = q_0_5 * q_0_6;
+            const auto R_97 = 1 - (R_65 * Q_5_65 + R_33 * Q_6_33 + C_1_96);
+            const auto Q_4_33 = q_0_4 * q_4_5;
+            const auto Q_4_97 = Q_4_33 * q_4_6;
+            const auto Q_4_65 = q_0_4 * q_4_6;
+            const auto R_17 = 1 - q_0_4;
+            const auto Q_6_17 = q_0_6 * q_4_6;
+            const auto C_1_80 = q_0_4 * q_0_6;
+            const auto R_81 = 1 - (R_65 * Q_4_65 + R_17 * Q_6_17 + C_1_80);
+            const auto Q_5_17 = q_0_5 * q_4_5;
+            const auto Q_5_81 = Q_5_17 * q_5_6;
+            const auto C_65_48 = Q_4_65 * Q_5_65;
+            const auto C_1_48 = q_0_4 * q_0_5;
+            const auto R_49 = 1 - (R_33 * Q_4_33 + R_17 * Q_5_17 + C_1_48);
+            const auto Q_6_49 = Q_6_17 * q_5_6;
+            const auto C_33_80 = Q_4_33 * Q_6_33;
+            const auto C_17_96 = Q_5_17 * Q_6_17;
+            const auto C_1_112 = C_1_48 * q_0_6;
+            const auto R_113 = 1 - (R_97 * Q_4_97 + R_81 * Q_5_81 + R_65 * C_65_48 + R_49 * Q_6_49
+                    + R_33 * C_33_80 + R_17 * C_17_96 + C_1_112);
+            const auto Q_3_17 = q_0_3 * q_3_4;
+            const auto Q_3_49 = Q_3_17 * q_3_5;
+            const auto Q_3_113 = Q_3_49 * q_3_6;
+            const auto Q_3_33 = q_0_3 * q_3_5;
+            const auto Q_3_97 = Q_3_33 * q_3_6;
+            const auto Q_3_65 = q_0_3 * q_3_6;
+            const auto R_9 = 1 - q_0_3;
+            const auto Q_6_9 = q_0_6 * q_3_6;
+            const auto C_1_72 = q_0_3 * q_0_6;
+            const auto R_73 = 1 - (R_65 * Q_3_65 + R_9 * Q_6_9 + C_1_72);
+            const auto Q_5_9 = q_0_5 * q_3_5;
+            const auto Q_5_73 = Q_5_9 * q_5_6;
+            const auto C_65_40 = Q_3_65 * Q_5_65;
+            const auto C_1_40 = q_0_3 * q_0_5;
+            const auto R_41 = 1 - (R_33 * Q_3_33 + R_9 * Q_5_9 + C_1_40);
+            const auto Q_6_41 = Q_6_9 * q_5_6;
+            const auto C_33_72 = Q_3_33 * Q_6_33;
+            const auto C_9_96 = Q_5_9 * Q_6_9;
+            const auto C_1_104 = C_1_40 * q_0_6;
+            const auto R_105 = 1 - (R_97 * Q_3_97 + R_73 * Q_5_73 + R_65 * C_65_40 + R_41 * Q_6_41
+                    + R_33 * C_33_72 + R_9 * C_9_96 + C_1_104);
+            const auto Q_4_9 = q_0_4 * q_3_4;
+            const auto Q_4_41 = Q_4_9 * q_4_5;
+            const auto Q_4_105 = Q_4_41 * q_4_6;
+            const auto C_97_24 = Q_3_97 * Q_4_97;
+            const auto Q_3_81 = Q_3_17 * q_3_6;
+            const auto Q_4_73 = Q_4_9 * q_4_6;
+            const auto C_65_24 = Q_3_65 * Q_4_65;
+            const auto C_1_24 = q_0_3 * q_0_4;
+            const auto R_25 = 1 - (R_17 * Q_3_17 + R_9 * Q_4_9 + C_1_24);
+            const auto Q_6_25 = Q_6_9 * q_4_6;
+            const auto C_17_72 = Q_3_17 * Q_6_17;
+            const auto C_9_80 = Q_4_9 * Q_6_9;
+            const auto C_1_88 = C_1_24 * q_0_6;
+            const auto R_89 = 1 - (R_81 * Q_3_81 + R_73 * Q_4_73 + R_65 * C_65_24 + R_25 * Q_6_25
+                    + R_17 * C_17_72 + R_9 * C_9_80 + C_1_88);
+            const auto Q_5_25 = Q_5_9 * q_4_5;
+            const auto Q_5_89 = Q_5_25 * q_5_6;
+            const auto C_81_40 = Q_3_81 * Q_5_81;
+            const auto C_73_48 = Q_4_73 * Q_5_73;
+            const auto C_65_56 = C_65_24 * Q_5_65;
+            const auto C_33_24 = Q_3_33 * Q_4_33;
+            const auto C_17_40 = Q_3_17 * Q_5_17;
+            const auto C_9_48 = Q_4_9 * Q_5_9;
+            const auto C_1_56 = C_1_24 * q_0_5;
+            const auto R_57 = 1 - (R_49 * Q_3_49 + R_41 * Q_4_41 + R_33 * C_33_24 + R_25 * Q_5_25
+                    + R_17 * C_17_40 + R_9 * C_9_48 + C_1_56);
+            const auto Q_6_57 = Q_6_25 * q_5_6;
+            const auto C_49_72 = Q_3_49 * Q_6_49;
+            const auto C_41_80 = Q_4_41 * Q_6_41;
+            const auto C_33_88 = C_33_24 * Q_6_33;
+            const auto C_25_96 = Q_5_25 * Q_6_25;
+            const auto C_17_104 = C_17_40 * Q_6_17;
+            const auto C_9_112 = C_9_48 * Q_6_9;
+            const auto C_1_120 = C_1_56 * q_0_6;
+            const auto R_121 = 1 - (R_113 * Q_3_113 + R_105 * Q_4_105 + R_97 * C_97_24 + R_89 * Q_5_89
+                    + R_81 * C_81_40 + R_73 * C_73_48 + R_65 * C_65_56 + R_57 * Q_6_57
+                    + R_49 * C_49_72 + R_41 * C_41_80 + R_33 * C_33_88 + R_25 * C_25_96
+                    + R_17 * C_17_104 + R_9 * C_9_112 + C_1_120);
+            const auto Q_2_9 = q_0_2 * q_2_3;
+            const auto Q_2_25 = Q_2_9 * q_2_4;
+            const auto Q_2_57 = Q_2_25 * q_2_5;
+            const auto Q_2_121 = Q_2_57 * q_2_6;
+            const auto Q_2_17 = q_0_2 * q_2_4;
+            const auto Q_2_49 = Q_2_17 * q_2_5;
+            const auto Q_2_113 = Q_2_49 * q_2_6;
+            const auto Q_2_33 = q_0_2 * q_2_5;
+            const auto Q_2_97 = Q_2_33 * q_2_6;
+            const auto Q_2_65 = q_0_2 * q_2_6;
+            const auto R_5 = 1 - q_0_2;
+            const auto Q_6_5 = q_0_6 * q_2_6;
+            const auto C_1_68 = q_0_2 * q_0_6;
+            const auto R_69 = 1 - (R_65 * Q_2_65 + R_5 * Q_6_5 + C_1_68);
+            const auto Q_5_5 = q_0_5 * q_2_5;
+            const auto Q_5_69 = Q_5_5 * q_5_6;
+            const auto C_65_36 = Q_2_65 * Q_5_65;
+            const auto C_1_36 = q_0_2 * q_0_5;
+            const auto R_37 = 1 - (R_33 * Q_2_33 + R_5 * Q_5_5 + C_1_36);
+            const auto Q_6_37 = Q_6_5 * q_5_6;
+            const auto C_33_68 = Q_2_33 * Q_6_33;
+            const auto C_5_96 = Q_5_5 * Q_6_5;
+            const auto C_1_100 = C_1_36 * q_0_6;
+            const auto R_101 = 1 - (R_97 * Q_2_97 + R_69 * Q_5_69 + R_65 * C_65_36 + R_37 * Q_6_37
+                    + R_33 * C_33_68 + R_5 * C_5_96 + C_1_100);
+            const auto Q_4_5 = q_0_4 * q_2_4;
+            const auto Q_4_37 = Q_4_5 * q_4_5;
+            const auto Q_4_101 = Q_4_37 * q_4_6;
+            const auto C_97_20 = Q_2_97 * Q_4_97;
+            const auto Q_2_81 = Q_2_17 * q_2_6;
+            const auto Q_4_69 = Q_4_5 * q_4_6;
+            const auto C_65_20 = Q_2_65 * Q_4_65;
+            const auto C_1_20 = q_0_2 * q_0_4;
+            const auto R_21 = 1 - (R_17 * Q_2_17 + R_5 * Q_4_5 + C_1_20);
+            const auto Q_6_21 = Q_6_5 * q_4_6;
+            const auto C_17_68 = Q_2_17 * Q_6_17;
+            const auto C_5_80 = Q_4_5 * Q_6_5;
+            const auto C_1_84 = C_1_20 * q_0_6;
+            const auto R_85 = 1 - (R_81 * Q_2_81 + R_69 * Q_4_69 + R_65 * C_65_20 + R_21 * Q_6_21
+                    + R_17 * C_17_68 + R_5 * C_5_80 + C_1_84);
+            const auto Q_5_21 = Q_5_5 * q_4_5;
+            const auto Q_5_85 = Q_5_21 * q_5_6;
+            const auto C_81_36 = Q_2_81 * Q_5_81;
+            const auto C_69_48 = Q_4_69 * Q_5_69;
+            const auto C_65_52 = C_65_20 * Q_5_65;
+            const auto C_33_20 = Q_2_33 * Q_4_33;
+            const auto C_17_36 = Q_2_17 * Q_5_17;
+            const auto C_5_48 = Q_4_5 * Q_5_5;
+            const auto C_1_52 = C_1_20 * q_0_5;
+            const auto R_53 = 1 - (R_49 * Q_2_49 + R_37 * Q_4_37 + R_33 * C_33_20 + R_21 * Q_5_21
+                    + R_17 * C_17_36 + R_5 * C_5_48 + C_1_52);
+            const auto Q_6_53 = Q_6_21 * q_5_6;
+            const auto C_49_68 = Q_2_49 * Q_6_49;
+            const auto C_37_80 = Q_4_37 * Q_6_37;
+            const auto C_33_84 = C_33_20 * Q_6_33;
+            const auto C_21_96 = Q_5_21 * Q_6_21;
+            const auto C_17_100 = C_17_36 * Q_6_17;
+            const auto C_5_112 = C_5_48 * Q_6_5;
+            const auto C_1_116 = C_1_52 * q_0_6;
+            const auto R_117 = 1 - (R_113 * Q_2_113 + R_101 * Q_4_101 + R_97 * C_97_20 + R_85 * Q_5_85
+                    + R_81 * C_81_36 + R_69 * C_69_48 + R_65 * C_65_52 + R_53 * Q_6_53
+                    + R_49 * C_49_68 + R_37 * C_37_80 + R_33 * C_33_84 + R_21 * C_21_96
+                    + R_17 * C_17_100 + R_5 * C_5_112 + C_1_116);
+            const auto Q_3_5 = q_0_3 * q_2_3;
+            const auto Q_3_21 = Q_3_5 * q_3_4;
+            const auto Q_3_53 = Q_3_21 * q_3_5;
+            const auto Q_3_117 = Q_3_53 * q_3_6;
+            const auto C_113_12 = Q_2_113 * Q_3_113;
+            const auto Q_2_41 = Q_2_9 * q_2_5;
+            const auto Q_2_105 = Q_2_41 * q_2_6;
+            const auto Q_3_37 = Q_3_5 * q_3_5;
+            const auto Q_3_101 = Q_3_37 * q_3_6;
+            const auto C_97_12 = Q_2_97 * Q_3_97;
+            const auto Q_2_73 = Q_2_9 * q_2_6;
+            const auto Q_3_69 = Q_3_5 * q_3_6;
+            const auto C_65_12 = Q_2_65 * Q_3_65;
+            const auto C_1_12 = q_0_2 * q_0_3;
+            const auto R_13 = 1 - (R_9 * Q_2_9 + R_5 * Q_3_5 + C_1_12);
+            const auto Q_6_13 = Q_6_5 * q_3_6;
+            const auto C_9_68 = Q_2_9 * Q_6_9;
+            const auto C_5_72 = Q_3_5 * Q_6_5;
+            const auto C_1_76 = C_1_12 * q_0_6;
+            const auto R_77 = 1 - (R_73 * Q_2_73 + R_69 * Q_3_69 + R_65 * C_65_12 + R_13 * Q_6_13
+                    + R_9 * C_9_68 + R_5 * C_5_72 + C_1_76);
+            const auto Q_5_13 = Q_5_5 * q_3_5;
+            const auto Q_5_77 = Q_5_13 * q_5_6;
+            const auto C_73_36 = Q_2_73 * Q_5_73;
+            const auto C_69_40 = Q_3_69 * Q_5_69;
+            const auto C_65_44 = C_65_12 * Q_5_65;
+            const auto C_33_12 = Q_2_33 * Q_3_33;
+            const auto C_9_36 = Q_2_9 * Q_5_9;
+            const auto C_5_40 = Q_3_5 * Q_5_5;
+            const auto C_1_44 = C_1_12 * q_0_5;
+            const auto R_45 = 1 - (R_41 * Q_2_41 + R_37 * Q_3_37 + R_33 * C_33_12 + R_13 * Q_5_13
+                    + R_9 * C_9_36 + R_5 * C_5_40 + C_1_44);
+            const auto Q_6_45 = Q_6_13 * q_5_6;
+            const auto C_41_68 = Q_2_41 * Q_6_41;
+            const auto C_37_72 = Q_3_37 * Q_6_37;
+            const auto C_33_76 = C_33_12 * Q_6_33;
+            const auto C_13_96 = Q_5_13 * Q_6_13;
+            const auto C_9_100 = C_9_36 * Q_6_9;
+            const auto C_5_104 = C_5_40 * Q_6_5;
+            const auto C_1_108 = C_1_44 * q_0_6;
+            const auto R_109 = 1 - (R_105 * Q_2_105 + R_101 * Q_3_101 + R_97 * C_97_12 + R_77 * Q_5_77
+                    + R_73 * C_73_36 + R_69 * C_69_40 + R_65 * C_65_44 + R_45 * Q_6_45
+                    + R_41 * C_41_68 + R_37 * C_37_72 + R_33 * C_33_76 + R_13 * C_13_96
+                    + R_9 * C_9_100 + R_5 * C_5_104 + C_1_108);
+            const auto Q_4_13 = Q_4_5 * q_3_4;
+            const auto Q_4_45 = Q_4_13 * q_4_5;
+            const auto Q_4_109 = Q_4_45 * q_4_6;
+            const auto C_105_20 = Q_2_105 * Q_4_105;
+            const auto C_101_24 = Q_3_101 * Q_4_101;
+            const auto C_97_28 = C_97_12 * Q_4_97;
+            const auto Q_2_89 = Q_2_25 * q_2_6;
+            const auto Q_3_85 = Q_3_21 * q_3_6;
+            const auto C_81_12 = Q_2_81 * Q_3_81;
+            const auto Q_4_77 = Q_4_13 * q_4_6;
+            const auto C_73_20 = Q_2_73 * Q_4_73;
+            const auto C_69_24 = Q_3_69 * Q_4_69;
+            const auto C_65_28 = C_65_12 * Q_4_65;
+            const auto C_17_12 = Q_2_17 * Q_3_17;
+            const auto C_9_20 = Q_2_9 * Q_4_9;
+            const auto C_5_24 = Q_3_5 * Q_4_5;
+            const auto C_1_28 = C_1_12 * q_0_4;
+            const auto R_29 = 1 - (R_25 * Q_2_25 + R_21 * Q_3_21 + R_17 * C_17_12 + R_13 * Q_4_13
+                    + R_9 * C_9_20 + R_5 * C_5_24 + C_1_28);
+            const auto Q_6_29 = Q_6_13 * q_4_6;
+            const auto C_25_68 = Q_2_25 * Q_6_25;
+            const auto C_21_72 = Q_3_21 * Q_6_21;
+            const auto C_17_76 = C_17_12 * Q_6_17;
+            const auto C_13_80 = Q_4_13 * Q_6_13;
+            const auto C_9_84 = C_9_20 * Q_6_9;
+            const auto C_5_88 = C_5_24 * Q_6_5;
+            const auto C_1_92 = C_1_28 * q_0_6;
+            const auto R_93 = 1 - (R_89 * Q_2_89 + R_85 * Q_3_85 + R_81 * C_81_12 + R_77 * Q_4_77
+                    + R_73 * C_73_20 + R_69 * C_69_24 + R_65 * C_65_28 + R_29 * Q_6_29
+                    + R_25 * C_25_68 + R_21 * C_21_72 + R_17 * C_17_76 + R_13 * C_13_80
+                    + R_9 * C_9_84 + R_5 * C_5_88 + C_1_92);
+            const auto Q_5_29 = Q_5_13 * q_4_5;
+            const auto Q_5_93 = Q_5_29 * q_5_6;
+            const auto C_89_36 = Q_2_89 * Q_5_89;
+            const auto C_85_40 = Q_3_85 * Q_5_85;
+            const auto C_81_44 = C_81_12 * Q_5_81;
+            const auto C_77_48 = Q_4_77 * Q_5_77;
+            const auto C_73_52 = C_73_20 * Q_5_73;
+            const auto C_69_56 = C_69_24 * Q_5_69;
+            const auto C_65_60 = C_65_28 * Q_5_65;
+            const auto C_49_12 = Q_2_49 * Q_3_49;
+            const auto C_41_20 = Q_2_41 * Q_4_41;
+            const auto C_37_24 = Q_3_37 * Q_4_37;
+            const auto C_33_28 = C_33_12 * Q_4_33;
+            const auto C_25_36 = Q_2_25 * Q_5_25;
+            const auto C_21_40 = Q_3_21 * Q_5_21;
+            const auto C_17_44 = C_17_12 * Q_5_17;
+            const auto C_13_48 = Q_4_13 * Q_5_13;
+            const auto C_9_52 = C_9_20 * Q_5_9;
+            const auto C_5_56 = C_5_24 * Q_5_5;
+            const auto C_1_60 = C_1_28 * q_0_5;
+            const auto R_61 = 1 - (R_57 * Q_2_57 + R_53 * Q_3_53 + R_49 * C_49_12 + R_45 * Q_4_45
+                    + R_41 * C_41_20 + R_37 * C_37_24 + R_33 * C_33_28 + R_29 * Q_5_29
+                    + R_25 * C_25_36 + R_21 * C_21_40 + R_17 * C_17_44 + R_13 * C_13_48
+                    + R_9 * C_9_52 + R_5 * C_5_56 + C_1_60);
+            const auto Q_6_61 = Q_6_29 * q_5_6;
+            const auto C_57_68 = Q_2_57 * Q_6_57;
+            const auto C_53_72 = Q_3_53 * Q_6_53;
+            const auto C_49_76 = C_49_12 * Q_6_49;
+            const auto C_45_80 = Q_4_45 * Q_6_45;
+            const auto C_41_84 = C_41_20 * Q_6_41;
+            const auto C_37_88 = C_37_24 * Q_6_37;
+            const auto C_33_92 = C_33_28 * Q_6_33;
+            const auto C_29_96 = Q_5_29 * Q_6_29;
+            const auto C_25_100 = C_25_36 * Q_6_25;
+            const auto C_21_104 = C_21_40 * Q_6_21;
+            const auto C_17_108 = C_17_44 * Q_6_17;
+            const auto C_13_112 = C_13_48 * Q_6_13;
+            const auto C_9_116 = C_9_52 * Q_6_9;
+            const auto C_5_120 = C_5_56 * Q_6_5;
+            const auto C_1_124 = C_1_60 * q_0_6;
+            const auto R_125 = 1 - (R_121 * Q_2_121 + R_117 * Q_3_117 + R_113 * C_113_12 + R_109 * Q_4_109
+                    + R_105 * C_105_20 + R_101 * C_101_24 + R_97 * C_97_28 + R_93 * Q_5_93
+                    + R_89 * C_89_36 + R_85 * C_85_40 + R_81 * C_81_44 + R_77 * C_77_48
+                    + R_73 * C_73_52 + R_69 * C_69_56 + R_65 * C_65_60 + R_61 * Q_6_61
+                    + R_57 * C_57_68 + R_53 * C_53_72 + R_49 * C_49_76 + R_45 * C_45_80
+                    + R_41 * C_41_84 + R_37 * C_37_88 + R_33 * C_33_92 + R_29 * C_29_96
+                    + R_25 * C_25_100 + R_21 * C_21_104 + R_17 * C_17_108 + R_13 * C_13_112
+                    + R_9 * C_9_116 + R_5 * C_5_120 + C_1_124);
+            const auto Q_1_5 = q_0_1 * q_1_2;
+            const auto Q_1_13 = Q_1_5 * q_1_3;
+            const auto Q_1_29 = Q_1_13 * q_1_4;
+            const auto Q_1_61 = Q_1_29 * q_1_5;
+            const auto Q_1_125 = Q_1_61 * q_1_6;
+            const auto Q_1_9 = q_0_1 * q_1_3;
+            const auto Q_1_25 = Q_1_9 * q_1_4;
+            const auto Q_1_57 = Q_1_25 * q_1_5;
+            const auto Q_1_121 = Q_1_57 * q_1_6;
+            const auto Q_1_17 = q_0_1 * q_1_4;
+            const auto Q_1_49 = Q_1_17 * q_1_5;
+            const auto Q_1_113 = Q_1_49 * q_1_6;
+            const auto Q_1_33 = q_0_1 * q_1_5;
+            const auto Q_1_97 = Q_1_33 * q_1_6;
+            const auto Q_1_65 = q_0_1 * q_1_6;
+            const auto R_3 = 1 - q_0_1;
+            const auto Q_6_3 = q_0_6 * q_1_6;
+            const auto C_1_66 = q_0_1 * q_0_6;
+            const auto R_67 = 1 - (R_65 * Q_1_65 + R_3 * Q_6_3 + C_1_66);
+            const auto Q_5_3 = q_0_5 * q_1_5;
+            const auto Q_5_67 = Q_5_3 * q_5_6;
+            const auto C_65_34 = Q_1_65 * Q_5_65;
+            const auto C_1_34 = q_0_1 * q_0_5;
+            const auto R_35 = 1 - (R_33 * Q_1_33 + R_3 * Q_5_3 + C_1_34);
+            const auto Q_6_35 = Q_6_3 * q_5_6;
+            const auto C_33_66 = Q_1_33 * Q_6_33;
+            const auto C_3_96 = Q_5_3 * Q_6_3;
+            const auto C_1_98 = C_1_34 * q_0_6;
+            const auto R_99 = 1 - (R_97 * Q_1_97 + R_67 * Q_5_67 + R_65 * C_65_34 + R_35 * Q_6_35
+                    + R_33 * C_33_66 + R_3 * C_3_96 + C_1_98);
+            const auto Q_4_3 = q_0_4 * q_1_4;
+            const auto Q_4_35 = Q_4_3 * q_4_5;
+            const auto Q_4_99 = Q_4_35 * q_4_6;
+            const auto C_97_18 = Q_1_97 * Q_4_97;
+            const auto Q_1_81 = Q_1_17 * q_1_6;
+            const auto Q_4_67 = Q_4_3 * q_4_6;
+            const auto C_65_18 = Q_1_65 * Q_4_65;
+            const auto C_1_18 = q_0_1 * q_0_4;
+            const auto R_19 = 1 - (R_17 * Q_1_17 + R_3 * Q_4_3 + C_1_18);
+            const auto Q_6_19 = Q_6_3 * q_4_6;
+            const auto C_17_66 = Q_1_17 * Q_6_17;
+            const auto C_3_80 = Q_4_3 * Q_6_3;
+            const auto C_1_82 = C_1_18 * q_0_6;
+            const auto R_83 = 1 - (R_81 * Q_1_81 + R_67 * Q_4_67 + R_65 * C_65_18 + R_19 * Q_6_19
+                    + R_17 * C_17_66 + R_3 * C_3_80 + C_1_82);
+            const auto Q_5_19 = Q_5_3 * q_4_5;
+            const auto Q_5_83 = Q_5_19 * q_5_6;
+            const auto C_81_34 = Q_1_81 * Q_5_81;
+            const auto C_67_48 = Q_4_67 * Q_5_67;
+            const auto C_65_50 = C_65_18 * Q_5_65;
+            const auto C_33_18 = Q_1_33 * Q_4_33;
+            const auto C_17_34 = Q_1_17 * Q_5_17;
+            const auto C_3_48 = Q_4_3 * Q_5_3;
+            const auto C_1_50 = C_1_18 * q_0_5;
+            const auto R_51 = 1 - (R_49 * Q_1_49 + R_35 * Q_4_35 + R_33 * C_33_18 + R_19 * Q_5_19
+                    + R_17 * C_17_34 + R_3 * C_3_48 + C_1_50);
+            const auto Q_6_51 = Q_6_19 * q_5_6;
+            const auto C_49_66 = Q_1_49 * Q_6_49;
+            const auto C_35_80 = Q_4_35 * Q_6_35;
+            const auto C_33_82 = C_33_18 * Q_6_33;
+            const auto C_19_96 = Q_5_19 * Q_6_19;
+            const auto C_17_98 = C_17_34 * Q_6_17;
+            const auto C_3_112 = C_3_48 * Q_6_3;
+            const auto C_1_114 = C_1_50 * q_0_6;
+            const auto R_115 = 1 - (R_113 * Q_1_113 + R_99 * Q_4_99 + R_97 * C_97_18 + R_83 * Q_5_83
+                    + R_81 * C_81_34 + R_67 * C_67_48 + R_65 * C_65_50 + R_51 * Q_6_51
+                    + R_49 * C_49_66 + R_35 * C_35_80 + R_33 * C_33_82 + R_19 * C_19_96
+                    + R_17 * C_17_98 + R_3 * C_3_112 + C_1_114);
+            const auto Q_3_3 = q_0_3 * q_1_3;
+            const auto Q_3_19 = Q_3_3 * q_3_4;
+            const auto Q_3_51 = Q_3_19 * q_3_5;
+            const auto Q_3_115 = Q_3_51 * q_3_6;
+            const auto C_113_10 = Q_1_113 * Q_3_113;
+            const auto Q_1_41 = Q_1_9 * q_1_5;
+            const auto Q_1_105 = Q_1_41 * q_1_6;
+            const auto Q_3_35 = Q_3_3 * q_3_5;
+            const auto Q_3_99 = Q_3_35 * q_3_6;
+            const auto C_97_10 = Q_1_97 * Q_3_97;
+            const auto Q_1_73 = Q_1_9 * q_1_6;
+            const auto Q_3_67 = Q_3_3 * q_3_6;
+            const auto C_65_10 = Q_1_65 * Q_3_65;
+            const auto C_1_10 = q_0_1 * q_0_3;
+            const auto R_11 = 1 - (R_9 * Q_1_9 + R_3 * Q_3_3 + C_1_10);
+            const auto Q_6_11 = Q_6_3 * q_3_6;
+            const auto C_9_66 = Q_1_9 * Q_6_9;
+            const auto C_3_72 = Q_3_3 * Q_6_3;
+            const auto C_1_74 = C_1_10 * q_0_6;
+            const auto R_75 = 1 - (R_73 * Q_1_73 + R_67 * Q_3_67 + R_65 * C_65_10 + R_11 * Q_6_11
+                    + R_9 * C_9_66 + R_3 * C_3_72 + C_1_74);
+            const auto Q_5_11 = Q_5_3 * q_3_5;
+            const auto Q_5_75 = Q_5_11 * q_5_6;
+            const auto C_73_34 = Q_1_73 * Q_5_73;
+            const auto C_67_40 = Q_3_67 * Q_5_67;
+            const auto C_65_42 = C_65_10 * Q_5_65;
+            const auto C_33_10 = Q_1_33 * Q_3_33;
+            const auto C_9_34 = Q_1_9 * Q_5_9;
+            const auto C_3_40 = Q_3_3 * Q_5_3;
+            const auto C_1_42 = C_1_10 * q_0_5;
+            const auto R_43 = 1 - (R_41 * Q_1_41 + R_35 * Q_3_35 + R_33 * C_33_10 + R_11 * Q_5_11
+                    + R_9 * C_9_34 + R_3 * C_3_40 + C_1_42);
+            const auto Q_6_43 = Q_6_11 * q_5_6;
+            const auto C_41_66 = Q_1_41 * Q_6_41;
+            const auto C_35_72 = Q_3_35 * Q_6_35;
+            const auto C_33_74 = C_33_10 * Q_6_33;
+            const auto C_11_96 = Q_5_11 * Q_6_11;
+            const auto C_9_98 = C_9_34 * Q_6_9;
+            const auto C_3_104 = C_3_40 * Q_6_3;
+            const auto C_1_106 = C_1_42 * q_0_6;
+            const auto R_107 = 1 - (R_105 * Q_1_105 + R_99 * Q_3_99 + R_97 * C_97_10 + R_75 * Q_5_75
+                    + R_73 * C_73_34 + R_67 * C_67_40 + R_65 * C_65_42 + R_43 * Q_6_43
+                    + R_41 * C_41_66 + R_35 * C_35_72 + R_33 * C_33_74 + R_11 * C_11_96
+                    + R_9 * C_9_98 + R_3 * C_3_104 + C_1_106);
+            const auto Q_4_11 = Q_4_3 * q_3_4;
+            const auto Q_4_43 = Q_4_11 * q_4_5;
+            const auto Q_4_107 = Q_4_43 * q_4_6;
+            const auto C_105_18 = Q_1_105 * Q_4_105;
+            const auto C_99_24 = Q_3_99 * Q_4_99;
+            const auto C_97_26 = C_97_10 * Q_4_97;
+            const auto Q_1_89 = Q_1_25 * q_1_6;
+            const auto Q_3_83 = Q_3_19 * q_3_6;
+            const auto C_81_10 = Q_1_81 * Q_3_81;
+            const auto Q_4_75 = Q_4_11 * q_4_6;
+            const auto C_73_18 = Q_1_73 * Q_4_73;
+            const auto C_67_24 = Q_3_67 * Q_4_67;
+            const auto C_65_26 = C_65_10 * Q_4_65;
+            const auto C_17_10 = Q_1_17 * Q_3_17;
+            const auto C_9_18 = Q_1_9 * Q_4_9;
+            const auto C_3_24 = Q_3_3 * Q_4_3;
+            const auto C_1_26 = C_1_10 * q_0_4;
+            const auto R_27 = 1 - (R_25 * Q_1_25 + R_19 * Q_3_19 + R_17 * C_17_10 + R_11 * Q_4_11
+                    + R_9 * C_9_18 + R_3 * C_3_24 + C_1_26);
+            const auto Q_6_27 = Q_6_11 * q_4_6;
+            const auto C_25_66 = Q_1_25 * Q_6_25;
+            const auto C_19_72 = Q_3_19 * Q_6_19;
+            const auto C_17_74 = C_17_10 * Q_6_17;
+            const auto C_11_80 = Q_4_11 * Q_6_11;
+            const auto C_9_82 = C_9_18 * Q_6_9;
+            const auto C_3_88 = C_3_24 * Q_6_3;
+            const auto C_1_90 = C_1_26 * q_0_6;
+            const auto R_91 = 1 - (R_89 * Q_1_89 + R_83 * Q_3_83 + R_81 * C_81_10 + R_75 * Q_4_75
+                    + R_73 * C_73_18 + R_67 * C_67_24 + R_65 * C_65_26 + R_27 * Q_6_27
+                    + R_25 * C_25_66 + R_19 * C_19_72 + R_17 * C_17_74 + R_11 * C_11_80
+                    + R_9 * C_9_82 + R_3 * C_3_88 + C_1_90);
+            const auto Q_5_27 = Q_5_11 * q_4_5;
+            const auto Q_5_91 = Q_5_27 * q_5_6;
+            const auto C_89_34 = Q_1_89 * Q_5_89;
+            const auto C_83_40 = Q_3_83 * Q_5_83;
+            const auto C_81_42 = C_81_10 * Q_5_81;
+            const auto C_75_48 = Q_4_75 * Q_5_75;
+            const auto C_73_50 = C_73_18 * Q_5_73;
+            const auto C_67_56 = C_67_24 * Q_5_67;
+            const auto C_65_58 = C_65_26 * Q_5_65;
+            const auto C_49_10 = Q_1_49 * Q_3_49;
+            const auto C_41_18 = Q_1_41 * Q_4_41;
+            const auto C_35_24 = Q_3_35 * Q_4_35;
+            const auto C_33_26 = C_33_10 * Q_4_33;
+            const auto C_25_34 = Q_1_25 * Q_5_25;
+            const auto C_19_40 = Q_3_19 * Q_5_19;
+            const auto C_17_42 = C_17_10 * Q_5_17;
+            const auto C_11_48 = Q_4_11 * Q_5_11;
+            const auto C_9_50 = C_9_18 * Q_5_9;
+            const auto C_3_56 = C_3_24 * Q_5_3;
+            const auto C_1_58 = C_1_26 * q_0_5;
+            const auto R_59 = 1 - (R_57 * Q_1_57 + R_51 * Q_3_51 + R_49 * C_49_10 + R_43 * Q_4_43
+                    + R_41 * C_41_18 + R_35 * C_35_24 + R_33 * C_33_26 + R_27 * Q_5_27
+                    + R_25 * C_25_34 + R_19 * C_19_40 + R_17 * C_17_42 + R_11 * C_11_48
+                    + R_9 * C_9_50 + R_3 * C_3_56 + C_1_58);
+            const auto Q_6_59 = Q_6_27 * q_5_6;
+            const auto C_57_66 = Q_1_57 * Q_6_57;
+            const auto C_51_72 = Q_3_51 * Q_6_51;
+            const auto C_49_74 = C_49_10 * Q_6_49;
+            const auto C_43_80 = Q_4_43 * Q_6_43;
+            const auto C_41_82 = C_41_18 * Q_6_41;
+            const auto C_35_88 = C_35_24 * Q_6_35;
+            const auto C_33_90 = C_33_26 * Q_6_33;
+            const auto C_27_96 = Q_5_27 * Q_6_27;
+            const auto C_25_98 = C_25_34 * Q_6_25;
+            const auto C_19_104 = C_19_40 * Q_6_19;
+            const auto C_17_106 = C_17_42 * Q_6_17;
+            const auto C_11_112 = C_11_48 * Q_6_11;
+            const auto C_9_114 = C_9_50 * Q_6_9;
+            const auto C_3_120 = C_3_56 * Q_6_3;
+            const auto C_1_122 = C_1_58 * q_0_6;
+            const auto R_123 = 1 - (R_121 * Q_1_121 + R_115 * Q_3_115 + R_113 * C_113_10 + R_107 * Q_4_107
+                    + R_105 * C_105_18 + R_99 * C_99_24 + R_97 * C_97_26 + R_91 * Q_5_91
+                    + R_89 * C_89_34 + R_83 * C_83_40 + R_81 * C_81_42 + R_75 * C_75_48
+                    + R_73 * C_73_50 + R_67 * C_67_56 + R_65 * C_65_58 + R_59 * Q_6_59
+                    + R_57 * C_57_66 + R_51 * C_51_72 + R_49 * C_49_74 + R_43 * C_43_80
+                    + R_41 * C_41_82 + R_35 * C_35_88 + R_33 * C_33_90 + R_27 * C_27_96
+                    + R_25 * C_25_98 + R_19 * C_19_104 + R_17 * C_17_106 + R_11 * C_11_112
+                    + R_9 * C_9_114 + R_3 * C_3_120 + C_1_122);
+            const auto Q_2_3 = q_0_2 * q_1_2;
+            const auto Q_2_11 = Q_2_3 * q_2_3;
+            const auto Q_2_27 = Q_2_11 * q_2_4;
+            const auto Q_2_59 = Q_2_27 * q_2_5;
+            const auto Q_2_123 = Q_2_59 * q_2_6;
+            const auto C_121_6 = Q_1_121 * Q_2_121;
+            const auto Q_1_21 = Q_1_5 * q_1_4;
+            const auto Q_1_53 = Q_1_21 * q_1_5;
+            const auto Q_1_117 = Q_1_53 * q_1_6;
+            const auto Q_2_19 = Q_2_3 * q_2_4;
+            const auto Q_2_51 = Q_2_19 * q_2_5;
+            const auto Q_2_115 = Q_2_51 * q_2_6;
+            const auto C_113_6 = Q_1_113 * Q_2_113;
+            const auto Q_1_37 = Q_1_5 * q_1_5;
+            const auto Q_1_101 = Q_1_37 * q_1_6;
+            const auto Q_2_35 = Q_2_3 * q_2_5;
+            const auto Q_2_99 = Q_2_35 * q_2_6;
+            const auto C_97_6 = Q_1_97 * Q_2_97;
+            const auto Q_1_69 = Q_1_5 * q_1_6;
+            const auto Q_2_67 = Q_2_3 * q_2_6;
+            const auto C_65_6 = Q_1_65 * Q_2_65;
+            const auto C_1_6 = q_0_1 * q_0_2;
+            const auto R_7 = 1 - (R_5 * Q_1_5 + R_3 * Q_2_3 + C_1_6);
+            const auto Q_6_7 = Q_6_3 * q_2_6;
+            const auto C_5_66 = Q_1_5 * Q_6_5;
+            const auto C_3_68 = Q_2_3 * Q_6_3;
+            const auto C_1_70 = C_1_6 * q_0_6;
+            const auto R_71 = 1 - (R_69 * Q_1_69 + R_67 * Q_2_67 + R_65 * C_65_6 + R_7 * Q_6_7
+                    + R_5 * C_5_66 + R_3 * C_3_68 + C_1_70);
+            const auto Q_5_7 = Q_5_3 * q_2_5;
+            const auto Q_5_71 = Q_5_7 * q_5_6;
+            const auto C_69_34 = Q_1_69 * Q_5_69;
+            const auto C_67_36 = Q_2_67 * Q_5_67;
+            const auto C_65_38 = C_65_6 * Q_5_65;
+            const auto C_33_6 = Q_1_33 * Q_2_33;
+            const auto C_5_34 = Q_1_5 * Q_5_5;
+            const auto C_3_36 = Q_2_3 * Q_5_3;
+            const auto C_1_38 = C_1_6 * q_0_5;
+            const auto R_39 = 1 - (R_37 * Q_1_37 + R_35 * Q_2_35 + R_33 * C_33_6 + R_7 * Q_5_7
+                    + R_5 * C_5_34 + R_3 * C_3_36 + C_1_38);
+            const auto Q_6_39 = Q_6_7 * q_5_6;
+            const auto C_37_66 = Q_1_37 * Q_6_37;
+            const auto C_35_68 = Q_2_35 * Q_6_35;
+            const auto C_33_70 = C_33_6 * Q_6_33;
+            const auto C_7_96 = Q_5_7 * Q_6_7;
+            const auto C_5_98 = C_5_34 * Q_6_5;
+            const auto C_3_100 = C_3_36 * Q_6_3;
+            const auto C_1_102 = C_1_38 * q_0_6;
+            const auto R_103 = 1 - (R_101 * Q_1_101 + R_99 * Q_2_99 + R_97 * C_97_6 + R_71 * Q_5_71
+                    + R_69 * C_69_34 + R_67 * C_67_36 + R_65 * C_65_38 + R_39 * Q_6_39
+                    + R_37 * C_37_66 + R_35 * C_35_68 + R_33 * C_33_70 + R_7 * C_7_96
+                    + R_5 * C_5_98 + R_3 * C_3_100 + C_1_102);
+            const auto Q_4_7 = Q_4_3 * q_2_4;
+            const auto Q_4_39 = Q_4_7 * q_4_5;
+            const auto Q_4_103 = Q_4_39 * q_4_6;
+            const auto C_101_18 = Q_1_101 * Q_4_101;
+            const auto C_99_20 = Q_2_99 * Q_4_99;
+            const auto C_97_22 = C_97_6 * Q_4_97;
+            const auto Q_1_85 = Q_1_21 * q_1_6;
+            const auto Q_2_83 = Q_2_19 * q_2_6;
+            const auto C_81_6 = Q_1_81 * Q_2_81;
+            const auto Q_4_71 = Q_4_7 * q_4_6;
+            const auto C_69_18 = Q_1_69 * Q_4_69;
+            const auto C_67_20 = Q_2_67 * Q_4_67;
+            const auto C_65_22 = C_65_6 * Q_4_65;
+            const auto C_17_6 = Q_1_17 * Q_2_17;
+            const auto C_5_18 = Q_1_5 * Q_4_5;
+            const auto C_3_20 = Q_2_3 * Q_4_3;
+            const auto C_1_22 = C_1_6 * q_0_4;
+            const auto R_23 = 1 - (R_21 * Q_1_21 + R_19 * Q_2_19 + R_17 * C_17_6 + R_7 * Q_4_7
+                    + R_5 * C_5_18 + R_3 * C_3_20 + C_1_22);
+            const auto Q_6_23 = Q_6_7 * q_4_6;
+            const auto C_21_66 = Q_1_21 * Q_6_21;
+            const auto C_19_68 = Q_2_19 * Q_6_19;
+            const auto C_17_70 = C_17_6 * Q_6_17;
+            const auto C_7_80 = Q_4_7 * Q_6_7;
+            const auto C_5_82 = C_5_18 * Q_6_5;
+            const auto C_3_84 = C_3_20 * Q_6_3;
+            const auto C_1_86 = C_1_22 * q_0_6;
+            const auto R_87 = 1 - (R_85 * Q_1_85 + R_83 * Q_2_83 + R_81 * C_81_6 + R_71 * Q_4_71
+                    + R_69 * C_69_18 + R_67 * C_67_20 + R_65 * C_65_22 + R_23 * Q_6_23
+                    + R_21 * C_21_66 + R_19 * C_19_68 + R_17 * C_17_70 + R_7 * C_7_80
+                    + R_5 * C_5_82 + R_3 * C_3_84 + C_1_86);
+            const auto Q_5_23 = Q_5_7 * q_4_5;
+            const auto Q_5_87 = Q_5_23 * q_5_6;
+            const auto C_85_34 = Q_1_85 * Q_5_85;
+            const auto C_83_36 = Q_2_83 * Q_5_83;
+            const auto C_81_38 = C_81_6 * Q_5_81;
+            const auto C_71_48 = Q_4_71 * Q_5_71;
+            const auto C_69_50 = C_69_18 * Q_5_69;
+            const auto C_67_52 = C_67_20 * Q_5_67;
+            const auto C_65_54 = C_65_22 * Q_5_65;
+            const auto C_49_6 = Q_1_49 * Q_2_49;
+            const auto C_37_18 = Q_1_37 * Q_4_37;
+            const auto C_35_20 = Q_2_35 * Q_4_35;
+            const auto C_33_22 = C_33_6 * Q_4_33;
+            const auto C_21_34 = Q_1_21 * Q_5_21;
+            const auto C_19_36 = Q_2_19 * Q_5_19;
+            const auto C_17_38 = C_17_6 * Q_5_17;
+            const auto C_7_48 = Q_4_7 * Q_5_7;
+            const auto C_5_50 = C_5_18 * Q_5_5;
+            const auto C_3_52 = C_3_20 * Q_5_3;
+            const auto C_1_54 = C_1_22 * q_0_5;
+            const auto R_55 = 1 - (R_53 * Q_1_53 + R_51 * Q_2_51 + R_49 * C_49_6 + R_39 * Q_4_39
+                    + R_37 * C_37_18 + R_35 * C_35_20 + R_33 * C_33_22 + R_23 * Q_5_23
+                    + R_21 * C_21_34 + R_19 * C_19_36 + R_17 * C_17_38 + R_7 * C_7_48
+                    + R_5 * C_5_50 + R_3 * C_3_52 + C_1_54);
+            const auto Q_6_55 = Q_6_23 * q_5_6;
+            const auto C_53_66 = Q_1_53 * Q_6_53;
+            const auto C_51_68 = Q_2_51 * Q_6_51;
+            const auto C_49_70 = C_49_6 * Q_6_49;
+            const auto C_39_80 = Q_4_39 * Q_6_39;
+            const auto C_37_82 = C_37_18 * Q_6_37;
+            const auto C_35_84 = C_35_20 * Q_6_35;
+            const auto C_33_86 = C_33_22 * Q_6_33;
+            const auto C_23_96 = Q_5_23 * Q_6_23;
+            const auto C_21_98 = C_21_34 * Q_6_21;
+            const auto C_19_100 = C_19_36 * Q_6_19;
+            const auto C_17_102 = C_17_38 * Q_6_17;
+            const auto C_7_112 = C_7_48 * Q_6_7;
+            const auto C_5_114 = C_5_50 * Q_6_5;
+            const auto C_3_116 = C_3_52 * Q_6_3;
+            const auto C_1_118 = C_1_54 * q_0_6;
+            const auto R_119 = 1 - (R_117 * Q_1_117 + R_115 * Q_2_115 + R_113 * C_113_6 + R_103 * Q_4_103
+                    + R_101 * C_101_18 + R_99 * C_99_20 + R_97 * C_97_22 + R_87 * Q_5_87
+                    + R_85 * C_85_34 + R_83 * C_83_36 + R_81 * C_81_38 + R_71 * C_71_48
+                    + R_69 * C_69_50 + R_67 * C_67_52 + R_65 * C_65_54 + R_55 * Q_6_55
+                    + R_53 * C_53_66 + R_51 * C_51_68 + R_49 * C_49_70 + R_39 * C_39_80
+                    + R_37 * C_37_82 + R_35 * C_35_84 + R_33 * C_33_86 + R_23 * C_23_96
+                    + R_21 * C_21_98 + R_19 * C_19_100 + R_17 * C_17_102 + R_7 * C_7_112
+                    + R_5 * C_5_114 + R_3 * C_3_116 + C_1_118);
+            const auto Q_3_7 = Q_3_3 * q_2_3;
+            const auto Q_3_23 = Q_3_7 * q_3_4;
+            const auto Q_3_55 = Q_3_23 * q_3_5;
+            const auto Q_3_119 = Q_3_55 * q_3_6;
+            const auto C_117_10 = Q_1_117 * Q_3_117;
+            const auto C_115_12 = Q_2_115 * Q_3_115;
+            const auto C_113_14 = C_113_6 * Q_3_113;
+            const auto Q_1_45 = Q_1_13 * q_1_5;
+            const auto Q_1_109 = Q_1_45 * q_1_6;
+            const auto Q_2_43 = Q_2_11 * q_2_5;
+            const auto Q_2_107 = Q_2_43 * q_2_6;
+            const auto C_105_6 = Q_1_105 * Q_2_105;
+            const auto Q_3_39 = Q_3_7 * q_3_5;
+            const auto Q_3_103 = Q_3_39 * q_3_6;
+            const auto C_101_10 = Q_1_101 * Q_3_101;
+            const auto C_99_12 = Q_2_99 * Q_3_99;
+            const auto C_97_14 = C_97_6 * Q_3_97;
+            const auto Q_1_77 = Q_1_13 * q_1_6;
+            const auto Q_2_75 = Q_2_11 * q_2_6;
+            const auto C_73_6 = Q_1_73 * Q_2_73;
+            const auto Q_3_71 = Q_3_7 * q_3_6;
+            const auto C_69_10 = Q_1_69 * Q_3_69;
+            const auto C_67_12 = Q_2_67 * Q_3_67;
+            const auto C_65_14 = C_65_6 * Q_3_65;
+            const auto C_9_6 = Q_1_9 * Q_2_9;
+            const auto C_5_10 = Q_1_5 * Q_3_5;
+            const auto C_3_12 = Q_2_3 * Q_3_3;
+            const auto C_1_14 = C_1_6 * q_0_3;
+            const auto R_15 = 1 - (R_13 * Q_1_13 + R_11 * Q_2_11 + R_9 * C_9_6 + R_7 * Q_3_7
+                    + R_5 * C_5_10 + R_3 * C_3_12 + C_1_14);
+            const auto Q_6_15 = Q_6_7 * q_3_6;
+            const auto C_13_66 = Q_1_13 * Q_6_13;
+            const auto C_11_68 = Q_2_11 * Q_6_11;
+            const auto C_9_70 = C_9_6 * Q_6_9;
+            const auto C_7_72 = Q_3_7 * Q_6_7;
+            const auto C_5_74 = C_5_10 * Q_6_5;
+            const auto C_3_76 = C_3_12 * Q_6_3;
+            const auto C_1_78 = C_1_14 * q_0_6;
+            const auto R_79 = 1 - (R_77 * Q_1_77 + R_75 * Q_2_75 + R_73 * C_73_6 + R_71 * Q_3_71
+                    + R_69 * C_69_10 + R_67 * C_67_12 + R_65 * C_65_14 + R_15 * Q_6_15
+                    + R_13 * C_13_66 + R_11 * C_11_68 + R_9 * C_9_70 + R_7 * C_7_72
+                    + R_5 * C_5_74 + R_3 * C_3_76 + C_1_78);
+            const auto Q_5_15 = Q_5_7 * q_3_5;
+            const auto Q_5_79 = Q_5_15 * q_5_6;
+            const auto C_77_34 = Q_1_77 * Q_5_77;
+            const auto C_75_36 = Q_2_75 * Q_5_75;
+            const auto C_73_38 = C_73_6 * Q_5_73;
+            const auto C_71_40 = Q_3_71 * Q_5_71;
+            const auto C_69_42 = C_69_10 * Q_5_69;
+            const auto C_67_44 = C_67_12 * Q_5_67;
+            const auto C_65_46 = C_65_14 * Q_5_65;
+            const auto C_41_6 = Q_1_41 * Q_2_41;
+            const auto C_37_10 = Q_1_37 * Q_3_37;
+            const auto C_35_12 = Q_2_35 * Q_3_35;
+            const auto C_33_14 = C_33_6 * Q_3_33;
+            const auto C_13_34 = Q_1_13 * Q_5_13;
+            const auto C_11_36 = Q_2_11 * Q_5_11;
+            const auto C_9_38 = C_9_6 * Q_5_9;
+            const auto C_7_40 = Q_3_7 * Q_5_7;
+            const auto C_5_42 = C_5_10 * Q_5_5;
+            const auto C_3_44 = C_3_12 * Q_5_3;
+            const auto C_1_46 = C_1_14 * q_0_5;
+            const auto R_47 = 1 - (R_45 * Q_1_45 + R_43 * Q_2_43 + R_41 * C_41_6 + R_39 * Q_3_39
+                    + R_37 * C_37_10 + R_35 * C_35_12 + R_33 * C_33_14 + R_15 * Q_5_15
+                    + R_13 * C_13_34 + R_11 * C_11_36 + R_9 * C_9_38 + R_7 * C_7_40
+                    + R_5 * C_5_42 + R_3 * C_3_44 + C_1_46);
+            const auto Q_6_47 = Q_6_15 * q_5_6;
+            const auto C_45_66 = Q_1_45 * Q_6_45;
+            const auto C_43_68 = Q_2_43 * Q_6_43;
+            const auto C_41_70 = C_41_6 * Q_6_41;
+            const auto C_39_72 = Q_3_39 * Q_6_39;
+            const auto C_37_74 = C_37_10 * Q_6_37;
+            const auto C_35_76 = C_35_12 * Q_6_35;
+            const auto C_33_78 = C_33_14 * Q_6_33;
+            const auto C_15_96 = Q_5_15 * Q_6_15;
+            const auto C_13_98 = C_13_34 * Q_6_13;
+            const auto C_11_100 = C_11_36 * Q_6_11;
+            const auto C_9_102 = C_9_38 * Q_6_9;
+            const auto C_7_104 = C_7_40 * Q_6_7;
+            const auto C_5_106 = C_5_42 * Q_6_5;
+            const auto C_3_108 = C_3_44 * Q_6_3;
+            const auto C_1_110 = C_1_46 * q_0_6;
+            const auto R_111 = 1 - (R_109 * Q_1_109 + R_107 * Q_2_107 + R_105 * C_105_6 + R_103 * Q_3_103
+                    + R_101 * C_101_10 + R_99 * C_99_12 + R_97 * C_97_14 + R_79 * Q_5_79
+                    + R_77 * C_77_34 + R_75 * C_75_36 + R_73 * C_73_38 + R_71 * C_71_40
+                    + R_69 * C_69_42 + R_67 * C_67_44 + R_65 * C_65_46 + R_47 * Q_6_47
+                    + R_45 * C_45_66 + R_43 * C_43_68 + R_41 * C_41_70 + R_39 * C_39_72
+                    + R_37 * C_37_74 + R_35 * C_35_76 + R_33 * C_33_78 + R_15 * C_15_96
+                    + R_13 * C_13_98 + R_11 * C_11_100 + R_9 * C_9_102 + R_7 * C_7_104
+                    + R_5 * C_5_106 + R_3 * C_3_108 + C_1_110);
+            const auto Q_4_15 = Q_4_7 * q_3_4;
+            const auto Q_4_47 = Q_4_15 * q_4_5;
+            const auto Q_4_111 = Q_4_47 * q_4_6;
+            const auto C_109_18 = Q_1_109 * Q_4_109;
+            const auto C_107_20 = Q_2_107 * Q_4_107;
+            const auto C_105_22 = C_105_6 * Q_4_105;
+            const auto C_103_24 = Q_3_103 * Q_4_103;
+            const auto C_101_26 = C_101_10 * Q_4_101;
+            const auto C_99_28 = C_99_12 * Q_4_99;
+            const auto C_97_30 = C_97_14 * Q_4_97;
+            const auto Q_1_93 = Q_1_29 * q_1_6;
+            const auto Q_2_91 = Q_2_27 * q_2_6;
+            const auto C_89_6 = Q_1_89 * Q_2_89;
+            const auto Q_3_87 = Q_3_23 * q_3_6;
+            const auto C_85_10 = Q_1_85 * Q_3_85;
+            const auto C_83_12 = Q_2_83 * Q_3_83;
+            const auto C_81_14 = C_81_6 * Q_3_81;
+            const auto Q_4_79 = Q_4_15 * q_4_6;
+            const auto C_77_18 = Q_1_77 * Q_4_77;
+            const auto C_75_20 = Q_2_75 * Q_4_75;
+            const auto C_73_22 = C_73_6 * Q_4_73;
+            const auto C_71_24 = Q_3_71 * Q_4_71;
+            const auto C_69_26 = C_69_10 * Q_4_69;
+            const auto C_67_28 = C_67_12 * Q_4_67;
+            const auto C_65_30 = C_65_14 * Q_4_65;
+            const auto C_25_6 = Q_1_25 * Q_2_25;
+            const auto C_21_10 = Q_1_21 * Q_3_21;
+            const auto C_19_12 = Q_2_19 * Q_3_19;
+            const auto C_17_14 = C_17_6 * Q_3_17;
+            const auto C_13_18 = Q_1_13 * Q_4_13;
+            const auto C_11_20 = Q_2_11 * Q_4_11;
+            const auto C_9_22 = C_9_6 * Q_4_9;
+            const auto C_7_24 = Q_3_7 * Q_4_7;
+            const auto C_5_26 = C_5_10 * Q_4_5;
+            const auto C_3_28 = C_3_12 * Q_4_3;
+            const auto C_1_30 = C_1_14 * q_0_4;
+            const auto R_31 = 1 - (R_29 * Q_1_29 + R_27 * Q_2_27 + R_25 * C_25_6 + R_23 * Q_3_23
+                    + R_21 * C_21_10 + R_19 * C_19_12 + R_17 * C_17_14 + R_15 * Q_4_15
+                    + R_13 * C_13_18 + R_11 * C_11_20 + R_9 * C_9_22 + R_7 * C_7_24
+                    + R_5 * C_5_26 + R_3 * C_3_28 + C_1_30);
+            const auto Q_6_31 = Q_6_15 * q_4_6;
+            const auto C_29_66 = Q_1_29 * Q_6_29;
+            const auto C_27_68 = Q_2_27 * Q_6_27;
+            const auto C_25_70 = C_25_6 * Q_6_25;
+            const auto C_23_72 = Q_3_23 * Q_6_23;
+            const auto C_21_74 = C_21_10 * Q_6_21;
+            const auto C_19_76 = C_19_12 * Q_6_19;
+            const auto C_17_78 = C_17_14 * Q_6_17;
+            const auto C_15_80 = Q_4_15 * Q_6_15;
+            const auto C_13_82 = C_13_18 * Q_6_13;
+            const auto C_11_84 = C_11_20 * Q_6_11;
+            const auto C_9_86 = C_9_22 * Q_6_9;
+            const auto C_7_88 = C_7_24 * Q_6_7;
+            const auto C_5_90 = C_5_26 * Q_6_5;
+            const auto C_3_92 = C_3_28 * Q_6_3;
+            const auto C_1_94 = C_1_30 * q_0_6;
+            const auto R_95 = 1 - (R_93 * Q_1_93 + R_91 * Q_2_91 + R_89 * C_89_6 + R_87 * Q_3_87
+                    + R_85 * C_85_10 + R_83 * C_83_12 + R_81 * C_81_14 + R_79 * Q_4_79
+                    + R_77 * C_77_18 + R_75 * C_75_20 + R_73 * C_73_22 + R_71 * C_71_24
+                    + R_69 * C_69_26 + R_67 * C_67_28 + R_65 * C_65_30 + R_31 * Q_6_31
+                    + R_29 * C_29_66 + R_27 * C_27_68 + R_25 * C_25_70 + R_23 * C_23_72
+                    + R_21 * C_21_74 + R_19 * C_19_76 + R_17 * C_17_78 + R_15 * C_15_80
+                    + R_13 * C_13_82 + R_11 * C_11_84 + R_9 * C_9_86 + R_7 * C_7_88
+                    + R_5 * C_5_90 + R_3 * C_3_92 + C_1_94);
+            const auto Q_5_31 = Q_5_15 * q_4_5;
+            const auto Q_5_95 = Q_5_31 * q_5_6;
+            const auto C_93_34 = Q_1_93 * Q_5_93;
+            const auto C_91_36 = Q_2_91 * Q_5_91;
+            const auto C_89_38 = C_89_6 * Q_5_89;
+            const auto C_87_40 = Q_3_87 * Q_5_87;
+            const auto C_85_42 = C_85_10 * Q_5_85;
+            const auto C_83_44 = C_83_12 * Q_5_83;
+            const auto C_81_46 = C_81_14 * Q_5_81;
+            const auto C_79_48 = Q_4_79 * Q_5_79;
+            const auto C_77_50 = C_77_18 * Q_5_77;
+            const auto C_75_52 = C_75_20 * Q_5_75;
+            const auto C_73_54 = C_73_22 * Q_5_73;
+            const auto C_71_56 = C_71_24 * Q_5_71;
+            const auto C_69_58 = C_69_26 * Q_5_69;
+            const auto C_67_60 = C_67_28 * Q_5_67;
+            const auto C_65_62 = C_65_30 * Q_5_65;
+            const auto C_57_6 = Q_1_57 * Q_2_57;
+            const auto C_53_10 = Q_1_53 * Q_3_53;
+            const auto C_51_12 = Q_2_51 * Q_3_51;
+            const auto C_49_14 = C_49_6 * Q_3_49;
+            const auto C_45_18 = Q_1_45 * Q_4_45;
+            const auto C_43_20 = Q_2_43 * Q_4_43;
+            const auto C_41_22 = C_41_6 * Q_4_41;
+            const auto C_39_24 = Q_3_39 * Q_4_39;
+            const auto C_37_26 = C_37_10 * Q_4_37;
+            const auto C_35_28 = C_35_12 * Q_4_35;
+            const auto C_33_30 = C_33_14 * Q_4_33;
+            const auto C_29_34 = Q_1_29 * Q_5_29;
+            const auto C_27_36 = Q_2_27 * Q_5_27;
+            const auto C_25_38 = C_25_6 * Q_5_25;
+            const auto C_23_40 = Q_3_23 * Q_5_23;
+            const auto C_21_42 = C_21_10 * Q_5_21;
+            const auto C_19_44 = C_19_12 * Q_5_19;
+            const auto C_17_46 = C_17_14 * Q_5_17;
+            const auto C_15_48 = Q_4_15 * Q_5_15;
+            const auto C_13_50 = C_13_18 * Q_5_13;
+            const auto C_11_52 = C_11_20 * Q_5_11;
+            const auto C_9_54 = C_9_22 * Q_5_9;
+            const auto C_7_56 = C_7_24 * Q_5_7;
+            const auto C_5_58 = C_5_26 * Q_5_5;
+            const auto C_3_60 = C_3_28 * Q_5_3;
+            const auto C_1_62 = C_1_30 * q_0_5;
+            const auto R_63 = 1 - (R_61 * Q_1_61 + R_59 * Q_2_59 + R_57 * C_57_6 + R_55 * Q_3_55
+                    + R_53 * C_53_10 + R_51 * C_51_12 + R_49 * C_49_14 + R_47 * Q_4_47
+                    + R_45 * C_45_18 + R_43 * C_43_20 + R_41 * C_41_22 + R_39 * C_39_24
+                    + R_37 * C_37_26 + R_35 * C_35_28 + R_33 * C_33_30 + R_31 * Q_5_31
+                    + R_29 * C_29_34 + R_27 * C_27_36 + R_25 * C_25_38 + R_23 * C_23_40
+                    + R_21 * C_21_42 + R_19 * C_19_44 + R_17 * C_17_46 + R_15 * C_15_48
+                    + R_13 * C_13_50 + R_11 * C_11_52 + R_9 * C_9_54 + R_7 * C_7_56
+                    + R_5 * C_5_58 + R_3 * C_3_60 + C_1_62);
+            const auto Q_6_63 = Q_6_31 * q_5_6;
+            const auto C_61_66 = Q_1_61 * Q_6_61;
+            const auto C_59_68 = Q_2_59 * Q_6_59;
+            const auto C_57_70 = C_57_6 * Q_6_57;
+            const auto C_55_72 = Q_3_55 * Q_6_55;
+            const auto C_53_74 = C_53_10 * Q_6_53;
+            const auto C_51_76 = C_51_12 * Q_6_51;
+            const auto C_49_78 = C_49_14 * Q_6_49;
+            const auto C_47_80 = Q_4_47 * Q_6_47;
+            const auto C_45_82 = C_45_18 * Q_6_45;
+            const auto C_43_84 = C_43_20 * Q_6_43;
+            const auto C_41_86 = C_41_22 * Q_6_41;
+            const auto C_39_88 = C_39_24 * Q_6_39;
+            const auto C_37_90 = C_37_26 * Q_6_37;
+            const auto C_35_92 = C_35_28 * Q_6_35;
+            const auto C_33_94 = C_33_30 * Q_6_33;
+            const auto C_31_96 = Q_5_31 * Q_6_31;
+            const auto C_29_98 = C_29_34 * Q_6_29;
+            const auto C_27_100 = C_27_36 * Q_6_27;
+            const auto C_25_102 = C_25_38 * Q_6_25;
+            const auto C_23_104 = C_23_40 * Q_6_23;
+            const auto C_21_106 = C_21_42 * Q_6_21;
+            const auto C_19_108 = C_19_44 * Q_6_19;
+            const auto C_17_110 = C_17_46 * Q_6_17;
+            const auto C_15_112 = C_15_48 * Q_6_15;
+            const auto C_13_114 = C_13_50 * Q_6_13;
+            const auto C_11_116 = C_11_52 * Q_6_11;
+            const auto C_9_118 = C_9_54 * Q_6_9;
+            const auto C_7_120 = C_7_56 * Q_6_7;
+            const auto C_5_122 = C_5_58 * Q_6_5;
+            const auto C_3_124 = C_3_60 * Q_6_3;
+            const auto C_1_126 = C_1_62 * q_0_6;
+            const auto R_127 = 1 - (R_125 * Q_1_125 + R_123 * Q_2_123 + R_121 * C_121_6 + R_119 * Q_3_119
+                    + R_117 * C_117_10 + R_115 * C_115_12 + R_113 * C_113_14 + R_111 * Q_4_111
+                    + R_109 * C_109_18 + R_107 * C_107_20 + R_105 * C_105_22 + R_103 * C_103_24
+                    + R_101 * C_101_26 + R_99 * C_99_28 + R_97 * C_97_30 + R_95 * Q_5_95
+                    + R_93 * C_93_34 + R_91 * C_91_36 + R_89 * C_89_38 + R_87 * C_87_40
+                    + R_85 * C_85_42 + R_83 * C_83_44 + R_81 * C_81_46 + R_79 * C_79_48
+                    + R_77 * C_77_50 + R_75 * C_75_52 + R_73 * C_73_54 + R_71 * C_71_56
+                    + R_69 * C_69_58 + R_67 * C_67_60 + R_65 * C_65_62 + R_63 * Q_6_63
+                    + R_61 * C_61_66 + R_59 * C_59_68 + R_57 * C_57_70 + R_55 * C_55_72
+                    + R_53 * C_53_74 + R_51 * C_51_76 + R_49 * C_49_78 + R_47 * C_47_80
+                    + R_45 * C_45_82 + R_43 * C_43_84 + R_41 * C_41_86 + R_39 * C_39_88
+                    + R_37 * C_37_90 + R_35 * C_35_92 + R_33 * C_33_94 + R_31 * C_31_96
+                    + R_29 * C_29_98 + R_27 * C_27_100 + R_25 * C_25_102 + R_23 * C_23_104
+                    + R_21 * C_21_106 + R_19 * C_19_108 + R_17 * C_17_110 + R_15 * C_15_112
+                    + R_13 * C_13_114 + R_11 * C_11_116 + R_9 * C_9_118 + R_7 * C_7_120
+                    + R_5 * C_5_122 + R_3 * C_3_124 + C_1_126);
+            return R_127;
+        }
+
+        /// gradient[line * 7 + column], line < column: dR / dp of the edge
+        template<typename Matrix>
+        static double calculateCompleteGraph7ATR(const Matrix &matrix, double *gradient) {
+            const double q_0_1 = 1 - matrix.at(0, 1);
+            const double q_0_2 = 1 - matrix.at(0, 2);
+            const double q_0_3 = 1 - matrix.at(0, 3);
+            const double q_0_4 = 1 - matrix.at(0, 4);
+            const double q_0_5 = 1 - matrix.at(0, 5);
+            const double q_0_6 = 1 - matrix.at(0, 6);
+            const double q_1_2 = 1 - matrix.at(1, 2);
+            const double q_1_3 = 1 - matrix.at(1, 3);
+            const double q_1_4 = 1 - matrix.at(1, 4);
+            const double q_1_5 = 1 - matrix.at(1, 5);
+            const double q_1_6 = 1 - matrix.at(1, 6);
+            const double q_2_3 = 1 - matrix.at(2, 3);
+            const double q_2_4 = 1 - matrix.at(2, 4);
+            const double q_2_5 = 1 - matrix.at(2, 5);
+            const double q_2_6 = 1 - matrix.at(2, 6);
+            const double q_3_4 = 1 - matrix.at(3, 4);
+            const double q_3_5 = 1 - matrix.at(3, 5);
+            const double q_3_6 = 1 - matrix.at(3, 6);
+            const double q_4_5 = 1 - matrix.at(4, 5);
+            const double q_4_6 = 1 - matrix.at(4, 6);
+            const double q_5_6 = 1 - matrix.at(5, 6);
+            const double R_65 = 1 - q_0_6;
+            const double Q_5_65 = q_0_5 * q_5_6;
+            const double R_33 = 1 - q_0_5;
+            const double Q_6_33 = q_0_6 * q_5_6;
+            const double C_1_96 = q_0_5 * q_0_6;
+            const double R_97 = 1 - (R_65 * Q_5_65 + R_33 * Q_6_33 + C_1_96);
+            const double Q_4_33 = q_0_4 * q_4_5;
+            const double Q_4_97 = Q_4_33 * q_4_6;
+            const double Q_4_65 = q_0_4 * q_4_6;
+            const double R_17 = 1 - q_0_4;
+            const double Q_6_17 = q_0_6 * q_4_6;
+            const double C_1_80 = q_0_4 * q_0_6;
+            const double R_81 = 1 - (R_65 * Q_4_65 + R_17 * Q_6_17 + C_1_80);
+            const double Q_5_17 = q_0_5 * q_4_5;
+            const double Q_5_81 = Q_5_17 * q_5_6;
+            const double C_65_48 = Q_4_65 * Q_5_65;
+            const double C_1_48 = q_0_4 * q_0_5;
+            const double R_49 = 1 - (R_33 * Q_4_33 + R_17 * Q_5_17 + C_1_48);
+            const double Q_6_49 = Q_6_17 * q_5_6;
+            const double C_33_80 = Q_4_33 * Q_6_33;
+            const double C_17_96 = Q_5_17 * Q_6_17;
+            const double C_1_112 = C_1_48 * q_0_6;
+            const double R_113 = 1 - (R_97 * Q_4_97 + R_81 * Q_5_81 + R_65 * C_65_48 + R_49 * Q_6_49
+                    + R_33 * C_33_80 + R_17 * C_17_96 + C_1_112);
+            const double Q_3_17 = q_0_3 * q_3_4;
+            const double Q_3_49 = Q_3_17 * q_3_5;
+            const double Q_3_113 = Q_3_49 * q_3_6;
+            const double Q_3_33 = q_0_3 * q_3_5;
+            const double Q_3_97 = Q_3_33 * q_3_6;
+            const double Q_3_65 = q_0_3 * q_3_6;
+            const double R_9 = 1 - q_0_3;
+            const double Q_6_9 = q_0_6 * q_3_6;
+            const double C_1_72 = q_0_3 * q_0_6;
+            const double R_73 = 1 - (R_65 * Q_3_65 + R_9 * Q_6_9 + C_1_72);
+            const double Q_5_9 = q_0_5 * q_3_5;
+            const double Q_5_73 = Q_5_9 * q_5_6;
+            const double C_65_40 = Q_3_65 * Q_5_65;
+            const double C_1_40 = q_0_3 * q_0_5;
+            const double R_41 = 1 - (R_33 * Q_3_33 + R_9 * Q_5_9 + C_1_40);
+            const double Q_6_41 = Q_6_9 * q_5_6;
+            const double C_33_72 = Q_3_33 * Q_6_33;
+            const double C_9_96 = Q_5_9 * Q_6_9;
+            const double C_1_104 = C_1_40 * q_0_6;
+            const double R_105 = 1 - (R_97 * Q_3_97 + R_73 * Q_5_73 + R_65 * C_65_40 + R_41 * Q_6_41
+                    + R_33 * C_33_72 + R_9 * C_9_96 + C_1_104);
+            const double Q_4_9 = q_0_4 * q_3_4;
+            const double Q_4_41 = Q_4_9 * q_4_5;
+            const double Q_4_105 = Q_4_41 * q_4_6;
+            const double C_97_24 = Q_3_97 * Q_4_97;
+            const double Q_3_81 = Q_3_17 * q_3_6;
+            const double Q_4_73 = Q_4_9 * q_4_6;
+            const double C_65_24 = Q_3_65 * Q_4_65;
+            const double C_1_24 = q_0_3 * q_0_4;
+            const double R_25 = 1 - (R_17 * Q_3_17 + R_9 * Q_4_9 + C_1_24);
+            const double Q_6_25 = Q_6_9 * q_4_6;
+            const double C_17_72 = Q_3_17 * Q_6_17;
+            const double C_9_80 = Q_4_9 * Q_6_9;
+            const double C_1_88 = C_1_24 * q_0_6;
+            const double R_89 = 1 - (R_81 * Q_3_81 + R_73 * Q_4_73 + R_65 * C_65_24 + R_25 * Q_6_25
+                    + R_17 * C_17_72 + R_9 * C_9_80 + C_1_88);
+            const double Q_5_25 = Q_5_9 * q_4_5;
+            const double Q_5_89 = Q_5_25 * q_5_6;
+            const double C_81_40 = Q_3_81 * Q_5_81;
+            const double C_73_48 = Q_4_73 * Q_5_73;
+            const double C_65_56 = C_65_24 * Q_5_65;
+            const double C_33_24 = Q_3_33 * Q_4_33;
+            const double C_17_40 = Q_3_17 * Q_5_17;
+            const double C_9_48 = Q_4_9 * Q_5_9;
+            const double C_1_56 = C_1_24 * q_0_5;
+            const double R_57 = 1 - (R_49 * Q_3_49 + R_41 * Q_4_41 + R_33 * C_33_24 + R_25 * Q_5_25
+                    + R_17 * C_17_40 + R_9 * C_9_48 + C_1_56);
+            const double Q_6_57 = Q_6_25 * q_5_6;
+            const double C_49_72 = Q_3_49 * Q_6_49;
+            const double C_41_80 = Q_4_41 * Q_6_41;
+            const double C_33_88 = C_33_24 * Q_6_33;
+            const double C_25_96 = Q_5_25 * Q_6_25;
+            const double C_17_104 = C_17_40 * Q_6_17;
+            const double C_9_112 = C_9_48 * Q_6_9;
+            const double C_1_120 = C_1_56 * q_0_6;
+            const double R_121 = 1 - (R_113 * Q_3_113 + R_105 * Q_4_105 + R_97 * C_97_24 + R_89 * Q_5_89
+                    + R_81 * C_81_40 + R_73 * C_73_48 + R_65 * C_65_56 + R_57 * Q_6_57
+                    + R_49 * C_49_72 + R_41 * C_41_80 + R_33 * C_33_88 + R_25 * C_25_96
+                    + R_17 * C_17_104 + R_9 * C_9_112 + C_1_120);
+            const double Q_2_9 = q_0_2 * q_2_3;
+            const double Q_2_25 = Q_2_9 * q_2_4;
+            const double Q_2_57 = Q_2_25 * q_2_5;
+            const double Q_2_121 = Q_2_57 * q_2_6;
+            const double Q_2_17 = q_0_2 * q_2_4;
+            const double Q_2_49 = Q_2_17 * q_2_5;
+            const double Q_2_113 = Q_2_49 * q_2_6;
+            const double Q_2_33 = q_0_2 * q_2_5;
+            const double Q_2_97 = Q_2_33 * q_2_6;
+            const double Q_2_65 = q_0_2 * q_2_6;
+            const double R_5 = 1 - q_0_2;
+            const double Q_6_5 = q_0_6 * q_2_6;
+            const double C_1_68 = q_0_2 * q_0_6;
+            const double R_69 = 1 - (R_65 * Q_2_65 + R_5 * Q_6_5 + C_1_68);
+            const double Q_5_5 = q_0_5 * q_2_5;
+            const double Q_5_69 = Q_5_5 * q_5_6;
+            const double C_65_36 = Q_2_65 * Q_5_65;
+            const double C_1_36 = q_0_2 * q_0_5;
+            const double R_37 = 1 - (R_33 * Q_2_33 + R_5 * Q_5_5 + C_1_36);
+            const double Q_6_37 = Q_6_5 * q_5_6;
+            const double C_33_68 = Q_2_33 * Q_6_33;
+            const double C_5_96 = Q_5_5 * Q_6_5;
+            const double C_1_100 = C_1_36 * q_0_6;
+            const double R_101 = 1 - (R_97 * Q_2_97 + R_69 * Q_5_69 + R_65 * C_65_36 + R_37 * Q_6_37
+                    + R_33 * C_33_68 + R_5 * C_5_96 + C_1_100);
+            const double Q_4_5 = q_0_4 * q_2_4;
+            const double Q_4_37 = Q_4_5 * q_4_5;
+            const double Q_4_101 = Q_4_37 * q_4_6;
+            const double C_97_20 = Q_2_97 * Q_4_97;
+            const double Q_2_81 = Q_2_17 * q_2_6;
+            const double Q_4_69 = Q_4_5 * q_4_6;
+            const double C_65_20 = Q_2_65 * Q_4_65;
+            const double C_1_20 = q_0_2 * q_0_4;
+            const double R_21 = 1 - (R_17 * Q_2_17 + R_5 * Q_4_5 + C_1_20);
+            const double Q_6_21 = Q_6_5 * q_4_6;
+            const double C_17_68 = Q_2_17 * Q_6_17;
+            const double C_5_80 = Q_4_5 * Q_6_5;
+            const double C_1_84 = C_1_20 * q_0_6;
+            const double R_85 = 1 - (R_81 * Q_2_81 + R_69 * Q_4_69 + R_65 * C_65_20 + R_21 * Q_6_21
+                    + R_17 * C_17_68 + R_5 * C_5_80 + C_1_84);
+            const double Q_5_21 = Q_5_5 * q_4_5;
+            const double Q_5_85 = Q_5_21 * q_5_6;
+            const double C_81_36 = Q_2_81 * Q_5_81;
+            const double C_69_48 = Q_4_69 * Q_5_69;
+            const double C_65_52 = C_65_20 * Q_5_65;
+            const double C_33_20 = Q_2_33 * Q_4_33;
+            const double C_17_36 = Q_2_17 * Q_5_17;
+            const double C_5_48 = Q_4_5 * Q_5_5;
+            const double C_1_52 = C_1_20 * q_0_5;
+            const double R_53 = 1 - (R_49 * Q_2_49 + R_37 * Q_4_37 + R_33 * C_33_20 + R_21 * Q_5_21
+                    + R_17 * C_17_36 + R_5 * C_5_48 + C_1_52);
+            const double Q_6_53 = Q_6_21 * q_5_6;
+            const double C_49_68 = Q_2_49 * Q_6_49;
+            const double C_37_80 = Q_4_37 * Q_6_37;
+            const double C_33_84 = C_33_20 * Q_6_33;
+            const double C_21_96 = Q_5_21 * Q_6_21;
+            const double C_17_100 = C_17_36 * Q_6_17;
+            const double C_5_112 = C_5_48 * Q_6_5;
+            const double C_1_116 = C_1_52 * q_0_6;
+            const double R_117 = 1 - (R_113 * Q_2_113 + R_101 * Q_4_101 + R_97 * C_97_20 + R_85 * Q_5_85
+                    + R_81 * C_81_36 + R_69 * C_69_48 + R_65 * C_65_52 + R_53 * Q_6_53
+                    + R_49 * C_49_68 + R_37 * C_37_80 + R_33 * C_33_84 + R_21 * C_21_96
+                    + R_17 * C_17_100 + R_5 * C_5_112 + C_1_116);
+            const double Q_3_5 = q_0_3 * q_2_3;
+            const double Q_3_21 = Q_3_5 * q_3_4;
+            const double Q_3_53 = Q_3_21 * q_3_5;
+            const double Q_3_117 = Q_3_53 * q_3_6;
+            const double C_113_12 = Q_2_113 * Q_3_113;
+            const double Q_2_41 = Q_2_9 * q_2_5;
+            const double Q_2_105 = Q_2_41 * q_2_6;
+            const double Q_3_37 = Q_3_5 * q_3_5;
+            const double Q_3_101 = Q_3_37 * q_3_6;
+            const double C_97_12 = Q_2_97 * Q_3_97;
+            const double Q_2_73 = Q_2_9 * q_2_6;
+            const double Q_3_69 = Q_3_5 * q_3_6;
+            const double C_65_12 = Q_2_65 * Q_3_65;
+            const double C_1_12 = q_0_2 * q_0_3;
+            const double R_13 = 1 - (R_9 * Q_2_9 + R_5 * Q_3_5 + C_1_12);
+            const double Q_6_13 = Q_6_5 * q_3_6;
+            const double C_9_68 = Q_2_9 * Q_6_9;
+            const double C_5_72 = Q_3_5 * Q_6_5;
+            const double C_1_76 = C_1_12 * q_0_6;
+            const double R_77 = 1 - (R_73 * Q_2_73 + R_69 * Q_3_69 + R_65 * C_65_12 + R_13 * Q_6_13
+                    + R_9 * C_9_68 + R_5 * C_5_72 + C_1_76);
+            const double Q_5_13 = Q_5_5 * q_3_5;
+            const double Q_5_77 = Q_5_13 * q_5_6;
+            const double C_73_36 = Q_2_73 * Q_5_73;
+            const double C_69_40 = Q_3_69 * Q_5_69;
+            const double C_65_44 = C_65_12 * Q_5_65;
+            const double C_33_12 = Q_2_33 * Q_3_33;
+            const double C_9_36 = Q_2_9 * Q_5_9;
+            const double C_5_40 = Q_3_5 * Q_5_5;
+            const double C_1_44 = C_1_12 * q_0_5;
+            const double R_45 = 1 - (R_41 * Q_2_41 + R_37 * Q_3_37 + R_33 * C_33_12 + R_13 * Q_5_13
+                    + R_9 * C_9_36 + R_5 * C_5_40 + C_1_44);
+            const double Q_6_45 = Q_6_13 * q_5_6;
+            const double C_41_68 = Q_2_41 * Q_6_41;
+            const double C_37_72 = Q_3_37 * Q_6_37;
+            const double C_33_76 = C_33_12 * Q_6_33;
+            const double C_13_96 = Q_5_13 * Q_6_13;
+            const double C_9_100 = C_9_36 * Q_6_9;
+            const double C_5_104 = C_5_40 * Q_6_5;
+            const double C_1_108 = C_1_44 * q_0_6;
+            const double R_109 = 1 - (R_105 * Q_2_105 + R_101 * Q_3_101 + R_97 * C_97_12 + R_77 * Q_5_77
+                    + R_73 * C_73_36 + R_69 * C_69_40 + R_65 * C_65_44 + R_45 * Q_6_45
+                    + R_41 * C_41_68 + R_37 * C_37_72 + R_33 * C_33_76 + R_13 * C_13_96
+                    + R_9 * C_9_100 + R_5 * C_5_104 + C_1_108);
+            const double Q_4_13 = Q_4_5 * q_3_4;
+            const double Q_4_45 = Q_4_13 * q_4_5;
+            const double Q_4_109 = Q_4_45 * q_4_6;
+            const double C_105_20 = Q_2_105 * Q_4_105;
+            const double C_101_24 = Q_3_101 * Q_4_101;
+            const double C_97_28 = C_97_12 * Q_4_97;
+            const double Q_2_89 = Q_2_25 * q_2_6;
+            const double Q_3_85 = Q_3_21 * q_3_6;
+            const double C_81_12 = Q_2_81 * Q_3_81;
+            const double Q_4_77 = Q_4_13 * q_4_6;
+            const double C_73_20 = Q_2_73 * Q_4_73;
+            const double C_69_24 = Q_3_69 * Q_4_69;
+            const double C_65_28 = C_65_12 * Q_4_65;
+            const double C_17_12 = Q_2_17 * Q_3_17;
+            const double C_9_20 = Q_2_9 * Q_4_9;
+            const double C_5_24 = Q_3_5 * Q_4_5;
+            const double C_1_28 = C_1_12 * q_0_4;
+            const double R_29 = 1 - (R_25 * Q_2_25 + R_21 * Q_3_21 + R_17 * C_17_12 + R_13 * Q_4_13
+                    + R_9 * C_9_20 + R_5 * C_5_24 + C_1_28);
+            const double Q_6_29 = Q_6_13 * q_4_6;
+            const double C_25_68 = Q_2_25 * Q_6_25;
+            const double C_21_72 = Q_3_21 * Q_6_21;
+            const double C_17_76 = C_17_12 * Q_6_17;
+            const double C_13_80 = Q_4_13 * Q_6_13;
+            const double C_9_84 = C_9_20 * Q_6_9;
+            const double C_5_88 = C_5_24 * Q_6_5;
+            const double C_1_92 = C_1_28 * q_0_6;
+            const double R_93 = 1 - (R_89 * Q_2_89 + R_85 * Q_3_85 + R_81 * C_81_12 + R_77 * Q_4_77
+                    + R_73 * C_73_20 + R_69 * C_69_24 + R_65 * C_65_28 + R_29 * Q_6_29
+                    + R_25 * C_25_68 + R_21 * C_21_72 + R_17 * C_17_76 + R_13 * C_13_80
+                    + R_9 * C_9_84 + R_5 * C_5_88 + C_1_92);
+            const double Q_5_29 = Q_5_13 * q_4_5;
+            const double Q_5_93 = Q_5_29 * q_5_6;
+            const double C_89_36 = Q_2_89 * Q_5_89;
+            const double C_85_40 = Q_3_85 * Q_5_85;
+            const double C_81_44 = C_81_12 * Q_5_81;
+            const double C_77_48 = Q_4_77 * Q_5_77;
+            const double C_73_52 = C_73_20 * Q_5_73;
+            const double C_69_56 = C_69_24 * Q_5_69;
+            const double C_65_60 = C_65_28 * Q_5_65;
+            const double C_49_12 = Q_2_49 * Q_3_49;
+            const double C_41_20 = Q_2_41 * Q_4_41;
+            const double C_37_24 = Q_3_37 * Q_4_37;
+            const double C_33_28 = C_33_12 * Q_4_33;
+            const double C_25_36 = Q_2_25 * Q_5_25;
+            const double C_21_40 = Q_3_21 * Q_5_21;
+            const double C_17_44 = C_17_12 * Q_5_17;
+            const double C_13_48 = Q_4_13 * Q_5_13;
+            const double C_9_52 = C_9_20 * Q_5_9;
+            const double C_5_56 = C_5_24 * Q_5_5;
+            const double C_1_60 = C_1_28 * q_0_5;
+            const double R_61 = 1 - (R_57 * Q_2_57 + R_53 * Q_3_53 + R_49 * C_49_12 + R_45 * Q_4_45
+                    + R_41 * C_41_20 + R_37 * C_37_24 + R_33 * C_33_28 + R_29 * Q_5_29
+                    + R_25 * C_25_36 + R_21 * C_21_40 + R_17 * C_17_44 + R_13 * C_13_48
+                    + R_9 * C_9_52 + R_5 * C_5_56 + C_1_60);
+            const double Q_6_61 = Q_6_29 * q_5_6;
+            const double C_57_68 = Q_2_57 * Q_6_57;
+            const double C_53_72 = Q_3_53 * Q_6_53;
+            const double C_49_76 = C_49_12 * Q_6_49;
+            const double C_45_80 = Q_4_45 * Q_6_45;
+            const double C_41_84 = C_41_20 * Q_6_41;
+            const double C_37_88 = C_37_24 * Q_6_37;
+            const double C_33_92 = C_33_28 * Q_6_33;
+            const double C_29_96 = Q_5_29 * Q_6_29;
+            const double C_25_100 = C_25_36 * Q_6_25;
+            const double C_21_104 = C_21_40 * Q_6_21;
+            const double C_17_108 = C_17_44 * Q_6_17;
+            const double C_13_112 = C_13_48 * Q_6_13;
+            const double C_9_116 = C_9_52 * Q_6_9;
+            const double C_5_120 = C_5_56 * Q_6_5;
+            const double C_1_124 = C_1_60 * q_0_6;
+            const double R_125 = 1 - (R_121 * Q_2_121 + R_117 * Q_3_117 + R_113 * C_113_12 + R_109 * Q_4_109
+                    + R_105 * C_105_20 + R_101 * C_101_24 + R_97 * C_97_28 + R_93 * Q_5_93
+                    + R_89 * C_89_36 + R_85 * C_85_40 + R_81 * C_81_44 + R_77 * C_77_48
+                    + R_73 * C_73_52 + R_69 * C_69_56 + R_65 * C_65_60 + R_61 * Q_6_61
+                    + R_57 * C_57_68 + R_53 * C_53_72 + R_49 * C_49_76 + R_45 * C_45_80
+                    + R_41 * C_41_84 + R_37 * C_37_88 + R_33 * C_33_92 + R_29 * C_29_96
+                    + R_25 * C_25_100 + R_21 * C_21_104 + R_17 * C_17_108 + R_13 * C_13_112
+                    + R_9 * C_9_116 + R_5 * C_5_120 + C_1_124);
+            const double Q_1_5 = q_0_1 * q_1_2;
+            const double Q_1_13 = Q_1_5 * q_1_3;
+            const double Q_1_29 = Q_1_13 * q_1_4;
+            const double Q_1_61 = Q_1_29 * q_1_5;
+            const double Q_1_125 = Q_1_61 * q_1_6;
+            const double Q_1_9 = q_0_1 * q_1_3;
+            const double Q_1_25 = Q_1_9 * q_1_4;
+            const double Q_1_57 = Q_1_25 * q_1_5;
+            const double Q_1_121 = Q_1_57 * q_1_6;
+            const double Q_1_17 = q_0_1 * q_1_4;
+            const double Q_1_49 = Q_1_17 * q_1_5;
+            const double Q_1_113 = Q_1_49 * q_1_6;
+            const double Q_1_33 = q_0_1 * q_1_5;
+            const double Q_1_97 = Q_1_33 * q_1_6;
+            const double Q_1_65 = q_0_1 * q_1_6;
+            const double R_3 = 1 - q_0_1;
+            const double Q_6_3 = q_0_6 * q_1_6;
+            const double C_1_66 = q_0_1 * q_0_6;
+            const double R_67 = 1 - (R_65 * Q_1_65 + R_3 * Q_6_3 + C_1_66);
+            const double Q_5_3 = q_0_5 * q_1_5;
+            const double Q_5_67 = Q_5_3 * q_5_6;
+            const double C_65_34 = Q_1_65 * Q_5_65;
+            const double C_1_34 = q_0_1 * q_0_5;
+            const double R_35 = 1 - (R_33 * Q_1_33 + R_3 * Q_5_3 + C_1_34);
+            const double Q_6_35 = Q_6_3 * q_5_6;
+            const double C_33_66 = Q_1_33 * Q_6_33;
+            const double C_3_96 = Q_5_3 * Q_6_3;
+            const double C_1_98 = C_1_34 * q_0_6;
+            const double R_99 = 1 - (R_97 * Q_1_97 + R_67 * Q_5_67 + R_65 * C_65_34 + R_35 * Q_6_35
+                    + R_33 * C_33_66 + R_3 * C_3_96 + C_1_98);
+            const double Q_4_3 = q_0_4 * q_1_4;
+            const double Q_4_35 = Q_4_3 * q_4_5;
+            const double Q_4_99 = Q_4_35 * q_4_6;
+            const double C_97_18 = Q_1_97 * Q_4_97;
+            const double Q_1_81 = Q_1_17 * q_1_6;
+            const double Q_4_67 = Q_4_3 * q_4_6;
+            const double C_65_18 = Q_1_65 * Q_4_65;
+            const double C_1_18 = q_0_1 * q_0_4;
+            const double R_19 = 1 - (R_17 * Q_1_17 + R_3 * Q_4_3 + C_1_18);
+            const double Q_6_19 = Q_6_3 * q_4_6;
+            const double C_17_66 = Q_1_17 * Q_6_17;
+            const double C_3_80 = Q_4_3 * Q_6_3;
+            const double C_1_82 = C_1_18 * q_0_6;
+            const double R_83 = 1 - (R_81 * Q_1_81 + R_67 * Q_4_67 + R_65 * C_65_18 + R_19 * Q_6_19
+                    + R_17 * C_17_66 + R_3 * C_3_80 + C_1_82);
+            const double Q_5_19 = Q_5_3 * q_4_5;
+            const double Q_5_83 = Q_5_19 * q_5_6;
+            const double C_81_34 = Q_1_81 * Q_5_81;
+            const double C_67_48 = Q_4_67 * Q_5_67;
+            const double C_65_50 = C_65_18 * Q_5_65;
+            const double C_33_18 = Q_1_33 * Q_4_33;
+            const double C_17_34 = Q_1_17 * Q_5_17;
+            const double C_3_48 = Q_4_3 * Q_5_3;
+            const double C_1_50 = C_1_18 * q_0_5;
+            const double R_51 = 1 - (R_49 * Q_1_49 + R_35 * Q_4_35 + R_33 * C_33_18 + R_19 * Q_5_19
+                    + R_17 * C_17_34 + R_3 * C_3_48 + C_1_50);
+            const double Q_6_51 = Q_6_19 * q_5_6;
+            const double C_49_66 = Q_1_49 * Q_6_49;
+            const double C_35_80 = Q_4_35 * Q_6_35;
+            const double C_33_82 = C_33_18 * Q_6_33;
+            const double C_19_96 = Q_5_19 * Q_6_19;
+            const double C_17_98 = C_17_34 * Q_6_17;
+            const double C_3_112 = C_3_48 * Q_6_3;
+            const double C_1_114 = C_1_50 * q_0_6;
+            const double R_115 = 1 - (R_113 * Q_1_113 + R_99 * Q_4_99 + R_97 * C_97_18 + R_83 * Q_5_83
+                    + R_81 * C_81_34 + R_67 * C_67_48 + R_65 * C_65_50 + R_51 * Q_6_51
+                    + R_49 * C_49_66 + R_35 * C_35_80 + R_33 * C_33_82 + R_19 * C_19_96
+                    + R_17 * C_17_98 + R_3 * C_3_112 + C_1_114);
+            const double Q_3_3 = q_0_3 * q_1_3;
+            const double Q_3_19 = Q_3_3 * q_3_4;
+            const double Q_3_51 = Q_3_19 * q_3_5;
+            const double Q_3_115 = Q_3_51 * q_3_6;
+            const double C_113_10 = Q_1_113 * Q_3_113;
+            const double Q_1_41 = Q_1_9 * q_1_5;
+            const double Q_1_105 = Q_1_41 * q_1_6;
+            const double Q_3_35 = Q_3_3 * q_3_5;
+            const double Q_3_99 = Q_3_35 * q_3_6;
+            const double C_97_10 = Q_1_97 * Q_3_97;
+            const double Q_1_73 = Q_1_9 * q_1_6;
+            const double Q_3_67 = Q_3_3 * q_3_6;
+            const double C_65_10 = Q_1_65 * Q_3_65;
+            const double C_1_10 = q_0_1 * q_0_3;
+            const double R_11 = 1 - (R_9 * Q_1_9 + R_3 * Q_3_3 + C_1_10);
+            const double Q_6_11 = Q_6_3 * q_3_6;
+            const double C_9_66 = Q_1_9 * Q_6_9;
+            const double C_3_72 = Q_3_3 * Q_6_3;
+            const double C_1_74 = C_1_10 * q_0_6;
+            const double R_75 = 1 - (R_73 * Q_1_73 + R_67 * Q_3_67 + R_65 * C_65_10 + R_11 * Q_6_11
+                    + R_9 * C_9_66 + R_3 * C_3_72 + C_1_74);
+            const double Q_5_11 = Q_5_3 * q_3_5;
+            const double Q_5_75 = Q_5_11 * q_5_6;
+            const double C_73_34 = Q_1_73 * Q_5_73;
+            const double C_67_40 = Q_3_67 * Q_5_67;
+            const double C_65_42 = C_65_10 * Q_5_65;
+            const double C_33_10 = Q_1_33 * Q_3_33;
+            const double C_9_34 = Q_1_9 * Q_5_9;
+            const double C_3_40 = Q_3_3 * Q_5_3;
+            const double C_1_42 = C_1_10 * q_0_5;
+            const double R_43 = 1 - (R_41 * Q_1_41 + R_35 * Q_3_35 + R_33 * C_33_10 + R_11 * Q_5_11
+                    + R_9 * C_9_34 + R_3 * C_3_40 + C_1_42);
+            const double Q_6_43 = Q_6_11 * q_5_6;
+            const double C_41_66 = Q_1_41 * Q_6_41;
+            const double C_35_72 = Q_3_35 * Q_6_35;
+            const double C_33_74 = C_33_10 * Q_6_33;
+            const double C_11_96 = Q_5_11 * Q_6_11;
+            const double C_9_98 = C_9_34 * Q_6_9;
+            const double C_3_104 = C_3_40 * Q_6_3;
+            const double C_1_106 = C_1_42 * q_0_6;
+            const double R_107 = 1 - (R_105 * Q_1_105 + R_99 * Q_3_99 + R_97 * C_97_10 + R_75 * Q_5_75
+                    + R_73 * C_73_34 + R_67 * C_67_40 + R_65 * C_65_42 + R_43 * Q_6_43
+                    + R_41 * C_41_66 + R_35 * C_35_72 + R_33 * C_33_74 + R_11 * C_11_96
+                    + R_9 * C_9_98 + R_3 * C_3_104 + C_1_106);
+            const double Q_4_11 = Q_4_3 * q_3_4;
+            const double Q_4_43 = Q_4_11 * q_4_5;
+            const double Q_4_107 = Q_4_43 * q_4_6;
+            const double C_105_18 = Q_1_105 * Q_4_105;
+            const double C_99_24 = Q_3_99 * Q_4_99;
+            const double C_97_26 = C_97_10 * Q_4_97;
+            const double Q_1_89 = Q_1_25 * q_1_6;
+            const double Q_3_83 = Q_3_19 * q_3_6;
+            const double C_81_10 = Q_1_81 * Q_3_81;
+            const double Q_4_75 = Q_4_11 * q_4_6;
+            const double C_73_18 = Q_1_73 * Q_4_73;
+            const double C_67_24 = Q_3_67 * Q_4_67;
+            const double C_65_26 = C_65_10 * Q_4_65;
+            const double C_17_10 = Q_1_17 * Q_3_17;
+            const double C_9_18 = Q_1_9 * Q_4_9;
+            const double C_3_24 = Q_3_3 * Q_4_3;
+            const double C_1_26 = C_1_10 * q_0_4;
+            const double R_27 = 1 - (R_25 * Q_1_25 + R_19 * Q_3_19 + R_17 * C_17_10 + R_11 * Q_4_11
+                    + R_9 * C_9_18 + R_3 * C_3_24 + C_1_26);
+            const double Q_6_27 = Q_6_11 * q_4_6;
+            const double C_25_66 = Q_1_25 * Q_6_25;
+            const double C_19_72 = Q_3_19 * Q_6_19;
+            const double C_17_74 = C_17_10 * Q_6_17;
+            const double C_11_80 = Q_4_11 * Q_6_11;
+            const double C_9_82 = C_9_18 * Q_6_9;
+            const double C_3_88 = C_3_24 * Q_6_3;
+            const double C_1_90 = C_1_26 * q_0_6;
+            const double R_91 = 1 - (R_89 * Q_1_89 + R_83 * Q_3_83 + R_81 * C_81_10 + R_75 * Q_4_75
+                    + R_73 * C_73_18 + R_67 * C_67_24 + R_65 * C_65_26 + R_27 * Q_6_27
+                    + R_25 * C_25_66 + R_19 * C_19_72 + R_17 * C_17_74 + R_11 * C_11_80
+                    + R_9 * C_9_82 + R_3 * C_3_88 + C_1_90);
+            const double Q_5_27 = Q_5_11 * q_4_5;
+            const double Q_5_91 = Q_5_27 * q_5_6;
+            const double C_89_34 = Q_1_89 * Q_5_89;
+            const double C_83_40 = Q_3_83 * Q_5_83;
+            const double C_81_42 = C_81_10 * Q_5_81;
+            const double C_75_48 = Q_4_75 * Q_5_75;
+            const double C_73_50 = C_73_18 * Q_5_73;
+            const double C_67_56 = C_67_24 * Q_5_67;
+            const double C_65_58 = C_65_26 * Q_5_65;
+            const double C_49_10 = Q_1_49 * Q_3_49;
+            const double C_41_18 = Q_1_41 * Q_4_41;
+            const double C_35_24 = Q_3_35 * Q_4_35;
+            const double C_33_26 = C_33_10 * Q_4_33;
+            const double C_25_34 = Q_1_25 * Q_5_25;
+            const double C_19_40 = Q_3_19 * Q_5_19;
+            const double C_17_42 = C_17_10 * Q_5_17;
+            const double C_11_48 = Q_4_11 * Q_5_11;
+            const double C_9_50 = C_9_18 * Q_5_9;
+            const double C_3_56 = C_3_24 * Q_5_3;
+            const double C_1_58 = C_1_26 * q_0_5;
+            const double R_59 = 1 - (R_57 * Q_1_57 + R_51 * Q_3_51 + R_49 * C_49_10 + R_43 * Q_4_43
+                    + R_41 * C_41_18 + R_35 * C_35_24 + R_33 * C_33_26 + R_27 * Q_5_27
+                    + R_25 * C_25_34 + R_19 * C_19_40 + R_17 * C_17_42 + R_11 * C_11_48
+                    + R_9 * C_9_50 + R_3 * C_3_56 + C_1_58);
+            const double Q_6_59 = Q_6_27 * q_5_6;
+            const double C_57_66 = Q_1_57 * Q_6_57;
+            const double C_51_72 = Q_3_51 * Q_6_51;
+            const double C_49_74 = C_49_10 * Q_6_49;
+            const double C_43_80 = Q_4_43 * Q_6_43;
+            const double C_41_82 = C_41_18 * Q_6_41;
+            const double C_35_88 = C_35_24 * Q_6_35;
+            const double C_33_90 = C_33_26 * Q_6_33;
+            const double C_27_96 = Q_5_27 * Q_6_27;
+            const double C_25_98 = C_25_34 * Q_6_25;
+            const double C_19_104 = C_19_40 * Q_6_19;
+            const double C_17_106 = C_17_42 * Q_6_17;
+            const double C_11_112 = C_11_48 * Q_6_11;
+            const double C_9_114 = C_9_50 * Q_6_9;
+            const double C_3_120 = C_3_56 * Q_6_3;
+            const double C_1_122 = C_1_58 * q_0_6;
+            const double R_123 = 1 - (R_121 * Q_1_121 + R_115 * Q_3_115 + R_113 * C_113_10 + R_107 * Q_4_107
+                    + R_105 * C_105_18 + R_99 * C_99_24 + R_97 * C_97_26 + R_91 * Q_5_91
+                    + R_89 * C_89_34 + R_83 * C_83_40 + R_81 * C_81_42 + R_75 * C_75_48
+                    + R_73 * C_73_50 + R_67 * C_67_56 + R_65 * C_65_58 + R_59 * Q_6_59
+                    + R_57 * C_57_66 + R_51 * C_51_72 + R_49 * C_49_74 + R_43 * C_43_80
+                    + R_41 * C_41_82 + R_35 * C_35_88 + R_33 * C_33_90 + R_27 * C_27_96
+                    + R_25 * C_25_98 + R_19 * C_19_104 + R_17 * C_17_106 + R_11 * C_11_112
+                    + R_9 * C_9_114 + R_3 * C_3_120 + C_1_122);
+            const double Q_2_3 = q_0_2 * q_1_2;
+            const double Q_2_11 = Q_2_3 * q_2_3;
+            const double Q_2_27 = Q_2_11 * q_2_4;
+            const double Q_2_59 = Q_2_27 * q_2_5;
+            const double Q_2_123 = Q_2_59 * q_2_6;
+            const double C_121_6 = Q_1_121 * Q_2_121;
+            const double Q_1_21 = Q_1_5 * q_1_4;
+            const double Q_1_53 = Q_1_21 * q_1_5;
+            const double Q_1_117 = Q_1_53 * q_1_6;
+            const double Q_2_19 = Q_2_3 * q_2_4;
+            const double Q_2_51 = Q_2_19 * q_2_5;
+            const double Q_2_115 = Q_2_51 * q_2_6;
+            const double C_113_6 = Q_1_113 * Q_2_113;
+            const double Q_1_37 = Q_1_5 * q_1_5;
+            const double Q_1_101 = Q_1_37 * q_1_6;
+            const double Q_2_35 = Q_2_3 * q_2_5;
+            const double Q_2_99 = Q_2_35 * q_2_6;
+            const double C_97_6 = Q_1_97 * Q_2_97;
+            const double Q_1_69 = Q_1_5 * q_1_6;
+            const double Q_2_67 = Q_2_3 * q_2_6;
+            const double C_65_6 = Q_1_65 * Q_2_65;
+            const double C_1_6 = q_0_1 * q_0_2;
+            const double R_7 = 1 - (R_5 * Q_1_5 + R_3 * Q_2_3 + C_1_6);
+            const double Q_6_7 = Q_6_3 * q_2_6;
+            const double C_5_66 = Q_1_5 * Q_6_5;
+            const double C_3_68 = Q_2_3 * Q_6_3;
+            const double C_1_70 = C_1_6 * q_0_6;
+            const double R_71 = 1 - (R_69 * Q_1_69 + R_67 * Q_2_67 + R_65 * C_65_6 + R_7 * Q_6_7
+                    + R_5 * C_5_66 + R_3 * C_3_68 + C_1_70);
+            const double Q_5_7 = Q_5_3 * q_2_5;
+            const double Q_5_71 = Q_5_7 * q_5_6;
+            const double C_69_34 = Q_1_69 * Q_5_69;
+            const double C_67_36 = Q_2_67 * Q_5_67;
+            const double C_65_38 = C_65_6 * Q_5_65;
+            const double C_33_6 = Q_1_33 * Q_2_33;
+            const double C_5_34 = Q_1_5 * Q_5_5;
+            const double C_3_36 = Q_2_3 * Q_5_3;
+            const double C_1_38 = C_1_6 * q_0_5;
+            const double R_39 = 1 - (R_37 * Q_1_37 + R_35 * Q_2_35 + R_33 * C_33_6 + R_7 * Q_5_7
+                    + R_5 * C_5_34 + R_3 * C_3_36 + C_1_38);
+            const double Q_6_39 = Q_6_7 * q_5_6;
+            const double C_37_66 = Q_1_37 * Q_6_37;
+            const double C_35_68 = Q_2_35 * Q_6_35;
+            const double C_33_70 = C_33_6 * Q_6_33;
+            const double C_7_96 = Q_5_7 * Q_6_7;
+            const double C_5_98 = C_5_34 * Q_6_5;
+            const double C_3_100 = C_3_36 * Q_6_3;
+            const double C_1_102 = C_1_38 * q_0_6;
+            const double R_103 = 1 - (R_101 * Q_1_101 + R_99 * Q_2_99 + R_97 * C_97_6 + R_71 * Q_5_71
+                    + R_69 * C_69_34 + R_67 * C_67_36 + R_65 * C_65_38 + R_39 * Q_6_39
+                    + R_37 * C_37_66 + R_35 * C_35_68 + R_33 * C_33_70 + R_7 * C_7_96
+                    + R_5 * C_5_98 + R_3 * C_3_100 + C_1_102);
+            const double Q_4_7 = Q_4_3 * q_2_4;
+            const double Q_4_39 = Q_4_7 * q_4_5;
+            const double Q_4_103 = Q_4_39 * q_4_6;
+            const double C_101_18 = Q_1_101 * Q_4_101;
+            const double C_99_20 = Q_2_99 * Q_4_99;
+            const double C_97_22 = C_97_6 * Q_4_97;
+            const double Q_1_85 = Q_1_21 * q_1_6;
+            const double Q_2_83 = Q_2_19 * q_2_6;
+            const double C_81_6 = Q_1_81 * Q_2_81;
+            const double Q_4_71 = Q_4_7 * q_4_6;
+            const double C_69_18 = Q_1_69 * Q_4_69;
+            const double C_67_20 = Q_2_67 * Q_4_67;
+            const double C_65_22 = C_65_6 * Q_4_65;
+            const double C_17_6 = Q_1_17 * Q_2_17;
+            const double C_5_18 = Q_1_5 * Q_4_5;
+            const double C_3_20 = Q_2_3 * Q_4_3;
+            const double C_1_22 = C_1_6 * q_0_4;
+            const double R_23 = 1 - (R_21 * Q_1_21 + R_19 * Q_2_19 + R_17 * C_17_6 + R_7 * Q_4_7
+                    + R_5 * C_5_18 + R_3 * C_3_20 + C_1_22);
+            const double Q_6_23 = Q_6_7 * q_4_6;
+            const double C_21_66 = Q_1_21 * Q_6_21;
+            const double C_19_68 = Q_2_19 * Q_6_19;
+            const double C_17_70 = C_17_6 * Q_6_17;
+            const double C_7_80 = Q_4_7 * Q_6_7;
+            const double C_5_82 = C_5_18 * Q_6_5;
+            const double C_3_84 = C_3_20 * Q_6_3;
+            const double C_1_86 = C_1_22 * q_0_6;
+            const double R_87 = 1 - (R_85 * Q_1_85 + R_83 * Q_2_83 + R_81 * C_81_6 + R_71 * Q_4_71
+                    + R_69 * C_69_18 + R_67 * C_67_20 + R_65 * C_65_22 + R_23 * Q_6_23
+                    + R_21 * C_21_66 + R_19 * C_19_68 + R_17 * C_17_70 + R_7 * C_7_80
+                    + R_5 * C_5_82 + R_3 * C_3_84 + C_1_86);
+            const double Q_5_23 = Q_5_7 * q_4_5;
+            const double Q_5_87 = Q_5_23 * q_5_6;
+            const double C_85_34 = Q_1_85 * Q_5_85;
+            const double C_83_36 = Q_2_83 * Q_5_83;
+            const double C_81_38 = C_81_6 * Q_5_81;
+            const double C_71_48 = Q_4_71 * Q_5_71;
+            const double C_69_50 = C_69_18 * Q_5_69;
+            const double C_67_52 = C_67_20 * Q_5_67;
+            const double C_65_54 = C_65_22 * Q_5_65;
+            const double C_49_6 = Q_1_49 * Q_2_49;
+            const double C_37_18 = Q_1_37 * Q_4_37;
+            const double C_35_20 = Q_2_35 * Q_4_35;
+            const double C_33_22 = C_33_6 * Q_4_33;
+            const double C_21_34 = Q_1_21 * Q_5_21;
+            const double C_19_36 = Q_2_19 * Q_5_19;
+            const double C_17_38 = C_17_6 * Q_5_17;
+            const double C_7_48 = Q_4_7 * Q_5_7;
+            const double C_5_50 = C_5_18 * Q_5_5;
+            const double C_3_52 = C_3_20 * Q_5_3;
+            const double C_1_54 = C_1_22 * q_0_5;
+            const double R_55 = 1 - (R_53 * Q_1_53 + R_51 * Q_2_51 + R_49 * C_49_6 + R_39 * Q_4_39
+                    + R_37 * C_37_18 + R_35 * C_35_20 + R_33 * C_33_22 + R_23 * Q_5_23
+                    + R_21 * C_21_34 + R_19 * C_19_36 + R_17 * C_17_38 + R_7 * C_7_48
+                    + R_5 * C_5_50 + R_3 * C_3_52 + C_1_54);
+            const double Q_6_55 = Q_6_23 * q_5_6;
+            const double C_53_66 = Q_1_53 * Q_6_53;
+            const double C_51_68 = Q_2_51 * Q_6_51;
+            const double C_49_70 = C_49_6 * Q_6_49;
+            const double C_39_80 = Q_4_39 * Q_6_39;
+            const double C_37_82 = C_37_18 * Q_6_37;
+            const double C_35_84 = C_35_20 * Q_6_35;
+            const double C_33_86 = C_33_22 * Q_6_33;
+            const double C_23_96 = Q_5_23 * Q_6_23;
+            const double C_21_98 = C_21_34 * Q_6_21;
+            const double C_19_100 = C_19_36 * Q_6_19;
+            const double C_17_102 = C_17_38 * Q_6_17;
+            const double C_7_112 = C_7_48 * Q_6_7;
+            const double C_5_114 = C_5_50 * Q_6_5;
+            const double C_3_116 = C_3_52 * Q_6_3;
+            const double C_1_118 = C_1_54 * q_0_6;
+            const double R_119 = 1 - (R_117 * Q_1_117 + R_115 * Q_2_115 + R_113 * C_113_6 + R_103 * Q_4_103
+                    + R_101 * C_101_18 + R_99 * C_99_20 + R_97 * C_97_22 + R_87 * Q_5_87
+                    + R_85 * C_85_34 + R_83 * C_83_36 + R_81 * C_81_38 + R_71 * C_71_48
+                    + R_69 * C_69_50 + R_67 * C_67_52 + R_65 * C_65_54 + R_55 * Q_6_55
+                    + R_53 * C_53_66 + R_51 * C_51_68 + R_49 * C_49_70 + R_39 * C_39_80
+                    + R_37 * C_37_82 + R_35 * C_35_84 + R_33 * C_33_86 + R_23 * C_23_96
+                    + R_21 * C_21_98 + R_19 * C_19_100 + R_17 * C_17_102 + R_7 * C_7_112
+                    + R_5 * C_5_114 + R_3 * C_3_116 + C_1_118);
+            const double Q_3_7 = Q_3_3 * q_2_3;
+            const double Q_3_23 = Q_3_7 * q_3_4;
+            const double Q_3_55 = Q_3_23 * q_3_5;
+            const double Q_3_119 = Q_3_55 * q_3_6;
+            const double C_117_10 = Q_1_117 * Q_3_117;
+            const double C_115_12 = Q_2_115 * Q_3_115;
+            const double C_113_14 = C_113_6 * Q_3_113;
+            const double Q_1_45 = Q_1_13 * q_1_5;
+            const double Q_1_109 = Q_1_45 * q_1_6;
+            const double Q_2_43 = Q_2_11 * q_2_5;
+            const double Q_2_107 = Q_2_43 * q_2_6;
+            const double C_105_6 = Q_1_105 * Q_2_105;
+            const double Q_3_39 = Q_3_7 * q_3_5;
+            const double Q_3_103 = Q_3_39 * q_3_6;
+            const double C_101_10 = Q_1_101 * Q_3_101;
+            const double C_99_12 = Q_2_99 * Q_3_99;
+            const double C_97_14 = C_97_6 * Q_3_97;
+            const double Q_1_77 = Q_1_13 * q_1_6;
+            const double Q_2_75 = Q_2_11 * q_2_6;
+            const double C_73_6 = Q_1_73 * Q_2_73;
+            const double Q_3_71 = Q_3_7 * q_3_6;
+            const double C_69_10 = Q_1_69 * Q_3_69;
+            const double C_67_12 = Q_2_67 * Q_3_67;
+            const double C_65_14 = C_65_6 * Q_3_65;
+            const double C_9_6 = Q_1_9 * Q_2_9;
+            const double C_5_10 = Q_1_5 * Q_3_5;
+            const double C_3_12 = Q_2_3 * Q_3_3;
+            const double C_1_14 = C_1_6 * q_0_3;
+            const double R_15 = 1 - (R_13 * Q_1_13 + R_11 * Q_2_11 + R_9 * C_9_6 + R_7 * Q_3_7
+                    + R_5 * C_5_10 + R_3 * C_3_12 + C_1_14);
+            const double Q_6_15 = Q_6_7 * q_3_6;
+            const double C_13_66 = Q_1_13 * Q_6_13;
+            const double C_11_68 = Q_2_11 * Q_6_11;
+            const double C_9_70 = C_9_6 * Q_6_9;
+            const double C_7_72 = Q_3_7 * Q_6_7;
+            const double C_5_74 = C_5_10 * Q_6_5;
+            const double C_3_76 = C_3_12 * Q_6_3;
+            const double C_1_78 = C_1_14 * q_0_6;
+            const double R_79 = 1 - (R_77 * Q_1_77 + R_75 * Q_2_75 + R_73 * C_73_6 + R_71 * Q_3_71
+                    + R_69 * C_69_10 + R_67 * C_67_12 + R_65 * C_65_14 + R_15 * Q_6_15
+                    + R_13 * C_13_66 + R_11 * C_11_68 + R_9 * C_9_70 + R_7 * C_7_72
+                    + R_5 * C_5_74 + R_3 * C_3_76 + C_1_78);
+            const double Q_5_15 = Q_5_7 * q_3_5;
+            const double Q_5_79 = Q_5_15 * q_5_6;
+            const double C_77_34 = Q_1_77 * Q_5_77;
+            const double C_75_36 = Q_2_75 * Q_5_75;
+            const double C_73_38 = C_73_6 * Q_5_73;
+            const double C_71_40 = Q_3_71 * Q_5_71;
+            const double C_69_42 = C_69_10 * Q_5_69;
+            const double C_67_44 = C_67_12 * Q_5_67;
+            const double C_65_46 = C_65_14 * Q_5_65;
+            const double C_41_6 = Q_1_41 * Q_2_41;
+            const double C_37_10 = Q_1_37 * Q_3_37;
+            const double C_35_12 = Q_2_35 * Q_3_35;
+            const double C_33_14 = C_33_6 * Q_3_33;
+            const double C_13_34 = Q_1_13 * Q_5_13;
+            const double C_11_36 = Q_2_11 * Q_5_11;
+            const double C_9_38 = C_9_6 * Q_5_9;
+            const double C_7_40 = Q_3_7 * Q_5_7;
+            const double C_5_42 = C_5_10 * Q_5_5;
+            const double C_3_44 = C_3_12 * Q_5_3;
+            const double C_1_46 = C_1_14 * q_0_5;
+            const double R_47 = 1 - (R_45 * Q_1_45 + R_43 * Q_2_43 + R_41 * C_41_6 + R_39 * Q_3_39
+                    + R_37 * C_37_10 + R_35 * C_35_12 + R_33 * C_33_14 + R_15 * Q_5_15
+                    + R_13 * C_13_34 + R_11 * C_11_36 + R_9 * C_9_38 + R_7 * C_7_40
+                    + R_5 * C_5_42 + R_3 * C_3_44 + C_1_46);
+            const double Q_6_47 = Q_6_15 * q_5_6;
+            const double C_45_66 = Q_1_45 * Q_6_45;
+            const double C_43_68 = Q_2_43 * Q_6_43;
+            const double C_41_70 = C_41_6 * Q_6_41;
+            const double C_39_72 = Q_3_39 * Q_6_39;
+            const double C_37_74 = C_37_10 * Q_6_37;
+            const double C_35_76 = C_35_12 * Q_6_35;
+            const double C_33_78 = C_33_14 * Q_6_33;
+            const double C_15_96 = Q_5_15 * Q_6_15;
+            const double C_13_98 = C_13_34 * Q_6_13;
+            const double C_11_100 = C_11_36 * Q_6_11;
+            const double C_9_102 = C_9_38 * Q_6_9;
+            const double C_7_104 = C_7_40 * Q_6_7;
+            const double C_5_106 = C_5_42 * Q_6_5;
+            const double C_3_108 = C_3_44 * Q_6_3;
+            const double C_1_110 = C_1_46 * q_0_6;
+            const double R_111 = 1 - (R_109 * Q_1_109 + R_107 * Q_2_107 + R_105 * C_105_6 + R_103 * Q_3_103
+                    + R_101 * C_101_10 + R_99 * C_99_12 + R_97 * C_97_14 + R_79 * Q_5_79
+                    + R_77 * C_77_34 + R_75 * C_75_36 + R_73 * C_73_38 + R_71 * C_71_40
+                    + R_69 * C_69_42 + R_67 * C_67_44 + R_65 * C_65_46 + R_47 * Q_6_47
+                    + R_45 * C_45_66 + R_43 * C_43_68 + R_41 * C_41_70 + R_39 * C_39_72
+                    + R_37 * C_37_74 + R_35 * C_35_76 + R_33 * C_33_78 + R_15 * C_15_96
+                    + R_13 * C_13_98 + R_11 * C_11_100 + R_9 * C_9_102 + R_7 * C_7_104
+                    + R_5 * C_5_106 + R_3 * C_3_108 + C_1_110);
+            const double Q_4_15 = Q_4_7 * q_3_4;
+            const double Q_4_47 = Q_4_15 * q_4_5;
+            const double Q_4_111 = Q_4_47 * q_4_6;
+            const double C_109_18 = Q_1_109 * Q_4_109;
+            const double C_107_20 = Q_2_107 * Q_4_107;
+            const double C_105_22 = C_105_6 * Q_4_105;
+            const double C_103_24 = Q_3_103 * Q_4_103;
+            const double C_101_26 = C_101_10 * Q_4_101;
+            const double C_99_28 = C_99_12 * Q_4_99;
+            const double C_97_30 = C_97_14 * Q_4_97;
+            const double Q_1_93 = Q_1_29 * q_1_6;
+            const double Q_2_91 = Q_2_27 * q_2_6;
+            const double C_89_6 = Q_1_89 * Q_2_89;
+            const double Q_3_87 = Q_3_23 * q_3_6;
+            const double C_85_10 = Q_1_85 * Q_3_85;
+            const double C_83_12 = Q_2_83 * Q_3_83;
+            const double C_81_14 = C_81_6 * Q_3_81;
+            const double Q_4_79 = Q_4_15 * q_4_6;
+            const double C_77_18 = Q_1_77 * Q_4_77;
+            const double C_75_20 = Q_2_75 * Q_4_75;
+            const double C_73_22 = C_73_6 * Q_4_73;
+            const double C_71_24 = Q_3_71 * Q_4_71;
+            const double C_69_26 = C_69_10 * Q_4_69;
+            const double C_67_28 = C_67_12 * Q_4_67;
+            const double C_65_30 = C_65_14 * Q_4_65;
+            const double C_25_6 = Q_1_25 * Q_2_25;
+            const double C_21_10 = Q_1_21 * Q_3_21;
+            const double C_19_12 = Q_2_19 * Q_3_19;
+            const double C_17_14 = C_17_6 * Q_3_17;
+            const double C_13_18 = Q_1_13 * Q_4_13;
+            const double C_11_20 = Q_2_11 * Q_4_11;
+            const double C_9_22 = C_9_6 * Q_4_9;
+            const double C_7_24 = Q_3_7 * Q_4_7;
+            const double C_5_26 = C_5_10 * Q_4_5;
+            const double C_3_28 = C_3_12 * Q_4_3;
+            const double C_1_30 = C_1_14 * q_0_4;
+            const double R_31 = 1 - (R_29 * Q_1_29 + R_27 * Q_2_27 + R_25 * C_25_6 + R_23 * Q_3_23
+                    + R_21 * C_21_10 + R_19 * C_19_12 + R_17 * C_17_14 + R_15 * Q_4_15
+                    + R_13 * C_13_18 + R_11 * C_11_20 + R_9 * C_9_22 + R_7 * C_7_24
+                    + R_5 * C_5_26 + R_3 * C_3_28 + C_1_30);
+            const double Q_6_31 = Q_6_15 * q_4_6;
+            const double C_29_66 = Q_1_29 * Q_6_29;
+            const double C_27_68 = Q_2_27 * Q_6_27;
+            const double C_25_70 = C_25_6 * Q_6_25;
+            const double C_23_72 = Q_3_23 * Q_6_23;
+            const double C_21_74 = C_21_10 * Q_6_21;
+            const double C_19_76 = C_19_12 * Q_6_19;
+            const double C_17_78 = C_17_14 * Q_6_17;
+            const double C_15_80 = Q_4_15 * Q_6_15;
+            const double C_13_82 = C_13_18 * Q_6_13;
+            const double C_11_84 = C_11_20 * Q_6_11;
+            const double C_9_86 = C_9_22 * Q_6_9;
+            const double C_7_88 = C_7_24 * Q_6_7;
+            const double C_5_90 = C_5_26 * Q_6_5;
+            const double C_3_92 = C_3_28 * Q_6_3;
+            const double C_1_94 = C_1_30 * q_0_6;
+            const double R_95 = 1 - (R_93 * Q_1_93 + R_91 * Q_2_91 + R_89 * C_89_6 + R_87 * Q_3_87
+                    + R_85 * C_85_10 + R_83 * C_83_12 + R_81 * C_81_14 + R_79 * Q_4_79
+                    + R_77 * C_77_18 + R_75 * C_75_20 + R_73 * C_73_22 + R_71 * C_71_24
+                    + R_69 * C_69_26 + R_67 * C_67_28 + R_65 * C_65_30 + R_31 * Q_6_31
+                    + R_29 * C_29_66 + R_27 * C_27_68 + R_25 * C_25_70 + R_23 * C_23_72
+                    + R_21 * C_21_74 + R_19 * C_19_76 + R_17 * C_17_78 + R_15 * C_15_80
+                    + R_13 * C_13_82 + R_11 * C_11_84 + R_9 * C_9_86 + R_7 * C_7_88
+                    + R_5 * C_5_90 + R_3 * C_3_92 + C_1_94);
+            const double Q_5_31 = Q_5_15 * q_4_5;
+            const double Q_5_95 = Q_5_31 * q_5_6;
+            const double C_93_34 = Q_1_93 * Q_5_93;
+            const double C_91_36 = Q_2_91 * Q_5_91;
+            const double C_89_38 = C_89_6 * Q_5_89;
+            const double C_87_40 = Q_3_87 * Q_5_87;
+            const double C_85_42 = C_85_10 * Q_5_85;
+            const double C_83_44 = C_83_12 * Q_5_83;
+            const double C_81_46 = C_81_14 * Q_5_81;
+            const double C_79_48 = Q_4_79 * Q_5_79;
+            const double C_77_50 = C_77_18 * Q_5_77;
+            const double C_75_52 = C_75_20 * Q_5_75;
+            const double C_73_54 = C_73_22 * Q_5_73;
+            const double C_71_56 = C_71_24 * Q_5_71;
+            const double C_69_58 = C_69_26 * Q_5_69;
+            const double C_67_60 = C_67_28 * Q_5_67;
+            const double C_65_62 = C_65_30 * Q_5_65;
+            const double C_57_6 = Q_1_57 * Q_2_57;
+            const double C_53_10 = Q_1_53 * Q_3_53;
+            const double C_51_12 = Q_2_51 * Q_3_51;
+            const double C_49_14 = C_49_6 * Q_3_49;
+            const double C_45_18 = Q_1_45 * Q_4_45;
+            const double C_43_20 = Q_2_43 * Q_4_43;
+            const double C_41_22 = C_41_6 * Q_4_41;
+            const double C_39_24 = Q_3_39 * Q_4_39;
+            const double C_37_26 = C_37_10 * Q_4_37;
+            const double C_35_28 = C_35_12 * Q_4_35;
+            const double C_33_30 = C_33_14 * Q_4_33;
+            const double C_29_34 = Q_1_29 * Q_5_29;
+            const double C_27_36 = Q_2_27 * Q_5_27;
+            const double C_25_38 = C_25_6 * Q_5_25;
+            const double C_23_40 = Q_3_23 * Q_5_23;
+            const double C_21_42 = C_21_10 * Q_5_21;
+            const double C_19_44 = C_19_12 * Q_5_19;
+            const double C_17_46 = C_17_14 * Q_5_17;
+            const double C_15_48 = Q_4_15 * Q_5_15;
+            const double C_13_50 = C_13_18 * Q_5_13;
+            const double C_11_52 = C_11_20 * Q_5_11;
+            const double C_9_54 = C_9_22 * Q_5_9;
+            const double C_7_56 = C_7_24 * Q_5_7;
+            const double C_5_58 = C_5_26 * Q_5_5;
+            const double C_3_60 = C_3_28 * Q_5_3;
+            const double C_1_62 = C_1_30 * q_0_5;
+            const double R_63 = 1 - (R_61 * Q_1_61 + R_59 * Q_2_59 + R_57 * C_57_6 + R_55 * Q_3_55
+                    + R_53 * C_53_10 + R_51 * C_51_12 + R_49 * C_49_14 + R_47 * Q_4_47
+                    + R_45 * C_45_18 + R_43 * C_43_20 + R_41 * C_41_22 + R_39 * C_39_24
+                    + R_37 * C_37_26 + R_35 * C_35_28 + R_33 * C_33_30 + R_31 * Q_5_31
+                    + R_29 * C_29_34 + R_27 * C_27_36 + R_25 * C_25_38 + R_23 * C_23_40
+                    + R_21 * C_21_42 + R_19 * C_19_44 + R_17 * C_17_46 + R_15 * C_15_48
+                    + R_13 * C_13_50 + R_11 * C_11_52 + R_9 * C_9_54 + R_7 * C_7_56
+                    + R_5 * C_5_58 + R_3 * C_3_60 + C_1_62);
+            const double Q_6_63 = Q_6_31 * q_5_6;
+            const double C_61_66 = Q_1_61 * Q_6_61;
+            const double C_59_68 = Q_2_59 * Q_6_59;
+            const double C_57_70 = C_57_6 * Q_6_57;
+            const double C_55_72 = Q_3_55 * Q_6_55;
+            const double C_53_74 = C_53_10 * Q_6_53;
+            const double C_51_76 = C_51_12 * Q_6_51;
+            const double C_49_78 = C_49_14 * Q_6_49;
+            const double C_47_80 = Q_4_47 * Q_6_47;
+            const double C_45_82 = C_45_18 * Q_6_45;
+            const double C_43_84 = C_43_20 * Q_6_43;
+            const double C_41_86 = C_41_22 * Q_6_41;
+            const double C_39_88 = C_39_24 * Q_6_39;
+            const double C_37_90 = C_37_26 * Q_6_37;
+            const double C_35_92 = C_35_28 * Q_6_35;
+            const double C_33_94 = C_33_30 * Q_6_33;
+            const double C_31_96 = Q_5_31 * Q_6_31;
+            const double C_29_98 = C_29_34 * Q_6_29;
+            const double C_27_100 = C_27_36 * Q_6_27;
+            const double C_25_102 = C_25_38 * Q_6_25;
+            const double C_23_104 = C_23_40 * Q_6_23;
+            const double C_21_106 = C_21_42 * Q_6_21;
+            const double C_19_108 = C_19_44 * Q_6_19;
+            const double C_17_110 = C_17_46 * Q_6_17;
+            const double C_15_112 = C_15_48 * Q_6_15;
+            const double C_13_114 = C_13_50 * Q_6_13;
+            const double C_11_116 = C_11_52 * Q_6_11;
+            const double C_9_118 = C_9_54 * Q_6_9;
+            const double C_7_120 = C_7_56 * Q_6_7;
+            const double C_5_122 = C_5_58 * Q_6_5;
+            const double C_3_124 = C_3_60 * Q_6_3;
+            const double C_1_126 = C_1_62 * q_0_6;
+            const double R_127 = 1 - (R_125 * Q_1_125 + R_123 * Q_2_123 + R_121 * C_121_6 + R_119 * Q_3_119
+                    + R_117 * C_117_10 + R_115 * C_115_12 + R_113 * C_113_14 + R_111 * Q_4_111
+                    + R_109 * C_109_18 + R_107 * C_107_20 + R_105 * C_105_22 + R_103 * C_103_24
+                    + R_101 * C_101_26 + R_99 * C_99_28 + R_97 * C_97_30 + R_95 * Q_5_95
+                    + R_93 * C_93_34 + R_91 * C_91_36 + R_89 * C_89_38 + R_87 * C_87_40
+                    + R_85 * C_85_42 + R_83 * C_83_44 + R_81 * C_81_46 + R_79 * C_79_48
+                    + R_77 * C_77_50 + R_75 * C_75_52 + R_73 * C_73_54 + R_71 * C_71_56
+                    + R_69 * C_69_58 + R_67 * C_67_60 + R_65 * C_65_62 + R_63 * Q_6_63
+                    + R_61 * C_61_66 + R_59 * C_59_68 + R_57 * C_57_70 + R_55 * C_55_72
+                    + R_53 * C_53_74 + R_51 * C_51_76 + R_49 * C_49_78 + R_47 * C_47_80
+                    + R_45 * C_45_82 + R_43 * C_43_84 + R_41 * C_41_86 + R_39 * C_39_88
+                    + R_37 * C_37_90 + R_35 * C_35_92 + R_33 * C_33_94 + R_31 * C_31_96
+                    + R_29 * C_29_98 + R_27 * C_27_100 + R_25 * C_25_102 + R_23 * C_23_104
+                    + R_21 * C_21_106 + R_19 * C_19_108 + R_17 * C_17_110 + R_15 * C_15_112
+                    + R_13 * C_13_114 + R_11 * C_11_116 + R_9 * C_9_118 + R_7 * C_7_120
+                    + R_5 * C_5_122 + R_3 * C_3_124 + C_1_126);
+            double d_R_127 = 1.;
+            double d_R_125 = -d_R_127 * Q_1_125;
+            double d_Q_1_125 = -d_R_127 * R_125;
+            double d_R_123 = -d_R_127 * Q_2_123;
+            double d_Q_2_123 = -d_R_127 * R_123;
+            double d_R_121 = -d_R_127 * C_121_6;
+            double d_C_121_6 = -d_R_127 * R_121;
+            double d_R_119 = -d_R_127 * Q_3_119;
+            double d_Q_3_119 = -d_R_127 * R_119;
+            double d_R_117 = -d_R_127 * C_117_10;
+            double d_C_117_10 = -d_R_127 * R_117;
+            double d_R_115 = -d_R_127 * C_115_12;
+            double d_C_115_12 = -d_R_127 * R_115;
+            double d_R_113 = -d_R_127 * C_113_14;
+            double d_C_113_14 = -d_R_127 * R_113;
+            double d_R_111 = -d_R_127 * Q_4_111;
+            double d_Q_4_111 = -d_R_127 * R_111;
+            double d_R_109 = -d_R_127 * C_109_18;
+            double d_C_109_18 = -d_R_127 * R_109;
+            double d_R_107 = -d_R_127 * C_107_20;
+            double d_C_107_20 = -d_R_127 * R_107;
+            double d_R_105 = -d_R_127 * C_105_22;
+            double d_C_105_22 = -d_R_127 * R_105;
+            double d_R_103 = -d_R_127 * C_103_24;
+            double d_C_103_24 = -d_R_127 * R_103;
+            double d_R_101 = -d_R_127 * C_101_26;
+            double d_C_101_26 = -d_R_127 * R_101;
+            double d_R_99 = -d_R_127 * C_99_28;
+            double d_C_99_28 = -d_R_127 * R_99;
+            double d_R_97 = -d_R_127 * C_97_30;
+            double d_C_97_30 = -d_R_127 * R_97;
+            double d_R_95 = -d_R_127 * Q_5_95;
+            double d_Q_5_95 = -d_R_127 * R_95;
+            double d_R_93 = -d_R_127 * C_93_34;
+            double d_C_93_34 = -d_R_127 * R_93;
+            double d_R_91 = -d_R_127 * C_91_36;
+            double d_C_91_36 = -d_R_127 * R_91;
+            double d_R_89 = -d_R_127 * C_89_38;
+            double d_C_89_38 = -d_R_127 * R_89;
+            double d_R_87 = -d_R_127 * C_87_40;
+            double d_C_87_40 = -d_R_127 * R_87;
+            double d_R_85 = -d_R_127 * C_85_42;
+            double d_C_85_42 = -d_R_127 * R_85;
+            double d_R_83 = -d_R_127 * C_83_44;
+            double d_C_83_44 = -d_R_127 * R_83;
+            double d_R_81 = -d_R_127 * C_81_46;
+            double d_C_81_46 = -d_R_127 * R_81;
+            double d_R_79 = -d_R_127 * C_79_48;
+            double d_C_79_48 = -d_R_127 * R_79;
+            double d_R_77 = -d_R_127 * C_77_50;
+            double d_C_77_50 = -d_R_127 * R_77;
+            double d_R_75 = -d_R_127 * C_75_52;
+            double d_C_75_52 = -d_R_127 * R_75;
+            double d_R_73 = -d_R_127 * C_73_54;
+            double d_C_73_54 = -d_R_127 * R_73;
+            double d_R_71 = -d_R_127 * C_71_56;
+            double d_C_71_56 = -d_R_127 * R_71;
+            double d_R_69 = -d_R_127 * C_69_58;
+            double d_C_69_58 = -d_R_127 * R_69;
+            double d_R_67 = -d_R_127 * C_67_60;
+            double d_C_67_60 = -d_R_127 * R_67;
+            double d_R_65 = -d_R_127 * C_65_62;
+            double d_C_65_62 = -d_R_127 * R_65;
+            double d_R_63 = -d_R_127 * Q_6_63;
+            double d_Q_6_63 = -d_R_127 * R_63;
+            double d_R_61 = -d_R_127 * C_61_66;
+            double d_C_61_66 = -d_R_127 * R_61;
+            double d_R_59 = -d_R_127 * C_59_68;
+            double d_C_59_68 = -d_R_127 * R_59;
+            double d_R_57 = -d_R_127 * C_57_70;
+            double d_C_57_70 = -d_R_127 * R_57;
+            double d_R_55 = -d_R_127 * C_55_72;
+            double d_C_55_72 = -d_R_127 * R_55;
+            double d_R_53 = -d_R_127 * C_53_74;
+            double d_C_53_74 = -d_R_127 * R_53;
+            double d_R_51 = -d_R_127 * C_51_76;
+            double d_C_51_76 = -d_R_127 * R_51;
+            double d_R_49 = -d_R_127 * C_49_78;
+            double d_C_49_78 = -d_R_127 * R_49;
+            double d_R_47 = -d_R_127 * C_47_80;
+            double d_C_47_80 = -d_R_127 * R_47;
+            double d_R_45 = -d_R_127 * C_45_82;
+            double d_C_45_82 = -d_R_127 * R_45;
+            double d_R_43 = -d_R_127 * C_43_84;
+            double d_C_43_84 = -d_R_127 * R_43;
+            double d_R_41 = -d_R_127 * C_41_86;
+            double d_C_41_86 = -d_R_127 * R_41;
+            double d_R_39 = -d_R_127 * C_39_88;
+            double d_C_39_88 = -d_R_127 * R_39;
+            double d_R_37 = -d_R_127 * C_37_90;
+            double d_C_37_90 = -d_R_127 * R_37;
+            double d_R_35 = -d_R_127 * C_35_92;
+            double d_C_35_92 = -d_R_127 * R_35;
+            double d_R_33 = -d_R_127 * C_33_94;
+            double d_C_33_94 = -d_R_127 * R_33;
+            double d_R_31 = -d_R_127 * C_31_96;
+            double d_C_31_96 = -d_R_127 * R_31;
+            double d_R_29 = -d_R_127 * C_29_98;
+            double d_C_29_98 = -d_R_127 * R_29;
+            double d_R_27 = -d_R_127 * C_27_100;
+            double d_C_27_100 = -d_R_127 * R_27;
+            double d_R_25 = -d_R_127 * C_25_102;
+            double d_C_25_102 = -d_R_127 * R_25;
+            double d_R_23 = -d_R_127 * C_23_104;
+            double d_C_23_104 = -d_R_127 * R_23;
+            double d_R_21 = -d_R_127 * C_21_106;
+            double d_C_21_106 = -d_R_127 * R_21;
+            double d_R_19 = -d_R_127 * C_19_108;
+            double d_C_19_108 = -d_R_127 * R_19;
+            double d_R_17 = -d_R_127 * C_17_110;
+            double d_C_17_110 = -d_R_127 * R_17;
+            double d_R_15 = -d_R_127 * C_15_112;
+            double d_C_15_112 = -d_R_127 * R_15;
+            double d_R_13 = -d_R_127 * C_13_114;
+            double d_C_13_114 = -d_R_127 * R_13;
+            double d_R_11 = -d_R_127 * C_11_116;
+            double d_C_11_116 = -d_R_127 * R_11;
+            double d_R_9 = -d_R_127 * C_9_118;
+            double d_C_9_118 = -d_R_127 * R_9;
+            double d_R_7 = -d_R_127 * C_7_120;
+            double d_C_7_120 = -d_R_127 * R_7;
+            double d_R_5 = -d_R_127 * C_5_122;
+            double d_C_5_122 = -d_R_127 * R_5;
+            double d_R_3 = -d_R_127 * C_3_124;
+            double d_C_3_124 = -d_R_127 * R_3;
+            double d_C_1_126 = -d_R_127;
+            double d_C_1_62 = d_C_1_126 * q_0_6;
+            double d_q_0_6 = d_C_1_126 * C_1_62;
+            double d_C_3_60 = d_C_3_124 * Q_6_3;
+            double d_Q_6_3 = d_C_3_124 * C_3_60;
+            double d_C_5_58 = d_C_5_122 * Q_6_5;
+            double d_Q_6_5 = d_C_5_122 * C_5_58;
+            double d_C_7_56 = d_C_7_120 * Q_6_7;
+            double d_Q_6_7 = d_C_7_120 * C_7_56;
+            double d_C_9_54 = d_C_9_118 * Q_6_9;
+            double d_Q_6_9 = d_C_9_118 * C_9_54;
+            double d_C_11_52 = d_C_11_116 * Q_6_11;
+            double d_Q_6_11 = d_C_11_116 * C_11_52;
+            double d_C_13_50 = d_C_13_114 * Q_6_13;
+            double d_Q_6_13 = d_C_13_114 * C_13_50;
+            double d_C_15_48 = d_C_15_112 * Q_6_15;
+            double d_Q_6_15 = d_C_15_112 * C_15_48;
+            double d_C_17_46 = d_C_17_110 * Q_6_17;
+            double d_Q_6_17 = d_C_17_110 * C_17_46;
+            double d_C_19_44 = d_C_19_108 * Q_6_19;
+            double d_Q_6_19 = d_C_19_108 * C_19_44;
+            double d_C_21_42 = d_C_21_106 * Q_6_21;
+            double d_Q_6_21 = d_C_21_106 * C_21_42;
+            double d_C_23_40 = d_C_23_104 * Q_6_23;
+            double d_Q_6_23 = d_C_23_104 * C_23_40;
+            double d_C_25_38 = d_C_25_102 * Q_6_25;
+            double d_Q_6_25 = d_C_25_102 * C_25_38;
+            double d_C_27_36 = d_C_27_100 * Q_6_27;
+            double d_Q_6_27 = d_C_27_100 * C_27_36;
+            double d_C_29_34 = d_C_29_98 * Q_6_29;
+            double d_Q_6_29 = d_C_29_98 * C_29_34;
+            double d_Q_5_31 = d_C_31_96 * Q_6_31;
+            double d_Q_6_31 = d_C_31_96 * Q_5_31;
+            double d_C_33_30 = d_C_33_94 * Q_6_33;
+            double d_Q_6_33 = d_C_33_94 * C_33_30;
+            double d_C_35_28 = d_C_35_92 * Q_6_35;
+            double d_Q_6_35 = d_C_35_92 * C_35_28;
+            double d_C_37_26 = d_C_37_90 * Q_6_37;
+            double d_Q_6_37 = d_C_37_90 * C_37_26;
+            double d_C_39_24 = d_C_39_88 * Q_6_39;
+            double d_Q_6_39 = d_C_39_88 * C_39_24;
+            double d_C_41_22 = d_C_41_86 * Q_6_41;
+            double d_Q_6_41 = d_C_41_86 * C_41_22;
+            double d_C_43_20 = d_C_43_84 * Q_6_43;
+            double d_Q_6_43 = d_C_43_84 * C_43_20;
+            double d_C_45_18 = d_C_45_82 * Q_6_45;
+            double d_Q_6_45 = d_C_45_82 * C_45_18;
+            double d_Q_4_47 = d_C_47_80 * Q_6_47;
+            double d_Q_6_47 = d_C_47_80 * Q_4_47;
+            double d_C_49_14 = d_C_49_78 * Q_6_49;
+            double d_Q_6_49 = d_C_49_78 * C_49_14;
+            double d_C_51_12 = d_C_51_76 * Q_6_51;
+            double d_Q_6_51 = d_C_51_76 * C_51_12;
+            double d_C_53_10 = d_C_53_74 * Q_6_53;
+            double d_Q_6_53 = d_C_53_74 * C_53_10;
+            double d_Q_3_55 = d_C_55_72 * Q_6_55;
+            double d_Q_6_55 = d_C_55_72 * Q_3_55;
+            double d_C_57_6 = d_C_57_70 * Q_6_57;
+            double d_Q_6_57 = d_C_57_70 * C_57_6;
+            double d_Q_2_59 = d_C_59_68 * Q_6_59;
+            double d_Q_6_59 = d_C_59_68 * Q_2_59;
+            double d_Q_1_61 = d_C_61_66 * Q_6_61;
+            double d_Q_6_61 = d_C_61_66 * Q_1_61;
+            d_Q_6_31 += d_Q_6_63 * q_5_6;
+            double d_q_5_6 = d_Q_6_63 * Q_6_31;
+            d_R_61 += -d_R_63 * Q_1_61;
+            d_Q_1_61 += -d_R_63 * R_61;
+            d_R_59 += -d_R_63 * Q_2_59;
+            d_Q_2_59 += -d_R_63 * R_59;
+            d_R_57 += -d_R_63 * C_57_6;
+            d_C_57_6 += -d_R_63 * R_57;
+            d_R_55 += -d_R_63 * Q_3_55;
+            d_Q_3_55 += -d_R_63 * R_55;
+            d_R_53 += -d_R_63 * C_53_10;
+            d_C_53_10 += -d_R_63 * R_53;
+            d_R_51 += -d_R_63 * C_51_12;
+            d_C_51_12 += -d_R_63 * R_51;
+            d_R_49 += -d_R_63 * C_49_14;
+            d_C_49_14 += -d_R_63 * R_49;
+            d_R_47 += -d_R_63 * Q_4_47;
+            d_Q_4_47 += -d_R_63 * R_47;
+            d_R_45 += -d_R_63 * C_45_18;
+            d_C_45_18 += -d_R_63 * R_45;
+            d_R_43 += -d_R_63 * C_43_20;
+            d_C_43_20 += -d_R_63 * R_43;
+            d_R_41 += -d_R_63 * C_41_22;
+            d_C_41_22 += -d_R_63 * R_41;
+            d_R_39 += -d_R_63 * C_39_24;
+            d_C_39_24 += -d_R_63 * R_39;
+            d_R_37 += -d_R_63 * C_37_26;
+            d_C_37_26 += -d_R_63 * R_37;
+            d_R_35 += -d_R_63 * C_35_28;
+            d_C_35_28 += -d_R_63 * R_35;
+            d_R_33 += -d_R_63 * C_33_30;
+            d_C_33_30 += -d_R_63 * R_33;
+            d_R_31 += -d_R_63 * Q_5_31;
+            d_Q_5_31 += -d_R_63 * R_31;
+            d_R_29 += -d_R_63 * C_29_34;
+            d_C_29_34 += -d_R_63 * R_29;
+            d_R_27 += -d_R_63 * C_27_36;
+            d_C_27_36 += -d_R_63 * R_27;
+            d_R_25 += -d_R_63 * C_25_38;
+            d_C_25_38 += -d_R_63 * R_25;
+            d_R_23 += -d_R_63 * C_23_40;
+            d_C_23_40 += -d_R_63 * R_23;
+            d_R_21 += -d_R_63 * C_21_42;
+            d_C_21_42 += -d_R_63 * R_21;
+            d_R_19 += -d_R_63 * C_19_44;
+            d_C_19_44 += -d_R_63 * R_19;
+            d_R_17 += -d_R_63 * C_17_46;
+            d_C_17_46 += -d_R_63 * R_17;
+            d_R_15 += -d_R_63 * C_15_48;
+            d_C_15_48 += -d_R_63 * R_15;
+            d_R_13 += -d_R_63 * C_13_50;
+            d_C_13_50 += -d_R_63 * R_13;
+            d_R_11 += -d_R_63 * C_11_52;
+            d_C_11_52 += -d_R_63 * R_11;
+            d_R_9 += -d_R_63 * C_9_54;
+            d_C_9_54 += -d_R_63 * R_9;
+            d_R_7 += -d_R_63 * C_7_56;
+            d_C_7_56 += -d_R_63 * R_7;
+            d_R_5 += -d_R_63 * C_5_58;
+            d_C_5_58 += -d_R_63 * R_5;
+            d_R_3 += -d_R_63 * C_3_60;
+            d_C_3_60 += -d_R_63 * R_3;
+            d_C_1_62 += -d_R_63;
+            double d_C_1_30 = d_C_1_62 * q_0_5;
+            double d_q_0_5 = d_C_1_62 * C_1_30;
+            double d_C_3_28 = d_C_3_60 * Q_5_3;
+            double d_Q_5_3 = d_C_3_60 * C_3_28;
+            double d_C_5_26 = d_C_5_58 * Q_5_5;
+            double d_Q_5_5 = d_C_5_58 * C_5_26;
+            double d_C_7_24 = d_C_7_56 * Q_5_7;
+            double d_Q_5_7 = d_C_7_56 * C_7_24;
+            double d_C_9_22 = d_C_9_54 * Q_5_9;
+            double d_Q_5_9 = d_C_9_54 * C_9_22;
+            double d_C_11_20 = d_C_11_52 * Q_5_11;
+            double d_Q_5_11 = d_C_11_52 * C_11_20;
+            double d_C_13_18 = d_C_13_50 * Q_5_13;
+            double d_Q_5_13 = d_C_13_50 * C_13_18;
+            double d_Q_4_15 = d_C_15_48 * Q_5_15;
+            double d_Q_5_15 = d_C_15_48 * Q_4_15;
+            double d_C_17_14 = d_C_17_46 * Q_5_17;
+            double d_Q_5_17 = d_C_17_46 * C_17_14;
+            double d_C_19_12 = d_C_19_44 * Q_5_19;
+            double d_Q_5_19 = d_C_19_44 * C_19_12;
+            double d_C_21_10 = d_C_21_42 * Q_5_21;
+            double d_Q_5_21 = d_C_21_42 * C_21_10;
+            double d_Q_3_23 = d_C_23_40 * Q_5_23;
+            double d_Q_5_23 = d_C_23_40 * Q_3_23;
+            double d_C_25_6 = d_C_25_38 * Q_5_25;
+            double d_Q_5_25 = d_C_25_38 * C_25_6;
+            double d_Q_2_27 = d_C_27_36 * Q_5_27;
+            double d_Q_5_27 = d_C_27_36 * Q_2_27;
+            double d_Q_1_29 = d_C_29_34 * Q_5_29;
+            double d_Q_5_29 = d_C_29_34 * Q_1_29;
+            double d_C_33_14 = d_C_33_30 * Q_4_33;
+            double d_Q_4_33 = d_C_33_30 * C_33_14;
+            double d_C_35_12 = d_C_35_28 * Q_4_35;
+            double d_Q_4_35 = d_C_35_28 * C_35_12;
+            double d_C_37_10 = d_C_37_26 * Q_4_37;
+            double d_Q_4_37 = d_C_37_26 * C_37_10;
+            double d_Q_3_39 = d_C_39_24 * Q_4_39;
+            double d_Q_4_39 = d_C_39_24 * Q_3_39;
+            double d_C_41_6 = d_C_41_22 * Q_4_41;
+            double d_Q_4_41 = d_C_41_22 * C_41_6;
+            double d_Q_2_43 = d_C_43_20 * Q_4_43;
+            double d_Q_4_43 = d_C_43_20 * Q_2_43;
+            double d_Q_1_45 = d_C_45_18 * Q_4_45;
+            double d_Q_4_45 = d_C_45_18 * Q_1_45;
+            double d_C_49_6 = d_C_49_14 * Q_3_49;
+            double d_Q_3_49 = d_C_49_14 * C_49_6;
+            double d_Q_2_51 = d_C_51_12 * Q_3_51;
+            double d_Q_3_51 = d_C_51_12 * Q_2_51;
+            double d_Q_1_53 = d_C_53_10 * Q_3_53;
+            double d_Q_3_53 = d_C_53_10 * Q_1_53;
+            double d_Q_1_57 = d_C_57_6 * Q_2_57;
+            double d_Q_2_57 = d_C_57_6 * Q_1_57;
+            double d_C_65_30 = d_C_65_62 * Q_5_65;
+            double d_Q_5_65 = d_C_65_62 * C_65_30;
+            double d_C_67_28 = d_C_67_60 * Q_5_67;
+            double d_Q_5_67 = d_C_67_60 * C_67_28;
+            double d_C_69_26 = d_C_69_58 * Q_5_69;
+            double d_Q_5_69 = d_C_69_58 * C_69_26;
+            double d_C_71_24 = d_C_71_56 * Q_5_71;
+            double d_Q_5_71 = d_C_71_56 * C_71_24;
+            double d_C_73_22 = d_C_73_54 * Q_5_73;
+            double d_Q_5_73 = d_C_73_54 * C_73_22;
+            double d_C_75_20 = d_C_75_52 * Q_5_75;
+            double d_Q_5_75 = d_C_75_52 * C_75_20;
+            double d_C_77_18 = d_C_77_50 * Q_5_77;
+            double d_Q_5_77 = d_C_77_50 * C_77_18;
+            double d_Q_4_79 = d_C_79_48 * Q_5_79;
+            double d_Q_5_79 = d_C_79_48 * Q_4_79;
+            double d_C_81_14 = d_C_81_46 * Q_5_81;
+            double d_Q_5_81 = d_C_81_46 * C_81_14;
+            double d_C_83_12 = d_C_83_44 * Q_5_83;
+            double d_Q_5_83 = d_C_83_44 * C_83_12;
+            double d_C_85_10 = d_C_85_42 * Q_5_85;
+            double d_Q_5_85 = d_C_85_42 * C_85_10;
+            double d_Q_3_87 = d_C_87_40 * Q_5_87;
+            double d_Q_5_87 = d_C_87_40 * Q_3_87;
+            double d_C_89_6 = d_C_89_38 * Q_5_89;
+            double d_Q_5_89 = d_C_89_38 * C_89_6;
+            double d_Q_2_91 = d_C_91_36 * Q_5_91;
+            double d_Q_5_91 = d_C_91_36 * Q_2_91;
+            double d_Q_1_93 = d_C_93_34 * Q_5_93;
+            double d_Q_5_93 = d_C_93_34 * Q_1_93;
+            d_Q_5_31 += d_Q_5_95 * q_5_6;
+            d_q_5_6 += d_Q_5_95 * Q_5_31;
+            d_Q_5_15 += d_Q_5_31 * q_4_5;
+            double d_q_4_5 = d_Q_5_31 * Q_5_15;
+            d_R_93 += -d_R_95 * Q_1_93;
+            d_Q_1_93 += -d_R_95 * R_93;
+            d_R_91 += -d_R_95 * Q_2_91;
+            d_Q_2_91 += -d_R_95 * R_91;
+            d_R_89 += -d_R_95 * C_89_6;
+            d_C_89_6 += -d_R_95 * R_89;
+            d_R_87 += -d_R_95 * Q_3_87;
+            d_Q_3_87 += -d_R_95 * R_87;
+            d_R_85 += -d_R_95 * C_85_10;
+            d_C_85_10 += -d_R_95 * R_85;
+            d_R_83 += -d_R_95 * C_83_12;
+            d_C_83_12 += -d_R_95 * R_83;
+            d_R_81 += -d_R_95 * C_81_14;
+            d_C_81_14 += -d_R_95 * R_81;
+            d_R_79 += -d_R_95 * Q_4_79;
+            d_Q_4_79 += -d_R_95 * R_79;
+            d_R_77 += -d_R_95 * C_77_18;
+            d_C_77_18 += -d_R_95 * R_77;
+            d_R_75 += -d_R_95 * C_75_20;
+            d_C_75_20 += -d_R_95 * R_75;
+            d_R_73 += -d_R_95 * C_73_22;
+            d_C_73_22 += -d_R_95 * R_73;
+            d_R_71 += -d_R_95 * C_71_24;
+            d_C_71_24 += -d_R_95 * R_71;
+            d_R_69 += -d_R_95 * C_69_26;
+            d_C_69_26 += -d_R_95 * R_69;
+            d_R_67 += -d_R_95 * C_67_28;
+            d_C_67_28 += -d_R_95 * R_67;
+            d_R_65 += -d_R_95 * C_65_30;
+            d_C_65_30 += -d_R_95 * R_65;
+            d_R_31 += -d_R_95 * Q_6_31;
+            d_Q_6_31 += -d_R_95 * R_31;
+            d_R_29 += -d_R_95 * C_29_66;
+            double d_C_29_66 = -d_R_95 * R_29;
+            d_R_27 += -d_R_95 * C_27_68;
+            double d_C_27_68 = -d_R_95 * R_27;
+            d_R_25 += -d_R_95 * C_25_70;
+            double d_C_25_70 = -d_R_95 * R_25;
+            d_R_23 += -d_R_95 * C_23_72;
+            double d_C_23_72 = -d_R_95 * R_23;
+            d_R_21 += -d_R_95 * C_21_74;
+            double d_C_21_74 = -d_R_95 * R_21;
+            d_R_19 += -d_R_95 * C_19_76;
+            double d_C_19_76 = -d_R_95 * R_19;
+            d_R_17 += -d_R_95 * C_17_78;
+            double d_C_17_78 = -d_R_95 * R_17;
+            d_R_15 += -d_R_95 * C_15_80;
+            double d_C_15_80 = -d_R_95 * R_15;
+            d_R_13 += -d_R_95 * C_13_82;
+            double d_C_13_82 = -d_R_95 * R_13;
+            d_R_11 += -d_R_95 * C_11_84;
+            double d_C_11_84 = -d_R_95 * R_11;
+            d_R_9 += -d_R_95 * C_9_86;
+            double d_C_9_86 = -d_R_95 * R_9;
+            d_R_7 += -d_R_95 * C_7_88;
+            double d_C_7_88 = -d_R_95 * R_7;
+            d_R_5 += -d_R_95 * C_5_90;
+            double d_C_5_90 = -d_R_95 * R_5;
+            d_R_3 += -d_R_95 * C_3_92;
+            double d_C_3_92 = -d_R_95 * R_3;
+            double d_C_1_94 = -d_R_95;
+            d_C_1_30 += d_C_1_94 * q_0_6;
+            d_q_0_6 += d_C_1_94 * C_1_30;
+            d_C_3_28 += d_C_3_92 * Q_6_3;
+            d_Q_6_3 += d_C_3_92 * C_3_28;
+            d_C_5_26 += d_C_5_90 * Q_6_5;
+            d_Q_6_5 += d_C_5_90 * C_5_26;
+            d_C_7_24 += d_C_7_88 * Q_6_7;
+            d_Q_6_7 += d_C_7_88 * C_7_24;
+            d_C_9_22 += d_C_9_86 * Q_6_9;
+            d_Q_6_9 += d_C_9_86 * C_9_22;
+            d_C_11_20 += d_C_11_84 * Q_6_11;
+            d_Q_6_11 += d_C_11_84 * C_11_20;
+            d_C_13_18 += d_C_13_82 * Q_6_13;
+            d_Q_6_13 += d_C_13_82 * C_13_18;
+            d_Q_4_15 += d_C_15_80 * Q_6_15;
+            d_Q_6_15 += d_C_15_80 * Q_4_15;
+            d_C_17_14 += d_C_17_78 * Q_6_17;
+            d_Q_6_17 += d_C_17_78 * C_17_14;
+            d_C_19_12 += d_C_19_76 * Q_6_19;
+            d_Q_6_19 += d_C_19_76 * C_19_12;
+            d_C_21_10 += d_C_21_74 * Q_6_21;
+            d_Q_6_21 += d_C_21_74 * C_21_10;
+            d_Q_3_23 += d_C_23_72 * Q_6_23;
+            d_Q_6_23 += d_C_23_72 * Q_3_23;
+            d_C_25_6 += d_C_25_70 * Q_6_25;
+            d_Q_6_25 += d_C_25_70 * C_25_6;
+            d_Q_2_27 += d_C_27_68 * Q_6_27;
+            d_Q_6_27 += d_C_27_68 * Q_2_27;
+            d_Q_1_29 += d_C_29_66 * Q_6_29;
+            d_Q_6_29 += d_C_29_66 * Q_1_29;
+            d_Q_6_15 += d_Q_6_31 * q_4_6;
+            double d_q_4_6 = d_Q_6_31 * Q_6_15;
+            d_R_29 += -d_R_31 * Q_1_29;
+            d_Q_1_29 += -d_R_31 * R_29;
+            d_R_27 += -d_R_31 * Q_2_27;
+            d_Q_2_27 += -d_R_31 * R_27;
+            d_R_25 += -d_R_31 * C_25_6;
+            d_C_25_6 += -d_R_31 * R_25;
+            d_R_23 += -d_R_31 * Q_3_23;
+            d_Q_3_23 += -d_R_31 * R_23;
+            d_R_21 += -d_R_31 * C_21_10;
+            d_C_21_10 += -d_R_31 * R_21;
+            d_R_19 += -d_R_31 * C_19_12;
+            d_C_19_12 += -d_R_31 * R_19;
+            d_R_17 += -d_R_31 * C_17_14;
+            d_C_17_14 += -d_R_31 * R_17;
+            d_R_15 += -d_R_31 * Q_4_15;
+            d_Q_4_15 += -d_R_31 * R_15;
+            d_R_13 += -d_R_31 * C_13_18;
+            d_C_13_18 += -d_R_31 * R_13;
+            d_R_11 += -d_R_31 * C_11_20;
+            d_C_11_20 += -d_R_31 * R_11;
+            d_R_9 += -d_R_31 * C_9_22;
+            d_C_9_22 += -d_R_31 * R_9;
+            d_R_7 += -d_R_31 * C_7_24;
+            d_C_7_24 += -d_R_31 * R_7;
+            d_R_5 += -d_R_31 * C_5_26;
+            d_C_5_26 += -d_R_31 * R_5;
+            d_R_3 += -d_R_31 * C_3_28;
+            d_C_3_28 += -d_R_31 * R_3;
+            d_C_1_30 += -d_R_31;
+            double d_C_1_14 = d_C_1_30 * q_0_4;
+            double d_q_0_4 = d_C_1_30 * C_1_14;
+            double d_C_3_12 = d_C_3_28 * Q_4_3;
+            double d_Q_4_3 = d_C_3_28 * C_3_12;
+            double d_C_5_10 = d_C_5_26 * Q_4_5;
+            double d_Q_4_5 = d_C_5_26 * C_5_10;
+            double d_Q_3_7 = d_C_7_24 * Q_4_7;
+            double d_Q_4_7 = d_C_7_24 * Q_3_7;
+            double d_C_9_6 = d_C_9_22 * Q_4_9;
+            double d_Q_4_9 = d_C_9_22 * C_9_6;
+            double d_Q_2_11 = d_C_11_20 * Q_4_11;
+            double d_Q_4_11 = d_C_11_20 * Q_2_11;
+            double d_Q_1_13 = d_C_13_18 * Q_4_13;
+            double d_Q_4_13 = d_C_13_18 * Q_1_13;
+            double d_C_17_6 = d_C_17_14 * Q_3_17;
+            double d_Q_3_17 = d_C_17_14 * C_17_6;
+            double d_Q_2_19 = d_C_19_12 * Q_3_19;
+            double d_Q_3_19 = d_C_19_12 * Q_2_19;
+            double d_Q_1_21 = d_C_21_10 * Q_3_21;
+            double d_Q_3_21 = d_C_21_10 * Q_1_21;
+            double d_Q_1_25 = d_C_25_6 * Q_2_25;
+            double d_Q_2_25 = d_C_25_6 * Q_1_25;
+            double d_C_65_14 = d_C_65_30 * Q_4_65;
+            double d_Q_4_65 = d_C_65_30 * C_65_14;
+            double d_C_67_12 = d_C_67_28 * Q_4_67;
+            double d_Q_4_67 = d_C_67_28 * C_67_12;
+            double d_C_69_10 = d_C_69_26 * Q_4_69;
+            double d_Q_4_69 = d_C_69_26 * C_69_10;
+            double d_Q_3_71 = d_C_71_24 * Q_4_71;
+            double d_Q_4_71 = d_C_71_24 * Q_3_71;
+            double d_C_73_6 = d_C_73_22 * Q_4_73;
+            double d_Q_4_73 = d_C_73_22 * C_73_6;
+            double d_Q_2_75 = d_C_75_20 * Q_4_75;
+            double d_Q_4_75 = d_C_75_20 * Q_2_75;
+            double d_Q_1_77 = d_C_77_18 * Q_4_77;
+            double d_Q_4_77 = d_C_77_18 * Q_1_77;
+            d_Q_4_15 += d_Q_4_79 * q_4_6;
+            d_q_4_6 += d_Q_4_79 * Q_4_15;
+            double d_C_81_6 = d_C_81_14 * Q_3_81;
+            double d_Q_3_81 = d_C_81_14 * C_81_6;
+            double d_Q_2_83 = d_C_83_12 * Q_3_83;
+            double d_Q_3_83 = d_C_83_12 * Q_2_83;
+            double d_Q_1_85 = d_C_85_10 * Q_3_85;
+            double d_Q_3_85 = d_C_85_10 * Q_1_85;
+            d_Q_3_23 += d_Q_3_87 * q_3_6;
+            double d_q_3_6 = d_Q_3_87 * Q_3_23;
+            double d_Q_1_89 = d_C_89_6 * Q_2_89;
+            double d_Q_2_89 = d_C_89_6 * Q_1_89;
+            d_Q_2_27 += d_Q_2_91 * q_2_6;
+            double d_q_2_6 = d_Q_2_91 * Q_2_27;
+            d_Q_1_29 += d_Q_1_93 * q_1_6;
+            double d_q_1_6 = d_Q_1_93 * Q_1_29;
+            double d_C_97_14 = d_C_97_30 * Q_4_97;
+            double d_Q_4_97 = d_C_97_30 * C_97_14;
+            double d_C_99_12 = d_C_99_28 * Q_4_99;
+            double d_Q_4_99 = d_C_99_28 * C_99_12;
+            double d_C_101_10 = d_C_101_26 * Q_4_101;
+            double d_Q_4_101 = d_C_101_26 * C_101_10;
+            double d_Q_3_103 = d_C_103_24 * Q_4_103;
+            double d_Q_4_103 = d_C_103_24 * Q_3_103;
+            double d_C_105_6 = d_C_105_22 * Q_4_105;
+            double d_Q_4_105 = d_C_105_22 * C_105_6;
+            double d_Q_2_107 = d_C_107_20 * Q_4_107;
+            double d_Q_4_107 = d_C_107_20 * Q_2_107;
+            double d_Q_1_109 = d_C_109_18 * Q_4_109;
+            double d_Q_4_109 = d_C_109_18 * Q_1_109;
+            d_Q_4_47 += d_Q_4_111 * q_4_6;
+            d_q_4_6 += d_Q_4_111 * Q_4_47;
+            d_Q_4_15 += d_Q_4_47 * q_4_5;
+            d_q_4_5 += d_Q_4_47 * Q_4_15;
+            d_Q_4_7 += d_Q_4_15 * q_3_4;
+            double d_q_3_4 = d_Q_4_15 * Q_4_7;
+            d_R_109 += -d_R_111 * Q_1_109;
+            d_Q_1_109 += -d_R_111 * R_109;
+            d_R_107 += -d_R_111 * Q_2_107;
+            d_Q_2_107 += -d_R_111 * R_107;
+            d_R_105 += -d_R_111 * C_105_6;
+            d_C_105_6 += -d_R_111 * R_105;
+            d_R_103 += -d_R_111 * Q_3_103;
+            d_Q_3_103 += -d_R_111 * R_103;
+            d_R_101 += -d_R_111 * C_101_10;
+            d_C_101_10 += -d_R_111 * R_101;
+            d_R_99 += -d_R_111 * C_99_12;
+            d_C_99_12 += -d_R_111 * R_99;
+            d_R_97 += -d_R_111 * C_97_14;
+            d_C_97_14 += -d_R_111 * R_97;
+            d_R_79 += -d_R_111 * Q_5_79;
+            d_Q_5_79 += -d_R_111 * R_79;
+            d_R_77 += -d_R_111 * C_77_34;
+            double d_C_77_34 = -d_R_111 * R_77;
+            d_R_75 += -d_R_111 * C_75_36;
+            double d_C_75_36 = -d_R_111 * R_75;
+            d_R_73 += -d_R_111 * C_73_38;
+            double d_C_73_38 = -d_R_111 * R_73;
+            d_R_71 += -d_R_111 * C_71_40;
+            double d_C_71_40 = -d_R_111 * R_71;
+            d_R_69 += -d_R_111 * C_69_42;
+            double d_C_69_42 = -d_R_111 * R_69;
+            d_R_67 += -d_R_111 * C_67_44;
+            double d_C_67_44 = -d_R_111 * R_67;
+            d_R_65 += -d_R_111 * C_65_46;
+            double d_C_65_46 = -d_R_111 * R_65;
+            d_R_47 += -d_R_111 * Q_6_47;
+            d_Q_6_47 += -d_R_111 * R_47;
+            d_R_45 += -d_R_111 * C_45_66;
+            double d_C_45_66 = -d_R_111 * R_45;
+            d_R_43 += -d_R_111 * C_43_68;
+            double d_C_43_68 = -d_R_111 * R_43;
+            d_R_41 += -d_R_111 * C_41_70;
+            double d_C_41_70 = -d_R_111 * R_41;
+            d_R_39 += -d_R_111 * C_39_72;
+            double d_C_39_72 = -d_R_111 * R_39;
+            d_R_37 += -d_R_111 * C_37_74;
+            double d_C_37_74 = -d_R_111 * R_37;
+            d_R_35 += -d_R_111 * C_35_76;
+            double d_C_35_76 = -d_R_111 * R_35;
+            d_R_33 += -d_R_111 * C_33_78;
+            double d_C_33_78 = -d_R_111 * R_33;
+            d_R_15 += -d_R_111 * C_15_96;
+            double d_C_15_96 = -d_R_111 * R_15;
+            d_R_13 += -d_R_111 * C_13_98;
+            double d_C_13_98 = -d_R_111 * R_13;
+            d_R_11 += -d_R_111 * C_11_100;
+            double d_C_11_100 = -d_R_111 * R_11;
+            d_R_9 += -d_R_111 * C_9_102;
+            double d_C_9_102 = -d_R_111 * R_9;
+            d_R_7 += -d_R_111 * C_7_104;
+            double d_C_7_104 = -d_R_111 * R_7;
+            d_R_5 += -d_R_111 * C_5_106;
+            double d_C_5_106 = -d_R_111 * R_5;
+            d_R_3 += -d_R_111 * C_3_108;
+            double d_C_3_108 = -d_R_111 * R_3;
+            double d_C_1_110 = -d_R_111;
+            double d_C_1_46 = d_C_1_110 * q_0_6;
+            d_q_0_6 += d_C_1_110 * C_1_46;
+            double d_C_3_44 = d_C_3_108 * Q_6_3;
+            d_Q_6_3 += d_C_3_108 * C_3_44;
+            double d_C_5_42 = d_C_5_106 * Q_6_5;
+            d_Q_6_5 += d_C_5_106 * C_5_42;
+            double d_C_7_40 = d_C_7_104 * Q_6_7;
+            d_Q_6_7 += d_C_7_104 * C_7_40;
+            double d_C_9_38 = d_C_9_102 * Q_6_9;
+            d_Q_6_9 += d_C_9_102 * C_9_38;
+            double d_C_11_36 = d_C_11_100 * Q_6_11;
+            d_Q_6_11 += d_C_11_100 * C_11_36;
+            double d_C_13_34 = d_C_13_98 * Q_6_13;
+            d_Q_6_13 += d_C_13_98 * C_13_34;
+            d_Q_5_15 += d_C_15_96 * Q_6_15;
+            d_Q_6_15 += d_C_15_96 * Q_5_15;
+            d_C_33_14 += d_C_33_78 * Q_6_33;
+            d_Q_6_33 += d_C_33_78 * C_33_14;
+            d_C_35_12 += d_C_35_76 * Q_6_35;
+            d_Q_6_35 += d_C_35_76 * C_35_12;
+            d_C_37_10 += d_C_37_74 * Q_6_37;
+            d_Q_6_37 += d_C_37_74 * C_37_10;
+            d_Q_3_39 += d_C_39_72 * Q_6_39;
+            d_Q_6_39 += d_C_39_72 * Q_3_39;
+            d_C_41_6 += d_C_41_70 * Q_6_41;
+            d_Q_6_41 += d_C_41_70 * C_41_6;
+            d_Q_2_43 += d_C_43_68 * Q_6_43;
+            d_Q_6_43 += d_C_43_68 * Q_2_43;
+            d_Q_1_45 += d_C_45_66 * Q_6_45;
+            d_Q_6_45 += d_C_45_66 * Q_1_45;
+            d_Q_6_15 += d_Q_6_47 * q_5_6;
+            d_q_5_6 += d_Q_6_47 * Q_6_15;
+            d_R_45 += -d_R_47 * Q_1_45;
+            d_Q_1_45 += -d_R_47 * R_45;
+            d_R_43 += -d_R_47 * Q_2_43;
+            d_Q_2_43 += -d_R_47 * R_43;
+            d_R_41 += -d_R_47 * C_41_6;
+            d_C_41_6 += -d_R_47 * R_41;
+            d_R_39 += -d_R_47 * Q_3_39;
+            d_Q_3_39 += -d_R_47 * R_39;
+            d_R_37 += -d_R_47 * C_37_10;
+            d_C_37_10 += -d_R_47 * R_37;
+            d_R_35 += -d_R_47 * C_35_12;
+            d_C_35_12 += -d_R_47 * R_35;
+            d_R_33 += -d_R_47 * C_33_14;
+            d_C_33_14 += -d_R_47 * R_33;
+            d_R_15 += -d_R_47 * Q_5_15;
+            d_Q_5_15 += -d_R_47 * R_15;
+            d_R_13 += -d_R_47 * C_13_34;
+            d_C_13_34 += -d_R_47 * R_13;
+            d_R_11 += -d_R_47 * C_11_36;
+            d_C_11_36 += -d_R_47 * R_11;
+            d_R_9 += -d_R_47 * C_9_38;
+            d_C_9_38 += -d_R_47 * R_9;
+            d_R_7 += -d_R_47 * C_7_40;
+            d_C_7_40 += -d_R_47 * R_7;
+            d_R_5 += -d_R_47 * C_5_42;
+            d_C_5_42 += -d_R_47 * R_5;
+            d_R_3 += -d_R_47 * C_3_44;
+            d_C_3_44 += -d_R_47 * R_3;
+            d_C_1_46 += -d_R_47;
+            d_C_1_14 += d_C_1_46 * q_0_5;
+            d_q_0_5 += d_C_1_46 * C_1_14;
+            d_C_3_12 += d_C_3_44 * Q_5_3;
+            d_Q_5_3 += d_C_3_44 * C_3_12;
+            d_C_5_10 += d_C_5_42 * Q_5_5;
+            d_Q_5_5 += d_C_5_42 * C_5_10;
+            d_Q_3_7 += d_C_7_40 * Q_5_7;
+            d_Q_5_7 += d_C_7_40 * Q_3_7;
+            d_C_9_6 += d_C_9_38 * Q_5_9;
+            d_Q_5_9 += d_C_9_38 * C_9_6;
+            d_Q_2_11 += d_C_11_36 * Q_5_11;
+            d_Q_5_11 += d_C_11_36 * Q_2_11;
+            d_Q_1_13 += d_C_13_34 * Q_5_13;
+            d_Q_5_13 += d_C_13_34 * Q_1_13;
+            double d_C_33_6 = d_C_33_14 * Q_3_33;
+            double d_Q_3_33 = d_C_33_14 * C_33_6;
+            double d_Q_2_35 = d_C_35_12 * Q_3_35;
+            double d_Q_3_35 = d_C_35_12 * Q_2_35;
+            double d_Q_1_37 = d_C_37_10 * Q_3_37;
+            double d_Q_3_37 = d_C_37_10 * Q_1_37;
+            double d_Q_1_41 = d_C_41_6 * Q_2_41;
+            double d_Q_2_41 = d_C_41_6 * Q_1_41;
+            d_C_65_14 += d_C_65_46 * Q_5_65;
+            d_Q_5_65 += d_C_65_46 * C_65_14;
+            d_C_67_12 += d_C_67_44 * Q_5_67;
+            d_Q_5_67 += d_C_67_44 * C_67_12;
+            d_C_69_10 += d_C_69_42 * Q_5_69;
+            d_Q_5_69 += d_C_69_42 * C_69_10;
+            d_Q_3_71 += d_C_71_40 * Q_5_71;
+            d_Q_5_71 += d_C_71_40 * Q_3_71;
+            d_C_73_6 += d_C_73_38 * Q_5_73;
+            d_Q_5_73 += d_C_73_38 * C_73_6;
+            d_Q_2_75 += d_C_75_36 * Q_5_75;
+            d_Q_5_75 += d_C_75_36 * Q_2_75;
+            d_Q_1_77 += d_C_77_34 * Q_5_77;
+            d_Q_5_77 += d_C_77_34 * Q_1_77;
+            d_Q_5_15 += d_Q_5_79 * q_5_6;
+            d_q_5_6 += d_Q_5_79 * Q_5_15;
+            d_Q_5_7 += d_Q_5_15 * q_3_5;
+            double d_q_3_5 = d_Q_5_15 * Q_5_7;
+            d_R_77 += -d_R_79 * Q_1_77;
+            d_Q_1_77 += -d_R_79 * R_77;
+            d_R_75 += -d_R_79 * Q_2_75;
+            d_Q_2_75 += -d_R_79 * R_75;
+            d_R_73 += -d_R_79 * C_73_6;
+            d_C_73_6 += -d_R_79 * R_73;
+            d_R_71 += -d_R_79 * Q_3_71;
+            d_Q_3_71 += -d_R_79 * R_71;
+            d_R_69 += -d_R_79 * C_69_10;
+            d_C_69_10 += -d_R_79 * R_69;
+            d_R_67 += -d_R_79 * C_67_12;
+            d_C_67_12 += -d_R_79 * R_67;
+            d_R_65 += -d_R_79 * C_65_14;
+            d_C_65_14 += -d_R_79 * R_65;
+            d_R_15 += -d_R_79 * Q_6_15;
+            d_Q_6_15 += -d_R_79 * R_15;
+            d_R_13 += -d_R_79 * C_13_66;
+            double d_C_13_66 = -d_R_79 * R_13;
+            d_R_11 += -d_R_79 * C_11_68;
+            double d_C_11_68 = -d_R_79 * R_11;
+            d_R_9 += -d_R_79 * C_9_70;
+            double d_C_9_70 = -d_R_79 * R_9;
+            d_R_7 += -d_R_79 * C_7_72;
+            double d_C_7_72 = -d_R_79 * R_7;
+            d_R_5 += -d_R_79 * C_5_74;
+            double d_C_5_74 = -d_R_79 * R_5;
+            d_R_3 += -d_R_79 * C_3_76;
+            double d_C_3_76 = -d_R_79 * R_3;
+            double d_C_1_78 = -d_R_79;
+            d_C_1_14 += d_C_1_78 * q_0_6;
+            d_q_0_6 += d_C_1_78 * C_1_14;
+            d_C_3_12 += d_C_3_76 * Q_6_3;
+            d_Q_6_3 += d_C_3_76 * C_3_12;
+            d_C_5_10 += d_C_5_74 * Q_6_5;
+            d_Q_6_5 += d_C_5_74 * C_5_10;
+            d_Q_3_7 += d_C_7_72 * Q_6_7;
+            d_Q_6_7 += d_C_7_72 * Q_3_7;
+            d_C_9_6 += d_C_9_70 * Q_6_9;
+            d_Q_6_9 += d_C_9_70 * C_9_6;
+            d_Q_2_11 += d_C_11_68 * Q_6_11;
+            d_Q_6_11 += d_C_11_68 * Q_2_11;
+            d_Q_1_13 += d_C_13_66 * Q_6_13;
+            d_Q_6_13 += d_C_13_66 * Q_1_13;
+            d_Q_6_7 += d_Q_6_15 * q_3_6;
+            d_q_3_6 += d_Q_6_15 * Q_6_7;
+            d_R_13 += -d_R_15 * Q_1_13;
+            d_Q_1_13 += -d_R_15 * R_13;
+            d_R_11 += -d_R_15 * Q_2_11;
+            d_Q_2_11 += -d_R_15 * R_11;
+            d_R_9 += -d_R_15 * C_9_6;
+            d_C_9_6 += -d_R_15 * R_9;
+            d_R_7 += -d_R_15 * Q_3_7;
+            d_Q_3_7 += -d_R_15 * R_7;
+            d_R_5 += -d_R_15 * C_5_10;
+            d_C_5_10 += -d_R_15 * R_5;
+            d_R_3 += -d_R_15 * C_3_12;
+            d_C_3_12 += -d_R_15 * R_3;
+            d_C_1_14 += -d_R_15;
+            double d_C_1_6 = d_C_1_14 * q_0_3;
+            double d_q_0_3 = d_C_1_14 * C_1_6;
+            double d_Q_2_3 = d_C_3_12 * Q_3_3;
+            double d_Q_3_3 = d_C_3_12 * Q_2_3;
+            double d_Q_1_5 = d_C_5_10 * Q_3_5;
+            double d_Q_3_5 = d_C_5_10 * Q_1_5;
+            double d_Q_1_9 = d_C_9_6 * Q_2_9;
+            double d_Q_2_9 = d_C_9_6 * Q_1_9;
+            double d_C_65_6 = d_C_65_14 * Q_3_65;
+            double d_Q_3_65 = d_C_65_14 * C_65_6;
+            double d_Q_2_67 = d_C_67_12 * Q_3_67;
+            double d_Q_3_67 = d_C_67_12 * Q_2_67;
+            double d_Q_1_69 = d_C_69_10 * Q_3_69;
+            double d_Q_3_69 = d_C_69_10 * Q_1_69;
+            d_Q_3_7 += d_Q_3_71 * q_3_6;
+            d_q_3_6 += d_Q_3_71 * Q_3_7;
+            double d_Q_1_73 = d_C_73_6 * Q_2_73;
+            double d_Q_2_73 = d_C_73_6 * Q_1_73;
+            d_Q_2_11 += d_Q_2_75 * q_2_6;
+            d_q_2_6 += d_Q_2_75 * Q_2_11;
+            d_Q_1_13 += d_Q_1_77 * q_1_6;
+            d_q_1_6 += d_Q_1_77 * Q_1_13;
+            double d_C_97_6 = d_C_97_14 * Q_3_97;
+            double d_Q_3_97 = d_C_97_14 * C_97_6;
+            double d_Q_2_99 = d_C_99_12 * Q_3_99;
+            double d_Q_3_99 = d_C_99_12 * Q_2_99;
+            double d_Q_1_101 = d_C_101_10 * Q_3_101;
+            double d_Q_3_101 = d_C_101_10 * Q_1_101;
+            d_Q_3_39 += d_Q_3_103 * q_3_6;
+            d_q_3_6 += d_Q_3_103 * Q_3_39;
+            d_Q_3_7 += d_Q_3_39 * q_3_5;
+            d_q_3_5 += d_Q_3_39 * Q_3_7;
+            double d_Q_1_105 = d_C_105_6 * Q_2_105;
+            double d_Q_2_105 = d_C_105_6 * Q_1_105;
+            d_Q_2_43 += d_Q_2_107 * q_2_6;
+            d_q_2_6 += d_Q_2_107 * Q_2_43;
+            d_Q_2_11 += d_Q_2_43 * q_2_5;
+            double d_q_2_5 = d_Q_2_43 * Q_2_11;
+            d_Q_1_45 += d_Q_1_109 * q_1_6;
+            d_q_1_6 += d_Q_1_109 * Q_1_45;
+            d_Q_1_13 += d_Q_1_45 * q_1_5;
+            double d_q_1_5 = d_Q_1_45 * Q_1_13;
+            double d_C_113_6 = d_C_113_14 * Q_3_113;
+            double d_Q_3_113 = d_C_113_14 * C_113_6;
+            double d_Q_2_115 = d_C_115_12 * Q_3_115;
+            double d_Q_3_115 = d_C_115_12 * Q_2_115;
+            double d_Q_1_117 = d_C_117_10 * Q_3_117;
+            double d_Q_3_117 = d_C_117_10 * Q_1_117;
+            d_Q_3_55 += d_Q_3_119 * q_3_6;
+            d_q_3_6 += d_Q_3_119 * Q_3_55;
+            d_Q_3_23 += d_Q_3_55 * q_3_5;
+            d_q_3_5 += d_Q_3_55 * Q_3_23;
+            d_Q_3_7 += d_Q_3_23 * q_3_4;
+            d_q_3_4 += d_Q_3_23 * Q_3_7;
+            d_Q_3_3 += d_Q_3_7 * q_2_3;
+            double d_q_2_3 = d_Q_3_7 * Q_3_3;
+            d_R_117 += -d_R_119 * Q_1_117;
+            d_Q_1_117 += -d_R_119 * R_117;
+            d_R_115 += -d_R_119 * Q_2_115;
+            d_Q_2_115 += -d_R_119 * R_115;
+            d_R_113 += -d_R_119 * C_113_6;
+            d_C_113_6 += -d_R_119 * R_113;
+            d_R_103 += -d_R_119 * Q_4_103;
+            d_Q_4_103 += -d_R_119 * R_103;
+            d_R_101 += -d_R_119 * C_101_18;
+            double d_C_101_18 = -d_R_119 * R_101;
+            d_R_99 += -d_R_119 * C_99_20;
+            double d_C_99_20 = -d_R_119 * R_99;
+            d_R_97 += -d_R_119 * C_97_22;
+            double d_C_97_22 = -d_R_119 * R_97;
+            d_R_87 += -d_R_119 * Q_5_87;
+            d_Q_5_87 += -d_R_119 * R_87;
+            d_R_85 += -d_R_119 * C_85_34;
+            double d_C_85_34 = -d_R_119 * R_85;
+            d_R_83 += -d_R_119 * C_83_36;
+            double d_C_83_36 = -d_R_119 * R_83;
+            d_R_81 += -d_R_119 * C_81_38;
+            double d_C_81_38 = -d_R_119 * R_81;
+            d_R_71 += -d_R_119 * C_71_48;
+            double d_C_71_48 = -d_R_119 * R_71;
+            d_R_69 += -d_R_119 * C_69_50;
+            double d_C_69_50 = -d_R_119 * R_69;
+            d_R_67 += -d_R_119 * C_67_52;
+            double d_C_67_52 = -d_R_119 * R_67;
+            d_R_65 += -d_R_119 * C_65_54;
+            double d_C_65_54 = -d_R_119 * R_65;
+            d_R_55 += -d_R_119 * Q_6_55;
+            d_Q_6_55 += -d_R_119 * R_55;
+            d_R_53 += -d_R_119 * C_53_66;
+            double d_C_53_66 = -d_R_119 * R_53;
+            d_R_51 += -d_R_119 * C_51_68;
+            double d_C_51_68 = -d_R_119 * R_51;
+            d_R_49 += -d_R_119 * C_49_70;
+            double d_C_49_70 = -d_R_119 * R_49;
+            d_R_39 += -d_R_119 * C_39_80;
+            double d_C_39_80 = -d_R_119 * R_39;
+            d_R_37 += -d_R_119 * C_37_82;
+            double d_C_37_82 = -d_R_119 * R_37;
+            d_R_35 += -d_R_119 * C_35_84;
+            double d_C_35_84 = -d_R_119 * R_35;
+            d_R_33 += -d_R_119 * C_33_86;
+            double d_C_33_86 = -d_R_119 * R_33;
+            d_R_23 += -d_R_119 * C_23_96;
+            double d_C_23_96 = -d_R_119 * R_23;
+            d_R_21 += -d_R_119 * C_21_98;
+            double d_C_21_98 = -d_R_119 * R_21;
+            d_R_19 += -d_R_119 * C_19_100;
+            double d_C_19_100 = -d_R_119 * R_19;
+            d_R_17 += -d_R_119 * C_17_102;
+            double d_C_17_102 = -d_R_119 * R_17;
+            d_R_7 += -d_R_119 * C_7_112;
+            double d_C_7_112 = -d_R_119 * R_7;
+            d_R_5 += -d_R_119 * C_5_114;
+            double d_C_5_114 = -d_R_119 * R_5;
+            d_R_3 += -d_R_119 * C_3_116;
+            double d_C_3_116 = -d_R_119 * R_3;
+            double d_C_1_118 = -d_R_119;
+            double d_C_1_54 = d_C_1_118 * q_0_6;
+            d_q_0_6 += d_C_1_118 * C_1_54;
+            double d_C_3_52 = d_C_3_116 * Q_6_3;
+            d_Q_6_3 += d_C_3_116 * C_3_52;
+            double d_C_5_50 = d_C_5_114 * Q_6_5;
+            d_Q_6_5 += d_C_5_114 * C_5_50;
+            double d_C_7_48 = d_C_7_112 * Q_6_7;
+            d_Q_6_7 += d_C_7_112 * C_7_48;
+            double d_C_17_38 = d_C_17_102 * Q_6_17;
+            d_Q_6_17 += d_C_17_102 * C_17_38;
+            double d_C_19_36 = d_C_19_100 * Q_6_19;
+            d_Q_6_19 += d_C_19_100 * C_19_36;
+            double d_C_21_34 = d_C_21_98 * Q_6_21;
+            d_Q_6_21 += d_C_21_98 * C_21_34;
+            d_Q_5_23 += d_C_23_96 * Q_6_23;
+            d_Q_6_23 += d_C_23_96 * Q_5_23;
+            double d_C_33_22 = d_C_33_86 * Q_6_33;
+            d_Q_6_33 += d_C_33_86 * C_33_22;
+            double d_C_35_20 = d_C_35_84 * Q_6_35;
+            d_Q_6_35 += d_C_35_84 * C_35_20;
+            double d_C_37_18 = d_C_37_82 * Q_6_37;
+            d_Q_6_37 += d_C_37_82 * C_37_18;
+            d_Q_4_39 += d_C_39_80 * Q_6_39;
+            d_Q_6_39 += d_C_39_80 * Q_4_39;
+            d_C_49_6 += d_C_49_70 * Q_6_49;
+            d_Q_6_49 += d_C_49_70 * C_49_6;
+            d_Q_2_51 += d_C_51_68 * Q_6_51;
+            d_Q_6_51 += d_C_51_68 * Q_2_51;
+            d_Q_1_53 += d_C_53_66 * Q_6_53;
+            d_Q_6_53 += d_C_53_66 * Q_1_53;
+            d_Q_6_23 += d_Q_6_55 * q_5_6;
+            d_q_5_6 += d_Q_6_55 * Q_6_23;
+            d_R_53 += -d_R_55 * Q_1_53;
+            d_Q_1_53 += -d_R_55 * R_53;
+            d_R_51 += -d_R_55 * Q_2_51;
+            d_Q_2_51 += -d_R_55 * R_51;
+            d_R_49 += -d_R_55 * C_49_6;
+            d_C_49_6 += -d_R_55 * R_49;
+            d_R_39 += -d_R_55 * Q_4_39;
+            d_Q_4_39 += -d_R_55 * R_39;
+            d_R_37 += -d_R_55 * C_37_18;
+            d_C_37_18 += -d_R_55 * R_37;
+            d_R_35 += -d_R_55 * C_35_20;
+            d_C_35_20 += -d_R_55 * R_35;
+            d_R_33 += -d_R_55 * C_33_22;
+            d_C_33_22 += -d_R_55 * R_33;
+            d_R_23 += -d_R_55 * Q_5_23;
+            d_Q_5_23 += -d_R_55 * R_23;
+            d_R_21 += -d_R_55 * C_21_34;
+            d_C_21_34 += -d_R_55 * R_21;
+            d_R_19 += -d_R_55 * C_19_36;
+            d_C_19_36 += -d_R_55 * R_19;
+            d_R_17 += -d_R_55 * C_17_38;
+            d_C_17_38 += -d_R_55 * R_17;
+            d_R_7 += -d_R_55 * C_7_48;
+            d_C_7_48 += -d_R_55 * R_7;
+            d_R_5 += -d_R_55 * C_5_50;
+            d_C_5_50 += -d_R_55 * R_5;
+            d_R_3 += -d_R_55 * C_3_52;
+            d_C_3_52 += -d_R_55 * R_3;
+            d_C_1_54 += -d_R_55;
+            double d_C_1_22 = d_C_1_54 * q_0_5;
+            d_q_0_5 += d_C_1_54 * C_1_22;
+            double d_C_3_20 = d_C_3_52 * Q_5_3;
+            d_Q_5_3 += d_C_3_52 * C_3_20;
+            double d_C_5_18 = d_C_5_50 * Q_5_5;
+            d_Q_5_5 += d_C_5_50 * C_5_18;
+            d_Q_4_7 += d_C_7_48 * Q_5_7;
+            d_Q_5_7 += d_C_7_48 * Q_4_7;
+            d_C_17_6 += d_C_17_38 * Q_5_17;
+            d_Q_5_17 += d_C_17_38 * C_17_6;
+            d_Q_2_19 += d_C_19_36 * Q_5_19;
+            d_Q_5_19 += d_C_19_36 * Q_2_19;
+            d_Q_1_21 += d_C_21_34 * Q_5_21;
+            d_Q_5_21 += d_C_21_34 * Q_1_21;
+            d_C_33_6 += d_C_33_22 * Q_4_33;
+            d_Q_4_33 += d_C_33_22 * C_33_6;
+            d_Q_2_35 += d_C_35_20 * Q_4_35;
+            d_Q_4_35 += d_C_35_20 * Q_2_35;
+            d_Q_1_37 += d_C_37_18 * Q_4_37;
+            d_Q_4_37 += d_C_37_18 * Q_1_37;
+            double d_Q_1_49 = d_C_49_6 * Q_2_49;
+            double d_Q_2_49 = d_C_49_6 * Q_1_49;
+            double d_C_65_22 = d_C_65_54 * Q_5_65;
+            d_Q_5_65 += d_C_65_54 * C_65_22;
+            double d_C_67_20 = d_C_67_52 * Q_5_67;
+            d_Q_5_67 += d_C_67_52 * C_67_20;
+            double d_C_69_18 = d_C_69_50 * Q_5_69;
+            d_Q_5_69 += d_C_69_50 * C_69_18;
+            d_Q_4_71 += d_C_71_48 * Q_5_71;
+            d_Q_5_71 += d_C_71_48 * Q_4_71;
+            d_C_81_6 += d_C_81_38 * Q_5_81;
+            d_Q_5_81 += d_C_81_38 * C_81_6;
+            d_Q_2_83 += d_C_83_36 * Q_5_83;
+            d_Q_5_83 += d_C_83_36 * Q_2_83;
+            d_Q_1_85 += d_C_85_34 * Q_5_85;
+            d_Q_5_85 += d_C_85_34 * Q_1_85;
+            d_Q_5_23 += d_Q_5_87 * q_5_6;
+            d_q_5_6 += d_Q_5_87 * Q_5_23;
+            d_Q_5_7 += d_Q_5_23 * q_4_5;
+            d_q_4_5 += d_Q_5_23 * Q_5_7;
+            d_R_85 += -d_R_87 * Q_1_85;
+            d_Q_1_85 += -d_R_87 * R_85;
+            d_R_83 += -d_R_87 * Q_2_83;
+            d_Q_2_83 += -d_R_87 * R_83;
+            d_R_81 += -d_R_87 * C_81_6;
+            d_C_81_6 += -d_R_87 * R_81;
+            d_R_71 += -d_R_87 * Q_4_71;
+            d_Q_4_71 += -d_R_87 * R_71;
+            d_R_69 += -d_R_87 * C_69_18;
+            d_C_69_18 += -d_R_87 * R_69;
+            d_R_67 += -d_R_87 * C_67_20;
+            d_C_67_20 += -d_R_87 * R_67;
+            d_R_65 += -d_R_87 * C_65_22;
+            d_C_65_22 += -d_R_87 * R_65;
+            d_R_23 += -d_R_87 * Q_6_23;
+            d_Q_6_23 += -d_R_87 * R_23;
+            d_R_21 += -d_R_87 * C_21_66;
+            double d_C_21_66 = -d_R_87 * R_21;
+            d_R_19 += -d_R_87 * C_19_68;
+            double d_C_19_68 = -d_R_87 * R_19;
+            d_R_17 += -d_R_87 * C_17_70;
+            double d_C_17_70 = -d_R_87 * R_17;
+            d_R_7 += -d_R_87 * C_7_80;
+            double d_C_7_80 = -d_R_87 * R_7;
+            d_R_5 += -d_R_87 * C_5_82;
+            double d_C_5_82 = -d_R_87 * R_5;
+            d_R_3 += -d_R_87 * C_3_84;
+            double d_C_3_84 = -d_R_87 * R_3;
+            double d_C_1_86 = -d_R_87;
+            d_C_1_22 += d_C_1_86 * q_0_6;
+            d_q_0_6 += d_C_1_86 * C_1_22;
+            d_C_3_20 += d_C_3_84 * Q_6_3;
+            d_Q_6_3 += d_C_3_84 * C_3_20;
+            d_C_5_18 += d_C_5_82 * Q_6_5;
+            d_Q_6_5 += d_C_5_82 * C_5_18;
+            d_Q_4_7 += d_C_7_80 * Q_6_7;
+            d_Q_6_7 += d_C_7_80 * Q_4_7;
+            d_C_17_6 += d_C_17_70 * Q_6_17;
+            d_Q_6_17 += d_C_17_70 * C_17_6;
+            d_Q_2_19 += d_C_19_68 * Q_6_19;
+            d_Q_6_19 += d_C_19_68 * Q_2_19;
+            d_Q_1_21 += d_C_21_66 * Q_6_21;
+            d_Q_6_21 += d_C_21_66 * Q_1_21;
+            d_Q_6_7 += d_Q_6_23 * q_4_6;
+            d_q_4_6 += d_Q_6_23 * Q_6_7;
+            d_R_21 += -d_R_23 * Q_1_21;
+            d_Q_1_21 += -d_R_23 * R_21;
+            d_R_19 += -d_R_23 * Q_2_19;
+            d_Q_2_19 += -d_R_23 * R_19;
+            d_R_17 += -d_R_23 * C_17_6;
+            d_C_17_6 += -d_R_23 * R_17;
+            d_R_7 += -d_R_23 * Q_4_7;
+            d_Q_4_7 += -d_R_23 * R_7;
+            d_R_5 += -d_R_23 * C_5_18;
+            d_C_5_18 += -d_R_23 * R_5;
+            d_R_3 += -d_R_23 * C_3_20;
+            d_C_3_20 += -d_R_23 * R_3;
+            d_C_1_22 += -d_R_23;
+            d_C_1_6 += d_C_1_22 * q_0_4;
+            d_q_0_4 += d_C_1_22 * C_1_6;
+            d_Q_2_3 += d_C_3_20 * Q_4_3;
+            d_Q_4_3 += d_C_3_20 * Q_2_3;
+            d_Q_1_5 += d_C_5_18 * Q_4_5;
+            d_Q_4_5 += d_C_5_18 * Q_1_5;
+            double d_Q_1_17 = d_C_17_6 * Q_2_17;
+            double d_Q_2_17 = d_C_17_6 * Q_1_17;
+            d_C_65_6 += d_C_65_22 * Q_4_65;
+            d_Q_4_65 += d_C_65_22 * C_65_6;
+            d_Q_2_67 += d_C_67_20 * Q_4_67;
+            d_Q_4_67 += d_C_67_20 * Q_2_67;
+            d_Q_1_69 += d_C_69_18 * Q_4_69;
+            d_Q_4_69 += d_C_69_18 * Q_1_69;
+            d_Q_4_7 += d_Q_4_71 * q_4_6;
+            d_q_4_6 += d_Q_4_71 * Q_4_7;
+            double d_Q_1_81 = d_C_81_6 * Q_2_81;
+            double d_Q_2_81 = d_C_81_6 * Q_1_81;
+            d_Q_2_19 += d_Q_2_83 * q_2_6;
+            d_q_2_6 += d_Q_2_83 * Q_2_19;
+            d_Q_1_21 += d_Q_1_85 * q_1_6;
+            d_q_1_6 += d_Q_1_85 * Q_1_21;
+            d_C_97_6 += d_C_97_22 * Q_4_97;
+            d_Q_4_97 += d_C_97_22 * C_97_6;
+            d_Q_2_99 += d_C_99_20 * Q_4_99;
+            d_Q_4_99 += d_C_99_20 * Q_2_99;
+            d_Q_1_101 += d_C_101_18 * Q_4_101;
+            d_Q_4_101 += d_C_101_18 * Q_1_101;
+            d_Q_4_39 += d_Q_4_103 * q_4_6;
+            d_q_4_6 += d_Q_4_103 * Q_4_39;
+            d_Q_4_7 += d_Q_4_39 * q_4_5;
+            d_q_4_5 += d_Q_4_39 * Q_4_7;
+            d_Q_4_3 += d_Q_4_7 * q_2_4;
+            double d_q_2_4 = d_Q_4_7 * Q_4_3;
+            d_R_101 += -d_R_103 * Q_1_101;
+            d_Q_1_101 += -d_R_103 * R_101;
+            d_R_99 += -d_R_103 * Q_2_99;
+            d_Q_2_99 += -d_R_103 * R_99;
+            d_R_97 += -d_R_103 * C_97_6;
+            d_C_97_6 += -d_R_103 * R_97;
+            d_R_71 += -d_R_103 * Q_5_71;
+            d_Q_5_71 += -d_R_103 * R_71;
+            d_R_69 += -d_R_103 * C_69_34;
+            double d_C_69_34 = -d_R_103 * R_69;
+            d_R_67 += -d_R_103 * C_67_36;
+            double d_C_67_36 = -d_R_103 * R_67;
+            d_R_65 += -d_R_103 * C_65_38;
+            double d_C_65_38 = -d_R_103 * R_65;
+            d_R_39 += -d_R_103 * Q_6_39;
+            d_Q_6_39 += -d_R_103 * R_39;
+            d_R_37 += -d_R_103 * C_37_66;
+            double d_C_37_66 = -d_R_103 * R_37;
+            d_R_35 += -d_R_103 * C_35_68;
+            double d_C_35_68 = -d_R_103 * R_35;
+            d_R_33 += -d_R_103 * C_33_70;
+            double d_C_33_70 = -d_R_103 * R_33;
+            d_R_7 += -d_R_103 * C_7_96;
+            double d_C_7_96 = -d_R_103 * R_7;
+            d_R_5 += -d_R_103 * C_5_98;
+            double d_C_5_98 = -d_R_103 * R_5;
+            d_R_3 += -d_R_103 * C_3_100;
+            double d_C_3_100 = -d_R_103 * R_3;
+            double d_C_1_102 = -d_R_103;
+            double d_C_1_38 = d_C_1_102 * q_0_6;
+            d_q_0_6 += d_C_1_102 * C_1_38;
+            double d_C_3_36 = d_C_3_100 * Q_6_3;
+            d_Q_6_3 += d_C_3_100 * C_3_36;
+            double d_C_5_34 = d_C_5_98 * Q_6_5;
+            d_Q_6_5 += d_C_5_98 * C_5_34;
+            d_Q_5_7 += d_C_7_96 * Q_6_7;
+            d_Q_6_7 += d_C_7_96 * Q_5_7;
+            d_C_33_6 += d_C_33_70 * Q_6_33;
+            d_Q_6_33 += d_C_33_70 * C_33_6;
+            d_Q_2_35 += d_C_35_68 * Q_6_35;
+            d_Q_6_35 += d_C_35_68 * Q_2_35;
+            d_Q_1_37 += d_C_37_66 * Q_6_37;
+            d_Q_6_37 += d_C_37_66 * Q_1_37;
+            d_Q_6_7 += d_Q_6_39 * q_5_6;
+            d_q_5_6 += d_Q_6_39 * Q_6_7;
+            d_R_37 += -d_R_39 * Q_1_37;
+            d_Q_1_37 += -d_R_39 * R_37;
+            d_R_35 += -d_R_39 * Q_2_35;
+            d_Q_2_35 += -d_R_39 * R_35;
+            d_R_33 += -d_R_39 * C_33_6;
+            d_C_33_6 += -d_R_39 * R_33;
+            d_R_7 += -d_R_39 * Q_5_7;
+            d_Q_5_7 += -d_R_39 * R_7;
+            d_R_5 += -d_R_39 * C_5_34;
+            d_C_5_34 += -d_R_39 * R_5;
+            d_R_3 += -d_R_39 * C_3_36;
+            d_C_3_36 += -d_R_39 * R_3;
+            d_C_1_38 += -d_R_39;
+            d_C_1_6 += d_C_1_38 * q_0_5;
+            d_q_0_5 += d_C_1_38 * C_1_6;
+            d_Q_2_3 += d_C_3_36 * Q_5_3;
+            d_Q_5_3 += d_C_3_36 * Q_2_3;
+            d_Q_1_5 += d_C_5_34 * Q_5_5;
+            d_Q_5_5 += d_C_5_34 * Q_1_5;
+            double d_Q_1_33 = d_C_33_6 * Q_2_33;
+            double d_Q_2_33 = d_C_33_6 * Q_1_33;
+            d_C_65_6 += d_C_65_38 * Q_5_65;
+            d_Q_5_65 += d_C_65_38 * C_65_6;
+            d_Q_2_67 += d_C_67_36 * Q_5_67;
+            d_Q_5_67 += d_C_67_36 * Q_2_67;
+            d_Q_1_69 += d_C_69_34 * Q_5_69;
+            d_Q_5_69 += d_C_69_34 * Q_1_69;
+            d_Q_5_7 += d_Q_5_71 * q_5_6;
+            d_q_5_6 += d_Q_5_71 * Q_5_7;
+            d_Q_5_3 += d_Q_5_7 * q_2_5;
+            d_q_2_5 += d_Q_5_7 * Q_5_3;
+            d_R_69 += -d_R_71 * Q_1_69;
+            d_Q_1_69 += -d_R_71 * R_69;
+            d_R_67 += -d_R_71 * Q_2_67;
+            d_Q_2_67 += -d_R_71 * R_67;
+            d_R_65 += -d_R_71 * C_65_6;
+            d_C_65_6 += -d_R_71 * R_65;
+            d_R_7 += -d_R_71 * Q_6_7;
+            d_Q_6_7 += -d_R_71 * R_7;
+            d_R_5 += -d_R_71 * C_5_66;
+            double d_C_5_66 = -d_R_71 * R_5;
+            d_R_3 += -d_R_71 * C_3_68;
+            double d_C_3_68 = -d_R_71 * R_3;
+            double d_C_1_70 = -d_R_71;
+            d_C_1_6 += d_C_1_70 * q_0_6;
+            d_q_0_6 += d_C_1_70 * C_1_6;
+            d_Q_2_3 += d_C_3_68 * Q_6_3;
+            d_Q_6_3 += d_C_3_68 * Q_2_3;
+            d_Q_1_5 += d_C_5_66 * Q_6_5;
+            d_Q_6_5 += d_C_5_66 * Q_1_5;
+            d_Q_6_3 += d_Q_6_7 * q_2_6;
+            d_q_2_6 += d_Q_6_7 * Q_6_3;
+            d_R_5 += -d_R_7 * Q_1_5;
+            d_Q_1_5 += -d_R_7 * R_5;
+            d_R_3 += -d_R_7 * Q_2_3;
+            d_Q_2_3 += -d_R_7 * R_3;
+            d_C_1_6 += -d_R_7;
+            double d_q_0_1 = d_C_1_6 * q_0_2;
+            double d_q_0_2 = d_C_1_6 * q_0_1;
+            double d_Q_1_65 = d_C_65_6 * Q_2_65;
+            double d_Q_2_65 = d_C_65_6 * Q_1_65;
+            d_Q_2_3 += d_Q_2_67 * q_2_6;
+            d_q_2_6 += d_Q_2_67 * Q_2_3;
+            d_Q_1_5 += d_Q_1_69 * q_1_6;
+            d_q_1_6 += d_Q_1_69 * Q_1_5;
+            double d_Q_1_97 = d_C_97_6 * Q_2_97;
+            double d_Q_2_97 = d_C_97_6 * Q_1_97;
+            d_Q_2_35 += d_Q_2_99 * q_2_6;
+            d_q_2_6 += d_Q_2_99 * Q_2_35;
+            d_Q_2_3 += d_Q_2_35 * q_2_5;
+            d_q_2_5 += d_Q_2_35 * Q_2_3;
+            d_Q_1_37 += d_Q_1_101 * q_1_6;
+            d_q_1_6 += d_Q_1_101 * Q_1_37;
+            d_Q_1_5 += d_Q_1_37 * q_1_5;
+            d_q_1_5 += d_Q_1_37 * Q_1_5;
+            double d_Q_1_113 = d_C_113_6 * Q_2_113;
+            double d_Q_2_113 = d_C_113_6 * Q_1_113;
+            d_Q_2_51 += d_Q_2_115 * q_2_6;
+            d_q_2_6 += d_Q_2_115 * Q_2_51;
+            d_Q_2_19 += d_Q_2_51 * q_2_5;
+            d_q_2_5 += d_Q_2_51 * Q_2_19;
+            d_Q_2_3 += d_Q_2_19 * q_2_4;
+            d_q_2_4 += d_Q_2_19 * Q_2_3;
+            d_Q_1_53 += d_Q_1_117 * q_1_6;
+            d_q_1_6 += d_Q_1_117 * Q_1_53;
+            d_Q_1_21 += d_Q_1_53 * q_1_5;
+            d_q_1_5 += d_Q_1_53 * Q_1_21;
+            d_Q_1_5 += d_Q_1_21 * q_1_4;
+            double d_q_1_4 = d_Q_1_21 * Q_1_5;
+            double d_Q_1_121 = d_C_121_6 * Q_2_121;
+            double d_Q_2_121 = d_C_121_6 * Q_1_121;
+            d_Q_2_59 += d_Q_2_123 * q_2_6;
+            d_q_2_6 += d_Q_2_123 * Q_2_59;
+            d_Q_2_27 += d_Q_2_59 * q_2_5;
+            d_q_2_5 += d_Q_2_59 * Q_2_27;
+            d_Q_2_11 += d_Q_2_27 * q_2_4;
+            d_q_2_4 += d_Q_2_27 * Q_2_11;
+            d_Q_2_3 += d_Q_2_11 * q_2_3;
+            d_q_2_3 += d_Q_2_11 * Q_2_3;
+            d_q_0_2 += d_Q_2_3 * q_1_2;
+            double d_q_1_2 = d_Q_2_3 * q_0_2;
+            d_R_121 += -d_R_123 * Q_1_121;
+            d_Q_1_121 += -d_R_123 * R_121;
+            d_R_115 += -d_R_123 * Q_3_115;
+            d_Q_3_115 += -d_R_123 * R_115;
+            d_R_113 += -d_R_123 * C_113_10;
+            double d_C_113_10 = -d_R_123 * R_113;
+            d_R_107 += -d_R_123 * Q_4_107;
+            d_Q_4_107 += -d_R_123 * R_107;
+            d_R_105 += -d_R_123 * C_105_18;
+            double d_C_105_18 = -d_R_123 * R_105;
+            d_R_99 += -d_R_123 * C_99_24;
+            double d_C_99_24 = -d_R_123 * R_99;
+            d_R_97 += -d_R_123 * C_97_26;
+            double d_C_97_26 = -d_R_123 * R_97;
+            d_R_91 += -d_R_123 * Q_5_91;
+            d_Q_5_91 += -d_R_123 * R_91;
+            d_R_89 += -d_R_123 * C_89_34;
+            double d_C_89_34 = -d_R_123 * R_89;
+            d_R_83 += -d_R_123 * C_83_40;
+            double d_C_83_40 = -d_R_123 * R_83;
+            d_R_81 += -d_R_123 * C_81_42;
+            double d_C_81_42 = -d_R_123 * R_81;
+            d_R_75 += -d_R_123 * C_75_48;
+            double d_C_75_48 = -d_R_123 * R_75;
+            d_R_73 += -d_R_123 * C_73_50;
+            double d_C_73_50 = -d_R_123 * R_73;
+            d_R_67 += -d_R_123 * C_67_56;
+            double d_C_67_56 = -d_R_123 * R_67;
+            d_R_65 += -d_R_123 * C_65_58;
+            double d_C_65_58 = -d_R_123 * R_65;
+            d_R_59 += -d_R_123 * Q_6_59;
+            d_Q_6_59 += -d_R_123 * R_59;
+            d_R_57 += -d_R_123 * C_57_66;
+            double d_C_57_66 = -d_R_123 * R_57;
+            d_R_51 += -d_R_123 * C_51_72;
+            double d_C_51_72 = -d_R_123 * R_51;
+            d_R_49 += -d_R_123 * C_49_74;
+            double d_C_49_74 = -d_R_123 * R_49;
+            d_R_43 += -d_R_123 * C_43_80;
+            double d_C_43_80 = -d_R_123 * R_43;
+            d_R_41 += -d_R_123 * C_41_82;
+            double d_C_41_82 = -d_R_123 * R_41;
+            d_R_35 += -d_R_123 * C_35_88;
+            double d_C_35_88 = -d_R_123 * R_35;
+            d_R_33 += -d_R_123 * C_33_90;
+            double d_C_33_90 = -d_R_123 * R_33;
+            d_R_27 += -d_R_123 * C_27_96;
+            double d_C_27_96 = -d_R_123 * R_27;
+            d_R_25 += -d_R_123 * C_25_98;
+            double d_C_25_98 = -d_R_123 * R_25;
+            d_R_19 += -d_R_123 * C_19_104;
+            double d_C_19_104 = -d_R_123 * R_19;
+            d_R_17 += -d_R_123 * C_17_106;
+            double d_C_17_106 = -d_R_123 * R_17;
+            d_R_11 += -d_R_123 * C_11_112;
+            double d_C_11_112 = -d_R_123 * R_11;
+            d_R_9 += -d_R_123 * C_9_114;
+            double d_C_9_114 = -d_R_123 * R_9;
+            d_R_3 += -d_R_123 * C_3_120;
+            double d_C_3_120 = -d_R_123 * R_3;
+            double d_C_1_122 = -d_R_123;
+            double d_C_1_58 = d_C_1_122 * q_0_6;
+            d_q_0_6 += d_C_1_122 * C_1_58;
+            double d_C_3_56 = d_C_3_120 * Q_6_3;
+            d_Q_6_3 += d_C_3_120 * C_3_56;
+            double d_C_9_50 = d_C_9_114 * Q_6_9;
+            d_Q_6_9 += d_C_9_114 * C_9_50;
+            double d_C_11_48 = d_C_11_112 * Q_6_11;
+            d_Q_6_11 += d_C_11_112 * C_11_48;
+            double d_C_17_42 = d_C_17_106 * Q_6_17;
+            d_Q_6_17 += d_C_17_106 * C_17_42;
+            double d_C_19_40 = d_C_19_104 * Q_6_19;
+            d_Q_6_19 += d_C_19_104 * C_19_40;
+            double d_C_25_34 = d_C_25_98 * Q_6_25;
+            d_Q_6_25 += d_C_25_98 * C_25_34;
+            d_Q_5_27 += d_C_27_96 * Q_6_27;
+            d_Q_6_27 += d_C_27_96 * Q_5_27;
+            double d_C_33_26 = d_C_33_90 * Q_6_33;
+            d_Q_6_33 += d_C_33_90 * C_33_26;
+            double d_C_35_24 = d_C_35_88 * Q_6_35;
+            d_Q_6_35 += d_C_35_88 * C_35_24;
+            double d_C_41_18 = d_C_41_82 * Q_6_41;
+            d_Q_6_41 += d_C_41_82 * C_41_18;
+            d_Q_4_43 += d_C_43_80 * Q_6_43;
+            d_Q_6_43 += d_C_43_80 * Q_4_43;
+            double d_C_49_10 = d_C_49_74 * Q_6_49;
+            d_Q_6_49 += d_C_49_74 * C_49_10;
+            d_Q_3_51 += d_C_51_72 * Q_6_51;
+            d_Q_6_51 += d_C_51_72 * Q_3_51;
+            d_Q_1_57 += d_C_57_66 * Q_6_57;
+            d_Q_6_57 += d_C_57_66 * Q_1_57;
+            d_Q_6_27 += d_Q_6_59 * q_5_6;
+            d_q_5_6 += d_Q_6_59 * Q_6_27;
+            d_R_57 += -d_R_59 * Q_1_57;
+            d_Q_1_57 += -d_R_59 * R_57;
+            d_R_51 += -d_R_59 * Q_3_51;
+            d_Q_3_51 += -d_R_59 * R_51;
+            d_R_49 += -d_R_59 * C_49_10;
+            d_C_49_10 += -d_R_59 * R_49;
+            d_R_43 += -d_R_59 * Q_4_43;
+            d_Q_4_43 += -d_R_59 * R_43;
+            d_R_41 += -d_R_59 * C_41_18;
+            d_C_41_18 += -d_R_59 * R_41;
+            d_R_35 += -d_R_59 * C_35_24;
+            d_C_35_24 += -d_R_59 * R_35;
+            d_R_33 += -d_R_59 * C_33_26;
+            d_C_33_26 += -d_R_59 * R_33;
+            d_R_27 += -d_R_59 * Q_5_27;
+            d_Q_5_27 += -d_R_59 * R_27;
+            d_R_25 += -d_R_59 * C_25_34;
+            d_C_25_34 += -d_R_59 * R_25;
+            d_R_19 += -d_R_59 * C_19_40;
+            d_C_19_40 += -d_R_59 * R_19;
+            d_R_17 += -d_R_59 * C_17_42;
+            d_C_17_42 += -d_R_59 * R_17;
+            d_R_11 += -d_R_59 * C_11_48;
+            d_C_11_48 += -d_R_59 * R_11;
+            d_R_9 += -d_R_59 * C_9_50;
+            d_C_9_50 += -d_R_59 * R_9;
+            d_R_3 += -d_R_59 * C_3_56;
+            d_C_3_56 += -d_R_59 * R_3;
+            d_C_1_58 += -d_R_59;
+            double d_C_1_26 = d_C_1_58 * q_0_5;
+            d_q_0_5 += d_C_1_58 * C_1_26;
+            double d_C_3_24 = d_C_3_56 * Q_5_3;
+            d_Q_5_3 += d_C_3_56 * C_3_24;
+            double d_C_9_18 = d_C_9_50 * Q_5_9;
+            d_Q_5_9 += d_C_9_50 * C_9_18;
+            d_Q_4_11 += d_C_11_48 * Q_5_11;
+            d_Q_5_11 += d_C_11_48 * Q_4_11;
+            double d_C_17_10 = d_C_17_42 * Q_5_17;
+            d_Q_5_17 += d_C_17_42 * C_17_10;
+            d_Q_3_19 += d_C_19_40 * Q_5_19;
+            d_Q_5_19 += d_C_19_40 * Q_3_19;
+            d_Q_1_25 += d_C_25_34 * Q_5_25;
+            d_Q_5_25 += d_C_25_34 * Q_1_25;
+            double d_C_33_10 = d_C_33_26 * Q_4_33;
+            d_Q_4_33 += d_C_33_26 * C_33_10;
+            d_Q_3_35 += d_C_35_24 * Q_4_35;
+            d_Q_4_35 += d_C_35_24 * Q_3_35;
+            d_Q_1_41 += d_C_41_18 * Q_4_41;
+            d_Q_4_41 += d_C_41_18 * Q_1_41;
+            d_Q_1_49 += d_C_49_10 * Q_3_49;
+            d_Q_3_49 += d_C_49_10 * Q_1_49;
+            double d_C_65_26 = d_C_65_58 * Q_5_65;
+            d_Q_5_65 += d_C_65_58 * C_65_26;
+            double d_C_67_24 = d_C_67_56 * Q_5_67;
+            d_Q_5_67 += d_C_67_56 * C_67_24;
+            double d_C_73_18 = d_C_73_50 * Q_5_73;
+            d_Q_5_73 += d_C_73_50 * C_73_18;
+            d_Q_4_75 += d_C_75_48 * Q_5_75;
+            d_Q_5_75 += d_C_75_48 * Q_4_75;
+            double d_C_81_10 = d_C_81_42 * Q_5_81;
+            d_Q_5_81 += d_C_81_42 * C_81_10;
+            d_Q_3_83 += d_C_83_40 * Q_5_83;
+            d_Q_5_83 += d_C_83_40 * Q_3_83;
+            d_Q_1_89 += d_C_89_34 * Q_5_89;
+            d_Q_5_89 += d_C_89_34 * Q_1_89;
+            d_Q_5_27 += d_Q_5_91 * q_5_6;
+            d_q_5_6 += d_Q_5_91 * Q_5_27;
+            d_Q_5_11 += d_Q_5_27 * q_4_5;
+            d_q_4_5 += d_Q_5_27 * Q_5_11;
+            d_R_89 += -d_R_91 * Q_1_89;
+            d_Q_1_89 += -d_R_91 * R_89;
+            d_R_83 += -d_R_91 * Q_3_83;
+            d_Q_3_83 += -d_R_91 * R_83;
+            d_R_81 += -d_R_91 * C_81_10;
+            d_C_81_10 += -d_R_91 * R_81;
+            d_R_75 += -d_R_91 * Q_4_75;
+            d_Q_4_75 += -d_R_91 * R_75;
+            d_R_73 += -d_R_91 * C_73_18;
+            d_C_73_18 += -d_R_91 * R_73;
+            d_R_67 += -d_R_91 * C_67_24;
+            d_C_67_24 += -d_R_91 * R_67;
+            d_R_65 += -d_R_91 * C_65_26;
+            d_C_65_26 += -d_R_91 * R_65;
+            d_R_27 += -d_R_91 * Q_6_27;
+            d_Q_6_27 += -d_R_91 * R_27;
+            d_R_25 += -d_R_91 * C_25_66;
+            double d_C_25_66 = -d_R_91 * R_25;
+            d_R_19 += -d_R_91 * C_19_72;
+            double d_C_19_72 = -d_R_91 * R_19;
+            d_R_17 += -d_R_91 * C_17_74;
+            double d_C_17_74 = -d_R_91 * R_17;
+            d_R_11 += -d_R_91 * C_11_80;
+            double d_C_11_80 = -d_R_91 * R_11;
+            d_R_9 += -d_R_91 * C_9_82;
+            double d_C_9_82 = -d_R_91 * R_9;
+            d_R_3 += -d_R_91 * C_3_88;
+            double d_C_3_88 = -d_R_91 * R_3;
+            double d_C_1_90 = -d_R_91;
+            d_C_1_26 += d_C_1_90 * q_0_6;
+            d_q_0_6 += d_C_1_90 * C_1_26;
+            d_C_3_24 += d_C_3_88 * Q_6_3;
+            d_Q_6_3 += d_C_3_88 * C_3_24;
+            d_C_9_18 += d_C_9_82 * Q_6_9;
+            d_Q_6_9 += d_C_9_82 * C_9_18;
+            d_Q_4_11 += d_C_11_80 * Q_6_11;
+            d_Q_6_11 += d_C_11_80 * Q_4_11;
+            d_C_17_10 += d_C_17_74 * Q_6_17;
+            d_Q_6_17 += d_C_17_74 * C_17_10;
+            d_Q_3_19 += d_C_19_72 * Q_6_19;
+            d_Q_6_19 += d_C_19_72 * Q_3_19;
+            d_Q_1_25 += d_C_25_66 * Q_6_25;
+            d_Q_6_25 += d_C_25_66 * Q_1_25;
+            d_Q_6_11 += d_Q_6_27 * q_4_6;
+            d_q_4_6 += d_Q_6_27 * Q_6_11;
+            d_R_25 += -d_R_27 * Q_1_25;
+            d_Q_1_25 += -d_R_27 * R_25;
+            d_R_19 += -d_R_27 * Q_3_19;
+            d_Q_3_19 += -d_R_27 * R_19;
+            d_R_17 += -d_R_27 * C_17_10;
+            d_C_17_10 += -d_R_27 * R_17;
+            d_R_11 += -d_R_27 * Q_4_11;
+            d_Q_4_11 += -d_R_27 * R_11;
+            d_R_9 += -d_R_27 * C_9_18;
+            d_C_9_18 += -d_R_27 * R_9;
+            d_R_3 += -d_R_27 * C_3_24;
+            d_C_3_24 += -d_R_27 * R_3;
+            d_C_1_26 += -d_R_27;
+            double d_C_1_10 = d_C_1_26 * q_0_4;
+            d_q_0_4 += d_C_1_26 * C_1_10;
+            d_Q_3_3 += d_C_3_24 * Q_4_3;
+            d_Q_4_3 += d_C_3_24 * Q_3_3;
+            d_Q_1_9 += d_C_9_18 * Q_4_9;
+            d_Q_4_9 += d_C_9_18 * Q_1_9;
+            d_Q_1_17 += d_C_17_10 * Q_3_17;
+            d_Q_3_17 += d_C_17_10 * Q_1_17;
+            double d_C_65_10 = d_C_65_26 * Q_4_65;
+            d_Q_4_65 += d_C_65_26 * C_65_10;
+            d_Q_3_67 += d_C_67_24 * Q_4_67;
+            d_Q_4_67 += d_C_67_24 * Q_3_67;
+            d_Q_1_73 += d_C_73_18 * Q_4_73;
+            d_Q_4_73 += d_C_73_18 * Q_1_73;
+            d_Q_4_11 += d_Q_4_75 * q_4_6;
+            d_q_4_6 += d_Q_4_75 * Q_4_11;
+            d_Q_1_81 += d_C_81_10 * Q_3_81;
+            d_Q_3_81 += d_C_81_10 * Q_1_81;
+            d_Q_3_19 += d_Q_3_83 * q_3_6;
+            d_q_3_6 += d_Q_3_83 * Q_3_19;
+            d_Q_1_25 += d_Q_1_89 * q_1_6;
+            d_q_1_6 += d_Q_1_89 * Q_1_25;
+            double d_C_97_10 = d_C_97_26 * Q_4_97;
+            d_Q_4_97 += d_C_97_26 * C_97_10;
+            d_Q_3_99 += d_C_99_24 * Q_4_99;
+            d_Q_4_99 += d_C_99_24 * Q_3_99;
+            d_Q_1_105 += d_C_105_18 * Q_4_105;
+            d_Q_4_105 += d_C_105_18 * Q_1_105;
+            d_Q_4_43 += d_Q_4_107 * q_4_6;
+            d_q_4_6 += d_Q_4_107 * Q_4_43;
+            d_Q_4_11 += d_Q_4_43 * q_4_5;
+            d_q_4_5 += d_Q_4_43 * Q_4_11;
+            d_Q_4_3 += d_Q_4_11 * q_3_4;
+            d_q_3_4 += d_Q_4_11 * Q_4_3;
+            d_R_105 += -d_R_107 * Q_1_105;
+            d_Q_1_105 += -d_R_107 * R_105;
+            d_R_99 += -d_R_107 * Q_3_99;
+            d_Q_3_99 += -d_R_107 * R_99;
+            d_R_97 += -d_R_107 * C_97_10;
+            d_C_97_10 += -d_R_107 * R_97;
+            d_R_75 += -d_R_107 * Q_5_75;
+            d_Q_5_75 += -d_R_107 * R_75;
+            d_R_73 += -d_R_107 * C_73_34;
+            double d_C_73_34 = -d_R_107 * R_73;
+            d_R_67 += -d_R_107 * C_67_40;
+            double d_C_67_40 = -d_R_107 * R_67;
+            d_R_65 += -d_R_107 * C_65_42;
+            double d_C_65_42 = -d_R_107 * R_65;
+            d_R_43 += -d_R_107 * Q_6_43;
+            d_Q_6_43 += -d_R_107 * R_43;
+            d_R_41 += -d_R_107 * C_41_66;
+            double d_C_41_66 = -d_R_107 * R_41;
+            d_R_35 += -d_R_107 * C_35_72;
+            double d_C_35_72 = -d_R_107 * R_35;
+            d_R_33 += -d_R_107 * C_33_74;
+            double d_C_33_74 = -d_R_107 * R_33;
+            d_R_11 += -d_R_107 * C_11_96;
+            double d_C_11_96 = -d_R_107 * R_11;
+            d_R_9 += -d_R_107 * C_9_98;
+            double d_C_9_98 = -d_R_107 * R_9;
+            d_R_3 += -d_R_107 * C_3_104;
+            double d_C_3_104 = -d_R_107 * R_3;
+            double d_C_1_106 = -d_R_107;
+            double d_C_1_42 = d_C_1_106 * q_0_6;
+            d_q_0_6 += d_C_1_106 * C_1_42;
+            double d_C_3_40 = d_C_3_104 * Q_6_3;
+            d_Q_6_3 += d_C_3_104 * C_3_40;
+            double d_C_9_34 = d_C_9_98 * Q_6_9;
+            d_Q_6_9 += d_C_9_98 * C_9_34;
+            d_Q_5_11 += d_C_11_96 * Q_6_11;
+            d_Q_6_11 += d_C_11_96 * Q_5_11;
+            d_C_33_10 += d_C_33_74 * Q_6_33;
+            d_Q_6_33 += d_C_33_74 * C_33_10;
+            d_Q_3_35 += d_C_35_72 * Q_6_35;
+            d_Q_6_35 += d_C_35_72 * Q_3_35;
+            d_Q_1_41 += d_C_41_66 * Q_6_41;
+            d_Q_6_41 += d_C_41_66 * Q_1_41;
+            d_Q_6_11 += d_Q_6_43 * q_5_6;
+            d_q_5_6 += d_Q_6_43 * Q_6_11;
+            d_R_41 += -d_R_43 * Q_1_41;
+            d_Q_1_41 += -d_R_43 * R_41;
+            d_R_35 += -d_R_43 * Q_3_35;
+            d_Q_3_35 += -d_R_43 * R_35;
+            d_R_33 += -d_R_43 * C_33_10;
+            d_C_33_10 += -d_R_43 * R_33;
+            d_R_11 += -d_R_43 * Q_5_11;
+            d_Q_5_11 += -d_R_43 * R_11;
+            d_R_9 += -d_R_43 * C_9_34;
+            d_C_9_34 += -d_R_43 * R_9;
+            d_R_3 += -d_R_43 * C_3_40;
+            d_C_3_40 += -d_R_43 * R_3;
+            d_C_1_42 += -d_R_43;
+            d_C_1_10 += d_C_1_42 * q_0_5;
+            d_q_0_5 += d_C_1_42 * C_1_10;
+            d_Q_3_3 += d_C_3_40 * Q_5_3;
+            d_Q_5_3 += d_C_3_40 * Q_3_3;
+            d_Q_1_9 += d_C_9_34 * Q_5_9;
+            d_Q_5_9 += d_C_9_34 * Q_1_9;
+            d_Q_1_33 += d_C_33_10 * Q_3_33;
+            d_Q_3_33 += d_C_33_10 * Q_1_33;
+            d_C_65_10 += d_C_65_42 * Q_5_65;
+            d_Q_5_65 += d_C_65_42 * C_65_10;
+            d_Q_3_67 += d_C_67_40 * Q_5_67;
+            d_Q_5_67 += d_C_67_40 * Q_3_67;
+            d_Q_1_73 += d_C_73_34 * Q_5_73;
+            d_Q_5_73 += d_C_73_34 * Q_1_73;
+            d_Q_5_11 += d_Q_5_75 * q_5_6;
+            d_q_5_6 += d_Q_5_75 * Q_5_11;
+            d_Q_5_3 += d_Q_5_11 * q_3_5;
+            d_q_3_5 += d_Q_5_11 * Q_5_3;
+            d_R_73 += -d_R_75 * Q_1_73;
+            d_Q_1_73 += -d_R_75 * R_73;
+            d_R_67 += -d_R_75 * Q_3_67;
+            d_Q_3_67 += -d_R_75 * R_67;
+            d_R_65 += -d_R_75 * C_65_10;
+            d_C_65_10 += -d_R_75 * R_65;
+            d_R_11 += -d_R_75 * Q_6_11;
+            d_Q_6_11 += -d_R_75 * R_11;
+            d_R_9 += -d_R_75 * C_9_66;
+            double d_C_9_66 = -d_R_75 * R_9;
+            d_R_3 += -d_R_75 * C_3_72;
+            double d_C_3_72 = -d_R_75 * R_3;
+            double d_C_1_74 = -d_R_75;
+            d_C_1_10 += d_C_1_74 * q_0_6;
+            d_q_0_6 += d_C_1_74 * C_1_10;
+            d_Q_3_3 += d_C_3_72 * Q_6_3;
+            d_Q_6_3 += d_C_3_72 * Q_3_3;
+            d_Q_1_9 += d_C_9_66 * Q_6_9;
+            d_Q_6_9 += d_C_9_66 * Q_1_9;
+            d_Q_6_3 += d_Q_6_11 * q_3_6;
+            d_q_3_6 += d_Q_6_11 * Q_6_3;
+            d_R_9 += -d_R_11 * Q_1_9;
+            d_Q_1_9 += -d_R_11 * R_9;
+            d_R_3 += -d_R_11 * Q_3_3;
+            d_Q_3_3 += -d_R_11 * R_3;
+            d_C_1_10 += -d_R_11;
+            d_q_0_1 += d_C_1_10 * q_0_3;
+            d_q_0_3 += d_C_1_10 * q_0_1;
+            d_Q_1_65 += d_C_65_10 * Q_3_65;
+            d_Q_3_65 += d_C_65_10 * Q_1_65;
+            d_Q_3_3 += d_Q_3_67 * q_3_6;
+            d_q_3_6 += d_Q_3_67 * Q_3_3;
+            d_Q_1_9 += d_Q_1_73 * q_1_6;
+            d_q_1_6 += d_Q_1_73 * Q_1_9;
+            d_Q_1_97 += d_C_97_10 * Q_3_97;
+            d_Q_3_97 += d_C_97_10 * Q_1_97;
+            d_Q_3_35 += d_Q_3_99 * q_3_6;
+            d_q_3_6 += d_Q_3_99 * Q_3_35;
+            d_Q_3_3 += d_Q_3_35 * q_3_5;
+            d_q_3_5 += d_Q_3_35 * Q_3_3;
+            d_Q_1_41 += d_Q_1_105 * q_1_6;
+            d_q_1_6 += d_Q_1_105 * Q_1_41;
+            d_Q_1_9 += d_Q_1_41 * q_1_5;
+            d_q_1_5 += d_Q_1_41 * Q_1_9;
+            d_Q_1_113 += d_C_113_10 * Q_3_113;
+            d_Q_3_113 += d_C_113_10 * Q_1_113;
+            d_Q_3_51 += d_Q_3_115 * q_3_6;
+            d_q_3_6 += d_Q_3_115 * Q_3_51;
+            d_Q_3_19 += d_Q_3_51 * q_3_5;
+            d_q_3_5 += d_Q_3_51 * Q_3_19;
+            d_Q_3_3 += d_Q_3_19 * q_3_4;
+            d_q_3_4 += d_Q_3_19 * Q_3_3;
+            d_q_0_3 += d_Q_3_3 * q_1_3;
+            double d_q_1_3 = d_Q_3_3 * q_0_3;
+            d_R_113 += -d_R_115 * Q_1_113;
+            d_Q_1_113 += -d_R_115 * R_113;
+            d_R_99 += -d_R_115 * Q_4_99;
+            d_Q_4_99 += -d_R_115 * R_99;
+            d_R_97 += -d_R_115 * C_97_18;
+            double d_C_97_18 = -d_R_115 * R_97;
+            d_R_83 += -d_R_115 * Q_5_83;
+            d_Q_5_83 += -d_R_115 * R_83;
+            d_R_81 += -d_R_115 * C_81_34;
+            double d_C_81_34 = -d_R_115 * R_81;
+            d_R_67 += -d_R_115 * C_67_48;
+            double d_C_67_48 = -d_R_115 * R_67;
+            d_R_65 += -d_R_115 * C_65_50;
+            double d_C_65_50 = -d_R_115 * R_65;
+            d_R_51 += -d_R_115 * Q_6_51;
+            d_Q_6_51 += -d_R_115 * R_51;
+            d_R_49 += -d_R_115 * C_49_66;
+            double d_C_49_66 = -d_R_115 * R_49;
+            d_R_35 += -d_R_115 * C_35_80;
+            double d_C_35_80 = -d_R_115 * R_35;
+            d_R_33 += -d_R_115 * C_33_82;
+            double d_C_33_82 = -d_R_115 * R_33;
+            d_R_19 += -d_R_115 * C_19_96;
+            double d_C_19_96 = -d_R_115 * R_19;
+            d_R_17 += -d_R_115 * C_17_98;
+            double d_C_17_98 = -d_R_115 * R_17;
+            d_R_3 += -d_R_115 * C_3_112;
+            double d_C_3_112 = -d_R_115 * R_3;
+            double d_C_1_114 = -d_R_115;
+            double d_C_1_50 = d_C_1_114 * q_0_6;
+            d_q_0_6 += d_C_1_114 * C_1_50;
+            double d_C_3_48 = d_C_3_112 * Q_6_3;
+            d_Q_6_3 += d_C_3_112 * C_3_48;
+            double d_C_17_34 = d_C_17_98 * Q_6_17;
+            d_Q_6_17 += d_C_17_98 * C_17_34;
+            d_Q_5_19 += d_C_19_96 * Q_6_19;
+            d_Q_6_19 += d_C_19_96 * Q_5_19;
+            double d_C_33_18 = d_C_33_82 * Q_6_33;
+            d_Q_6_33 += d_C_33_82 * C_33_18;
+            d_Q_4_35 += d_C_35_80 * Q_6_35;
+            d_Q_6_35 += d_C_35_80 * Q_4_35;
+            d_Q_1_49 += d_C_49_66 * Q_6_49;
+            d_Q_6_49 += d_C_49_66 * Q_1_49;
+            d_Q_6_19 += d_Q_6_51 * q_5_6;
+            d_q_5_6 += d_Q_6_51 * Q_6_19;
+            d_R_49 += -d_R_51 * Q_1_49;
+            d_Q_1_49 += -d_R_51 * R_49;
+            d_R_35 += -d_R_51 * Q_4_35;
+            d_Q_4_35 += -d_R_51 * R_35;
+            d_R_33 += -d_R_51 * C_33_18;
+            d_C_33_18 += -d_R_51 * R_33;
+            d_R_19 += -d_R_51 * Q_5_19;
+            d_Q_5_19 += -d_R_51 * R_19;
+            d_R_17 += -d_R_51 * C_17_34;
+            d_C_17_34 += -d_R_51 * R_17;
+            d_R_3 += -d_R_51 * C_3_48;
+            d_C_3_48 += -d_R_51 * R_3;
+            d_C_1_50 += -d_R_51;
+            double d_C_1_18 = d_C_1_50 * q_0_5;
+            d_q_0_5 += d_C_1_50 * C_1_18;
+            d_Q_4_3 += d_C_3_48 * Q_5_3;
+            d_Q_5_3 += d_C_3_48 * Q_4_3;
+            d_Q_1_17 += d_C_17_34 * Q_5_17;
+            d_Q_5_17 += d_C_17_34 * Q_1_17;
+            d_Q_1_33 += d_C_33_18 * Q_4_33;
+            d_Q_4_33 += d_C_33_18 * Q_1_33;
+            double d_C_65_18 = d_C_65_50 * Q_5_65;
+            d_Q_5_65 += d_C_65_50 * C_65_18;
+            d_Q_4_67 += d_C_67_48 * Q_5_67;
+            d_Q_5_67 += d_C_67_48 * Q_4_67;
+            d_Q_1_81 += d_C_81_34 * Q_5_81;
+            d_Q_5_81 += d_C_81_34 * Q_1_81;
+            d_Q_5_19 += d_Q_5_83 * q_5_6;
+            d_q_5_6 += d_Q_5_83 * Q_5_19;
+            d_Q_5_3 += d_Q_5_19 * q_4_5;
+            d_q_4_5 += d_Q_5_19 * Q_5_3;
+            d_R_81 += -d_R_83 * Q_1_81;
+            d_Q_1_81 += -d_R_83 * R_81;
+            d_R_67 += -d_R_83 * Q_4_67;
+            d_Q_4_67 += -d_R_83 * R_67;
+            d_R_65 += -d_R_83 * C_65_18;
+            d_C_65_18 += -d_R_83 * R_65;
+            d_R_19 += -d_R_83 * Q_6_19;
+            d_Q_6_19 += -d_R_83 * R_19;
+            d_R_17 += -d_R_83 * C_17_66;
+            double d_C_17_66 = -d_R_83 * R_17;
+            d_R_3 += -d_R_83 * C_3_80;
+            double d_C_3_80 = -d_R_83 * R_3;
+            double d_C_1_82 = -d_R_83;
+            d_C_1_18 += d_C_1_82 * q_0_6;
+            d_q_0_6 += d_C_1_82 * C_1_18;
+            d_Q_4_3 += d_C_3_80 * Q_6_3;
+            d_Q_6_3 += d_C_3_80 * Q_4_3;
+            d_Q_1_17 += d_C_17_66 * Q_6_17;
+            d_Q_6_17 += d_C_17_66 * Q_1_17;
+            d_Q_6_3 += d_Q_6_19 * q_4_6;
+            d_q_4_6 += d_Q_6_19 * Q_6_3;
+            d_R_17 += -d_R_19 * Q_1_17;
+            d_Q_1_17 += -d_R_19 * R_17;
+            d_R_3 += -d_R_19 * Q_4_3;
+            d_Q_4_3 += -d_R_19 * R_3;
+            d_C_1_18 += -d_R_19;
+            d_q_0_1 += d_C_1_18 * q_0_4;
+            d_q_0_4 += d_C_1_18 * q_0_1;
+            d_Q_1_65 += d_C_65_18 * Q_4_65;
+            d_Q_4_65 += d_C_65_18 * Q_1_65;
+            d_Q_4_3 += d_Q_4_67 * q_4_6;
+            d_q_4_6 += d_Q_4_67 * Q_4_3;
+            d_Q_1_17 += d_Q_1_81 * q_1_6;
+            d_q_1_6 += d_Q_1_81 * Q_1_17;
+            d_Q_1_97 += d_C_97_18 * Q_4_97;
+            d_Q_4_97 += d_C_97_18 * Q_1_97;
+            d_Q_4_35 += d_Q_4_99 * q_4_6;
+            d_q_4_6 += d_Q_4_99 * Q_4_35;
+            d_Q_4_3 += d_Q_4_35 * q_4_5;
+            d_q_4_5 += d_Q_4_35 * Q_4_3;
+            d_q_0_4 += d_Q_4_3 * q_1_4;
+            d_q_1_4 += d_Q_4_3 * q_0_4;
+            d_R_97 += -d_R_99 * Q_1_97;
+            d_Q_1_97 += -d_R_99 * R_97;
+            d_R_67 += -d_R_99 * Q_5_67;
+            d_Q_5_67 += -d_R_99 * R_67;
+            d_R_65 += -d_R_99 * C_65_34;
+            double d_C_65_34 = -d_R_99 * R_65;
+            d_R_35 += -d_R_99 * Q_6_35;
+            d_Q_6_35 += -d_R_99 * R_35;
+            d_R_33 += -d_R_99 * C_33_66;
+            double d_C_33_66 = -d_R_99 * R_33;
+            d_R_3 += -d_R_99 * C_3_96;
+            double d_C_3_96 = -d_R_99 * R_3;
+            double d_C_1_98 = -d_R_99;
+            double d_C_1_34 = d_C_1_98 * q_0_6;
+            d_q_0_6 += d_C_1_98 * C_1_34;
+            d_Q_5_3 += d_C_3_96 * Q_6_3;
+            d_Q_6_3 += d_C_3_96 * Q_5_3;
+            d_Q_1_33 += d_C_33_66 * Q_6_33;
+            d_Q_6_33 += d_C_33_66 * Q_1_33;
+            d_Q_6_3 += d_Q_6_35 * q_5_6;
+            d_q_5_6 += d_Q_6_35 * Q_6_3;
+            d_R_33 += -d_R_35 * Q_1_33;
+            d_Q_1_33 += -d_R_35 * R_33;
+            d_R_3 += -d_R_35 * Q_5_3;
+            d_Q_5_3 += -d_R_35 * R_3;
+            d_C_1_34 += -d_R_35;
+            d_q_0_1 += d_C_1_34 * q_0_5;
+            d_q_0_5 += d_C_1_34 * q_0_1;
+            d_Q_1_65 += d_C_65_34 * Q_5_65;
+            d_Q_5_65 += d_C_65_34 * Q_1_65;
+            d_Q_5_3 += d_Q_5_67 * q_5_6;
+            d_q_5_6 += d_Q_5_67 * Q_5_3;
+            d_q_0_5 += d_Q_5_3 * q_1_5;
+            d_q_1_5 += d_Q_5_3 * q_0_5;
+            d_R_65 += -d_R_67 * Q_1_65;
+            d_Q_1_65 += -d_R_67 * R_65;
+            d_R_3 += -d_R_67 * Q_6_3;
+            d_Q_6_3 += -d_R_67 * R_3;
+            double d_C_1_66 = -d_R_67;
+            d_q_0_1 += d_C_1_66 * q_0_6;
+            d_q_0_6 += d_C_1_66 * q_0_1;
+            d_q_0_6 += d_Q_6_3 * q_1_6;
+            d_q_1_6 += d_Q_6_3 * q_0_6;
+            d_q_0_1 += -d_R_3;
+            d_q_0_1 += d_Q_1_65 * q_1_6;
+            d_q_1_6 += d_Q_1_65 * q_0_1;
+            d_Q_1_33 += d_Q_1_97 * q_1_6;
+            d_q_1_6 += d_Q_1_97 * Q_1_33;
+            d_q_0_1 += d_Q_1_33 * q_1_5;
+            d_q_1_5 += d_Q_1_33 * q_0_1;
+            d_Q_1_49 += d_Q_1_113 * q_1_6;
+            d_q_1_6 += d_Q_1_113 * Q_1_49;
+            d_Q_1_17 += d_Q_1_49 * q_1_5;
+            d_q_1_5 += d_Q_1_49 * Q_1_17;
+            d_q_0_1 += d_Q_1_17 * q_1_4;
+            d_q_1_4 += d_Q_1_17 * q_0_1;
+            d_Q_1_57 += d_Q_1_121 * q_1_6;
+            d_q_1_6 += d_Q_1_121 * Q_1_57;
+            d_Q_1_25 += d_Q_1_57 * q_1_5;
+            d_q_1_5 += d_Q_1_57 * Q_1_25;
+            d_Q_1_9 += d_Q_1_25 * q_1_4;
+            d_q_1_4 += d_Q_1_25 * Q_1_9;
+            d_q_0_1 += d_Q_1_9 * q_1_3;
+            d_q_1_3 += d_Q_1_9 * q_0_1;
+            d_Q_1_61 += d_Q_1_125 * q_1_6;
+            d_q_1_6 += d_Q_1_125 * Q_1_61;
+            d_Q_1_29 += d_Q_1_61 * q_1_5;
+            d_q_1_5 += d_Q_1_61 * Q_1_29;
+            d_Q_1_13 += d_Q_1_29 * q_1_4;
+            d_q_1_4 += d_Q_1_29 * Q_1_13;
+            d_Q_1_5 += d_Q_1_13 * q_1_3;
+            d_q_1_3 += d_Q_1_13 * Q_1_5;
+            d_q_0_1 += d_Q_1_5 * q_1_2;
+            d_q_1_2 += d_Q_1_5 * q_0_1;
+            d_R_121 += -d_R_125 * Q_2_121;
+            d_Q_2_121 += -d_R_125 * R_121;
+            d_R_117 += -d_R_125 * Q_3_117;
+            d_Q_3_117 += -d_R_125 * R_117;
+            d_R_113 += -d_R_125 * C_113_12;
+            double d_C_113_12 = -d_R_125 * R_113;
+            d_R_109 += -d_R_125 * Q_4_109;
+            d_Q_4_109 += -d_R_125 * R_109;
+            d_R_105 += -d_R_125 * C_105_20;
+            double d_C_105_20 = -d_R_125 * R_105;
+            d_R_101 += -d_R_125 * C_101_24;
+            double d_C_101_24 = -d_R_125 * R_101;
+            d_R_97 += -d_R_125 * C_97_28;
+            double d_C_97_28 = -d_R_125 * R_97;
+            d_R_93 += -d_R_125 * Q_5_93;
+            d_Q_5_93 += -d_R_125 * R_93;
+            d_R_89 += -d_R_125 * C_89_36;
+            double d_C_89_36 = -d_R_125 * R_89;
+            d_R_85 += -d_R_125 * C_85_40;
+            double d_C_85_40 = -d_R_125 * R_85;
+            d_R_81 += -d_R_125 * C_81_44;
+            double d_C_81_44 = -d_R_125 * R_81;
+            d_R_77 += -d_R_125 * C_77_48;
+            double d_C_77_48 = -d_R_125 * R_77;
+            d_R_73 += -d_R_125 * C_73_52;
+            double d_C_73_52 = -d_R_125 * R_73;
+            d_R_69 += -d_R_125 * C_69_56;
+            double d_C_69_56 = -d_R_125 * R_69;
+            d_R_65 += -d_R_125 * C_65_60;
+            double d_C_65_60 = -d_R_125 * R_65;
+            d_R_61 += -d_R_125 * Q_6_61;
+            d_Q_6_61 += -d_R_125 * R_61;
+            d_R_57 += -d_R_125 * C_57_68;
+            double d_C_57_68 = -d_R_125 * R_57;
+            d_R_53 += -d_R_125 * C_53_72;
+            double d_C_53_72 = -d_R_125 * R_53;
+            d_R_49 += -d_R_125 * C_49_76;
+            double d_C_49_76 = -d_R_125 * R_49;
+            d_R_45 += -d_R_125 * C_45_80;
+            double d_C_45_80 = -d_R_125 * R_45;
+            d_R_41 += -d_R_125 * C_41_84;
+            double d_C_41_84 = -d_R_125 * R_41;
+            d_R_37 += -d_R_125 * C_37_88;
+            double d_C_37_88 = -d_R_125 * R_37;
+            d_R_33 += -d_R_125 * C_33_92;
+            double d_C_33_92 = -d_R_125 * R_33;
+            d_R_29 += -d_R_125 * C_29_96;
+            double d_C_29_96 = -d_R_125 * R_29;
+            d_R_25 += -d_R_125 * C_25_100;
+            double d_C_25_100 = -d_R_125 * R_25;
+            d_R_21 += -d_R_125 * C_21_104;
+            double d_C_21_104 = -d_R_125 * R_21;
+            d_R_17 += -d_R_125 * C_17_108;
+            double d_C_17_108 = -d_R_125 * R_17;
+            d_R_13 += -d_R_125 * C_13_112;
+            double d_C_13_112 = -d_R_125 * R_13;
+            d_R_9 += -d_R_125 * C_9_116;
+            double d_C_9_116 = -d_R_125 * R_9;
+            d_R_5 += -d_R_125 * C_5_120;
+            double d_C_5_120 = -d_R_125 * R_5;
+            double d_C_1_124 = -d_R_125;
+            double d_C_1_60 = d_C_1_124 * q_0_6;
+            d_q_0_6 += d_C_1_124 * C_1_60;
+            double d_C_5_56 = d_C_5_120 * Q_6_5;
+            d_Q_6_5 += d_C_5_120 * C_5_56;
+            double d_C_9_52 = d_C_9_116 * Q_6_9;
+            d_Q_6_9 += d_C_9_116 * C_9_52;
+            double d_C_13_48 = d_C_13_112 * Q_6_13;
+            d_Q_6_13 += d_C_13_112 * C_13_48;
+            double d_C_17_44 = d_C_17_108 * Q_6_17;
+            d_Q_6_17 += d_C_17_108 * C_17_44;
+            double d_C_21_40 = d_C_21_104 * Q_6_21;
+            d_Q_6_21 += d_C_21_104 * C_21_40;
+            double d_C_25_36 = d_C_25_100 * Q_6_25;
+            d_Q_6_25 += d_C_25_100 * C_25_36;
+            d_Q_5_29 += d_C_29_96 * Q_6_29;
+            d_Q_6_29 += d_C_29_96 * Q_5_29;
+            double d_C_33_28 = d_C_33_92 * Q_6_33;
+            d_Q_6_33 += d_C_33_92 * C_33_28;
+            double d_C_37_24 = d_C_37_88 * Q_6_37;
+            d_Q_6_37 += d_C_37_88 * C_37_24;
+            double d_C_41_20 = d_C_41_84 * Q_6_41;
+            d_Q_6_41 += d_C_41_84 * C_41_20;
+            d_Q_4_45 += d_C_45_80 * Q_6_45;
+            d_Q_6_45 += d_C_45_80 * Q_4_45;
+            double d_C_49_12 = d_C_49_76 * Q_6_49;
+            d_Q_6_49 += d_C_49_76 * C_49_12;
+            d_Q_3_53 += d_C_53_72 * Q_6_53;
+            d_Q_6_53 += d_C_53_72 * Q_3_53;
+            d_Q_2_57 += d_C_57_68 * Q_6_57;
+            d_Q_6_57 += d_C_57_68 * Q_2_57;
+            d_Q_6_29 += d_Q_6_61 * q_5_6;
+            d_q_5_6 += d_Q_6_61 * Q_6_29;
+            d_R_57 += -d_R_61 * Q_2_57;
+            d_Q_2_57 += -d_R_61 * R_57;
+            d_R_53 += -d_R_61 * Q_3_53;
+            d_Q_3_53 += -d_R_61 * R_53;
+            d_R_49 += -d_R_61 * C_49_12;
+            d_C_49_12 += -d_R_61 * R_49;
+            d_R_45 += -d_R_61 * Q_4_45;
+            d_Q_4_45 += -d_R_61 * R_45;
+            d_R_41 += -d_R_61 * C_41_20;
+            d_C_41_20 += -d_R_61 * R_41;
+            d_R_37 += -d_R_61 * C_37_24;
+            d_C_37_24 += -d_R_61 * R_37;
+            d_R_33 += -d_R_61 * C_33_28;
+            d_C_33_28 += -d_R_61 * R_33;
+            d_R_29 += -d_R_61 * Q_5_29;
+            d_Q_5_29 += -d_R_61 * R_29;
+            d_R_25 += -d_R_61 * C_25_36;
+            d_C_25_36 += -d_R_61 * R_25;
+            d_R_21 += -d_R_61 * C_21_40;
+            d_C_21_40 += -d_R_61 * R_21;
+            d_R_17 += -d_R_61 * C_17_44;
+            d_C_17_44 += -d_R_61 * R_17;
+            d_R_13 += -d_R_61 * C_13_48;
+            d_C_13_48 += -d_R_61 * R_13;
+            d_R_9 += -d_R_61 * C_9_52;
+            d_C_9_52 += -d_R_61 * R_9;
+            d_R_5 += -d_R_61 * C_5_56;
+            d_C_5_56 += -d_R_61 * R_5;
+            d_C_1_60 += -d_R_61;
+            double d_C_1_28 = d_C_1_60 * q_0_5;
+            d_q_0_5 += d_C_1_60 * C_1_28;
+            double d_C_5_24 = d_C_5_56 * Q_5_5;
+            d_Q_5_5 += d_C_5_56 * C_5_24;
+            double d_C_9_20 = d_C_9_52 * Q_5_9;
+            d_Q_5_9 += d_C_9_52 * C_9_20;
+            d_Q_4_13 += d_C_13_48 * Q_5_13;
+            d_Q_5_13 += d_C_13_48 * Q_4_13;
+            double d_C_17_12 = d_C_17_44 * Q_5_17;
+            d_Q_5_17 += d_C_17_44 * C_17_12;
+            d_Q_3_21 += d_C_21_40 * Q_5_21;
+            d_Q_5_21 += d_C_21_40 * Q_3_21;
+            d_Q_2_25 += d_C_25_36 * Q_5_25;
+            d_Q_5_25 += d_C_25_36 * Q_2_25;
+            double d_C_33_12 = d_C_33_28 * Q_4_33;
+            d_Q_4_33 += d_C_33_28 * C_33_12;
+            d_Q_3_37 += d_C_37_24 * Q_4_37;
+            d_Q_4_37 += d_C_37_24 * Q_3_37;
+            d_Q_2_41 += d_C_41_20 * Q_4_41;
+            d_Q_4_41 += d_C_41_20 * Q_2_41;
+            d_Q_2_49 += d_C_49_12 * Q_3_49;
+            d_Q_3_49 += d_C_49_12 * Q_2_49;
+            double d_C_65_28 = d_C_65_60 * Q_5_65;
+            d_Q_5_65 += d_C_65_60 * C_65_28;
+            double d_C_69_24 = d_C_69_56 * Q_5_69;
+            d_Q_5_69 += d_C_69_56 * C_69_24;
+            double d_C_73_20 = d_C_73_52 * Q_5_73;
+            d_Q_5_73 += d_C_73_52 * C_73_20;
+            d_Q_4_77 += d_C_77_48 * Q_5_77;
+            d_Q_5_77 += d_C_77_48 * Q_4_77;
+            double d_C_81_12 = d_C_81_44 * Q_5_81;
+            d_Q_5_81 += d_C_81_44 * C_81_12;
+            d_Q_3_85 += d_C_85_40 * Q_5_85;
+            d_Q_5_85 += d_C_85_40 * Q_3_85;
+            d_Q_2_89 += d_C_89_36 * Q_5_89;
+            d_Q_5_89 += d_C_89_36 * Q_2_89;
+            d_Q_5_29 += d_Q_5_93 * q_5_6;
+            d_q_5_6 += d_Q_5_93 * Q_5_29;
+            d_Q_5_13 += d_Q_5_29 * q_4_5;
+            d_q_4_5 += d_Q_5_29 * Q_5_13;
+            d_R_89 += -d_R_93 * Q_2_89;
+            d_Q_2_89 += -d_R_93 * R_89;
+            d_R_85 += -d_R_93 * Q_3_85;
+            d_Q_3_85 += -d_R_93 * R_85;
+            d_R_81 += -d_R_93 * C_81_12;
+            d_C_81_12 += -d_R_93 * R_81;
+            d_R_77 += -d_R_93 * Q_4_77;
+            d_Q_4_77 += -d_R_93 * R_77;
+            d_R_73 += -d_R_93 * C_73_20;
+            d_C_73_20 += -d_R_93 * R_73;
+            d_R_69 += -d_R_93 * C_69_24;
+            d_C_69_24 += -d_R_93 * R_69;
+            d_R_65 += -d_R_93 * C_65_28;
+            d_C_65_28 += -d_R_93 * R_65;
+            d_R_29 += -d_R_93 * Q_6_29;
+            d_Q_6_29 += -d_R_93 * R_29;
+            d_R_25 += -d_R_93 * C_25_68;
+            double d_C_25_68 = -d_R_93 * R_25;
+            d_R_21 += -d_R_93 * C_21_72;
+            double d_C_21_72 = -d_R_93 * R_21;
+            d_R_17 += -d_R_93 * C_17_76;
+            double d_C_17_76 = -d_R_93 * R_17;
+            d_R_13 += -d_R_93 * C_13_80;
+            double d_C_13_80 = -d_R_93 * R_13;
+            d_R_9 += -d_R_93 * C_9_84;
+            double d_C_9_84 = -d_R_93 * R_9;
+            d_R_5 += -d_R_93 * C_5_88;
+            double d_C_5_88 = -d_R_93 * R_5;
+            double d_C_1_92 = -d_R_93;
+            d_C_1_28 += d_C_1_92 * q_0_6;
+            d_q_0_6 += d_C_1_92 * C_1_28;
+            d_C_5_24 += d_C_5_88 * Q_6_5;
+            d_Q_6_5 += d_C_5_88 * C_5_24;
+            d_C_9_20 += d_C_9_84 * Q_6_9;
+            d_Q_6_9 += d_C_9_84 * C_9_20;
+            d_Q_4_13 += d_C_13_80 * Q_6_13;
+            d_Q_6_13 += d_C_13_80 * Q_4_13;
+            d_C_17_12 += d_C_17_76 * Q_6_17;
+            d_Q_6_17 += d_C_17_76 * C_17_12;
+            d_Q_3_21 += d_C_21_72 * Q_6_21;
+            d_Q_6_21 += d_C_21_72 * Q_3_21;
+            d_Q_2_25 += d_C_25_68 * Q_6_25;
+            d_Q_6_25 += d_C_25_68 * Q_2_25;
+            d_Q_6_13 += d_Q_6_29 * q_4_6;
+            d_q_4_6 += d_Q_6_29 * Q_6_13;
+            d_R_25 += -d_R_29 * Q_2_25;
+            d_Q_2_25 += -d_R_29 * R_25;
+            d_R_21 += -d_R_29 * Q_3_21;
+            d_Q_3_21 += -d_R_29 * R_21;
+            d_R_17 += -d_R_29 * C_17_12;
+            d_C_17_12 += -d_R_29 * R_17;
+            d_R_13 += -d_R_29 * Q_4_13;
+            d_Q_4_13 += -d_R_29 * R_13;
+            d_R_9 += -d_R_29 * C_9_20;
+            d_C_9_20 += -d_R_29 * R_9;
+            d_R_5 += -d_R_29 * C_5_24;
+            d_C_5_24 += -d_R_29 * R_5;
+            d_C_1_28 += -d_R_29;
+            double d_C_1_12 = d_C_1_28 * q_0_4;
+            d_q_0_4 += d_C_1_28 * C_1_12;
+            d_Q_3_5 += d_C_5_24 * Q_4_5;
+            d_Q_4_5 += d_C_5_24 * Q_3_5;
+            d_Q_2_9 += d_C_9_20 * Q_4_9;
+            d_Q_4_9 += d_C_9_20 * Q_2_9;
+            d_Q_2_17 += d_C_17_12 * Q_3_17;
+            d_Q_3_17 += d_C_17_12 * Q_2_17;
+            double d_C_65_12 = d_C_65_28 * Q_4_65;
+            d_Q_4_65 += d_C_65_28 * C_65_12;
+            d_Q_3_69 += d_C_69_24 * Q_4_69;
+            d_Q_4_69 += d_C_69_24 * Q_3_69;
+            d_Q_2_73 += d_C_73_20 * Q_4_73;
+            d_Q_4_73 += d_C_73_20 * Q_2_73;
+            d_Q_4_13 += d_Q_4_77 * q_4_6;
+            d_q_4_6 += d_Q_4_77 * Q_4_13;
+            d_Q_2_81 += d_C_81_12 * Q_3_81;
+            d_Q_3_81 += d_C_81_12 * Q_2_81;
+            d_Q_3_21 += d_Q_3_85 * q_3_6;
+            d_q_3_6 += d_Q_3_85 * Q_3_21;
+            d_Q_2_25 += d_Q_2_89 * q_2_6;
+            d_q_2_6 += d_Q_2_89 * Q_2_25;
+            double d_C_97_12 = d_C_97_28 * Q_4_97;
+            d_Q_4_97 += d_C_97_28 * C_97_12;
+            d_Q_3_101 += d_C_101_24 * Q_4_101;
+            d_Q_4_101 += d_C_101_24 * Q_3_101;
+            d_Q_2_105 += d_C_105_20 * Q_4_105;
+            d_Q_4_105 += d_C_105_20 * Q_2_105;
+            d_Q_4_45 += d_Q_4_109 * q_4_6;
+            d_q_4_6 += d_Q_4_109 * Q_4_45;
+            d_Q_4_13 += d_Q_4_45 * q_4_5;
+            d_q_4_5 += d_Q_4_45 * Q_4_13;
+            d_Q_4_5 += d_Q_4_13 * q_3_4;
+            d_q_3_4 += d_Q_4_13 * Q_4_5;
+            d_R_105 += -d_R_109 * Q_2_105;
+            d_Q_2_105 += -d_R_109 * R_105;
+            d_R_101 += -d_R_109 * Q_3_101;
+            d_Q_3_101 += -d_R_109 * R_101;
+            d_R_97 += -d_R_109 * C_97_12;
+            d_C_97_12 += -d_R_109 * R_97;
+            d_R_77 += -d_R_109 * Q_5_77;
+            d_Q_5_77 += -d_R_109 * R_77;
+            d_R_73 += -d_R_109 * C_73_36;
+            double d_C_73_36 = -d_R_109 * R_73;
+            d_R_69 += -d_R_109 * C_69_40;
+            double d_C_69_40 = -d_R_109 * R_69;
+            d_R_65 += -d_R_109 * C_65_44;
+            double d_C_65_44 = -d_R_109 * R_65;
+            d_R_45 += -d_R_109 * Q_6_45;
+            d_Q_6_45 += -d_R_109 * R_45;
+            d_R_41 += -d_R_109 * C_41_68;
+            double d_C_41_68 = -d_R_109 * R_41;
+            d_R_37 += -d_R_109 * C_37_72;
+            double d_C_37_72 = -d_R_109 * R_37;
+            d_R_33 += -d_R_109 * C_33_76;
+            double d_C_33_76 = -d_R_109 * R_33;
+            d_R_13 += -d_R_109 * C_13_96;
+            double d_C_13_96 = -d_R_109 * R_13;
+            d_R_9 += -d_R_109 * C_9_100;
+            double d_C_9_100 = -d_R_109 * R_9;
+            d_R_5 += -d_R_109 * C_5_104;
+            double d_C_5_104 = -d_R_109 * R_5;
+            double d_C_1_108 = -d_R_109;
+            double d_C_1_44 = d_C_1_108 * q_0_6;
+            d_q_0_6 += d_C_1_108 * C_1_44;
+            double d_C_5_40 = d_C_5_104 * Q_6_5;
+            d_Q_6_5 += d_C_5_104 * C_5_40;
+            double d_C_9_36 = d_C_9_100 * Q_6_9;
+            d_Q_6_9 += d_C_9_100 * C_9_36;
+            d_Q_5_13 += d_C_13_96 * Q_6_13;
+            d_Q_6_13 += d_C_13_96 * Q_5_13;
+            d_C_33_12 += d_C_33_76 * Q_6_33;
+            d_Q_6_33 += d_C_33_76 * C_33_12;
+            d_Q_3_37 += d_C_37_72 * Q_6_37;
+            d_Q_6_37 += d_C_37_72 * Q_3_37;
+            d_Q_2_41 += d_C_41_68 * Q_6_41;
+            d_Q_6_41 += d_C_41_68 * Q_2_41;
+            d_Q_6_13 += d_Q_6_45 * q_5_6;
+            d_q_5_6 += d_Q_6_45 * Q_6_13;
+            d_R_41 += -d_R_45 * Q_2_41;
+            d_Q_2_41 += -d_R_45 * R_41;
+            d_R_37 += -d_R_45 * Q_3_37;
+            d_Q_3_37 += -d_R_45 * R_37;
+            d_R_33 += -d_R_45 * C_33_12;
+            d_C_33_12 += -d_R_45 * R_33;
+            d_R_13 += -d_R_45 * Q_5_13;
+            d_Q_5_13 += -d_R_45 * R_13;
+            d_R_9 += -d_R_45 * C_9_36;
+            d_C_9_36 += -d_R_45 * R_9;
+            d_R_5 += -d_R_45 * C_5_40;
+            d_C_5_40 += -d_R_45 * R_5;
+            d_C_1_44 += -d_R_45;
+            d_C_1_12 += d_C_1_44 * q_0_5;
+            d_q_0_5 += d_C_1_44 * C_1_12;
+            d_Q_3_5 += d_C_5_40 * Q_5_5;
+            d_Q_5_5 += d_C_5_40 * Q_3_5;
+            d_Q_2_9 += d_C_9_36 * Q_5_9;
+            d_Q_5_9 += d_C_9_36 * Q_2_9;
+            d_Q_2_33 += d_C_33_12 * Q_3_33;
+            d_Q_3_33 += d_C_33_12 * Q_2_33;
+            d_C_65_12 += d_C_65_44 * Q_5_65;
+            d_Q_5_65 += d_C_65_44 * C_65_12;
+            d_Q_3_69 += d_C_69_40 * Q_5_69;
+            d_Q_5_69 += d_C_69_40 * Q_3_69;
+            d_Q_2_73 += d_C_73_36 * Q_5_73;
+            d_Q_5_73 += d_C_73_36 * Q_2_73;
+            d_Q_5_13 += d_Q_5_77 * q_5_6;
+            d_q_5_6 += d_Q_5_77 * Q_5_13;
+            d_Q_5_5 += d_Q_5_13 * q_3_5;
+            d_q_3_5 += d_Q_5_13 * Q_5_5;
+            d_R_73 += -d_R_77 * Q_2_73;
+            d_Q_2_73 += -d_R_77 * R_73;
+            d_R_69 += -d_R_77 * Q_3_69;
+            d_Q_3_69 += -d_R_77 * R_69;
+            d_R_65 += -d_R_77 * C_65_12;
+            d_C_65_12 += -d_R_77 * R_65;
+            d_R_13 += -d_R_77 * Q_6_13;
+            d_Q_6_13 += -d_R_77 * R_13;
+            d_R_9 += -d_R_77 * C_9_68;
+            double d_C_9_68 = -d_R_77 * R_9;
+            d_R_5 += -d_R_77 * C_5_72;
+            double d_C_5_72 = -d_R_77 * R_5;
+            double d_C_1_76 = -d_R_77;
+            d_C_1_12 += d_C_1_76 * q_0_6;
+            d_q_0_6 += d_C_1_76 * C_1_12;
+            d_Q_3_5 += d_C_5_72 * Q_6_5;
+            d_Q_6_5 += d_C_5_72 * Q_3_5;
+            d_Q_2_9 += d_C_9_68 * Q_6_9;
+            d_Q_6_9 += d_C_9_68 * Q_2_9;
+            d_Q_6_5 += d_Q_6_13 * q_3_6;
+            d_q_3_6 += d_Q_6_13 * Q_6_5;
+            d_R_9 += -d_R_13 * Q_2_9;
+            d_Q_2_9 += -d_R_13 * R_9;
+            d_R_5 += -d_R_13 * Q_3_5;
+            d_Q_3_5 += -d_R_13 * R_5;
+            d_C_1_12 += -d_R_13;
+            d_q_0_2 += d_C_1_12 * q_0_3;
+            d_q_0_3 += d_C_1_12 * q_0_2;
+            d_Q_2_65 += d_C_65_12 * Q_3_65;
+            d_Q_3_65 += d_C_65_12 * Q_2_65;
+            d_Q_3_5 += d_Q_3_69 * q_3_6;
+            d_q_3_6 += d_Q_3_69 * Q_3_5;
+            d_Q_2_9 += d_Q_2_73 * q_2_6;
+            d_q_2_6 += d_Q_2_73 * Q_2_9;
+            d_Q_2_97 += d_C_97_12 * Q_3_97;
+            d_Q_3_97 += d_C_97_12 * Q_2_97;
+            d_Q_3_37 += d_Q_3_101 * q_3_6;
+            d_q_3_6 += d_Q_3_101 * Q_3_37;
+            d_Q_3_5 += d_Q_3_37 * q_3_5;
+            d_q_3_5 += d_Q_3_37 * Q_3_5;
+            d_Q_2_41 += d_Q_2_105 * q_2_6;
+            d_q_2_6 += d_Q_2_105 * Q_2_41;
+            d_Q_2_9 += d_Q_2_41 * q_2_5;
+            d_q_2_5 += d_Q_2_41 * Q_2_9;
+            d_Q_2_113 += d_C_113_12 * Q_3_113;
+            d_Q_3_113 += d_C_113_12 * Q_2_113;
+            d_Q_3_53 += d_Q_3_117 * q_3_6;
+            d_q_3_6 += d_Q_3_117 * Q_3_53;
+            d_Q_3_21 += d_Q_3_53 * q_3_5;
+            d_q_3_5 += d_Q_3_53 * Q_3_21;
+            d_Q_3_5 += d_Q_3_21 * q_3_4;
+            d_q_3_4 += d_Q_3_21 * Q_3_5;
+            d_q_0_3 += d_Q_3_5 * q_2_3;
+            d_q_2_3 += d_Q_3_5 * q_0_3;
+            d_R_113 += -d_R_117 * Q_2_113;
+            d_Q_2_113 += -d_R_117 * R_113;
+            d_R_101 += -d_R_117 * Q_4_101;
+            d_Q_4_101 += -d_R_117 * R_101;
+            d_R_97 += -d_R_117 * C_97_20;
+            double d_C_97_20 = -d_R_117 * R_97;
+            d_R_85 += -d_R_117 * Q_5_85;
+            d_Q_5_85 += -d_R_117 * R_85;
+            d_R_81 += -d_R_117 * C_81_36;
+            double d_C_81_36 = -d_R_117 * R_81;
+            d_R_69 += -d_R_117 * C_69_48;
+            double d_C_69_48 = -d_R_117 * R_69;
+            d_R_65 += -d_R_117 * C_65_52;
+            double d_C_65_52 = -d_R_117 * R_65;
+            d_R_53 += -d_R_117 * Q_6_53;
+            d_Q_6_53 += -d_R_117 * R_53;
+            d_R_49 += -d_R_117 * C_49_68;
+            double d_C_49_68 = -d_R_117 * R_49;
+            d_R_37 += -d_R_117 * C_37_80;
+            double d_C_37_80 = -d_R_117 * R_37;
+            d_R_33 += -d_R_117 * C_33_84;
+            double d_C_33_84 = -d_R_117 * R_33;
+            d_R_21 += -d_R_117 * C_21_96;
+            double d_C_21_96 = -d_R_117 * R_21;
+            d_R_17 += -d_R_117 * C_17_100;
+            double d_C_17_100 = -d_R_117 * R_17;
+            d_R_5 += -d_R_117 * C_5_112;
+            double d_C_5_112 = -d_R_117 * R_5;
+            double d_C_1_116 = -d_R_117;
+            double d_C_1_52 = d_C_1_116 * q_0_6;
+            d_q_0_6 += d_C_1_116 * C_1_52;
+            double d_C_5_48 = d_C_5_112 * Q_6_5;
+            d_Q_6_5 += d_C_5_112 * C_5_48;
+            double d_C_17_36 = d_C_17_100 * Q_6_17;
+            d_Q_6_17 += d_C_17_100 * C_17_36;
+            d_Q_5_21 += d_C_21_96 * Q_6_21;
+            d_Q_6_21 += d_C_21_96 * Q_5_21;
+            double d_C_33_20 = d_C_33_84 * Q_6_33;
+            d_Q_6_33 += d_C_33_84 * C_33_20;
+            d_Q_4_37 += d_C_37_80 * Q_6_37;
+            d_Q_6_37 += d_C_37_80 * Q_4_37;
+            d_Q_2_49 += d_C_49_68 * Q_6_49;
+            d_Q_6_49 += d_C_49_68 * Q_2_49;
+            d_Q_6_21 += d_Q_6_53 * q_5_6;
+            d_q_5_6 += d_Q_6_53 * Q_6_21;
+            d_R_49 += -d_R_53 * Q_2_49;
+            d_Q_2_49 += -d_R_53 * R_49;
+            d_R_37 += -d_R_53 * Q_4_37;
+            d_Q_4_37 += -d_R_53 * R_37;
+            d_R_33 += -d_R_53 * C_33_20;
+            d_C_33_20 += -d_R_53 * R_33;
+            d_R_21 += -d_R_53 * Q_5_21;
+            d_Q_5_21 += -d_R_53 * R_21;
+            d_R_17 += -d_R_53 * C_17_36;
+            d_C_17_36 += -d_R_53 * R_17;
+            d_R_5 += -d_R_53 * C_5_48;
+            d_C_5_48 += -d_R_53 * R_5;
+            d_C_1_52 += -d_R_53;
+            double d_C_1_20 = d_C_1_52 * q_0_5;
+            d_q_0_5 += d_C_1_52 * C_1_20;
+            d_Q_4_5 += d_C_5_48 * Q_5_5;
+            d_Q_5_5 += d_C_5_48 * Q_4_5;
+            d_Q_2_17 += d_C_17_36 * Q_5_17;
+            d_Q_5_17 += d_C_17_36 * Q_2_17;
+            d_Q_2_33 += d_C_33_20 * Q_4_33;
+            d_Q_4_33 += d_C_33_20 * Q_2_33;
+            double d_C_65_20 = d_C_65_52 * Q_5_65;
+            d_Q_5_65 += d_C_65_52 * C_65_20;
+            d_Q_4_69 += d_C_69_48 * Q_5_69;
+            d_Q_5_69 += d_C_69_48 * Q_4_69;
+            d_Q_2_81 += d_C_81_36 * Q_5_81;
+            d_Q_5_81 += d_C_81_36 * Q_2_81;
+            d_Q_5_21 += d_Q_5_85 * q_5_6;
+            d_q_5_6 += d_Q_5_85 * Q_5_21;
+            d_Q_5_5 += d_Q_5_21 * q_4_5;
+            d_q_4_5 += d_Q_5_21 * Q_5_5;
+            d_R_81 += -d_R_85 * Q_2_81;
+            d_Q_2_81 += -d_R_85 * R_81;
+            d_R_69 += -d_R_85 * Q_4_69;
+            d_Q_4_69 += -d_R_85 * R_69;
+            d_R_65 += -d_R_85 * C_65_20;
+            d_C_65_20 += -d_R_85 * R_65;
+            d_R_21 += -d_R_85 * Q_6_21;
+            d_Q_6_21 += -d_R_85 * R_21;
+            d_R_17 += -d_R_85 * C_17_68;
+            double d_C_17_68 = -d_R_85 * R_17;
+            d_R_5 += -d_R_85 * C_5_80;
+            double d_C_5_80 = -d_R_85 * R_5;
+            double d_C_1_84 = -d_R_85;
+            d_C_1_20 += d_C_1_84 * q_0_6;
+            d_q_0_6 += d_C_1_84 * C_1_20;
+            d_Q_4_5 += d_C_5_80 * Q_6_5;
+            d_Q_6_5 += d_C_5_80 * Q_4_5;
+            d_Q_2_17 += d_C_17_68 * Q_6_17;
+            d_Q_6_17 += d_C_17_68 * Q_2_17;
+            d_Q_6_5 += d_Q_6_21 * q_4_6;
+            d_q_4_6 += d_Q_6_21 * Q_6_5;
+            d_R_17 += -d_R_21 * Q_2_17;
+            d_Q_2_17 += -d_R_21 * R_17;
+            d_R_5 += -d_R_21 * Q_4_5;
+            d_Q_4_5 += -d_R_21 * R_5;
+            d_C_1_20 += -d_R_21;
+            d_q_0_2 += d_C_1_20 * q_0_4;
+            d_q_0_4 += d_C_1_20 * q_0_2;
+            d_Q_2_65 += d_C_65_20 * Q_4_65;
+            d_Q_4_65 += d_C_65_20 * Q_2_65;
+            d_Q_4_5 += d_Q_4_69 * q_4_6;
+            d_q_4_6 += d_Q_4_69 * Q_4_5;
+            d_Q_2_17 += d_Q_2_81 * q_2_6;
+            d_q_2_6 += d_Q_2_81 * Q_2_17;
+            d_Q_2_97 += d_C_97_20 * Q_4_97;
+            d_Q_4_97 += d_C_97_20 * Q_2_97;
+            d_Q_4_37 += d_Q_4_101 * q_4_6;
+            d_q_4_6 += d_Q_4_101 * Q_4_37;
+            d_Q_4_5 += d_Q_4_37 * q_4_5;
+            d_q_4_5 += d_Q_4_37 * Q_4_5;
+            d_q_0_4 += d_Q_4_5 * q_2_4;
+            d_q_2_4 += d_Q_4_5 * q_0_4;
+            d_R_97 += -d_R_101 * Q_2_97;
+            d_Q_2_97 += -d_R_101 * R_97;
+            d_R_69 += -d_R_101 * Q_5_69;
+            d_Q_5_69 += -d_R_101 * R_69;
+            d_R_65 += -d_R_101 * C_65_36;
+            double d_C_65_36 = -d_R_101 * R_65;
+            d_R_37 += -d_R_101 * Q_6_37;
+            d_Q_6_37 += -d_R_101 * R_37;
+            d_R_33 += -d_R_101 * C_33_68;
+            double d_C_33_68 = -d_R_101 * R_33;
+            d_R_5 += -d_R_101 * C_5_96;
+            double d_C_5_96 = -d_R_101 * R_5;
+            double d_C_1_100 = -d_R_101;
+            double d_C_1_36 = d_C_1_100 * q_0_6;
+            d_q_0_6 += d_C_1_100 * C_1_36;
+            d_Q_5_5 += d_C_5_96 * Q_6_5;
+            d_Q_6_5 += d_C_5_96 * Q_5_5;
+            d_Q_2_33 += d_C_33_68 * Q_6_33;
+            d_Q_6_33 += d_C_33_68 * Q_2_33;
+            d_Q_6_5 += d_Q_6_37 * q_5_6;
+            d_q_5_6 += d_Q_6_37 * Q_6_5;
+            d_R_33 += -d_R_37 * Q_2_33;
+            d_Q_2_33 += -d_R_37 * R_33;
+            d_R_5 += -d_R_37 * Q_5_5;
+            d_Q_5_5 += -d_R_37 * R_5;
+            d_C_1_36 += -d_R_37;
+            d_q_0_2 += d_C_1_36 * q_0_5;
+            d_q_0_5 += d_C_1_36 * q_0_2;
+            d_Q_2_65 += d_C_65_36 * Q_5_65;
+            d_Q_5_65 += d_C_65_36 * Q_2_65;
+            d_Q_5_5 += d_Q_5_69 * q_5_6;
+            d_q_5_6 += d_Q_5_69 * Q_5_5;
+            d_q_0_5 += d_Q_5_5 * q_2_5;
+            d_q_2_5 += d_Q_5_5 * q_0_5;
+            d_R_65 += -d_R_69 * Q_2_65;
+            d_Q_2_65 += -d_R_69 * R_65;
+            d_R_5 += -d_R_69 * Q_6_5;
+            d_Q_6_5 += -d_R_69 * R_5;
+            double d_C_1_68 = -d_R_69;
+            d_q_0_2 += d_C_1_68 * q_0_6;
+            d_q_0_6 += d_C_1_68 * q_0_2;
+            d_q_0_6 += d_Q_6_5 * q_2_6;
+            d_q_2_6 += d_Q_6_5 * q_0_6;
+            d_q_0_2 += -d_R_5;
+            d_q_0_2 += d_Q_2_65 * q_2_6;
+            d_q_2_6 += d_Q_2_65 * q_0_2;
+            d_Q_2_33 += d_Q_2_97 * q_2_6;
+            d_q_2_6 += d_Q_2_97 * Q_2_33;
+            d_q_0_2 += d_Q_2_33 * q_2_5;
+            d_q_2_5 += d_Q_2_33 * q_0_2;
+            d_Q_2_49 += d_Q_2_113 * q_2_6;
+            d_q_2_6 += d_Q_2_113 * Q_2_49;
+            d_Q_2_17 += d_Q_2_49 * q_2_5;
+            d_q_2_5 += d_Q_2_49 * Q_2_17;
+            d_q_0_2 += d_Q_2_17 * q_2_4;
+            d_q_2_4 += d_Q_2_17 * q_0_2;
+            d_Q_2_57 += d_Q_2_121 * q_2_6;
+            d_q_2_6 += d_Q_2_121 * Q_2_57;
+            d_Q_2_25 += d_Q_2_57 * q_2_5;
+            d_q_2_5 += d_Q_2_57 * Q_2_25;
+            d_Q_2_9 += d_Q_2_25 * q_2_4;
+            d_q_2_4 += d_Q_2_25 * Q_2_9;
+            d_q_0_2 += d_Q_2_9 * q_2_3;
+            d_q_2_3 += d_Q_2_9 * q_0_2;
+            d_R_113 += -d_R_121 * Q_3_113;
+            d_Q_3_113 += -d_R_121 * R_113;
+            d_R_105 += -d_R_121 * Q_4_105;
+            d_Q_4_105 += -d_R_121 * R_105;
+            d_R_97 += -d_R_121 * C_97_24;
+            double d_C_97_24 = -d_R_121 * R_97;
+            d_R_89 += -d_R_121 * Q_5_89;
+            d_Q_5_89 += -d_R_121 * R_89;
+            d_R_81 += -d_R_121 * C_81_40;
+            double d_C_81_40 = -d_R_121 * R_81;
+            d_R_73 += -d_R_121 * C_73_48;
+            double d_C_73_48 = -d_R_121 * R_73;
+            d_R_65 += -d_R_121 * C_65_56;
+            double d_C_65_56 = -d_R_121 * R_65;
+            d_R_57 += -d_R_121 * Q_6_57;
+            d_Q_6_57 += -d_R_121 * R_57;
+            d_R_49 += -d_R_121 * C_49_72;
+            double d_C_49_72 = -d_R_121 * R_49;
+            d_R_41 += -d_R_121 * C_41_80;
+            double d_C_41_80 = -d_R_121 * R_41;
+            d_R_33 += -d_R_121 * C_33_88;
+            double d_C_33_88 = -d_R_121 * R_33;
+            d_R_25 += -d_R_121 * C_25_96;
+            double d_C_25_96 = -d_R_121 * R_25;
+            d_R_17 += -d_R_121 * C_17_104;
+            double d_C_17_104 = -d_R_121 * R_17;
+            d_R_9 += -d_R_121 * C_9_112;
+            double d_C_9_112 = -d_R_121 * R_9;
+            double d_C_1_120 = -d_R_121;
+            double d_C_1_56 = d_C_1_120 * q_0_6;
+            d_q_0_6 += d_C_1_120 * C_1_56;
+            double d_C_9_48 = d_C_9_112 * Q_6_9;
+            d_Q_6_9 += d_C_9_112 * C_9_48;
+            double d_C_17_40 = d_C_17_104 * Q_6_17;
+            d_Q_6_17 += d_C_17_104 * C_17_40;
+            d_Q_5_25 += d_C_25_96 * Q_6_25;
+            d_Q_6_25 += d_C_25_96 * Q_5_25;
+            double d_C_33_24 = d_C_33_88 * Q_6_33;
+            d_Q_6_33 += d_C_33_88 * C_33_24;
+            d_Q_4_41 += d_C_41_80 * Q_6_41;
+            d_Q_6_41 += d_C_41_80 * Q_4_41;
+            d_Q_3_49 += d_C_49_72 * Q_6_49;
+            d_Q_6_49 += d_C_49_72 * Q_3_49;
+            d_Q_6_25 += d_Q_6_57 * q_5_6;
+            d_q_5_6 += d_Q_6_57 * Q_6_25;
+            d_R_49 += -d_R_57 * Q_3_49;
+            d_Q_3_49 += -d_R_57 * R_49;
+            d_R_41 += -d_R_57 * Q_4_41;
+            d_Q_4_41 += -d_R_57 * R_41;
+            d_R_33 += -d_R_57 * C_33_24;
+            d_C_33_24 += -d_R_57 * R_33;
+            d_R_25 += -d_R_57 * Q_5_25;
+            d_Q_5_25 += -d_R_57 * R_25;
+            d_R_17 += -d_R_57 * C_17_40;
+            d_C_17_40 += -d_R_57 * R_17;
+            d_R_9 += -d_R_57 * C_9_48;
+            d_C_9_48 += -d_R_57 * R_9;
+            d_C_1_56 += -d_R_57;
+            double d_C_1_24 = d_C_1_56 * q_0_5;
+            d_q_0_5 += d_C_1_56 * C_1_24;
+            d_Q_4_9 += d_C_9_48 * Q_5_9;
+            d_Q_5_9 += d_C_9_48 * Q_4_9;
+            d_Q_3_17 += d_C_17_40 * Q_5_17;
+            d_Q_5_17 += d_C_17_40 * Q_3_17;
+            d_Q_3_33 += d_C_33_24 * Q_4_33;
+            d_Q_4_33 += d_C_33_24 * Q_3_33;
+            double d_C_65_24 = d_C_65_56 * Q_5_65;
+            d_Q_5_65 += d_C_65_56 * C_65_24;
+            d_Q_4_73 += d_C_73_48 * Q_5_73;
+            d_Q_5_73 += d_C_73_48 * Q_4_73;
+            d_Q_3_81 += d_C_81_40 * Q_5_81;
+            d_Q_5_81 += d_C_81_40 * Q_3_81;
+            d_Q_5_25 += d_Q_5_89 * q_5_6;
+            d_q_5_6 += d_Q_5_89 * Q_5_25;
+            d_Q_5_9 += d_Q_5_25 * q_4_5;
+            d_q_4_5 += d_Q_5_25 * Q_5_9;
+            d_R_81 += -d_R_89 * Q_3_81;
+            d_Q_3_81 += -d_R_89 * R_81;
+            d_R_73 += -d_R_89 * Q_4_73;
+            d_Q_4_73 += -d_R_89 * R_73;
+            d_R_65 += -d_R_89 * C_65_24;
+            d_C_65_24 += -d_R_89 * R_65;
+            d_R_25 += -d_R_89 * Q_6_25;
+            d_Q_6_25 += -d_R_89 * R_25;
+            d_R_17 += -d_R_89 * C_17_72;
+            double d_C_17_72 = -d_R_89 * R_17;
+            d_R_9 += -d_R_89 * C_9_80;
+            double d_C_9_80 = -d_R_89 * R_9;
+            double d_C_1_88 = -d_R_89;
+            d_C_1_24 += d_C_1_88 * q_0_6;
+            d_q_0_6 += d_C_1_88 * C_1_24;
+            d_Q_4_9 += d_C_9_80 * Q_6_9;
+            d_Q_6_9 += d_C_9_80 * Q_4_9;
+            d_Q_3_17 += d_C_17_72 * Q_6_17;
+            d_Q_6_17 += d_C_17_72 * Q_3_17;
+            d_Q_6_9 += d_Q_6_25 * q_4_6;
+            d_q_4_6 += d_Q_6_25 * Q_6_9;
+            d_R_17 += -d_R_25 * Q_3_17;
+            d_Q_3_17 += -d_R_25 * R_17;
+            d_R_9 += -d_R_25 * Q_4_9;
+            d_Q_4_9 += -d_R_25 * R_9;
+            d_C_1_24 += -d_R_25;
+            d_q_0_3 += d_C_1_24 * q_0_4;
+            d_q_0_4 += d_C_1_24 * q_0_3;
+            d_Q_3_65 += d_C_65_24 * Q_4_65;
+            d_Q_4_65 += d_C_65_24 * Q_3_65;
+            d_Q_4_9 += d_Q_4_73 * q_4_6;
+            d_q_4_6 += d_Q_4_73 * Q_4_9;
+            d_Q_3_17 += d_Q_3_81 * q_3_6;
+            d_q_3_6 += d_Q_3_81 * Q_3_17;
+            d_Q_3_97 += d_C_97_24 * Q_4_97;
+            d_Q_4_97 += d_C_97_24 * Q_3_97;
+            d_Q_4_41 += d_Q_4_105 * q_4_6;
+            d_q_4_6 += d_Q_4_105 * Q_4_41;
+            d_Q_4_9 += d_Q_4_41 * q_4_5;
+            d_q_4_5 += d_Q_4_41 * Q_4_9;
+            d_q_0_4 += d_Q_4_9 * q_3_4;
+            d_q_3_4 += d_Q_4_9 * q_0_4;
+            d_R_97 += -d_R_105 * Q_3_97;
+            d_Q_3_97 += -d_R_105 * R_97;
+            d_R_73 += -d_R_105 * Q_5_73;
+            d_Q_5_73 += -d_R_105 * R_73;
+            d_R_65 += -d_R_105 * C_65_40;
+            double d_C_65_40 = -d_R_105 * R_65;
+            d_R_41 += -d_R_105 * Q_6_41;
+            d_Q_6_41 += -d_R_105 * R_41;
+            d_R_33 += -d_R_105 * C_33_72;
+            double d_C_33_72 = -d_R_105 * R_33;
+            d_R_9 += -d_R_105 * C_9_96;
+            double d_C_9_96 = -d_R_105 * R_9;
+            double d_C_1_104 = -d_R_105;
+            double d_C_1_40 = d_C_1_104 * q_0_6;
+            d_q_0_6 += d_C_1_104 * C_1_40;
+            d_Q_5_9 += d_C_9_96 * Q_6_9;
+            d_Q_6_9 += d_C_9_96 * Q_5_9;
+            d_Q_3_33 += d_C_33_72 * Q_6_33;
+            d_Q_6_33 += d_C_33_72 * Q_3_33;
+            d_Q_6_9 += d_Q_6_41 * q_5_6;
+            d_q_5_6 += d_Q_6_41 * Q_6_9;
+            d_R_33 += -d_R_41 * Q_3_33;
+            d_Q_3_33 += -d_R_41 * R_33;
+            d_R_9 += -d_R_41 * Q_5_9;
+            d_Q_5_9 += -d_R_41 * R_9;
+            d_C_1_40 += -d_R_41;
+            d_q_0_3 += d_C_1_40 * q_0_5;
+            d_q_0_5 += d_C_1_40 * q_0_3;
+            d_Q_3_65 += d_C_65_40 * Q_5_65;
+            d_Q_5_65 += d_C_65_40 * Q_3_65;
+            d_Q_5_9 += d_Q_5_73 * q_5_6;
+            d_q_5_6 += d_Q_5_73 * Q_5_9;
+            d_q_0_5 += d_Q_5_9 * q_3_5;
+            d_q_3_5 += d_Q_5_9 * q_0_5;
+            d_R_65 += -d_R_73 * Q_3_65;
+            d_Q_3_65 += -d_R_73 * R_65;
+            d_R_9 += -d_R_73 * Q_6_9;
+            d_Q_6_9 += -d_R_73 * R_9;
+            double d_C_1_72 = -d_R_73;
+            d_q_0_3 += d_C_1_72 * q_0_6;
+            d_q_0_6 += d_C_1_72 * q_0_3;
+            d_q_0_6 += d_Q_6_9 * q_3_6;
+            d_q_3_6 += d_Q_6_9 * q_0_6;
+            d_q_0_3 += -d_R_9;
+            d_q_0_3 += d_Q_3_65 * q_3_6;
+            d_q_3_6 += d_Q_3_65 * q_0_3;
+            d_Q_3_33 += d_Q_3_97 * q_3_6;
+            d_q_3_6 += d_Q_3_97 * Q_3_33;
+            d_q_0_3 += d_Q_3_33 * q_3_5;
+            d_q_3_5 += d_Q_3_33 * q_0_3;
+            d_Q_3_49 += d_Q_3_113 * q_3_6;
+            d_q_3_6 += d_Q_3_113 * Q_3_49;
+            d_Q_3_17 += d_Q_3_49 * q_3_5;
+            d_q_3_5 += d_Q_3_49 * Q_3_17;
+            d_q_0_3 += d_Q_3_17 * q_3_4;
+            d_q_3_4 += d_Q_3_17 * q_0_3;
+            d_R_97 += -d_R_113 * Q_4_97;
+            d_Q_4_97 += -d_R_113 * R_97;
+            d_R_81 += -d_R_113 * Q_5_81;
+            d_Q_5_81 += -d_R_113 * R_81;
+            d_R_65 += -d_R_113 * C_65_48;
+            double d_C_65_48 = -d_R_113 * R_65;
+            d_R_49 += -d_R_113 * Q_6_49;
+            d_Q_6_49 += -d_R_113 * R_49;
+            d_R_33 += -d_R_113 * C_33_80;
+            double d_C_33_80 = -d_R_113 * R_33;
+            d_R_17 += -d_R_113 * C_17_96;
+            double d_C_17_96 = -d_R_113 * R_17;
+            double d_C_1_112 = -d_R_113;
+            double d_C_1_48 = d_C_1_112 * q_0_6;
+            d_q_0_6 += d_C_1_112 * C_1_48;
+            d_Q_5_17 += d_C_17_96 * Q_6_17;
+            d_Q_6_17 += d_C_17_96 * Q_5_17;
+            d_Q_4_33 += d_C_33_80 * Q_6_33;
+            d_Q_6_33 += d_C_33_80 * Q_4_33;
+            d_Q_6_17 += d_Q_6_49 * q_5_6;
+            d_q_5_6 += d_Q_6_49 * Q_6_17;
+            d_R_33 += -d_R_49 * Q_4_33;
+            d_Q_4_33 += -d_R_49 * R_33;
+            d_R_17 += -d_R_49 * Q_5_17;
+            d_Q_5_17 += -d_R_49 * R_17;
+            d_C_1_48 += -d_R_49;
+            d_q_0_4 += d_C_1_48 * q_0_5;
+            d_q_0_5 += d_C_1_48 * q_0_4;
+            d_Q_4_65 += d_C_65_48 * Q_5_65;
+            d_Q_5_65 += d_C_65_48 * Q_4_65;
+            d_Q_5_17 += d_Q_5_81 * q_5_6;
+            d_q_5_6 += d_Q_5_81 * Q_5_17;
+            d_q_0_5 += d_Q_5_17 * q_4_5;
+            d_q_4_5 += d_Q_5_17 * q_0_5;
+            d_R_65 += -d_R_81 * Q_4_65;
+            d_Q_4_65 += -d_R_81 * R_65;
+            d_R_17 += -d_R_81 * Q_6_17;
+            d_Q_6_17 += -d_R_81 * R_17;
+            double d_C_1_80 = -d_R_81;
+            d_q_0_4 += d_C_1_80 * q_0_6;
+            d_q_0_6 += d_C_1_80 * q_0_4;
+            d_q_0_6 += d_Q_6_17 * q_4_6;
+            d_q_4_6 += d_Q_6_17 * q_0_6;
+            d_q_0_4 += -d_R_17;
+            d_q_0_4 += d_Q_4_65 * q_4_6;
+            d_q_4_6 += d_Q_4_65 * q_0_4;
+            d_Q_4_33 += d_Q_4_97 * q_4_6;
+            d_q_4_6 += d_Q_4_97 * Q_4_33;
+            d_q_0_4 += d_Q_4_33 * q_4_5;
+            d_q_4_5 += d_Q_4_33 * q_0_4;
+            d_R_65 += -d_R_97 * Q_5_65;
+            d_Q_5_65 += -d_R_97 * R_65;
+            d_R_33 += -d_R_97 * Q_6_33;
+            d_Q_6_33 += -d_R_97 * R_33;
+            double d_C_1_96 = -d_R_97;
+            d_q_0_5 += d_C_1_96 * q_0_6;
+            d_q_0_6 += d_C_1_96 * q_0_5;
+            d_q_0_6 += d_Q_6_33 * q_5_6;
+            d_q_5_6 += d_Q_6_33 * q_0_6;
+            d_q_0_5 += -d_R_33;
+            d_q_0_5 += d_Q_5_65 * q_5_6;
+            d_q_5_6 += d_Q_5_65 * q_0_5;
+            d_q_0_6 += -d_R_65;
+            gradient[41] = -d_q_5_6;
+            gradient[34] = -d_q_4_6;
+            gradient[33] = -d_q_4_5;
+            gradient[27] = -d_q_3_6;
+            gradient[26] = -d_q_3_5;
+            gradient[25] = -d_q_3_4;
+            gradient[20] = -d_q_2_6;
+            gradient[19] = -d_q_2_5;
+            gradient[18] = -d_q_2_4;
+            gradient[17] = -d_q_2_3;
+            gradient[13] = -d_q_1_6;
+            gradient[12] = -d_q_1_5;
+            gradient[11] = -d_q_1_4;
+            gradient[10] = -d_q_1_3;
+            gradient[9] = -d_q_1_2;
+            gradient[6] = -d_q_0_6;
+            gradient[5] = -d_q_0_5;
+            gradient[4] = -d_q_0_4;
+            gradient[3] = -d_q_0_3;
+            gradient[2] = -d_q_0_2;
+            gradient[1] = -d_q_0_1;
+            return R_127;
+        }
+
+        template<typename Matrix>
+        static auto calculateCompleteGraph8ATR(const Matrix &matrix) {
+            const auto q_0_1 = 1 - matrix.at(0, 1);
+            const auto q_0_2 = 1 - matrix.at(0, 2);
+            const auto q_0_3 = 1 - matrix.at(0, 3);
+            const auto q_0_4 = 1 - matrix.at(0, 4);
+            const auto q_0_5 = 1 - matrix.at(0, 5);
+            const auto q_0_6 = 1 - matrix.at(0, 6);
+            const auto q_0_7 = 1 - matrix.at(0, 7);
+            const auto q_1_2 = 1 - matrix.at(1, 2);
+            const auto q_1_3 = 1 - matrix.at(1, 3);
+            const auto q_1_4 = 1 - matrix.at(1, 4);
+            const auto q_1_5 = 1 - matrix.at(1, 5);
+            const auto q_1_6 = 1 - matrix.at(1, 6);
+            const auto q_1_7 = 1 - matrix.at(1, 7);
+            const auto q_2_3 = 1 - matrix.at(2, 3);
+            const auto q_2_4 = 1 - matrix.at(2, 4);
+            const auto q_2_5 = 1 - matrix.at(2, 5);
+            const auto q_2_6 = 1 - matrix.at(2, 6);
+            const auto q_2_7 = 1 - matrix.at(2, 7);
+            const auto q_3_4 = 1 - matrix.at(3, 4);
+            const auto q_3_5 = 1 - matrix.at(3, 5);
+            const auto q_3_6 = 1 - matrix.at(3, 6);
+            const auto q_3_7 = 1 - matrix.at(3, 7);
+            const auto q_4_5 = 1 - matrix.at(4, 5);
+            const auto q_4_6 = 1 - matrix.at(4, 6);
+            const auto q_4_7 = 1 - matrix.at(4, 7);
+            const auto q_5_6 = 1 - matrix.at(5, 6);
+            const auto q_5_7 = 1 - matrix.at(5, 7);
+            const auto q_6_7 = 1 - matrix.at(6, 7);
+            const auto R_129 = 1 - q_0_7;
+            const auto Q_6_129 = q_0_6 * q_6_7;
+            const auto R_65 = 1 - q_0_6;
+            const auto Q_7_65 = q_0_7 * q_6_7;
+            const auto C_1_192 = q_0_6 * q_0_7;
+            const auto R_193 = 1 - (R_129 * Q_6_129 + R_65 * Q_7_65 + C_1_192);
+            const auto Q_5_65 = q_0_5 * q_5_6;
+            const auto Q_5_193 = Q_5_65 * q_5_7;
+            const auto Q_5_129 = q_0_5 * q_5_7;
+            const auto R_33 = 1 - q_0_5;
+            const auto Q_7_33 = q_0_7 * q_5_7;
+            const auto C_1_160 = q_0_5 * q_0_7;
+            const auto R_161 = 1 - (R_129 * Q_5_129 + R_33 * Q_7_33 + C_1_160);
+            const auto Q_6_33 = q_0_6 * q_5_6;
+            const auto Q_6_161 = Q_6_33 * q_6_7;
+            const auto C_129_96 = Q_5_129 * Q_6_129;
+            const auto C_1_96 = q_0_5 * q_0_6;
+            const auto R_97 = 1 - (R_65 * Q_5_65 + R_33 * Q_6_33 + C_1_96);
+            const auto Q_7_97 = Q_7_33 * q_6_7;
+            const auto C_65_160 = Q_5_65 * Q_7_65;
+            const auto C_33_192 = Q_6_33 * Q_7_33;
+            const auto C_1_224 = C_1_96 * q_0_7;
+            const auto R_225 = 1 - (R_193 * Q_5_193 + R_161 * Q_6_161 + R_129 * C_129_96 + R_97 * Q_7_97
+                    + R_65 * C_65_160 + R_33 * C_33_192 + C_1_224);
+            const auto Q_4_33 = q_0_4 * q_4_5;
+            const auto Q_4_97 = Q_4_33 * q_4_6;
+            const auto Q_4_225 = Q_4_97 * q_4_7;
+            const auto Q_4_65 = q_0_4 * q_4_6;
+            const auto Q_4_193 = Q_4_65 * q_4_7;
+            const auto Q_4_129 = q_0_4 * q_4_7;
+            const auto R_17 = 1 - q_0_4;
+            const auto Q_7_17 = q_0_7 * q_4_7;
+            const auto C_1_144 = q_0_4 * q_0_7;
+            const auto R_145 = 1 - (R_129 * Q_4_129 + R_17 * Q_7_17 + C_1_144);
+            const auto Q_6_17 = q_0_6 * q_4_6;
+            const auto Q_6_145 = Q_6_17 * q_6_7;
+            const auto C_129_80 = Q_4_129 * Q_6_129;
+            const auto C_1_80 = q_0_4 * q_0_6;
+            const auto R_81 = 1 - (R_65 * Q_4_65 + R_17 * Q_6_17 + C_1_80);
+            const auto Q_7_81 = Q_7_17 * q_6_7;
+            const auto C_65_144 = Q_4_65 * Q_7_65;
+            const auto C_17_192 = Q_6_17 * Q_7_17;
+            const auto C_1_208 = C_1_80 * q_0_7;
+            const auto R_209 = 1 - (R_193 * Q_4_193 + R_145 * Q_6_145 + R_129 * C_129_80 + R_81 * Q_7_81
+                    + R_65 * C_65_144 + R_17 * C_17_192 + C_1_208);
+            const auto Q_5_17 = q_0_5 * q_4_5;
+            const auto Q_5_81 = Q_5_17 * q_5_6;
+            const auto Q_5_209 = Q_5_81 * q_5_7;
+            const auto C_193_48 = Q_4_193 * Q_5_193;
+            const auto Q_4_161 = Q_4_33 * q_4_7;
+            const auto Q_5_145 = Q_5_17 * q_5_7;
+            const auto C_129_48 = Q_4_129 * Q_5_129;
+            const auto C_1_48 = q_0_4 * q_0_5;
+            const auto R_49 = 1 - (R_33 * Q_4_33 + R_17 * Q_5_17 + C_1_48);
+            const auto Q_7_49 = Q_7_17 * q_5_7;
+            const auto C_33_144 = Q_4_33 * Q_7_33;
+            const auto C_17_160 = Q_5_17 * Q_7_17;
+            const auto C_1_176 = C_1_48 * q_0_7;
+            const auto R_177 = 1 - (R_161 * Q_4_161 + R_145 * Q_5_145 + R_129 * C_129_48 + R_49 * Q_7_49
+                    + R_33 * C_33_144 + R_17 * C_17_160 + C_1_176);
+            const auto Q_6_49 = Q_6_17 * q_5_6;
+            const auto Q_6_177 = Q_6_49 * q_6_7;
+            const auto C_161_80 = Q_4_161 * Q_6_161;
+            const auto C_145_96 = Q_5_145 * Q_6_145;
+            const auto C_129_112 = C_129_48 * Q_6_129;
+            const auto C_65_48 = Q_4_65 * Q_5_65;
+            const auto C_33_80 = Q_4_33 * Q_6_33;
+            const auto C_17_96 = Q_5_17 * Q_6_17;
+            const auto C_1_112 = C_1_48 * q_0_6;
+            const auto R_113 = 1 - (R_97 * Q_4_97 + R_81 * Q_5_81 + R_65 * C_65_48 + R_49 * Q_6_49
+                    + R_33 * C_33_80 + R_17 * C_17_96 + C_1_112);
+            const auto Q_7_113 = Q_7_49 * q_6_7;
+            const auto C_97_144 = Q_4_97 * Q_7_97;
+            const auto C_81_160 = Q_5_81 * Q_7_81;
+            const auto C_65_176 = C_65_48 * Q_7_65;
+            const auto C_49_192 = Q_6_49 * Q_7_49;
+            const auto C_33_208 = C_33_80 * Q_7_33;
+            const auto C_17_224 = C_17_96 * Q_7_17;
+            const auto C_1_240 = C_1_112 * q_0_7;
+            const auto R_241 = 1 - (R_225 * Q_4_225 + R_209 * Q_5_209 + R_193 * C_193_48 + R_177 * Q_6_177
+                    + R_161 * C_161_80 + R_145 * C_145_96 + R_129 * C_129_112 + R_113 * Q_7_113
+                    + R_97 * C_97_144 + R_81 * C_81_160 + R_65 * C_65_176 + R_49 * C_49_192
+                    + R_33 * C_33_208 + R_17 * C_17_224 + C_1_240);
+            const auto Q_3_17 = q_0_3 * q_3_4;
+            const auto Q_3_49 = Q_3_17 * q_3_5;
+            const auto Q_3_113 = Q_3_49 * q_3_6;
+            const auto Q_3_241 = Q_3_113 * q_3_7;
+            const auto Q_3_33 = q_0_3 * q_3_5;
+            const auto Q_3_97 = Q_3_33 * q_3_6;
+            const auto Q_3_225 = Q_3_97 * q_3_7;
+            const auto Q_3_65 = q_0_3 * q_3_6;
+            const auto Q_3_193 = Q_3_65 * q_3_7;
+            const auto Q_3_129 = q_0_3 * q_3_7;
+            const auto R_9 = 1 - q_0_3;
+            const auto Q_7_9 = q_0_7 * q_3_7;
+            const auto C_1_136 = q_0_3 * q_0_7;
+            const auto R_137 = 1 - (R_129 * Q_3_129 + R_9 * Q_7_9 + C_1_136);
+            const auto Q_6_9 = q_0_6 * q_3_6;
+            const auto Q_6_137 = Q_6_9 * q_6_7;
+            const auto C_129_72 = Q_3_129 * Q_6_129;
+            const auto C_1_72 = q_0_3 * q_0_6;
+            const auto R_73 = 1 - (R_65 * Q_3_65 + R_9 * Q_6_9 + C_1_72);
+            const auto Q_7_73 = Q_7_9 * q_6_7;
+            const auto C_65_136 = Q_3_65 * Q_7_65;
+            const auto C_9_192 = Q_6_9 * Q_7_9;
+            const auto C_1_200 = C_1_72 * q_0_7;
+            const auto R_201 = 1 - (R_193 * Q_3_193 + R_137 * Q_6_137 + R_129 * C_129_72 + R_73 * Q_7_73
+                    + R_65 * C_65_136 + R_9 * C_9_192 + C_1_200);
+            const auto Q_5_9 = q_0_5 * q_3_5;
+            const auto Q_5_73 = Q_5_9 * q_5_6;
+            const auto Q_5_201 = Q_5_73 * q_5_7;
+            const auto C_193_40 = Q_3_193 * Q_5_193;
+            const auto Q_3_161 = Q_3_33 * q_3_7;
+            const auto Q_5_137 = Q_5_9 * q_5_7;
+            const auto C_129_40 = Q_3_129 * Q_5_129;
+            const auto C_1_40 = q_0_3 * q_0_5;
+            const auto R_41 = 1 - (R_33 * Q_3_33 + R_9 * Q_5_9 + C_1_40);
+            const auto Q_7_41 = Q_7_9 * q_5_7;
+            const auto C_33_136 = Q_3_33 * Q_7_33;
+            const auto C_9_160 = Q_5_9 * Q_7_9;
+            const auto C_1_168 = C_1_40 * q_0_7;
+            const auto R_169 = 1 - (R_161 * Q_3_161 + R_137 * Q_5_137 + R_129 * C_129_40 + R_41 * Q_7_41
+                    + R_33 * C_33_136 + R_9 * C_9_160 + C_1_168);
+            const auto Q_6_41 = Q_6_9 * q_5_6;
+            const auto Q_6_169 = Q_6_41 * q_6_7;
+            const auto C_161_72 = Q_3_161 * Q_6_161;
+            const auto C_137_96 = Q_5_137 * Q_6_137;
+            const auto C_129_104 = C_129_40 * Q_6_129;
+            const auto C_65_40 = Q_3_65 * Q_5_65;
+            const auto C_33_72 = Q_3_33 * Q_6_33;
+            const auto C_9_96 = Q_5_9 * Q_6_9;
+            const auto C_1_104 = C_1_40 * q_0_6;
+            const auto R_105 = 1 - (R_97 * Q_3_97 + R_73 * Q_5_73 + R_65 * C_65_40 + R_41 * Q_6_41
+                    + R_33 * C_33_72 + R_9 * C_9_96 + C_1_104);
+            const auto Q_7_105 = Q_7_41 * q_6_7;
+            const auto C_97_136 = Q_3_97 * Q_7_97;
+            const auto C_73_160 = Q_5_73 * Q_7_73;
+            const auto C_65_168 = C_65_40 * Q_7_65;
+            const auto C_41_192 = Q_6_41 * Q_7_41;
+            const auto C_33_200 = C_33_72 * Q_7_33;
+            const auto C_9_224 = C_9_96 * Q_7_9;
+            const auto C_1_232 = C_1_104 * q_0_7;
+            const auto R_233 = 1 - (R_225 * Q_3_225 + R_201 * Q_5_201 + R_193 * C_193_40 + R_169 * Q_6_169
+                    + R_161 * C_161_72 + R_137 * C_137_96 + R_129 * C_129_104 + R_105 * Q_7_105
+                    + R_97 * C_97_136 + R_73 * C_73_160 + R_65 * C_65_168 + R_41 * C_41_192
+                    + R_33 * C_33_200 + R_9 * C_9_224 + C_1_232);
+            const auto Q_4_9 = q_0_4 * q_3_4;
+            const auto Q_4_41 = Q_4_9 * q_4_5;
+            const auto Q_4_105 = Q_4_41 * q_4_6;
+            const auto Q_4_233 = Q_4_105 * q_4_7;
+            const auto C_225_24 = Q_3_225 * Q_4_225;
+            const auto Q_3_81 = Q_3_17 * q_3_6;
+            const auto Q_3_209 = Q_3_81 * q_3_7;
+            const auto Q_4_73 = Q_4_9 * q_4_6;
+            const auto Q_4_201 = Q_4_73 * q_4_7;
+            const auto C_193_24 = Q_3_193 * Q_4_193;
+            const auto Q_3_145 = Q_3_17 * q_3_7;
+            const auto Q_4_137 = Q_4_9 * q_4_7;
+            const auto C_129_24 = Q_3_129 * Q_4_129;
+            const auto C_1_24 = q_0_3 * q_0_4;
+            const auto R_25 = 1 - (R_17 * Q_3_17 + R_9 * Q_4_9 + C_1_24);
+            const auto Q_7_25 = Q_7_9 * q_4_7;
+            const auto C_17_136 = Q_3_17 * Q_7_17;
+            const auto C_9_144 = Q_4_9 * Q_7_9;
+            const auto C_1_152 = C_1_24 * q_0_7;
+            const auto R_153 = 1 - (R_145 * Q_3_145 + R_137 * Q_4_137 + R_129 * C_129_24 + R_25 * Q_7_25
+                    + R_17 * C_17_136 + R_9 * C_9_144 + C_1_152);
+            const auto Q_6_25 = Q_6_9 * q_4_6;
+            const auto Q_6_153 = Q_6_25 * q_6_7;
+            const auto C_145_72 = Q_3_145 * Q_6_145;
+            const auto C_137_80 = Q_4_137 * Q_6_137;
+            const auto C_129_88 = C_129_24 * Q_6_129;
+            const auto C_65_24 = Q_3_65 * Q_4_65;
+            const auto C_17_72 = Q_3_17 * Q_6_17;
+            const auto C_9_80 = Q_4_9 * Q_6_9;
+            const auto C_1_88 = C_1_24 * q_0_6;
+            const auto R_89 = 1 - (R_81 * Q_3_81 + R_73 * Q_4_73 + R_65 * C_65_24 + R_25 * Q_6_25
+                    + R_17 * C_17_72 + R_9 * C_9_80 + C_1_88);
+            const auto Q_7_89 = Q_7_25 * q_6_7;
+            const auto C_81_136 = Q_3_81 * Q_7_81;
+            const auto C_73_144 = Q_4_73 * Q_7_73;
+            const auto C_65_152 = C_65_24 * Q_7_65;
+            const auto C_25_192 = Q_6_25 * Q_7_25;
+            const auto C_17_200 = C_17_72 * Q_7_17;
+            const auto C_9_208 = C_9_80 * Q_7_9;
+            const auto C_1_216 = C_1_88 * q_0_7;
+            const auto R_217 = 1 - (R_209 * Q_3_209 + R_201 * Q_4_201 + R_193 * C_193_24 + R_153 * Q_6_153
+                    + R_145 * C_145_72 + R_137 * C_137_80 + R_129 * C_129_88 + R_89 * Q_7_89
+                    + R_81 * C_81_136 + R_73 * C_73_144 + R_65 * C_65_152 + R_25 * C_25_192
+                    + R_17 * C_17_200 + R_9 * C_9_208 + C_1_216);
+            const auto Q_5_25 = Q_5_9 * q_4_5;
+            const auto Q_5_89 = Q_5_25 * q_5_6;
+            const auto Q_5_217 = Q_5_89 * q_5_7;
+            const auto C_209_40 = Q_3_209 * Q_5_209;
+            const auto C_201_48 = Q_4_201 * Q_5_201;
+            const auto C_193_56 = C_193_24 * Q_5_193;
+            const auto Q_3_177 = Q_3_49 * q_3_7;
+            const auto Q_4_169 = Q_4_41 * q_4_7;
+            const auto C_161_24 = Q_3_161 * Q_4_161;
+            const auto Q_5_153 = Q_5_25 * q_5_7;
+            const auto C_145_40 = Q_3_145 * Q_5_145;
+            const auto C_137_48 = Q_4_137 * Q_5_137;
+            const auto C_129_56 = C_129_24 * Q_5_129;
+            const auto C_33_24 = Q_3_33 * Q_4_33;
+            const auto C_17_40 = Q_3_17 * Q_5_17;
+            const auto C_9_48 = Q_4_9 * Q_5_9;
+            const auto C_1_56 = C_1_24 * q_0_5;
+            const auto R_57 = 1 - (R_49 * Q_3_49 + R_41 * Q_4_41 + R_33 * C_33_24 + R_25 * Q_5_25
+                    + R_17 * C_17_40 + R_9 * C_9_48 + C_1_56);
+            const auto Q_7_57 = Q_7_25 * q_5_7;
+            const auto C_49_136 = Q_3_49 * Q_7_49;
+            const auto C_41_144 = Q_4_41 * Q_7_41;
+            const auto C_33_152 = C_33_24 * Q_7_33;
+            const auto C_25_160 = Q_5_25 * Q_7_25;
+            const auto C_17_168 = C_17_40 * Q_7_17;
+            const auto C_9_176 = C_9_48 * Q_7_9;
+            const auto C_1_184 = C_1_56 * q_0_7;
+            const auto R_185 = 1 - (R_177 * Q_3_177 + R_169 * Q_4_169 + R_161 * C_161_24 + R_153 * Q_5_153
+                    + R_145 * C_145_40 + R_137 * C_137_48 + R_129 * C_129_56 + R_57 * Q_7_57
+                    + R_49 * C_49_136 + R_41 * C_41_144 + R_33 * C_33_152 + R_25 * C_25_160
+                    + R_17 * C_17_168 + R_9 * C_9_176 + C_1_184);
+            const auto Q_6_57 = Q_6_25 * q_5_6;
+            const auto Q_6_185 = Q_6_57 * q_6_7;
+            const auto C_177_72 = Q_3_177 * Q_6_177;
+            const auto C_169_80 = Q_4_169 * Q_6_169;
+            const auto C_161_88 = C_161_24 * Q_6_161;
+            const auto C_153_96 = Q_5_153 * Q_6_153;
+            const auto C_145_104 = C_145_40 * Q_6_145;
+            const auto C_137_112 = C_137_48 * Q_6_137;
+            const auto C_129_120 = C_129_56 * Q_6_129;
+            const auto C_97_24 = Q_3_97 * Q_4_97;
+            const auto C_81_40 = Q_3_81 * Q_5_81;
+            const auto C_73_48 = Q_4_73 * Q_5_73;
+            const auto C_65_56 = C_65_24 * Q_5_65;
+            const auto C_49_72 = Q_3_49 * Q_6_49;
+            const auto C_41_80 = Q_4_41 * Q_6_41;
+            const auto C_33_88 = C_33_24 * Q_6_33;
+            const auto C_25_96 = Q_5_25 * Q_6_25;
+            const auto C_17_104 = C_17_40 * Q_6_17;
+            const auto C_9_112 = C_9_48 * Q_6_9;
+            const auto C_1_120 = C_1_56 * q_0_6;
+            const auto R_121 = 1 - (R_113 * Q_3_113 + R_105 * Q_4_105 + R_97 * C_97_24 + R_89 * Q_5_89
+                    + R_81 * C_81_40 + R_73 * C_73_48 + R_65 * C_65_56 + R_57 * Q_6_57
+                    + R_49 * C_49_72 + R_41 * C_41_80 + R_33 * C_33_88 + R_25 * C_25_96
+                    + R_17 * C_17_104 + R_9 * C_9_112 + C_1_120);
+            const auto Q_7_121 = Q_7_57 * q_6_7;
+            const auto C_113_136 = Q_3_113 * Q_7_113;
+            const auto C_105_144 = Q_4_105 * Q_7_105;
+            const auto C_97_152 = C_97_24 * Q_7_97;
+            const auto C_89_160 = Q_5_89 * Q_7_89;
+            const auto C_81_168 = C_81_40 * Q_7_81;
+            const auto C_73_176 = C_73_48 * Q_7_73;
+            const auto C_65_184 = C_65_56 * Q_7_65;
+            const auto C_57_192 = Q_6_57 * Q_7_57;
+            const auto C_49_200 = C_49_72 * Q_7_49;
+            const auto C_41_208 = C_41_80 * Q_7_41;
+            const auto C_33_216 = C_33_88 * Q_7_33;
+            const auto C_25_224 = C_25_96 * Q_7_25;
+            const auto C_17_232 = C_17_104 * Q_7_17;
+            const auto C_9_240 = C_9_112 * Q_7_9;
+            const auto C_1_248 = C_1_120 * q_0_7;
+            const auto R_249 = 1 - (R_241 * Q_3_241 + R_233 * Q_4_233 + R_225 * C_225_24 + R_217 * Q_5_217
+                    + R_209 * C_209_40 + R_201 * C_201_48 + R_193 * C_193_56 + R_185 * Q_6_185
+                    + R_177 * C_177_72 + R_169 * C_169_80 + R_161 * C_161_88 + R_153 * C_153_96
+                    + R_145 * C_145_104 + R_137 * C_137_112 + R_129 * C_129_120 + R_121 * Q_7_121
+                    + R_113 * C_113_136 + R_105 * C_105_144 + R_97 * C_97_152 + R_89 * C_89_160
+                    + R_81 * C_81_168 + R_73 * C_73_176 + R_65 * C_65_184 + R_57 * C_57_192
+                    + R_49 * C_49_200 + R_41 * C_41_208 + R_33 * C_33_216 + R_25 * C_25_224
+                    + R_17 * C_17_232 + R_9 * C_9_240 + C_1_248);
+            const auto Q_2_9 = q_0_2 * q_2_3;
+            const auto Q_2_25 = Q_2_9 * q_2_4;
+            const auto Q_2_57 = Q_2_25 * q_2_5;
+            const auto Q_2_121 = Q_2_57 * q_2_6;
+            const auto Q_2_249 = Q_2_121 * q_2_7;
+            const auto Q_2_17 = q_0_2 * q_2_4;
+            const auto Q_2_49 = Q_2_17 * q_2_5;
+            const auto Q_2_113 = Q_2_49 * q_2_6;
+            const auto Q_2_241 = Q_2_113 * q_2_7;
+            const auto Q_2_33 = q_0_2 * q_2_5;
+            const auto Q_2_97 = Q_2_33 * q_2_6;
+            const auto Q_2_225 = Q_2_97 * q_2_7;
+            const auto Q_2_65 = q_0_2 * q_2_6;
+            const auto Q_2_193 = Q_2_65 * q_2_7;
+            const auto Q_2_129 = q_0_2 * q_2_7;
+            const auto R_5 = 1 - q_0_2;
+            const auto Q_7_5 = q_0_7 * q_2_7;
+            const auto C_1_132 = q_0_2 * q_0_7;
+            const auto R_133 = 1 - (R_129 * Q_2_129 + R_5 * Q_7_5 + C_1_132);
+            const auto Q_6_5 = q_0_6 * q_2_6;
+            const auto Q_6_133 = Q_6_5 * q_6_7;
+            const auto C_129_68 = Q_2_129 * Q_6_129;
+            const auto C_1_68 = q_0_2 * q_0_6;
+            const auto R_69 = 1 - (R_65 * Q_2_65 + R_5 * Q_6_5 + C_1_68);
+            const auto Q_7_69 = Q_7_5 * q_6_7;
+            const auto C_65_132 = Q_2_65 * Q_7_65;
+            const auto C_5_192 = Q_6_5 * Q_7_5;
+            const auto C_1_196 = C_1_68 * q_0_7;
+            const auto R_197 = 1 - (R_193 * Q_2_193 + R_133 * Q_6_133 + R_129 * C_129_68 + R_69 * Q_7_69
+                    + R_65 * C_65_132 + R_5 * C_5_192 + C_1_196);
+            const auto Q_5_5 = q_0_5 * q_2_5;
+            const auto Q_5_69 = Q_5_5 * q_5_6;
+            const auto Q_5_197 = Q_5_69 * q_5_7;
+            const auto C_193_36 = Q_2_193 * Q_5_193;
+            const auto Q_2_161 = Q_2_33 * q_2_7;
+            const auto Q_5_133 = Q_5_5 * q_5_7;
+            const auto C_129_36 = Q_2_129 * Q_5_129;
+            const auto C_1_36 = q_0_2 * q_0_5;
+            const auto R_37 = 1 - (R_33 * Q_2_33 + R_5 * Q_5_5 + C_1_36);
+            const auto Q_7_37 = Q_7_5 * q_5_7;
+            const auto C_33_132 = Q_2_33 * Q_7_33;
+            const auto C_5_160 = Q_5_5 * Q_7_5;
+            const auto C_1_164 = C_1_36 * q_0_7;
+            const auto R_165 = 1 - (R_161 * Q_2_161 + R_133 * Q_5_133 + R_129 * C_129_36 + R_37 * Q_7_37
+                    + R_33 * C_33_132 + R_5 * C_5_160 + C_1_164);
+            const auto Q_6_37 = Q_6_5 * q_5_6;
+            const auto Q_6_165 = Q_6_37 * q_6_7;
+            const auto C_161_68 = Q_2_161 * Q_6_161;
+            const auto C_133_96 = Q_5_133 * Q_6_133;
+            const auto C_129_100 = C_129_36 * Q_6_129;
+            const auto C_65_36 = Q_2_65 * Q_5_65;
+            const auto C_33_68 = Q_2_33 * Q_6_33;
+            const auto C_5_96 = Q_5_5 * Q_6_5;
+            const auto C_1_100 = C_1_36 * q_0_6;
+            const auto R_101 = 1 - (R_97 * Q_2_97 + R_69 * Q_5_69 + R_65 * C_65_36 + R_37 * Q_6_37
+                    + R_33 * C_33_68 + R_5 * C_5_96 + C_1_100);
+            const auto Q_7_101 = Q_7_37 * q_6_7;
+            const auto C_97_132 = Q_2_97 * Q_7_97;
+            const auto C_69_160 = Q_5_69 * Q_7_69;
+            const auto C_65_164 = C_65_36 * Q_7_65;
+            const auto C_37_192 = Q_6_37 * Q_7_37;
+            const auto C_33_196 = C_33_68 * Q_7_33;
+            const auto C_5_224 = C_5_96 * Q_7_5;
+            const auto C_1_228 = C_1_100 * q_0_7;
+            const auto R_229 = 1 - (R_225 * Q_2_225 + R_197 * Q_5_197 + R_193 * C_193_36 + R_165 * Q_6_165
+                    + R_161 * C_161_68 + R_133 * C_133_96 + R_129 * C_129_100 + R_101 * Q_7_101
+                    + R_97 * C_97_132 + R_69 * C_69_160 + R_65 * C_65_164 + R_37 * C_37_192
+                    + R_33 * C_33_196 + R_5 * C_5_224 + C_1_228);
+            const auto Q_4_5 = q_0_4 * q_2_4;
+            const auto Q_4_37 = Q_4_5 * q_4_5;
+            const auto Q_4_101 = Q_4_37 * q_4_6;
+            const auto Q_4_229 = Q_4_101 * q_4_7;
+            const auto C_225_20 = Q_2_225 * Q_4_225;
+            const auto Q_2_81 = Q_2_17 * q_2_6;
+            const auto Q_2_209 = Q_2_81 * q_2_7;
+            const auto Q_4_69 = Q_4_5 * q_4_6;
+            const auto Q_4_197 = Q_4_69 * q_4_7;
+            const auto C_193_20 = Q_2_193 * Q_4_193;
+            const auto Q_2_145 = Q_2_17 * q_2_7;
+            const auto Q_4_133 = Q_4_5 * q_4_7;
+            const auto C_129_20 = Q_2_129 * Q_4_129;
+            const auto C_1_20 = q_0_2 * q_0_4;
+            const auto R_21 = 1 - (R_17 * Q_2_17 + R_5 * Q_4_5 + C_1_20);
+            const auto Q_7_21 = Q_7_5 * q_4_7;
+            const auto C_17_132 = Q_2_17 * Q_7_17;
+            const auto C_5_144 = Q_4_5 * Q_7_5;
+            const auto C_1_148 = C_1_20 * q_0_7;
+            const auto R_149 = 1 - (R_145 * Q_2_145 + R_133 * Q_4_133 + R_129 * C_129_20 + R_21 * Q_7_21
+                    + R_17 * C_17_132 + R_5 * C_5_144 + C_1_148);
+            const auto Q_6_21 = Q_6_5 * q_4_6;
+            const auto Q_6_149 = Q_6_21 * q_6_7;
+            const auto C_145_68 = Q_2_145 * Q_6_145;
+            const auto C_133_80 = Q_4_133 * Q_6_133;
+            const auto C_129_84 = C_129_20 * Q_6_129;
+            const auto C_65_20 = Q_2_65 * Q_4_65;
+            const auto C_17_68 = Q_2_17 * Q_6_17;
+            const auto C_5_80 = Q_4_5 * Q_6_5;
+            const auto C_1_84 = C_1_20 * q_0_6;
+            const auto R_85 = 1 - (R_81 * Q_2_81 + R_69 * Q_4_69 + R_65 * C_65_20 + R_21 * Q_6_21
+                    + R_17 * C_17_68 + R_5 * C_5_80 + C_1_84);
+            const auto Q_7_85 = Q_7_21 * q_6_7;
+            const auto C_81_132 = Q_2_81 * Q_7_81;
+            const auto C_69_144 = Q_4_69 * Q_7_69;
+            const auto C_65_148 = C_65_20 * Q_7_65;
+            const auto C_21_192 = Q_6_21 * Q_7_21;
+            const auto C_17_196 = C_17_68 * Q_7_17;
+            const auto C_5_208 = C_5_80 * Q_7_5;
+            const auto C_1_212 = C_1_84 * q_0_7;
+            const auto R_213 = 1 - (R_209 * Q_2_209 + R_197 * Q_4_197 + R_193 * C_193_20 + R_149 * Q_6_149
+                    + R_145 * C_145_68 + R_133 * C_133_80 + R_129 * C_129_84 + R_85 * Q_7_85
+                    + R_81 * C_81_132 + R_69 * C_69_144 + R_65 * C_65_148 + R_21 * C_21_192
+                    + R_17 * C_17_196 + R_5 * C_5_208 + C_1_212);
+            const auto Q_5_21 = Q_5_5 * q_4_5;
+            const auto Q_5_85 = Q_5_21 * q_5_6;
+            const auto Q_5_213 = Q_5_85 * q_5_7;
+            const auto C_209_36 = Q_2_209 * Q_5_209;
+            const auto C_197_48 = Q_4_197 * Q_5_197;
+            const auto C_193_52 = C_193_20 * Q_5_193;
+            const auto Q_2_177 = Q_2_49 * q_2_7;
+            const auto Q_4_165 = Q_4_37 * q_4_7;
+            const auto C_161_20 = Q_2_161 * Q_4_161;
+            const auto Q_5_149 = Q_5_21 * q_5_7;
+            const auto C_145_36 = Q_2_145 * Q_5_145;
+            const auto C_133_48 = Q_4_133 * Q_5_133;
+            const auto C_129_52 = C_129_20 * Q_5_129;
+            const auto C_33_20 = Q_2_33 * Q_4_33;
+            const auto C_17_36 = Q_2_17 * Q_5_17;
+            const auto C_5_48 = Q_4_5 * Q_5_5;
+            const auto C_1_52 = C_1_20 * q_0_5;
+            const auto R_53 = 1 - (R_49 * Q_2_49 + R_37 * Q_4_37 + R_33 * C_33_20 + R_21 * Q_5_21
+                    + R_17 * C_17_36 + R_5 * C_5_48 + C_1_52);
+            const auto Q_7_53 = Q_7_21 * q_5_7;
+            const auto C_49_132 = Q_2_49 * Q_7_49;
+            const auto C_37_144 = Q_4_37 * Q_7_37;
+            const auto C_33_148 = C_33_20 * Q_7_33;
+            const auto C_21_160 = Q_5_21 * Q_7_21;
+            const auto C_17_164 = C_17_36 * Q_7_17;
+            const auto C_5_176 = C_5_48 * Q_7_5;
+            const auto C_1_180 = C_1_52 * q_0_7;
+            const auto R_181 = 1 - (R_177 * Q_2_177 + R_165 * Q_4_165 + R_161 * C_161_20 + R_149 * Q_5_149
+                    + R_145 * C_145_36 + R_133 * C_133_48 + R_129 * C_129_52 + R_53 * Q_7_53
+                    + R_49 * C_49_132 + R_37 * C_37_144 + R_33 * C_33_148 + R_21 * C_21_160
+                    + R_17 * C_17_164 + R_5 * C_5_176 + C_1_180);
+            const auto Q_6_53 = Q_6_21 * q_5_6;
+            const auto Q_6_181 = Q_6_53 * q_6_7;
+            const auto C_177_68 = Q_2_177 * Q_6_177;
+            const auto C_165_80 = Q_4_165 * Q_6_165;
+            const auto C_161_84 = C_161_20 * Q_6_161;
+            const auto C_149_96 = Q_5_149 * Q_6_149;
+            const auto C_145_100 = C_145_36 * Q_6_145;
+            const auto C_133_112 = C_133_48 * Q_6_133;
+            const auto C_129_116 = C_129_52 * Q_6_129;
+            const auto C_97_20 = Q_2_97 * Q_4_97;
+            const auto C_81_36 = Q_2_81 * Q_5_81;
+            const auto C_69_48 = Q_4_69 * Q_5_69;
+            const auto C_65_52 = C_65_20 * Q_5_65;
+            const auto C_49_68 = Q_2_49 * Q_6_49;
+            const auto C_37_80 = Q_4_37 * Q_6_37;
+            const auto C_33_84 = C_33_20 * Q_6_33;
+            const auto C_21_96 = Q_5_21 * Q_6_21;
+            const auto C_17_100 = C_17_36 * Q_6_17;
+            const auto C_5_112 = C_5_48 * Q_6_5;
+            const auto C_1_116 = C_1_52 * q_0_6;
+            const auto R_117 = 1 - (R_113 * Q_2_113 + R_101 * Q_4_101 + R_97 * C_97_20 + R_85 * Q_5_85
+                    + R_81 * C_81_36 + R_69 * C_69_48 + R_65 * C_65_52 + R_53 * Q_6_53
+                    + R_49 * C_49_68 + R_37 * C_37_80 + R_33 * C_33_84 + R_21 * C_21_96
+                    + R_17 * C_17_100 + R_5 * C_5_112 + C_1_116);
+            const auto Q_7_117 = Q_7_53 * q_6_7;
+            const auto C_113_132 = Q_2_113 * Q_7_113;
+            const auto C_101_144 = Q_4_101 * Q_7_101;
+            const auto C_97_148 = C_97_20 * Q_7_97;
+            const auto C_85_160 = Q_5_85 * Q_7_85;
+            const auto C_81_164 = C_81_36 * Q_7_81;
+            const auto C_69_176 = C_69_48 * Q_7_69;
+            const auto C_65_180 = C_65_52 * Q_7_65;
+            const auto C_53_192 = Q_6_53 * Q_7_53;
+            const auto C_49_196 = C_49_68 * Q_7_49;
+            const auto C_37_208 = C_37_80 * Q_7_37;
+            const auto C_33_212 = C_33_84 * Q_7_33;
+            const auto C_21_224 = C_21_96 * Q_7_21;
+            const auto C_17_228 = C_17_100 * Q_7_17;
+            const auto C_5_240 = C_5_112 * Q_7_5;
+            const auto C_1_244 = C_1_116 * q_0_7;
+            const auto R_245 = 1 - (R_241 * Q_2_241 + R_229 * Q_4_229 + R_225 * C_225_20 + R_213 * Q_5_213
+                    + R_209 * C_209_36 + R_197 * C_197_48 + R_193 * C_193_52 + R_181 * Q_6_181
+                    + R_177 * C_177_68 + R_165 * C_165_80 + R_161 * C_161_84 + R_149 * C_149_96
+                    + R_145 * C_145_100 + R_133 * C_133_112 + R_129 * C_129_116 + R_117 * Q_7_117
+                    + R_113 * C_113_132 + R_101 * C_101_144 + R_97 * C_97_148 + R_85 * C_85_160
+                    + R_81 * C_81_164 + R_69 * C_69_176 + R_65 * C_65_180 + R_53 * C_53_192
+                    + R_49 * C_49_196 + R_37 * C_37_208 + R_33 * C_33_212 + R_21 * C_21_224
+                    + R_17 * C_17_228 + R_5 * C_5_240 + C_1_244);
+            const auto Q_3_5 = q_0_3 * q_2_3;
+            const auto Q_3_21 = Q_3_5 * q_3_4;
+            const auto Q_3_53 = Q_3_21 * q_3_5;
+            const auto Q_3_117 = Q_3_53 * q_3_6;
+            const auto Q_3_245 = Q_3_117 * q_3_7;
+            const auto C_241_12 = Q_2_241 * Q_3_241;
+            const auto Q_2_41 = Q_2_9 * q_2_5;
+            const auto Q_2_105 = Q_2_41 * q_2_6;
+            const auto Q_2_233 = Q_2_105 * q_2_7;
+            const auto Q_3_37 = Q_3_5 * q_3_5;
+            const auto Q_3_101 = Q_3_37 * q_3_6;
+            const auto Q_3_229 = Q_3_101 * q_3_7;
+            const auto C_225_12 = Q_2_225 * Q_3_225;
+            const auto Q_2_73 = Q_2_9 * q_2_6;
+            const auto Q_2_201 = Q_2_73 * q_2_7;
+            const auto Q_3_69 = Q_3_5 * q_3_6;
+            const auto Q_3_197 = Q_3_69 * q_3_7;
+            const auto C_193_12 = Q_2_193 * Q_3_193;
+            const auto Q_2_137 = Q_2_9 * q_2_7;
+            const auto Q_3_133 = Q_3_5 * q_3_7;
+            const auto C_129_12 = Q_2_129 * Q_3_129;
+            const auto C_1_12 = q_0_2 * q_0_3;
+            const auto R_13 = 1 - (R_9 * Q_2_9 + R_5 * Q_3_5 + C_1_12);
+            const auto Q_7_13 = Q_7_5 * q_3_7;
+            const auto C_9_132 = Q_2_9 * Q_7_9;
+            const auto C_5_136 = Q_3_5 * Q_7_5;
+            const auto C_1_140 = C_1_12 * q_0_7;
+            const auto R_141 = 1 - (R_137 * Q_2_137 + R_133 * Q_3_133 + R_129 * C_129_12 + R_13 * Q_7_13
+                    + R_9 * C_9_132 + R_5 * C_5_136 + C_1_140);
+            const auto Q_6_13 = Q_6_5 * q_3_6;
+            const auto Q_6_141 = Q_6_13 * q_6_7;
+            const auto C_137_68 = Q_2_137 * Q_6_137;
+            const auto C_133_72 = Q_3_133 * Q_6_133;
+            const auto C_129_76 = C_129_12 * Q_6_129;
+            const auto C_65_12 = Q_2_65 * Q_3_65;
+            const auto C_9_68 = Q_2_9 * Q_6_9;
+            const auto C_5_72 = Q_3_5 * Q_6_5;
+            const auto C_1_76 = C_1_12 * q_0_6;
+            const auto R_77 = 1 - (R_73 * Q_2_73 + R_69 * Q_3_69 + R_65 * C_65_12 + R_13 * Q_6_13
+                    + R_9 * C_9_68 + R_5 * C_5_72 + C_1_76);
+            const auto Q_7_77 = Q_7_13 * q_6_7;
+            const auto C_73_132 = Q_2_73 * Q_7_73;
+            const auto C_69_136 = Q_3_69 * Q_7_69;
+            const auto C_65_140 = C_65_12 * Q_7_65;
+            const auto C_13_192 = Q_6_13 * Q_7_13;
+            const auto C_9_196 = C_9_68 * Q_7_9;
+            const auto C_5_200 = C_5_72 * Q_7_5;
+            const auto C_1_204 = C_1_76 * q_0_7;
+            const auto R_205 = 1 - (R_201 * Q_2_201 + R_197 * Q_3_197 + R_193 * C_193_12 + R_141 * Q_6_141
+                    + R_137 * C_137_68 + R_133 * C_133_72 + R_129 * C_129_76 + R_77 * Q_7_77
+                    + R_73 * C_73_132 + R_69 * C_69_136 + R_65 * C_65_140 + R_13 * C_13_192
+                    + R_9 * C_9_196 + R_5 * C_5_200 + C_1_204);
+            const auto Q_5_13 = Q_5_5 * q_3_5;
+            const auto Q_5_77 = Q_5_13 * q_5_6;
+            const auto Q_5_205 = Q_5_77 * q_5_7;
+            const auto C_201_36 = Q_2_201 * Q_5_201;
+            const auto C_197_40 = Q_3_197 * Q_5_197;
+            const auto C_193_44 = C_193_12 * Q_5_193;
+            const auto Q_2_169 = Q_2_41 * q_2_7;
+            const auto Q_3_165 = Q_3_37 * q_3_7;
+            const auto C_161_12 = Q_2_161 * Q_3_161;
+            const auto Q_5_141 = Q_5_13 * q_5_7;
+            const auto C_137_36 = Q_2_137 * Q_5_137;
+            const auto C_133_40 = Q_3_133 * Q_5_133;
+            const auto C_129_44 = C_129_12 * Q_5_129;
+            const auto C_33_12 = Q_2_33 * Q_3_33;
+            const auto C_9_36 = Q_2_9 * Q_5_9;
+            const auto C_5_40 = Q_3_5 * Q_5_5;
+            const auto C_1_44 = C_1_12 * q_0_5;
+            const auto R_45 = 1 - (R_41 * Q_2_41 + R_37 * Q_3_37 + R_33 * C_33_12 + R_13 * Q_5_13
+                    + R_9 * C_9_36 + R_5 * C_5_40 + C_1_44);
+            const auto Q_7_45 = Q_7_13 * q_5_7;
+            const auto C_41_132 = Q_2_41 * Q_7_41;
+            const auto C_37_136 = Q_3_37 * Q_7_37;
+            const auto C_33_140 = C_33_12 * Q_7_33;
+            const auto C_13_160 = Q_5_13 * Q_7_13;
+            const auto C_9_164 = C_9_36 * Q_7_9;
+            const auto C_5_168 = C_5_40 * Q_7_5;
+            const auto C_1_172 = C_1_44 * q_0_7;
+            const auto R_173 = 1 - (R_169 * Q_2_169 + R_165 * Q_3_165 + R_161 * C_161_12 + R_141 * Q_5_141
+                    + R_137 * C_137_36 + R_133 * C_133_40 + R_129 * C_129_44 + R_45 * Q_7_45
+                    + R_41 * C_41_132 + R_37 * C_37_136 + R_33 * C_33_140 + R_13 * C_13_160
+                    + R_9 * C_9_164 + R_5 * C_5_168 + C_1_172);
+            const auto Q_6_45 = Q_6_13 * q_5_6;
+            const auto Q_6_173 = Q_6_45 * q_6_7;
+            const auto C_169_68 = Q_2_169 * Q_6_169;
+            const auto C_165_72 = Q_3_165 * Q_6_165;
+            const auto C_161_76 = C_161_12 * Q_6_161;
+            const auto C_141_96 = Q_5_141 * Q_6_141;
+            const auto C_137_100 = C_137_36 * Q_6_137;
+            const auto C_133_104 = C_133_40 * Q_6_133;
+            const auto C_129_108 = C_129_44 * Q_6_129;
+            const auto C_97_12 = Q_2_97 * Q_3_97;
+            const auto C_73_36 = Q_2_73 * Q_5_73;
+            const auto C_69_40 = Q_3_69 * Q_5_69;
+            const auto C_65_44 = C_65_12 * Q_5_65;
+            const auto C_41_68 = Q_2_41 * Q_6_41;
+            const auto C_37_72 = Q_3_37 * Q_6_37;
+            const auto C_33_76 = C_33_12 * Q_6_33;
+            const auto C_13_96 = Q_5_13 * Q_6_13;
+            const auto C_9_100 = C_9_36 * Q_6_9;
+            const auto C_5_104 = C_5_40 * Q_6_5;
+            const auto C_1_108 = C_1_44 * q_0_6;
+            const auto R_109 = 1 - (R_105 * Q_2_105 + R_101 * Q_3_101 + R_97 * C_97_12 + R_77 * Q_5_77
+                    + R_73 * C_73_36 + R_69 * C_69_40 + R_65 * C_65_44 + R_45 * Q_6_45
+                    + R_41 * C_41_68 + R_37 * C_37_72 + R_33 * C_33_76 + R_13 * C_13_96
+                    + R_9 * C_9_100 + R_5 * C_5_104 + C_1_108);
+            const auto Q_7_109 = Q_7_45 * q_6_7;
+            const auto C_105_132 = Q_2_105 * Q_7_105;
+            const auto C_101_136 = Q_3_101 * Q_7_101;
+            const auto C_97_140 = C_97_12 * Q_7_97;
+            const auto C_77_160 = Q_5_77 * Q_7_77;
+            const auto C_73_164 = C_73_36 * Q_7_73;
+            const auto C_69_168 = C_69_40 * Q_7_69;
+            const auto C_65_172 = C_65_44 * Q_7_65;
+            const auto C_45_192 = Q_6_45 * Q_7_45;
+            const auto C_41_196 = C_41_68 * Q_7_41;
+            const auto C_37_200 = C_37_72 * Q_7_37;
+            const auto C_33_204 = C_33_76 * Q_7_33;
+            const auto C_13_224 = C_13_96 * Q_7_13;
+            const auto C_9_228 = C_9_100 * Q_7_9;
+            const auto C_5_232 = C_5_104 * Q_7_5;
+            const auto C_1_236 = C_1_108 * q_0_7;
+            const auto R_237 = 1 - (R_233 * Q_2_233 + R_229 * Q_3_229 + R_225 * C_225_12 + R_205 * Q_5_205
+                    + R_201 * C_201_36 + R_197 * C_197_40 + R_193 * C_193_44 + R_173 * Q_6_173
+                    + R_169 * C_169_68 + R_165 * C_165_72 + R_161 * C_161_76 + R_141 * C_141_96
+                    + R_137 * C_137_100 + R_133 * C_133_104 + R_129 * C_129_108 + R_109 * Q_7_109
+                    + R_105 * C_105_132 + R_101 * C_101_136 + R_97 * C_97_140 + R_77 * C_77_160
+                    + R_73 * C_73_164 + R_69 * C_69_168 + R_65 * C_65_172 + R_45 * C_45_192
+                    + R_41 * C_41_196 + R_37 * C_37_200 + R_33 * C_33_204 + R_13 * C_13_224
+                    + R_9 * C_9_228 + R_5 * C_5_232 + C_1_236);
+            const auto Q_4_13 = Q_4_5 * q_3_4;
+            const auto Q_4_45 = Q_4_13 * q_4_5;
+            const auto Q_4_109 = Q_4_45 * q_4_6;
+            const auto Q_4_237 = Q_4_109 * q_4_7;
+            const auto C_233_20 = Q_2_233 * Q_4_233;
+            const auto C_229_24 = Q_3_229 * Q_4_229;
+            const auto C_225_28 = C_225_12 * Q_4_225;
+            const auto Q_2_89 = Q_2_25 * q_2_6;
+            const auto Q_2_217 = Q_2_89 * q_2_7;
+            const auto Q_3_85 = Q_3_21 * q_3_6;
+            const auto Q_3_213 = Q_3_85 * q_3_7;
+            const auto C_209_12 = Q_2_209 * Q_3_209;
+            const auto Q_4_77 = Q_4_13 * q_4_6;
+            const auto Q_4_205 = Q_4_77 * q_4_7;
+            const auto C_201_20 = Q_2_201 * Q_4_201;
+            const auto C_197_24 = Q_3_197 * Q_4_197;
+            const auto C_193_28 = C_193_12 * Q_4_193;
+            const auto Q_2_153 = Q_2_25 * q_2_7;
+            const auto Q_3_149 = Q_3_21 * q_3_7;
+            const auto C_145_12 = Q_2_145 * Q_3_145;
+            const auto Q_4_141 = Q_4_13 * q_4_7;
+            const auto C_137_20 = Q_2_137 * Q_4_137;
+            const auto C_133_24 = Q_3_133 * Q_4_133;
+            const auto C_129_28 = C_129_12 * Q_4_129;
+            const auto C_17_12 = Q_2_17 * Q_3_17;
+            const auto C_9_20 = Q_2_9 * Q_4_9;
+            const auto C_5_24 = Q_3_5 * Q_4_5;
+            const auto C_1_28 = C_1_12 * q_0_4;
+            const auto R_29 = 1 - (R_25 * Q_2_25 + R_21 * Q_3_21 + R_17 * C_17_12 + R_13 * Q_4_13
+                    + R_9 * C_9_20 + R_5 * C_5_24 + C_1_28);
+            const auto Q_7_29 = Q_7_13 * q_4_7;
+            const auto C_25_132 = Q_2_25 * Q_7_25;
+            const auto C_21_136 = Q_3_21 * Q_7_21;
+            const auto C_17_140 = C_17_12 * Q_7_17;
+            const auto C_13_144 = Q_4_13 * Q_7_13;
+            const auto C_9_148 = C_9_20 * Q_7_9;
+            const auto C_5_152 = C_5_24 * Q_7_5;
+            const auto C_1_156 = C_1_28 * q_0_7;
+            const auto R_157 = 1 - (R_153 * Q_2_153 + R_149 * Q_3_149 + R_145 * C_145_12 + R_141 * Q_4_141
+                    + R_137 * C_137_20 + R_133 * C_133_24 + R_129 * C_129_28 + R_29 * Q_7_29
+                    + R_25 * C_25_132 + R_21 * C_21_136 + R_17 * C_17_140 + R_13 * C_13_144
+                    + R_9 * C_9_148 + R_5 * C_5_152 + C_1_156);
+            const auto Q_6_29 = Q_6_13 * q_4_6;
+            const auto Q_6_157 = Q_6_29 * q_6_7;
+            const auto C_153_68 = Q_2_153 * Q_6_153;
+            const auto C_149_72 = Q_3_149 * Q_6_149;
+            const auto C_145_76 = C_145_12 * Q_6_145;
+            const auto C_141_80 = Q_4_141 * Q_6_141;
+            const auto C_137_84 = C_137_20 * Q_6_137;
+            const auto C_133_88 = C_133_24 * Q_6_133;
+            const auto C_129_92 = C_129_28 * Q_6_129;
+            const auto C_81_12 = Q_2_81 * Q_3_81;
+            const auto C_73_20 = Q_2_73 * Q_4_73;
+            const auto C_69_24 = Q_3_69 * Q_4_69;
+            const auto C_65_28 = C_65_12 * Q_4_65;
+            const auto C_25_68 = Q_2_25 * Q_6_25;
+            const auto C_21_72 = Q_3_21 * Q_6_21;
+            const auto C_17_76 = C_17_12 * Q_6_17;
+            const auto C_13_80 = Q_4_13 * Q_6_13;
+            const auto C_9_84 = C_9_20 * Q_6_9;
+            const auto C_5_88 = C_5_24 * Q_6_5;
+            const auto C_1_92 = C_1_28 * q_0_6;
+            const auto R_93 = 1 - (R_89 * Q_2_89 + R_85 * Q_3_85 + R_81 * C_81_12 + R_77 * Q_4_77
+                    + R_73 * C_73_20 + R_69 * C_69_24 + R_65 * C_65_28 + R_29 * Q_6_29
+                    + R_25 * C_25_68 + R_21 * C_21_72 + R_17 * C_17_76 + R_13 * C_13_80
+                    + R_9 * C_9_84 + R_5 * C_5_88 + C_1_92);
+            const auto Q_7_93 = Q_7_29 * q_6_7;
+            const auto C_89_132 = Q_2_89 * Q_7_89;
+            const auto C_85_136 = Q_3_85 * Q_7_85;
+            const auto C_81_140 = C_81_12 * Q_7_81;
+            const auto C_77_144 = Q_4_77 * Q_7_77;
+            const auto C_73_148 = C_73_20 * Q_7_73;
+            const auto C_69_152 = C_69_24 * Q_7_69;
+            const auto C_65_156 = C_65_28 * Q_7_65;
+            const auto C_29_192 = Q_6_29 * Q_7_29;
+            const auto C_25_196 = C_25_68 * Q_7_25;
+            const auto C_21_200 = C_21_72 * Q_7_21;
+            const auto C_17_204 = C_17_76 * Q_7_17;
+            const auto C_13_208 = C_13_80 * Q_7_13;
+            const auto C_9_212 = C_9_84 * Q_7_9;
+            const auto C_5_216 = C_5_88 * Q_7_5;
+            const auto C_1_220 = C_1_92 * q_0_7;
+            const auto R_221 = 1 - (R_217 * Q_2_217 + R_213 * Q_3_213 + R_209 * C_209_12 + R_205 * Q_4_205
+                    + R_201 * C_201_20 + R_197 * C_197_24 + R_193 * C_193_28 + R_157 * Q_6_157
+                    + R_153 * C_153_68 + R_149 * C_149_72 + R_145 * C_145_76 + R_141 * C_141_80
+                    + R_137 * C_137_84 + R_133 * C_133_88 + R_129 * C_129_92 + R_93 * Q_7_93
+                    + R_89 * C_89_132 + R_85 * C_85_136 + R_81 * C_81_140 + R_77 * C_77_144
+                    + R_73 * C_73_148 + R_69 * C_69_152 + R_65 * C_65_156 + R_29 * C_29_192
+                    + R_25 * C_25_196 + R_21 * C_21_200 + R_17 * C_17_204 + R_13 * C_13_208
+                    + R_9 * C_9_212 + R_5 * C_5_216 + C_1_220);
+            const auto Q_5_29 = Q_5_13 * q_4_5;
+            const auto Q_5_93 = Q_5_29 * q_5_6;
+            const auto Q_5_221 = Q_5_93 * q_5_7;
+            const auto C_217_36 = Q_2_217 * Q_5_217;
+            const auto C_213_40 = Q_3_213 * Q_5_213;
+            const auto C_209_44 = C_209_12 * Q_5_209;
+            const auto C_205_48 = Q_4_205 * Q_5_205;
+            const auto C_201_52 = C_201_20 * Q_5_201;
+            const auto C_197_56 = C_197_24 * Q_5_197;
+            const auto C_193_60 = C_193_28 * Q_5_193;
+            const auto Q_2_185 = Q_2_57 * q_2_7;
+            const auto Q_3_181 = Q_3_53 * q_3_7;
+            const auto C_177_12 = Q_2_177 * Q_3_177;
+            const auto Q_4_173 = Q_4_45 * q_4_7;
+            const auto C_169_20 = Q_2_169 * Q_4_169;
+            const auto C_165_24 = Q_3_165 * Q_4_165;
+            const auto C_161_28 = C_161_12 * Q_4_161;
+            const auto Q_5_157 = Q_5_29 * q_5_7;
+            const auto C_153_36 = Q_2_153 * Q_5_153;
+            const auto C_149_40 = Q_3_149 * Q_5_149;
+            const auto C_145_44 = C_145_12 * Q_5_145;
+            const auto C_141_48 = Q_4_141 * Q_5_141;
+            const auto C_137_52 = C_137_20 * Q_5_137;
+            const auto C_133_56 = C_133_24 * Q_5_133;
+            const auto C_129_60 = C_129_28 * Q_5_129;
+            const auto C_49_12 = Q_2_49 * Q_3_49;
+            const auto C_41_20 = Q_2_41 * Q_4_41;
+            const auto C_37_24 = Q_3_37 * Q_4_37;
+            const auto C_33_28 = C_33_12 * Q_4_33;
+            const auto C_25_36 = Q_2_25 * Q_5_25;
+            const auto C_21_40 = Q_3_21 * Q_5_21;
+            const auto C_17_44 = C_17_12 * Q_5_17;
+            const auto C_13_48 = Q_4_13 * Q_5_13;
+            const auto C_9_52 = C_9_20 * Q_5_9;
+            const auto C_5_56 = C_5_24 * Q_5_5;
+            const auto C_1_60 = C_1_28 * q_0_5;
+            const auto R_61 = 1 - (R_57 * Q_2_57 + R_53 * Q_3_53 + R_49 * C_49_12 + R_45 * Q_4_45
+                    + R_41 * C_41_20 + R_37 * C_37_24 + R_33 * C_33_28 + R_29 * Q_5_29
+                    + R_25 * C_25_36 + R_21 * C_21_40 + R_17 * C_17_44 + R_13 * C_13_48
+                    + R_9 * C_9_52 + R_5 * C_5_56 + C_1_60);
+            const auto Q_7_61 = Q_7_29 * q_5_7;
+            const auto C_57_132 = Q_2_57 * Q_7_57;
+            const auto C_53_136 = Q_3_53 * Q_7_53;
+            const auto C_49_140 = C_49_12 * Q_7_49;
+            const auto C_45_144 = Q_4_45 * Q_7_45;
+            const auto C_41_148 = C_41_20 * Q_7_41;
+            const auto C_37_152 = C_37_24 * Q_7_37;
+            const auto C_33_156 = C_33_28 * Q_7_33;
+            const auto C_29_160 = Q_5_29 * Q_7_29;
+            const auto C_25_164 = C_25_36 * Q_7_25;
+            const auto C_21_168 = C_21_40 * Q_7_21;
+            const auto C_17_172 = C_17_44 * Q_7_17;
+            const auto C_13_176 = C_13_48 * Q_7_13;
+            const auto C_9_180 = C_9_52 * Q_7_9;
+            const auto C_5_184 = C_5_56 * Q_7_5;
+            const auto C_1_188 = C_1_60 * q_0_7;
+            const auto R_189 = 1 - (R_185 * Q_2_185 + R_181 * Q_3_181 + R_177 * C_177_12 + R_173 * Q_4_173
+                    + R_169 * C_169_20 + R_165 * C_165_24 + R_161 * C_161_28 + R_157 * Q_5_157
+                    + R_153 * C_153_36 + R_149 * C_149_40 + R_145 * C_145_44 + R_141 * C_141_48
+                    + R_137 * C_137_52 + R_133 * C_133_56 + R_129 * C_129_60 + R_61 * Q_7_61
+                    + R_57 * C_57_132 + R_53 * C_53_136 + R_49 * C_49_140 + R_45 * C_45_144
+                    + R_41 * C_41_148 + R_37 * C_37_152 + R_33 * C_33_156 + R_29 * C_29_160
+                    + R_25 * C_25_164 + R_21 * C_21_168 + R_17 * C_17_172 + R_13 * C_13_176
+                    + R_9 * C_9_180 + R_5 * C_5_184 + C_1_188);
+            const auto Q_6_61 = Q_6_29 * q_5_6;
+            const auto Q_6_189 = Q_6_61 * q_6_7;
+            const auto C_185_68 = Q_2_185 * Q_6_185;
+            const auto C_181_72 = Q_3_181 * Q_6_181;
+            const auto C_177_76 = C_177_12 * Q_6_177;
+            const auto C_173_80 = Q_4_173 * Q_6_173;
+            const auto C_169_84 = C_169_20 * Q_6_169;
+            const auto C_165_88 = C_165_24 * Q_6_165;
+            const auto C_161_92 = C_161_28 * Q_6_161;
+            const auto C_157_96 = Q_5_157 * Q_6_157;
+            const auto C_153_100 = C_153_36 * Q_6_153;
+            const auto C_149_104 = C_149_40 * Q_6_149;
+            const auto C_145_108 = C_145_44 * Q_6_145;
+            const auto C_141_112 = C_141_48 * Q_6_141;
+            const auto C_137_116 = C_137_52 * Q_6_137;
+            const auto C_133_120 = C_133_56 * Q_6_133;
+            const auto C_129_124 = C_129_60 * Q_6_129;
+            const auto C_113_12 = Q_2_113 * Q_3_113;
+            const auto C_105_20 = Q_2_105 * Q_4_105;
+            const auto C_101_24 = Q_3_101 * Q_4_101;
+            const auto C_97_28 = C_97_12 * Q_4_97;
+            const auto C_89_36 = Q_2_89 * Q_5_89;
+            const auto C_85_40 = Q_3_85 * Q_5_85;
+            const auto C_81_44 = C_81_12 * Q_5_81;
+            const auto C_77_48 = Q_4_77 * Q_5_77;
+            const auto C_73_52 = C_73_20 * Q_5_73;
+            const auto C_69_56 = C_69_24 * Q_5_69;
+            const auto C_65_60 = C_65_28 * Q_5_65;
+            const auto C_57_68 = Q_2_57 * Q_6_57;
+            const auto C_53_72 = Q_3_53 * Q_6_53;
+            const auto C_49_76 = C_49_12 * Q_6_49;
+            const auto C_45_80 = Q_4_45 * Q_6_45;
+            const auto C_41_84 = C_41_20 * Q_6_41;
+            const auto C_37_88 = C_37_24 * Q_6_37;
+            const auto C_33_92 = C_33_28 * Q_6_33;
+            const auto C_29_96 = Q_5_29 * Q_6_29;
+            const auto C_25_100 = C_25_36 * Q_6_25;
+            const auto C_21_104 = C_21_40 * Q_6_21;
+            const auto C_17_108 = C_17_44 * Q_6_17;
+            const auto C_13_112 = C_13_48 * Q_6_13;
+            const auto C_9_116 = C_9_52 * Q_6_9;
+            const auto C_5_120 = C_5_56 * Q_6_5;
+            const auto C_1_124 = C_1_60 * q_0_6;
+            const auto R_125 = 1 - (R_121 * Q_2_121 + R_117 * Q_3_117 + R_113 * C_113_12 + R_109 * Q_4_109
+                    + R_105 * C_105_20 + R_101 * C_101_24 + R_97 * C_97_28 + R_93 * Q_5_93
+                    + R_89 * C_89_36 + R_85 * C_85_40 + R_81 * C_81_44 + R_77 * C_77_48
+                    + R_73 * C_73_52 + R_69 * C_69_56 + R_65 * C_65_60 + R_61 * Q_6_61
+                    + R_57 * C_57_68 + R_53 * C_53_72 + R_49 * C_49_76 + R_45 * C_45_80
+                    + R_41 * C_41_84 + R_37 * C_37_88 + R_33 * C_33_92 + R_29 * C_29_96
+                    + R_25 * C_25_100 + R_21 * C_21_104 + R_17 * C_17_108 + R_13 * C_13_112
+                    + R_9 * C_9_116 + R_5 * C_5_120 + C_1_124);
+            const auto Q_7_125 = Q_7_61 * q_6_7;
+            const auto C_121_132 = Q_2_121 * Q_7_121;
+            const auto C_117_136 = Q_3_117 * Q_7_117;
+            const auto C_113_140 = C_113_12 * Q_7_113;
+            const auto C_109_144 = Q_4_109 * Q_7_109;
+            const auto C_105_148 = C_105_20 * Q_7_105;
+            const auto C_101_152 = C_101_24 * Q_7_101;
+            const auto C_97_156 = C_97_28 * Q_7_97;
+            const auto C_93_160 = Q_5_93 * Q_7_93;
+            const auto C_89_164 = C_89_36 * Q_7_89;
+            const auto C_85_168 = C_85_40 * Q_7_85;
+            const auto C_81_172 = C_81_44 * Q_7_81;
+            const auto C_77_176 = C_77_48 * Q_7_77;
+            const auto C_73_180 = C_73_52 * Q_7_73;
+            const auto C_69_184 = C_69_56 * Q_7_69;
+            const auto C_65_188 = C_65_60 * Q_7_65;
+            const auto C_61_192 = Q_6_61 * Q_7_61;
+            const auto C_57_196 = C_57_68 * Q_7_57;
+            const auto C_53_200 = C_53_72 * Q_7_53;
+            const auto C_49_204 = C_49_76 * Q_7_49;
+            const auto C_45_208 = C_45_80 * Q_7_45;
+            const auto C_41_212 = C_41_84 * Q_7_41;
+            const auto C_37_216 = C_37_88 * Q_7_37;
+            const auto C_33_220 = C_33_92 * Q_7_33;
+            const auto C_29_224 = C_29_96 * Q_7_29;
+            const auto C_25_228 = C_25_100 * Q_7_25;
+            const auto C_21_232 = C_21_104 * Q_7_21;
+            const auto C_17_236 = C_17_108 * Q_7_17;
+            const auto C_13_240 = C_13_112 * Q_7_13;
+            const auto C_9_244 = C_9_116 * Q_7_9;
+            const auto C_5_248 = C_5_120 * Q_7_5;
+            const auto C_1_252 = C_1_124 * q_0_7;
+            const auto R_253 = 1 - (R_249 * Q_2_249 + R_245 * Q_3_245 + R_241 * C_241_12 + R_237 * Q_4_237
+                    + R_233 * C_233_20 + R_229 * C_229_24 + R_225 * C_225_28 + R_221 * Q_5_221
+                    + R_217 * C_217_36 + R_213 * C_213_40 + R_209 * C_209_44 + R_205 * C_205_48
+                    + R_201 * C_201_52 + R_197 * C_197_56 + R_193 * C_193_60 + R_189 * Q_6_189
+                    + R_185 * C_185_68 + R_181 * C_181_72 + R_177 * C_177_76 + R_173 * C_173_80
+                    + R_169 * C_169_84 + R_165 * C_165_88 + R_161 * C_161_92 + R_157 * C_157_96
+                    + R_153 * C_153_100 + R_149 * C_149_104 + R_145 * C_145_108 + R_141 * C_141_112
+                    + R_137 * C_137_116 + R_133 * C_133_120 + R_129 * C_129_124 + R_125 * Q_7_125
+                    + R_121 * C_121_132 + R_117 * C_117_136 + R_113 * C_113_140 + R_109 * C_109_144
+                    + R_105 * C_105_148 + R_101 * C_101_152 + R_97 * C_97_156 + R_93 * C_93_160
+                    + R_89 * C_89_164 + R_85 * C_85_168 + R_81 * C_81_172 + R_77 * C_77_176
+                    + R_73 * C_73_180 + R_69 * C_69_184 + R_65 * C_65_188 + R_61 * C_61_192
+                    + R_57 * C_57_196 + R_53 * C_53_200 + R_49 * C_49_204 + R_45 * C_45_208
+                    + R_41 * C_41_212 + R_37 * C_37_216 + R_33 * C_33_220 + R_29 * C_29_224
+                    + R_25 * C_25_228 + R_21 * C_21_232 + R_17 * C_17_236 + R_13 * C_13_240
+                    + R_9 * C_9_244 + R_5 * C_5_248 + C_1_252);
+            const auto Q_1_5 = q_0_1 * q_1_2;
+            const auto Q_1_13 = Q_1_5 * q_1_3;
+            const auto Q_1_29 = Q_1_13 * q_1_4;
+            const auto Q_1_61 = Q_1_29 * q_1_5;
+            const auto Q_1_125 = Q_1_61 * q_1_6;
+            const auto Q_1_253 = Q_1_125 * q_1_7;
+            const auto Q_1_9 = q_0_1 * q_1_3;
+            const auto Q_1_25 = Q_1_9 * q_1_4;
+            const auto Q_1_57 = Q_1_25 * q_1_5;
+            const auto Q_1_121 = Q_1_57 * q_1_6;
+            const auto Q_1_249 = Q_1_121 * q_1_7;
+            const auto Q_1_17 = q_0_1 * q_1_4;
+            const auto Q_1_49 = Q_1_17 * q_1_5;
+            const auto Q_1_113 = Q_1_49 * q_1_6;
+            const auto Q_1_241 = Q_1_113 * q_1_7;
+            const auto Q_1_33 = q_0_1 * q_1_5;
+            const auto Q_1_97 = Q_1_33 * q_1_6;
+            const auto Q_1_225 = Q_1_97 * q_1_7;
+            const auto Q_1_65 = q_0_1 * q_1_6;
+            const auto Q_1_193 = Q_1_65 * q_1_7;
+            const auto Q_1_129 = q_0_1 * q_1_7;
+            const auto R_3 = 1 - q_0_1;
+            const auto Q_7_3 = q_0_7 * q_1_7;
+            const auto C_1_130 = q_0_1 * q_0_7;
+            const auto R_131 = 1 - (R_129 * Q_1_129 + R_3 * Q_7_3 + C_1_130);
+            const auto Q_6_3 = q_0_6 * q_1_6;
+            const auto Q_6_131 = Q_6_3 * q_6_7;
+            const auto C_129_66 = Q_1_129 * Q_6_129;
+            const auto C_1_66 = q_0_1 * q_0_6;
+            const auto R_67 = 1 - (R_65 * Q_1_65 + R_3 * Q_6_3 + C_1_66);
+            const auto Q_7_67 = Q_7_3 * q_6_7;
+            const auto C_65_130 = Q_1_65 * Q_7_65;
+            const auto C_3_192 = Q_6_3 * Q_7_3;
+            const auto C_1_194 = C_1_66 * q_0_7;
+            const auto R_195 = 1 - (R_193 * Q_1_193 + R_131 * Q_6_131 + R_129 * C_129_66 + R_67 * Q_7_67
+                    + R_65 * C_65_130 + R_3 * C_3_192 + C_1_194);
+            const auto Q_5_3 = q_0_5 * q_1_5;
+            const auto Q_5_67 = Q_5_3 * q_5_6;
+            const auto Q_5_195 = Q_5_67 * q_5_7;
+            const auto C_193_34 = Q_1_193 * Q_5_193;
+            const auto Q_1_161 = Q_1_33 * q_1_7;
+            const auto Q_5_131 = Q_5_3 * q_5_7;
+            const auto C_129_34 = Q_1_129 * Q_5_129;
+            const auto C_1_34 = q_0_1 * q_0_5;
+            const auto R_35 = 1 - (R_33 * Q_1_33 + R_3 * Q_5_3 + C_1_34);
+            const auto Q_7_35 = Q_7_3 * q_5_7;
+            const auto C_33_130 = Q_1_33 * Q_7_33;
+            const auto C_3_160 = Q_5_3 * Q_7_3;
+            const auto C_1_162 = C_1_34 * q_0_7;
+            const auto R_163 = 1 - (R_161 * Q_1_161 + R_131 * Q_5_131 + R_129 * C_129_34 + R_35 * Q_7_35
+                    + R_33 * C_33_130 + R_3 * C_3_160 + C_1_162);
+            const auto Q_6_35 = Q_6_3 * q_5_6;
+            const auto Q_6_163 = Q_6_35 * q_6_7;
+            const auto C_161_66 = Q_1_161 * Q_6_161;
+            const auto C_131_96 = Q_5_131 * Q_6_131;
+            const auto C_129_98 = C_129_34 * Q_6_129;
+            const auto C_65_34 = Q_1_65 * Q_5_65;
+            const auto C_33_66 = Q_1_33 * Q_6_33;
+            const auto C_3_96 = Q_5_3 * Q_6_3;
+            const auto C_1_98 = C_1_34 * q_0_6;
+            const auto R_99 = 1 - (R_97 * Q_1_97 + R_67 * Q_5_67 + R_65 * C_65_34 + R_35 * Q_6_35
+                    + R_33 * C_33_66 + R_3 * C_3_96 + C_1_98);
+            const auto Q_7_99 = Q_7_35 * q_6_7;
+            const auto C_97_130 = Q_1_97 * Q_7_97;
+            const auto C_67_160 = Q_5_67 * Q_7_67;
+            const auto C_65_162 = C_65_34 * Q_7_65;
+            const auto C_35_192 = Q_6_35 * Q_7_35;
+            const auto C_33_194 = C_33_66 * Q_7_33;
+            const auto C_3_224 = C_3_96 * Q_7_3;
+            const auto C_1_226 = C_1_98 * q_0_7;
+            const auto R_227 = 1 - (R_225 * Q_1_225 + R_195 * Q_5_195 + R_193 * C_193_34 + R_163 * Q_6_163
+                    + R_161 * C_161_66 + R_131 * C_131_96 + R_129 * C_129_98 + R_99 * Q_7_99
+                    + R_97 * C_97_130 + R_67 * C_67_160 + R_65 * C_65_162 + R_35 * C_35_192
+                    + R_33 * C_33_194 + R_3 * C_3_224 + C_1_226);
+            const auto Q_4_3 = q_0_4 * q_1_4;
+            const auto Q_4_35 = Q_4_3 * q_4_5;
+            const auto Q_4_99 = Q_4_35 * q_4_6;
+            const auto Q_4_227 = Q_4_99 * q_4_7;
+            const auto C_225_18 = Q_1_225 * Q_4_225;
+            const auto Q_1_81 = Q_1_17 * q_1_6;
+            const auto Q_1_209 = Q_1_81 * q_1_7;
+            const auto Q_4_67 = Q_4_3 * q_4_6;
+            const auto Q_4_195 = Q_4_67 * q_4_7;
+            const auto C_193_18 = Q_1_193 * Q_4_193;
+            const auto Q_1_145 = Q_1_17 * q_1_7;
+            const auto Q_4_131 = Q_4_3 * q_4_7;
+            const auto C_129_18 = Q_1_129 * Q_4_129;
+            const auto C_1_18 = q_0_1 * q_0_4;
+            const auto R_19 = 1 - (R_17 * Q_1_17 + R_3 * Q_4_3 + C_1_18);
+            const auto Q_7_19 = Q_7_3 * q_4_7;
+            const auto C_17_130 = Q_1_17 * Q_7_17;
+            const auto C_3_144 = Q_4_3 * Q_7_3;
+            const auto C_1_146 = C_1_18 * q_0_7;
+            const auto R_147 = 1 - (R_145 * Q_1_145 + R_131 * Q_4_131 + R_129 * C_129_18 + R_19 * Q_7_19
+                    + R_17 * C_17_130 + R_3 * C_3_144 + C_1_146);
+            const auto Q_6_19 = Q_6_3 * q_4_6;
+            const auto Q_6_147 = Q_6_19 * q_6_7;
+            const auto C_145_66 = Q_1_145 * Q_6_145;
+            const auto C_131_80 = Q_4_131 * Q_6_131;
+            const auto C_129_82 = C_129_18 * Q_6_129;
+            const auto C_65_18 = Q_1_65 * Q_4_65;
+            const auto C_17_66 = Q_1_17 * Q_6_17;
+            const auto C_3_80 = Q_4_3 * Q_6_3;
+            const auto C_1_82 = C_1_18 * q_0_6;
+            const auto R_83 = 1 - (R_81 * Q_1_81 + R_67 * Q_4_67 + R_65 * C_65_18 + R_19 * Q_6_19
+                    + R_17 * C_17_66 + R_3 * C_3_80 + C_1_82);
+            const auto Q_7_83 = Q_7_19 * q_6_7;
+            const auto C_81_130 = Q_1_81 * Q_7_81;
+            const auto C_67_144 = Q_4_67 * Q_7_67;
+            const auto C_65_146 = C_65_18 * Q_7_65;
+            const auto C_19_192 = Q_6_19 * Q_7_19;
+            const auto C_17_194 = C_17_66 * Q_7_17;
+            const auto C_3_208 = C_3_80 * Q_7_3;
+            const auto C_1_210 = C_1_82 * q_0_7;
+            const auto R_211 = 1 - (R_209 * Q_1_209 + R_195 * Q_4_195 + R_193 * C_193_18 + R_147 * Q_6_147
+                    + R_145 * C_145_66 + R_131 * C_131_80 + R_129 * C_129_82 + R_83 * Q_7_83
+                    + R_81 * C_81_130 + R_67 * C_67_144 + R_65 * C_65_146 + R_19 * C_19_192
+                    + R_17 * C_17_194 + R_3 * C_3_208 + C_1_210);
+            const auto Q_5_19 = Q_5_3 * q_4_5;
+            const auto Q_5_83 = Q_5_19 * q_5_6;
+            const auto Q_5_211 = Q_5_83 * q_5_7;
+            const auto C_209_34 = Q_1_209 * Q_5_209;
+            const auto C_195_48 = Q_4_195 * Q_5_195;
+            const auto C_193_50 = C_193_18 * Q_5_193;
+            const auto Q_1_177 = Q_1_49 * q_1_7;
+            const auto Q_4_163 = Q_4_35 * q_4_7;
+            const auto C_161_18 = Q_1_161 * Q_4_161;
+            const auto Q_5_147 = Q_5_19 * q_5_7;
+            const auto C_145_34 = Q_1_145 * Q_5_145;
+            const auto C_131_48 = Q_4_131 * Q_5_131;
+            const auto C_129_50 = C_129_18 * Q_5_129;
+            const auto C_33_18 = Q_1_33 * Q_4_33;
+            const auto C_17_34 = Q_1_17 * Q_5_17;
+            const auto C_3_48 = Q_4_3 * Q_5_3;
+            const auto C_1_50 = C_1_18 * q_0_5;
+            const auto R_51 = 1 - (R_49 * Q_1_49 + R_35 * Q_4_35 + R_33 * C_33_18 + R_19 * Q_5_19
+                    + R_17 * C_17_34 + R_3 * C_3_48 + C_1_50);
+            const auto Q_7_51 = Q_7_19 * q_5_7;
+            const auto C_49_130 = Q_1_49 * Q_7_49;
+            const auto C_35_144 = Q_4_35 * Q_7_35;
+            const auto C_33_146 = C_33_18 * Q_7_33;
+            const auto C_19_160 = Q_5_19 * Q_7_19;
+            const auto C_17_162 = C_17_34 * Q_7_17;
+            const auto C_3_176 = C_3_48 * Q_7_3;
+            const auto C_1_178 = C_1_50 * q_0_7;
+            const auto R_179 = 1 - (R_177 * Q_1_177 + R_163 * Q_4_163 + R_161 * C_161_18 + R_147 * Q_5_147
+                    + R_145 * C_145_34 + R_131 * C_131_48 + R_129 * C_129_50 + R_51 * Q_7_51
+                    + R_49 * C_49_130 + R_35 * C_35_144 + R_33 * C_33_146 + R_19 * C_19_160
+                    + R_17 * C_17_162 + R_3 * C_3_176 + C_1_178);
+            const auto Q_6_51 = Q_6_19 * q_5_6;
+            const auto Q_6_179 = Q_6_51 * q_6_7;
+            const auto C_177_66 = Q_1_177 * Q_6_177;
+            const auto C_163_80 = Q_4_163 * Q_6_163;
+            const auto C_161_82 = C_161_18 * Q_6_161;
+            const auto C_147_96 = Q_5_147 * Q_6_147;
+            const auto C_145_98 = C_145_34 * Q_6_145;
+            const auto C_131_112 = C_131_48 * Q_6_131;
+            const auto C_129_114 = C_129_50 * Q_6_129;
+            const auto C_97_18 = Q_1_97 * Q_4_97;
+            const auto C_81_34 = Q_1_81 * Q_5_81;
+            const auto C_67_48 = Q_4_67 * Q_5_67;
+            const auto C_65_50 = C_65_18 * Q_5_65;
+            const auto C_49_66 = Q_1_49 * Q_6_49;
+            const auto C_35_80 = Q_4_35 * Q_6_35;
+            const auto C_33_82 = C_33_18 * Q_6_33;
+            const auto C_19_96 = Q_5_19 * Q_6_19;
+            const auto C_17_98 = C_17_34 * Q_6_17;
+            const auto C_3_112 = C_3_48 * Q_6_3;
+            const auto C_1_114 = C_1_50 * q_0_6;
+            const auto R_115 = 1 - (R_113 * Q_1_113 + R_99 * Q_4_99 + R_97 * C_97_18 + R_83 * Q_5_83
+                    + R_81 * C_81_34 + R_67 * C_67_48 + R_65 * C_65_50 + R_51 * Q_6_51
+                    + R_49 * C_49_66 + R_35 * C_35_80 + R_33 * C_33_82 + R_19 * C_19_96
+                    + R_17 * C_17_98 + R_3 * C_3_112 + C_1_114);
+            const auto Q_7_115 = Q_7_51 * q_6_7;
+            const auto C_113_130 = Q_1_113 * Q_7_113;
+            const auto C_99_144 = Q_4_99 * Q_7_99;
+            const auto C_97_146 = C_97_18 * Q_7_97;
+            const auto C_83_160 = Q_5_83 * Q_7_83;
+            const auto C_81_162 = C_81_34 * Q_7_81;
+            const auto C_67_176 = C_67_48 * Q_7_67;
+            const auto C_65_178 = C_65_50 * Q_7_65;
+            const auto C_51_192 = Q_6_51 * Q_7_51;
+            const auto C_49_194 = C_49_66 * Q_7_49;
+            const auto C_35_208 = C_35_80 * Q_7_35;
+            const auto C_33_210 = C_33_82 * Q_7_33;
+            const auto C_19_224 = C_19_96 * Q_7_19;
+            const auto C_17_226 = C_17_98 * Q_7_17;
+            const auto C_3_240 = C_3_112 * Q_7_3;
+            const auto C_1_242 = C_1_114 * q_0_7;
+            const auto R_243 = 1 - (R_241 * Q_1_241 + R_227 * Q_4_227 + R_225 * C_225_18 + R_211 * Q_5_211
+                    + R_209 * C_209_34 + R_195 * C_195_48 + R_193 * C_193_50 + R_179 * Q_6_179
+                    + R_177 * C_177_66 + R_163 * C_163_80 + R_161 * C_161_82 + R_147 * C_147_96
+                    + R_145 * C_145_98 + R_131 * C_131_112 + R_129 * C_129_114 + R_115 * Q_7_115
+                    + R_113 * C_113_130 + R_99 * C_99_144 + R_97 * C_97_146 + R_83 * C_83_160
+                    + R_81 * C_81_162 + R_67 * C_67_176 + R_65 * C_65_178 + R_51 * C_51_192
+                    + R_49 * C_49_194 + R_35 * C_35_208 + R_33 * C_33_210 + R_19 * C_19_224
+                    + R_17 * C_17_226 + R_3 * C_3_240 + C_1_242);
+            const auto Q_3_3 = q_0_3 * q_1_3;
+            const auto Q_3_19 = Q_3_3 * q_3_4;
+            const auto Q_3_51 = Q_3_19 * q_3_5;
+            const auto Q_3_115 = Q_3_51 * q_3_6;
+            const auto Q_3_243 = Q_3_115 * q_3_7;
+            const auto C_241_10 = Q_1_241 * Q_3_241;
+            const auto Q_1_41 = Q_1_9 * q_1_5;
+            const auto Q_1_105 = Q_1_41 * q_1_6;
+            const auto Q_1_233 = Q_1_105 * q_1_7;
+            const auto Q_3_35 = Q_3_3 * q_3_5;
+            const auto Q_3_99 = Q_3_35 * q_3_6;
+            const auto Q_3_227 = Q_3_99 * q_3_7;
+            const auto C_225_10 = Q_1_225 * Q_3_225;
+            const auto Q_1_73 = Q_1_9 * q_1_6;
+            const auto Q_1_201 = Q_1_73 * q_1_7;
+            const auto Q_3_67 = Q_3_3 * q_3_6;
+            const auto Q_3_195 = Q_3_67 * q_3_7;
+            const auto C_193_10 = Q_1_193 * Q_3_193;
+            const auto Q_1_137 = Q_1_9 * q_1_7;
+            const auto Q_3_131 = Q_3_3 * q_3_7;
+            const auto C_129_10 = Q_1_129 * Q_3_129;
+            const auto C_1_10 = q_0_1 * q_0_3;
+            const auto R_11 = 1 - (R_9 * Q_1_9 + R_3 * Q_3_3 + C_1_10);
+            const auto Q_7_11 = Q_7_3 * q_3_7;
+            const auto C_9_130 = Q_1_9 * Q_7_9;
+            const auto C_3_136 = Q_3_3 * Q_7_3;
+            const auto C_1_138 = C_1_10 * q_0_7;
+            const auto R_139 = 1 - (R_137 * Q_1_137 + R_131 * Q_3_131 + R_129 * C_129_10 + R_11 * Q_7_11
+                    + R_9 * C_9_130 + R_3 * C_3_136 + C_1_138);
+            const auto Q_6_11 = Q_6_3 * q_3_6;
+            const auto Q_6_139 = Q_6_11 * q_6_7;
+            const auto C_137_66 = Q_1_137 * Q_6_137;
+            const auto C_131_72 = Q_3_131 * Q_6_131;
+            const auto C_129_74 = C_129_10 * Q_6_129;
+            const auto C_65_10 = Q_1_65 * Q_3_65;
+            const auto C_9_66 = Q_1_9 * Q_6_9;
+            const auto C_3_72 = Q_3_3 * Q_6_3;
+            const auto C_1_74 = C_1_10 * q_0_6;
+            const auto R_75 = 1 - (R_73 * Q_1_73 + R_67 * Q_3_67 + R_65 * C_65_10 + R_11 * Q_6_11
+                    + R_9 * C_9_66 + R_3 * C_3_72 + C_1_74);
+            const auto Q_7_75 = Q_7_11 * q_6_7;
+            const auto C_73_130 = Q_1_73 * Q_7_73;
+            const auto C_67_136 = Q_3_67 * Q_7_67;
+            const auto C_65_138 = C_65_10 * Q_7_65;
+            const auto C_11_192 = Q_6_11 * Q_7_11;
+            const auto C_9_194 = C_9_66 * Q_7_9;
+            const auto C_3_200 = C_3_72 * Q_7_3;
+            const auto C_1_202 = C_1_74 * q_0_7;
+            const auto R_203 = 1 - (R_201 * Q_1_201 + R_195 * Q_3_195 + R_193 * C_193_10 + R_139 * Q_6_139
+                    + R_137 * C_137_66 + R_131 * C_131_72 + R_129 * C_129_74 + R_75 * Q_7_75
+                    + R_73 * C_73_130 + R_67 * C_67_136 + R_65 * C_65_138 + R_11 * C_11_192
+                    + R_9 * C_9_194 + R_3 * C_3_200 + C_1_202);
+            const auto Q_5_11 = Q_5_3 * q_3_5;
+            const auto Q_5_75 = Q_5_11 * q_5_6;
+            const auto Q_5_203 = Q_5_75 * q_5_7;
+            const auto C_201_34 = Q_1_201 * Q_5_201;
+            const auto C_195_40 = Q_3_195 * Q_5_195;
+            const auto C_193_42 = C_193_10 * Q_5_193;
+            const auto Q_1_169 = Q_1_41 * q_1_7;
+            const auto Q_3_163 = Q_3_35 * q_3_7;
+            const auto C_161_10 = Q_1_161 * Q_3_161;
+            const auto Q_5_139 = Q_5_11 * q_5_7;
+            const auto C_137_34 = Q_1_137 * Q_5_137;
+            const auto C_131_40 = Q_3_131 * Q_5_131;
+            const auto C_129_42 = C_129_10 * Q_5_129;
+            const auto C_33_10 = Q_1_33 * Q_3_33;
+            const auto C_9_34 = Q_1_9 * Q_5_9;
+            const auto C_3_40 = Q_3_3 * Q_5_3;
+            const auto C_1_42 = C_1_10 * q_0_5;
+            const auto R_43 = 1 - (R_41 * Q_1_41 + R_35 * Q_3_35 + R_33 * C_33_10 + R_11 * Q_5_11
+                    + R_9 * C_9_34 + R_3 * C_3_40 + C_1_42);
+            const auto Q_7_43 = Q_7_11 * q_5_7;
+            const auto C_41_130 = Q_1_41 * Q_7_41;
+            const auto C_35_136 = Q_3_35 * Q_7_35;
+            const auto C_33_138 = C_33_10 * Q_7_33;
+            const auto C_11_160 = Q_5_11 * Q_7_11;
+            const auto C_9_162 = C_9_34 * Q_7_9;
+            const auto C_3_168 = C_3_40 * Q_7_3;
+            const auto C_1_170 = C_1_42 * q_0_7;
+            const auto R_171 = 1 - (R_169 * Q_1_169 + R_163 * Q_3_163 + R_161 * C_161_10 + R_139 * Q_5_139
+                    + R_137 * C_137_34 + R_131 * C_131_40 + R_129 * C_129_42 + R_43 * Q_7_43
+                    + R_41 * C_41_130 + R_35 * C_35_136 + R_33 * C_33_138 + R_11 * C_11_160
+                    + R_9 * C_9_162 + R_3 * C_3_168 + C_1_170);
+            const auto Q_6_43 = Q_6_11 * q_5_6;
+            const auto Q_6_171 = Q_6_43 * q_6_7;
+            const auto C_169_66 = Q_1_169 * Q_6_169;
+            const auto C_163_72 = Q_3_163 * Q_6_163;
+            const auto C_161_74 = C_161_10 * Q_6_161;
+            const auto C_139_96 = Q_5_139 * Q_6_139;
+            const auto C_137_98 = C_137_34 * Q_6_137;
+            const auto C_131_104 = C_131_40 * Q_6_131;
+            const auto C_129_106 = C_129_42 * Q_6_129;
+            const auto C_97_10 = Q_1_97 * Q_3_97;
+            const auto C_73_34 = Q_1_73 * Q_5_73;
+            const auto C_67_40 = Q_3_67 * Q_5_67;
+            const auto C_65_42 = C_65_10 * Q_5_65;
+            const auto C_41_66 = Q_1_41 * Q_6_41;
+            const auto C_35_72 = Q_3_35 * Q_6_35;
+            const auto C_33_74 = C_33_10 * Q_6_33;
+            const auto C_11_96 = Q_5_11 * Q_6_11;
+            const auto C_9_98 = C_9_34 * Q_6_9;
+            const auto C_3_104 = C_3_40 * Q_6_3;
+            const auto C_1_106 = C_1_42 * q_0_6;
+            const auto R_107 = 1 - (R_105 * Q_1_105 + R_99 * Q_3_99 + R_97 * C_97_10 + R_75 * Q_5_75
+                    + R_73 * C_73_34 + R_67 * C_67_40 + R_65 * C_65_42 + R_43 * Q_6_43
+                    + R_41 * C_41_66 + R_35 * C_35_72 + R_33 * C_33_74 + R_11 * C_11_96
+                    + R_9 * C_9_98 + R_3 * C_3_104 + C_1_106);
+            const auto Q_7_107 = Q_7_43 * q_6_7;
+            const auto C_105_130 = Q_1_105 * Q_7_105;
+            const auto C_99_136 = Q_3_99 * Q_7_99;
+            const auto C_97_138 = C_97_10 * Q_7_97;
+            const auto C_75_160 = Q_5_75 * Q_7_75;
+            const auto C_73_162 = C_73_34 * Q_7_73;
+            const auto C_67_168 = C_67_40 * Q_7_67;
+            const auto C_65_170 = C_65_42 * Q_7_65;
+            const auto C_43_192 = Q_6_43 * Q_7_43;
+            const auto C_41_194 = C_41_66 * Q_7_41;
+            const auto C_35_200 = C_35_72 * Q_7_35;
+            const auto C_33_202 = C_33_74 * Q_7_33;
+            const auto C_11_224 = C_11_96 * Q_7_11;
+            const auto C_9_226 = C_9_98 * Q_7_9;
+            const auto C_3_232 = C_3_104 * Q_7_3;
+            const auto C_1_234 = C_1_106 * q_0_7;
+            const auto R_235 = 1 - (R_233 * Q_1_233 + R_227 * Q_3_227 + R_225 * C_225_10 + R_203 * Q_5_203
+                    + R_201 * C_201_34 + R_195 * C_195_40 + R_193 * C_193_42 + R_171 * Q_6_171
+                    + R_169 * C_169_66 + R_163 * C_163_72 + R_161 * C_161_74 + R_139 * C_139_96
+                    + R_137 * C_137_98 + R_131 * C_131_104 + R_129 * C_129_106 + R_107 * Q_7_107
+                    + R_105 * C_105_130 + R_99 * C_99_136 + R_97 * C_97_138 + R_75 * C_75_160
+                    + R_73 * C_73_162 + R_67 * C_67_168 + R_65 * C_65_170 + R_43 * C_43_192
+                    + R_41 * C_41_194 + R_35 * C_35_200 + R_33 * C_33_202 + R_11 * C_11_224
+                    + R_9 * C_9_226 + R_3 * C_3_232 + C_1_234);
+            const auto Q_4_11 = Q_4_3 * q_3_4;
+            const auto Q_4_43 = Q_4_11 * q_4_5;
+            const auto Q_4_107 = Q_4_43 * q_4_6;
+            const auto Q_4_235 = Q_4_107 * q_4_7;
+            const auto C_233_18 = Q_1_233 * Q_4_233;
+            const auto C_227_24 = Q_3_227 * Q_4_227;
+            const auto C_225_26 = C_225_10 * Q_4_225;
+            const auto Q_1_89 = Q_1_25 * q_1_6;
+            const auto Q_1_217 = Q_1_89 * q_1_7;
+            const auto Q_3_83 = Q_3_19 * q_3_6;
+            const auto Q_3_211 = Q_3_83 * q_3_7;
+            const auto C_209_10 = Q_1_209 * Q_3_209;
+            const auto Q_4_75 = Q_4_11 * q_4_6;
+            const auto Q_4_203 = Q_4_75 * q_4_7;
+            const auto C_201_18 = Q_1_201 * Q_4_201;
+            const auto C_195_24 = Q_3_195 * Q_4_195;
+            const auto C_193_26 = C_193_10 * Q_4_193;
+            const auto Q_1_153 = Q_1_25 * q_1_7;
+            const auto Q_3_147 = Q_3_19 * q_3_7;
+            const auto C_145_10 = Q_1_145 * Q_3_145;
+            const auto Q_4_139 = Q_4_11 * q_4_7;
+            const auto C_137_18 = Q_1_137 * Q_4_137;
+            const auto C_131_24 = Q_3_131 * Q_4_131;
+            const auto C_129_26 = C_129_10 * Q_4_129;
+            const auto C_17_10 = Q_1_17 * Q_3_17;
+            const auto C_9_18 = Q_1_9 * Q_4_9;
+            const auto C_3_24 = Q_3_3 * Q_4_3;
+            const auto C_1_26 = C_1_10 * q_0_4;
+            const auto R_27 = 1 - (R_25 * Q_1_25 + R_19 * Q_3_19 + R_17 * C_17_10 + R_11 * Q_4_11
+                    + R_9 * C_9_18 + R_3 * C_3_24 + C_1_26);
+            const auto Q_7_27 = Q_7_11 * q_4_7;
+            const auto C_25_130 = Q_1_25 * Q_7_25;
+            const auto C_19_136 = Q_3_19 * Q_7_19;
+            const auto C_17_138 = C_17_10 * Q_7_17;
+            const auto C_11_144 = Q_4_11 * Q_7_11;
+            const auto C_9_146 = C_9_18 * Q_7_9;
+            const auto C_3_152 = C_3_24 * Q_7_3;
+            const auto C_1_154 = C_1_26 * q_0_7;
+            const auto R_155 = 1 - (R_153 * Q_1_153 + R_147 * Q_3_147 + R_145 * C_145_10 + R_139 * Q_4_139
+                    + R_137 * C_137_18 + R_131 * C_131_24 + R_129 * C_129_26 + R_27 * Q_7_27
+                    + R_25 * C_25_130 + R_19 * C_19_136 + R_17 * C_17_138 + R_11 * C_11_144
+                    + R_9 * C_9_146 + R_3 * C_3_152 + C_1_154);
+            const auto Q_6_27 = Q_6_11 * q_4_6;
+            const auto Q_6_155 = Q_6_27 * q_6_7;
+            const auto C_153_66 = Q_1_153 * Q_6_153;
+            const auto C_147_72 = Q_3_147 * Q_6_147;
+            const auto C_145_74 = C_145_10 * Q_6_145;
+            const auto C_139_80 = Q_4_139 * Q_6_139;
+            const auto C_137_82 = C_137_18 * Q_6_137;
+            const auto C_131_88 = C_131_24 * Q_6_131;
+            const auto C_129_90 = C_129_26 * Q_6_129;
+            const auto C_81_10 = Q_1_81 * Q_3_81;
+            const auto C_73_18 = Q_1_73 * Q_4_73;
+            const auto C_67_24 = Q_3_67 * Q_4_67;
+            const auto C_65_26 = C_65_10 * Q_4_65;
+            const auto C_25_66 = Q_1_25 * Q_6_25;
+            const auto C_19_72 = Q_3_19 * Q_6_19;
+            const auto C_17_74 = C_17_10 * Q_6_17;
+            const auto C_11_80 = Q_4_11 * Q_6_11;
+            const auto C_9_82 = C_9_18 * Q_6_9;
+            const auto C_3_88 = C_3_24 * Q_6_3;
+            const auto C_1_90 = C_1_26 * q_0_6;
+            const auto R_91 = 1 - (R_89 * Q_1_89 + R_83 * Q_3_83 + R_81 * C_81_10 + R_75 * Q_4_75
+                    + R_73 * C_73_18 + R_67 * C_67_24 + R_65 * C_65_26 + R_27 * Q_6_27
+                    + R_25 * C_25_66 + R_19 * C_19_72 + R_17 * C_17_74 + R_11 * C_11_80
+                    + R_9 * C_9_82 + R_3 * C_3_88 + C_1_90);
+            const auto Q_7_91 = Q_7_27 * q_6_7;
+            const auto C_89_130 = Q_1_89 * Q_7_89;
+            const auto C_83_136 = Q_3_83 * Q_7_83;
+            const auto C_81_138 = C_81_10 * Q_7_81;
+            const auto C_75_144 = Q_4_75 * Q_7_75;
+            const auto C_73_146 = C_73_18 * Q_7_73;
+            const auto C_67_152 = C_67_24 * Q_7_67;
+            const auto C_65_154 = C_65_26 * Q_7_65;
+            const auto C_27_192 = Q_6_27 * Q_7_27;
+            const auto C_25_194 = C_25_66 * Q_7_25;
+            const auto C_19_200 = C_19_72 * Q_7_19;
+            const auto C_17_202 = C_17_74 * Q_7_17;
+            const auto C_11_208 = C_11_80 * Q_7_11;
+            const auto C_9_210 = C_9_82 * Q_7_9;
+            const auto C_3_216 = C_3_88 * Q_7_3;
+            const auto C_1_218 = C_1_90 * q_0_7;
+            const auto R_219 = 1 - (R_217 * Q_1_217 + R_211 * Q_3_211 + R_209 * C_209_10 + R_203 * Q_4_203
+                    + R_201 * C_201_18 + R_195 * C_195_24 + R_193 * C_193_26 + R_155 * Q_6_155
+                    + R_153 * C_153_66 + R_147 * C_147_72 + R_145 * C_145_74 + R_139 * C_139_80
+                    + R_137 * C_137_82 + R_131 * C_131_88 + R_129 * C_129_90 + R_91 * Q_7_91
+                    + R_89 * C_89_130 + R_83 * C_83_136 + R_81 * C_81_138 + R_75 * C_75_144
+                    + R_73 * C_73_146 + R_67 * C_67_152 + R_65 * C_65_154 + R_27 * C_27_192
+                    + R_25 * C_25_194 + R_19 * C_19_200 + R_17 * C_17_202 + R_11 * C_11_208
+                    + R_9 * C_9_210 + R_3 * C_3_216 + C_1_218);
+            const auto Q_5_27 = Q_5_11 * q_4_5;
+            const auto Q_5_91 = Q_5_27 * q_5_6;
+            const auto Q_5_219 = Q_5_91 * q_5_7;
+            const auto C_217_34 = Q_1_217 * Q_5_217;
+            const auto C_211_40 = Q_3_211 * Q_5_211;
+            const auto C_209_42 = C_209_10 * Q_5_209;
+            const auto C_203_48 = Q_4_203 * Q_5_203;
+            const auto C_201_50 = C_201_18 * Q_5_201;
+            const auto C_195_56 = C_195_24 * Q_5_195;
+            const auto C_193_58 = C_193_26 * Q_5_193;
+            const auto Q_1_185 = Q_1_57 * q_1_7;
+            const auto Q_3_179 = Q_3_51 * q_3_7;
+            const auto C_177_10 = Q_1_177 * Q_3_177;
+            const auto Q_4_171 = Q_4_43 * q_4_7;
+            const auto C_169_18 = Q_1_169 * Q_4_169;
+            const auto C_163_24 = Q_3_163 * Q_4_163;
+            const auto C_161_26 = C_161_10 * Q_4_161;
+            const auto Q_5_155 = Q_5_27 * q_5_7;
+            const auto C_153_34 = Q_1_153 * Q_5_153;
+            const auto C_147_40 = Q_3_147 * Q_5_147;
+            const auto C_145_42 = C_145_10 * Q_5_145;
+            const auto C_139_48 = Q_4_139 * Q_5_139;
+            const auto C_137_50 = C_137_18 * Q_5_137;
+            const auto C_131_56 = C_131_24 * Q_5_131;
+            const auto C_129_58 = C_129_26 * Q_5_129;
+            const auto C_49_10 = Q_1_49 * Q_3_49;
+            const auto C_41_18 = Q_1_41 * Q_4_41;
+            const auto C_35_24 = Q_3_35 * Q_4_35;
+            const auto C_33_26 = C_33_10 * Q_4_33;
+            const auto C_25_34 = Q_1_25 * Q_5_25;
+            const auto C_19_40 = Q_3_19 * Q_5_19;
+            const auto C_17_42 = C_17_10 * Q_5_17;
+            const auto C_11_48 = Q_4_11 * Q_5_11;
+            const auto C_9_50 = C_9_18 * Q_5_9;
+            const auto C_3_56 = C_3_24 * Q_5_3;
+            const auto C_1_58 = C_1_26 * q_0_5;
+            const auto R_59 = 1 - (R_57 * Q_1_57 + R_51 * Q_3_51 + R_49 * C_49_10 + R_43 * Q_4_43
+                    + R_41 * C_41_18 + R_35 * C_35_24 + R_33 * C_33_26 + R_27 * Q_5_27
+                    + R_25 * C_25_34 + R_19 * C_19_40 + R_17 * C_17_42 + R_11 * C_11_48
+                    + R_9 * C_9_50 + R_3 * C_3_56 + C_1_58);
+            const auto Q_7_59 = Q_7_27 * q_5_7;
+            const auto C_57_130 = Q_1_57 * Q_7_57;
+            const auto C_51_136 = Q_3_51 * Q_7_51;
+            const auto C_49_138 = C_49_10 * Q_7_49;
+            const auto C_43_144 = Q_4_43 * Q_7_43;
+            const auto C_41_146 = C_41_18 * Q_7_41;
+            const auto C_35_152 = C_35_24 * Q_7_35;
+            const auto C_33_154 = C_33_26 * Q_7_33;
+            const auto C_27_160 = Q_5_27 * Q_7_27;
+            const auto C_25_162 = C_25_34 * Q_7_25;
+            const auto C_19_168 = C_19_40 * Q_7_19;
+            const auto C_17_170 = C_17_42 * Q_7_17;
+            const auto C_11_176 = C_11_48 * Q_7_11;
+            const auto C_9_178 = C_9_50 * Q_7_9;
+            const auto C_3_184 = C_3_56 * Q_7_3;
+            const auto C_1_186 = C_1_58 * q_0_7;
+            const auto R_187 = 1 - (R_185 * Q_1_185 + R_179 * Q_3_179 + R_177 * C_177_10 + R_171 * Q_4_171
+                    + R_169 * C_169_18 + R_163 * C_163_24 + R_161 * C_161_26 + R_155 * Q_5_155
+                    + R_153 * C_153_34 + R_147 * C_147_40 + R_145 * C_145_42 + R_139 * C_139_48
+                    + R_137 * C_137_50 + R_131 * C_131_56 + R_129 * C_129_58 + R_59 * Q_7_59
+                    + R_57 * C_57_130 + R_51 * C_51_136 + R_49 * C_49_138 + R_43 * C_43_144
+                    + R_41 * C_41_146 + R_35 * C_35_152 + R_33 * C_33_154 + R_27 * C_27_160
+                    + R_25 * C_25_162 + R_19 * C_19_168 + R_17 * C_17_170 + R_11 * C_11_176
+                    + R_9 * C_9_178 + R_3 * C_3_184 + C_1_186);
+            const auto Q_6_59 = Q_6_27 * q_5_6;
+            const auto Q_6_187 = Q_6_59 * q_6_7;
+            const auto C_185_66 = Q_1_185 * Q_6_185;
+            const auto C_179_72 = Q_3_179 * Q_6_179;
+            const auto C_177_74 = C_177_10 * Q_6_177;
+            const auto C_171_80 = Q_4_171 * Q_6_171;
+            const auto C_169_82 = C_169_18 * Q_6_169;
+            const auto C_163_88 = C_163_24 * Q_6_163;
+            const auto C_161_90 = C_161_26 * Q_6_161;
+            const auto C_155_96 = Q_5_155 * Q_6_155;
+            const auto C_153_98 = C_153_34 * Q_6_153;
+            const auto C_147_104 = C_147_40 * Q_6_147;
+            const auto C_145_106 = C_145_42 * Q_6_145;
+            const auto C_139_112 = C_139_48 * Q_6_139;
+            const auto C_137_114 = C_137_50 * Q_6_137;
+            const auto C_131_120 = C_131_56 * Q_6_131;
+            const auto C_129_122 = C_129_58 * Q_6_129;
+            const auto C_113_10 = Q_1_113 * Q_3_113;
+            const auto C_105_18 = Q_1_105 * Q_4_105;
+            const auto C_99_24 = Q_3_99 * Q_4_99;
+            const auto C_97_26 = C_97_10 * Q_4_97;
+            const auto C_89_34 = Q_1_89 * Q_5_89;
+            const auto C_83_40 = Q_3_83 * Q_5_83;
+            const auto C_81_42 = C_81_10 * Q_5_81;
+            const auto C_75_48 = Q_4_75 * Q_5_75;
+            const auto C_73_50 = C_73_18 * Q_5_73;
+            const auto C_67_56 = C_67_24 * Q_5_67;
+            const auto C_65_58 = C_65_26 * Q_5_65;
+            const auto C_57_66 = Q_1_57 * Q_6_57;
+            const auto C_51_72 = Q_3_51 * Q_6_51;
+            const auto C_49_74 = C_49_10 * Q_6_49;
+            const auto C_43_80 = Q_4_43 * Q_6_43;
+            const auto C_41_82 = C_41_18 * Q_6_41;
+            const auto C_35_88 = C_35_24 * Q_6_35;
+            const auto C_33_90 = C_33_26 * Q_6_33;
+            const auto C_27_96 = Q_5_27 * Q_6_27;
+            const auto C_25_98 = C_25_34 * Q_6_25;
+            const auto C_19_104 = C_19_40 * Q_6_19;
+            const auto C_17_106 = C_17_42 * Q_6_17;
+            const auto C_11_112 = C_11_48 * Q_6_11;
+            const auto C_9_114 = C_9_50 * Q_6_9;
+            const auto C_3_120 = C_3_56 * Q_6_3;
+            const auto C_1_122 = C_1_58 * q_0_6;
+            const auto R_123 = 1 - (R_121 * Q_1_121 + R_115 * Q_3_115 + R_113 * C_113_10 + R_107 * Q_4_107
+                    + R_105 * C_105_18 + R_99 * C_99_24 + R_97 * C_97_26 + R_91 * Q_5_91
+                    + R_89 * C_89_34 + R_83 * C_83_40 + R_81 * C_81_42 + R_75 * C_75_48
+                    + R_73 * C_73_50 + R_67 * C_67_56 + R_65 * C_65_58 + R_59 * Q_6_59
+                    + R_57 * C_57_66 + R_51 * C_51_72 + R_49 * C_49_74 + R_43 * C_43_80
+                    + R_41 * C_41_82 + R_35 * C_35_88 + R_33 * C_33_90 + R_27 * C_27_96
+                    + R_25 * C_25_98 + R_19 * C_19_104 + R_17 * C_17_106 + R_11 * C_11_112
+                    + R_9 * C_9_114 + R_3 * C_3_120 + C_1_122);
+            const auto Q_7_123 = Q_7_59 * q_6_7;
+            const auto C_121_130 = Q_1_121 * Q_7_121;
+            const auto C_115_136 = Q_3_115 * Q_7_115;
+            const auto C_113_138 = C_113_10 * Q_7_113;
+            const auto C_107_144 = Q_4_107 * Q_7_107;
+            const auto C_105_146 = C_105_18 * Q_7_105;
+            const auto C_99_152 = C_99_24 * Q_7_99;
+            const auto C_97_154 = C_97_26 * Q_7_97;
+            const auto C_91_160 = Q_5_91 * Q_7_91;
+            const auto C_89_162 = C_89_34 * Q_7_89;
+            const auto C_83_168 = C_83_40 * Q_7_83;
+            const auto C_81_170 = C_81_42 * Q_7_81;
+            const auto C_75_176 = C_75_48 * Q_7_75;
+            const auto C_73_178 = C_73_50 * Q_7_73;
+            const auto C_67_184 = C_67_56 * Q_7_67;
+            const auto C_65_186 = C_65_58 * Q_7_65;
+            const auto C_59_192 = Q_6_59 * Q_7_59;
+            const auto C_57_194 = C_57_66 * Q_7_57;
+            const auto C_51_200 = C_51_72 * Q_7_51;
+            const auto C_49_202 = C_49_74 * Q_7_49;
+            const auto C_43_208 = C_43_80 * Q_7_43;
+            const auto C_41_210 = C_41_82 * Q_7_41;
+            const auto C_35_216 = C_35_88 * Q_7_35;
+            const auto C_33_218 = C_33_90 * Q_7_33;
+            const auto C_27_224 = C_27_96 * Q_7_27;
+            const auto C_25_226 = C_25_98 * Q_7_25;
+            const auto C_19_232 = C_19_104 * Q_7_19;
+            const auto C_17_234 = C_17_106 * Q_7_17;
+            const auto C_11_240 = C_11_112 * Q_7_11;
+            const auto C_9_242 = C_9_114 * Q_7_9;
+            const auto C_3_248 = C_3_120 * Q_7_3;
+            const auto C_1_250 = C_1_122 * q_0_7;
+            const auto R_251 = 1 - (R_249 * Q_1_249 + R_243 * Q_3_243 + R_241 * C_241_10 + R_235 * Q_4_235
+                    + R_233 * C_233_18 + R_227 * C_227_24 + R_225 * C_225_26 + R_219 * Q_5_219
+                    + R_217 * C_217_34 + R_211 * C_211_40 + R_209 * C_209_42 + R_203 * C_203_48
+                    + R_201 * C_201_50 + R_195 * C_195_56 + R_193 * C_193_58 + R_187 * Q_6_187
+                    + R_185 * C_185_66 + R_179 * C_179_72 + R_177 * C_177_74 + R_171 * C_171_80
+                    + R_169 * C_169_82 + R_163 * C_163_88 + R_161 * C_161_90 + R_155 * C_155_96
+                    + R_153 * C_153_98 + R_147 * C_147_104 + R_145 * C_145_106 + R_139 * C_139_112
+                    + R_137 * C_137_114 + R_131 * C_131_120 + R_129 * C_129_122 + R_123 * Q_7_123
+                    + R_121 * C_121_130 + R_115 * C_115_136 + R_113 * C_113_138 + R_107 * C_107_144
+                    + R_105 * C_105_146 + R_99 * C_99_152 + R_97 * C_97_154 + R_91 * C_91_160
+                    + R_89 * C_89_162 + R_83 * C_83_168 + R_81 * C_81_170 + R_75 * C_75_176
+                    + R_73 * C_73_178 + R_67 * C_67_184 + R_65 * C_65_186 + R_59 * C_59_192
+                    + R_57 * C_57_194 + R_51 * C_51_200 + R_49 * C_49_202 + R_43 * C_43_208
+                    + R_41 * C_41_210 + R_35 * C_35_216 + R_33 * C_33_218 + R_27 * C_27_224
+                    + R_25 * C_25_226 + R_19 * C_19_232 + R_17 * C_17_234 + R_11 * C_11_240
+                    + R_9 * C_9_242 + R_3 * C_3_248 + C_1_250);
+            const auto Q_2_3 = q_0_2 * q_1_2;
+            const auto Q_2_11 = Q_2_3 * q_2_3;
+            const auto Q_2_27 = Q_2_11 * q_2_4;
+            const auto Q_2_59 = Q_2_27 * q_2_5;
+            const auto Q_2_123 = Q_2_59 * q_2_6;
+            const auto Q_2_251 = Q_2_123 * q_2_7;
+            const auto C_249_6 = Q_1_249 * Q_2_249;
+            const auto Q_1_21 = Q_1_5 * q_1_4;
+            const auto Q_1_53 = Q_1_21 * q_1_5;
+            const auto Q_1_117 = Q_1_53 * q_1_6;
+            const auto Q_1_245 = Q_1_117 * q_1_7;
+            const auto Q_2_19 = Q_2_3 * q_2_4;
+            const auto Q_2_51 = Q_2_19 * q_2_5;
+            const auto Q_2_115 = Q_2_51 * q_2_6;
+            const auto Q_2_243 = Q_2_115 * q_2_7;
+            const auto C_241_6 = Q_1_241 * Q_2_241;
+            const auto Q_1_37 = Q_1_5 * q_1_5;
+            const auto Q_1_101 = Q_1_37 * q_1_6;
+            const auto Q_1_229 = Q_1_101 * q_1_7;
+            const auto Q_2_35 = Q_2_3 * q_2_5;
+            const auto Q_2_99 = Q_2_35 * q_2_6;
+            const auto Q_2_227 = Q_2_99 * q_2_7;
+            const auto C_225_6 = Q_1_225 * Q_2_225;
+            const auto Q_1_69 = Q_1_5 * q_1_6;
+            const auto Q_1_197 = Q_1_69 * q_1_7;
+            const auto Q_2_67 = Q_2_3 * q_2_6;
+            const auto Q_2_195 = Q_2_67 * q_2_7;
+            const auto C_193_6 = Q_1_193 * Q_2_193;
+            const auto Q_1_133 = Q_1_5 * q_1_7;
+            const auto Q_2_131 = Q_2_3 * q_2_7;
+            const auto C_129_6 = Q_1_129 * Q_2_129;
+            const auto C_1_6 = q_0_1 * q_0_2;
+            const auto R_7 = 1 - (R_5 * Q_1_5 + R_3 * Q_2_3 + C_1_6);
+            const auto Q_7_7 = Q_7_3 * q_2_7;
+            const auto C_5_130 = Q_1_5 * Q_7_5;
+            const auto C_3_132 = Q_2_3 * Q_7_3;
+            const auto C_1_134 = C_1_6 * q_0_7;
+            const auto R_135 = 1 - (R_133 * Q_1_133 + R_131 * Q_2_131 + R_129 * C_129_6 + R_7 * Q_7_7
+                    + R_5 * C_5_130 + R_3 * C_3_132 + C_1_134);
+            const auto Q_6_7 = Q_6_3 * q_2_6;
+            const auto Q_6_135 = Q_6_7 * q_6_7;
+            const auto C_133_66 = Q_1_133 * Q_6_133;
+            const auto C_131_68 = Q_2_131 * Q_6_131;
+            const auto C_129_70 = C_129_6 * Q_6_129;
+            const auto C_65_6 = Q_1_65 * Q_2_65;
+            const auto C_5_66 = Q_1_5 * Q_6_5;
+            const auto C_3_68 = Q_2_3 * Q_6_3;
+            const auto C_1_70 = C_1_6 * q_0_6;
+            const auto R_71 = 1 - (R_69 * Q_1_69 + R_67 * Q_2_67 + R_65 * C_65_6 + R_7 * Q_6_7
+                    + R_5 * C_5_66 + R_3 * C_3_68 + C_1_70);
+            const auto Q_7_71 = Q_7_7 * q_6_7;
+            const auto C_69_130 = Q_1_69 * Q_7_69;
+            const auto C_67_132 = Q_2_67 * Q_7_67;
+            const auto C_65_134 = C_65_6 * Q_7_65;
+            const auto C_7_192 = Q_6_7 * Q_7_7;
+            const auto C_5_194 = C_5_66 * Q_7_5;
+            const auto C_3_196 = C_3_68 * Q_7_3;
+            const auto C_1_198 = C_1_70 * q_0_7;
+            const auto R_199 = 1 - (R_197 * Q_1_197 + R_195 * Q_2_195 + R_193 * C_193_6 + R_135 * Q_6_135
+                    + R_133 * C_133_66 + R_131 * C_131_68 + R_129 * C_129_70 + R_71 * Q_7_71
+                    + R_69 * C_69_130 + R_67 * C_67_132 + R_65 * C_65_134 + R_7 * C_7_192
+                    + R_5 * C_5_194 + R_3 * C_3_196 + C_1_198);
+            const auto Q_5_7 = Q_5_3 * q_2_5;
+            const auto Q_5_71 = Q_5_7 * q_5_6;
+            const auto Q_5_199 = Q_5_71 * q_5_7;
+            const auto C_197_34 = Q_1_197 * Q_5_197;
+            const auto C_195_36 = Q_2_195 * Q_5_195;
+            const auto C_193_38 = C_193_6 * Q_5_193;
+            const auto Q_1_165 = Q_1_37 * q_1_7;
+            const auto Q_2_163 = Q_2_35 * q_2_7;
+            const auto C_161_6 = Q_1_161 * Q_2_161;
+            const auto Q_5_135 = Q_5_7 * q_5_7;
+            const auto C_133_34 = Q_1_133 * Q_5_133;
+            const auto C_131_36 = Q_2_131 * Q_5_131;
+            const auto C_129_38 = C_129_6 * Q_5_129;
+            const auto C_33_6 = Q_1_33 * Q_2_33;
+            const auto C_5_34 = Q_1_5 * Q_5_5;
+            const auto C_3_36 = Q_2_3 * Q_5_3;
+            const auto C_1_38 = C_1_6 * q_0_5;
+            const auto R_39 = 1 - (R_37 * Q_1_37 + R_35 * Q_2_35 + R_33 * C_33_6 + R_7 * Q_5_7
+                    + R_5 * C_5_34 + R_3 * C_3_36 + C_1_38);
+            const auto Q_7_39 = Q_7_7 * q_5_7;
+            const auto C_37_130 = Q_1_37 * Q_7_37;
+            const auto C_35_132 = Q_2_35 * Q_7_35;
+            const auto C_33_134 = C_33_6 * Q_7_33;
+            const auto C_7_160 = Q_5_7 * Q_7_7;
+            const auto C_5_162 = C_5_34 * Q_7_5;
+            const auto C_3_164 = C_3_36 * Q_7_3;
+            const auto C_1_166 = C_1_38 * q_0_7;
+            const auto R_167 = 1 - (R_165 * Q_1_165 + R_163 * Q_2_163 + R_161 * C_161_6 + R_135 * Q_5_135
+                    + R_133 * C_133_34 + R_131 * C_131_36 + R_129 * C_129_38 + R_39 * Q_7_39
+                    + R_37 * C_37_130 + R_35 * C_35_132 + R_33 * C_33_134 + R_7 * C_7_160
+                    + R_5 * C_5_162 + R_3 * C_3_164 + C_1_166);
+            const auto Q_6_39 = Q_6_7 * q_5_6;
+            const auto Q_6_167 = Q_6_39 * q_6_7;
+            const auto C_165_66 = Q_1_165 * Q_6_165;
+            const auto C_163_68 = Q_2_163 * Q_6_163;
+            const auto C_161_70 = C_161_6 * Q_6_161;
+            const auto C_135_96 = Q_5_135 * Q_6_135;
+            const auto C_133_98 = C_133_34 * Q_6_133;
+            const auto C_131_100 = C_131_36 * Q_6_131;
+            const auto C_129_102 = C_129_38 * Q_6_129;
+            const auto C_97_6 = Q_1_97 * Q_2_97;
+            const auto C_69_34 = Q_1_69 * Q_5_69;
+            const auto C_67_36 = Q_2_67 * Q_5_67;
+            const auto C_65_38 = C_65_6 * Q_5_65;
+            const auto C_37_66 = Q_1_37 * Q_6_37;
+            const auto C_35_68 = Q_2_35 * Q_6_35;
+            const auto C_33_70 = C_33_6 * Q_6_33;
+            const auto C_7_96 = Q_5_7 * Q_6_7;
+            const auto C_5_98 = C_5_34 * Q_6_5;
+            const auto C_3_100 = C_3_36 * Q_6_3;
+            const auto C_1_102 = C_1_38 * q_0_6;
+            const auto R_103 = 1 - (R_101 * Q_1_101 + R_99 * Q_2_99 + R_97 * C_97_6 + R_71 * Q_5_71
+                    + R_69 * C_69_34 + R_67 * C_67_36 + R_65 * C_65_38 + R_39 * Q_6_39
+                    + R_37 * C_37_66 + R_35 * C_35_68 + R_33 * C_33_70 + R_7 * C_7_96
+                    + R_5 * C_5_98 + R_3 * C_3_100 + C_1_102);
+            const auto Q_7_103 = Q_7_39 * q_6_7;
+            const auto C_101_130 = Q_1_101 * Q_7_101;
+            const auto C_99_132 = Q_2_99 * Q_7_99;
+            const auto C_97_134 = C_97_6 * Q_7_97;
+            const auto C_71_160 = Q_5_71 * Q_7_71;
+            const auto C_69_162 = C_69_34 * Q_7_69;
+            const auto C_67_164 = C_67_36 * Q_7_67;
+            const auto C_65_166 = C_65_38 * Q_7_65;
+            const auto C_39_192 = Q_6_39 * Q_7_39;
+            const auto C_37_194 = C_37_66 * Q_7_37;
+            const auto C_35_196 = C_35_68 * Q_7_35;
+            const auto C_33_198 = C_33_70 * Q_7_33;
+            const auto C_7_224 = C_7_96 * Q_7_7;
+            const auto C_5_226 = C_5_98 * Q_7_5;
+            const auto C_3_228 = C_3_100 * Q_7_3;
+            const auto C_1_230 = C_1_102 * q_0_7;
+            const auto R_231 = 1 - (R_229 * Q_1_229 + R_227 * Q_2_227 + R_225 * C_225_6 + R_199 * Q_5_199
+                    + R_197 * C_197_34 + R_195 * C_195_36 + R_193 * C_193_38 + R_167 * Q_6_167
+                    + R_165 * C_165_66 + R_163 * C_163_68 + R_161 * C_161_70 + R_135 * C_135_96
+                    + R_133 * C_133_98 + R_131 * C_131_100 + R_129 * C_129_102 + R_103 * Q_7_103
+                    + R_101 * C_101_130 + R_99 * C_99_132 + R_97 * C_97_134 + R_71 * C_71_160
+                    + R_69 * C_69_162 + R_67 * C_67_164 + R_65 * C_65_166 + R_39 * C_39_192
+                    + R_37 * C_37_194 + R_35 * C_35_196 + R_33 * C_33_198 + R_7 * C_7_224
+                    + R_5 * C_5_226 + R_3 * C_3_228 + C_1_230);
+            const auto Q_4_7 = Q_4_3 * q_2_4;
+            const auto Q_4_39 = Q_4_7 * q_4_5;
+            const auto Q_4_103 = Q_4_39 * q_4_6;
+            const auto Q_4_231 = Q_4_103 * q_4_7;
+            const auto C_229_18 = Q_1_229 * Q_4_229;
+            const auto C_227_20 = Q_2_227 * Q_4_227;
+            const auto C_225_22 = C_225_6 * Q_4_225;
+            const auto Q_1_85 = Q_1_21 * q_1_6;
+            const auto Q_1_213 = Q_1_85 * q_1_7;
+            const auto Q_2_83 = Q_2_19 * q_2_6;
+            const auto Q_2_211 = Q_2_83 * q_2_7;
+            const auto C_209_6 = Q_1_209 * Q_2_209;
+            const auto Q_4_71 = Q_4_7 * q_4_6;
+            const auto Q_4_199 = Q_4_71 * q_4_7;
+            const auto C_197_18 = Q_1_197 * Q_4_197;
+            const auto C_195_20 = Q_2_195 * Q_4_195;
+            const auto C_193_22 = C_193_6 * Q_4_193;
+            const auto Q_1_149 = Q_1_21 * q_1_7;
+            const auto Q_2_147 = Q_2_19 * q_2_7;
+            const auto C_145_6 = Q_1_145 * Q_2_145;
+            const auto Q_4_135 = Q_4_7 * q_4_7;
+            const auto C_133_18 = Q_1_133 * Q_4_133;
+            const auto C_131_20 = Q_2_131 * Q_4_131;
+            const auto C_129_22 = C_129_6 * Q_4_129;
+            const auto C_17_6 = Q_1_17 * Q_2_17;
+            const auto C_5_18 = Q_1_5 * Q_4_5;
+            const auto C_3_20 = Q_2_3 * Q_4_3;
+            const auto C_1_22 = C_1_6 * q_0_4;
+            const auto R_23 = 1 - (R_21 * Q_1_21 + R_19 * Q_2_19 + R_17 * C_17_6 + R_7 * Q_4_7
+                    + R_5 * C_5_18 + R_3 * C_3_20 + C_1_22);
+            const auto Q_7_23 = Q_7_7 * q_4_7;
+            const auto C_21_130 = Q_1_21 * Q_7_21;
+            const auto C_19_132 = Q_2_19 * Q_7_19;
+            const auto C_17_134 = C_17_6 * Q_7_17;
+            const auto C_7_144 = Q_4_7 * Q_7_7;
+            const auto C_5_146 = C_5_18 * Q_7_5;
+            const auto C_3_148 = C_3_20 * Q_7_3;
+            const auto C_1_150 = C_1_22 * q_0_7;
+            const auto R_151 = 1 - (R_149 * Q_1_149 + R_147 * Q_2_147 + R_145 * C_145_6 + R_135 * Q_4_135
+                    + R_133 * C_133_18 + R_131 * C_131_20 + R_129 * C_129_22 + R_23 * Q_7_23
+                    + R_21 * C_21_130 + R_19 * C_19_132 + R_17 * C_17_134 + R_7 * C_7_144
+                    + R_5 * C_5_146 + R_3 * C_3_148 + C_1_150);
+            const auto Q_6_23 = Q_6_7 * q_4_6;
+            const auto Q_6_151 = Q_6_23 * q_6_7;
+            const auto C_149_66 = Q_1_149 * Q_6_149;
+            const auto C_147_68 = Q_2_147 * Q_6_147;
+            const auto C_145_70 = C_145_6 * Q_6_145;
+            const auto C_135_80 = Q_4_135 * Q_6_135;
+            const auto C_133_82 = C_133_18 * Q_6_133;
+            const auto C_131_84 = C_131_20 * Q_6_131;
+            const auto C_129_86 = C_129_22 * Q_6_129;
+            const auto C_81_6 = Q_1_81 * Q_2_81;
+            const auto C_69_18 = Q_1_69 * Q_4_69;
+            const auto C_67_20 = Q_2_67 * Q_4_67;
+            const auto C_65_22 = C_65_6 * Q_4_65;
+            const auto C_21_66 = Q_1_21 * Q_6_21;
+            const auto C_19_68 = Q_2_19 * Q_6_19;
+            const auto C_17_70 = C_17_6 * Q_6_17;
+            const auto C_7_80 = Q_4_7 * Q_6_7;
+            const auto C_5_82 = C_5_18 * Q_6_5;
+            const auto C_3_84 = C_3_20 * Q_6_3;
+            const auto C_1_86 = C_1_22 * q_0_6;
+            const auto R_87 = 1 - (R_85 * Q_1_85 + R_83 * Q_2_83 + R_81 * C_81_6 + R_71 * Q_4_71
+                    + R_69 * C_69_18 + R_67 * C_67_20 + R_65 * C_65_22 + R_23 * Q_6_23
+                    + R_21 * C_21_66 + R_19 * C_19_68 + R_17 * C_17_70 + R_7 * C_7_80
+                    + R_5 * C_5_82 + R_3 * C_3_84 + C_1_86);
+            const auto Q_7_87 = Q_7_23 * q_6_7;
+            const auto C_85_130 = Q_1_85 * Q_7_85;
+            const auto C_83_132 = Q_2_83 * Q_7_83;
+            const auto C_81_134 = C_81_6 * Q_7_81;
+            const auto C_71_144 = Q_4_71 * Q_7_71;
+            const auto C_69_146 = C_69_18 * Q_7_69;
+            const auto C_67_148 = C_67_20 * Q_7_67;
+            const auto C_65_150 = C_65_22 * Q_7_65;
+            const auto C_23_192 = Q_6_23 * Q_7_23;
+            const auto C_21_194 = C_21_66 * Q_7_21;
+            const auto C_19_196 = C_19_68 * Q_7_19;
+            const auto C_17_198 = C_17_70 * Q_7_17;
+            const auto C_7_208 = C_7_80 * Q_7_7;
+            const auto C_5_210 = C_5_82 * Q_7_5;
+            const auto C_3_212 = C_3_84 * Q_7_3;
+            const auto C_1_214 = C_1_86 * q_0_7;
+            const auto R_215 = 1 - (R_213 * Q_1_213 + R_211 * Q_2_211 + R_209 * C_209_6 + R_199 * Q_4_199
+                    + R_197 * C_197_18 + R_195 * C_195_20 + R_193 * C_193_22 + R_151 * Q_6_151
+                    + R_149 * C_149_66 + R_147 * C_147_68 + R_145 * C_145_70 + R_135 * C_135_80
+                    + R_133 * C_133_82 + R_131 * C_131_84 + R_129 * C_129_86 + R_87 * Q_7_87
+                    + R_85 * C_85_130 + R_83 * C_83_132 + R_81 * C_81_134 + R_71 * C_71_144
+                    + R_69 * C_69_146 + R_67 * C_67_148 + R_65 * C_65_150 + R_23 * C_23_192
+                    + R_21 * C_21_194 + R_19 * C_19_196 + R_17 * C_17_198 + R_7 * C_7_208
+                    + R_5 * C_5_210 + R_3 * C_3_212 + C_1_214);
+            const auto Q_5_23 = Q_5_7 * q_4_5;
+            const auto Q_5_87 = Q_5_23 * q_5_6;
+            const auto Q_5_215 = Q_5_87 * q_5_7;
+            const auto C_213_34 = Q_1_213 * Q_5_213;
+            const auto C_211_36 = Q_2_211 * Q_5_211;
+            const auto C_209_38 = C_209_6 * Q_5_209;
+            const auto C_199_48 = Q_4_199 * Q_5_199;
+            const auto C_197_50 = C_197_18 * Q_5_197;
+            const auto C_195_52 = C_195_20 * Q_5_195;
+            const auto C_193_54 = C_193_22 * Q_5_193;
+            const auto Q_1_181 = Q_1_53 * q_1_7;
+            const auto Q_2_179 = Q_2_51 * q_2_7;
+            const auto C_177_6 = Q_1_177 * Q_2_177;
+            const auto Q_4_167 = Q_4_39 * q_4_7;
+            const auto C_165_18 = Q_1_165 * Q_4_165;
+            const auto C_163_20 = Q_2_163 * Q_4_163;
+            const auto C_161_22 = C_161_6 * Q_4_161;
+            const auto Q_5_151 = Q_5_23 * q_5_7;
+            const auto C_149_34 = Q_1_149 * Q_5_149;
+            const auto C_147_36 = Q_2_147 * Q_5_147;
+            const auto C_145_38 = C_145_6 * Q_5_145;
+            const auto C_135_48 = Q_4_135 * Q_5_135;
+            const auto C_133_50 = C_133_18 * Q_5_133;
+            const auto C_131_52 = C_131_20 * Q_5_131;
+            const auto C_129_54 = C_129_22 * Q_5_129;
+            const auto C_49_6 = Q_1_49 * Q_2_49;
+            const auto C_37_18 = Q_1_37 * Q_4_37;
+            const auto C_35_20 = Q_2_35 * Q_4_35;
+            const auto C_33_22 = C_33_6 * Q_4_33;
+            const auto C_21_34 = Q_1_21 * Q_5_21;
+            const auto C_19_36 = Q_2_19 * Q_5_19;
+            const auto C_17_38 = C_17_6 * Q_5_17;
+            const auto C_7_48 = Q_4_7 * Q_5_7;
+            const auto C_5_50 = C_5_18 * Q_5_5;
+            const auto C_3_52 = C_3_20 * Q_5_3;
+            const auto C_1_54 = C_1_22 * q_0_5;
+            const auto R_55 = 1 - (R_53 * Q_1_53 + R_51 * Q_2_51 + R_49 * C_49_6 + R_39 * Q_4_39
+                    + R_37 * C_37_18 + R_35 * C_35_20 + R_33 * C_33_22 + R_23 * Q_5_23
+                    + R_21 * C_21_34 + R_19 * C_19_36 + R_17 * C_17_38 + R_7 * C_7_48
+                    + R_5 * C_5_50 + R_3 * C_3_52 + C_1_54);
+            const auto Q_7_55 = Q_7_23 * q_5_7;
+            const auto C_53_130 = Q_1_53 * Q_7_53;
+            const auto C_51_132 = Q_2_51 * Q_7_51;
+            const auto C_49_134 = C_49_6 * Q_7_49;
+            const auto C_39_144 = Q_4_39 * Q_7_39;
+            const auto C_37_146 = C_37_18 * Q_7_37;
+            const auto C_35_148 = C_35_20 * Q_7_35;
+            const auto C_33_150 = C_33_22 * Q_7_33;
+            const auto C_23_160 = Q_5_23 * Q_7_23;
+            const auto C_21_162 = C_21_34 * Q_7_21;
+            const auto C_19_164 = C_19_36 * Q_7_19;
+            const auto C_17_166 = C_17_38 * Q_7_17;
+            const auto C_7_176 = C_7_48 * Q_7_7;
+            const auto C_5_178 = C_5_50 * Q_7_5;
+            const auto C_3_180 = C_3_52 * Q_7_3;
+            const auto C_1_182 = C_1_54 * q_0_7;
+            const auto R_183 = 1 - (R_181 * Q_1_181 + R_179 * Q_2_179 + R_177 * C_177_6 + R_167 * Q_4_167
+                    + R_165 * C_165_18 + R_163 * C_163_20 + R_161 * C_161_22 + R_151 * Q_5_151
+                    + R_149 * C_149_34 + R_147 * C_147_36 + R_145 * C_145_38 + R_135 * C_135_48
+                    + R_133 * C_133_50 + R_131 * C_131_52 + R_129 * C_129_54 + R_55 * Q_7_55
+                    + R_53 * C_53_130 + R_51 * C_51_132 + R_49 * C_49_134 + R_39 * C_39_144
+                    + R_37 * C_37_146 + R_35 * C_35_148 + R_33 * C_33_150 + R_23 * C_23_160
+                    + R_21 * C_21_162 + R_19 * C_19_164 + R_17 * C_17_166 + R_7 * C_7_176
+                    + R_5 * C_5_178 + R_3 * C_3_180 + C_1_182);
+            const auto Q_6_55 = Q_6_23 * q_5_6;
+            const auto Q_6_183 = Q_6_55 * q_6_7;
+            const auto C_181_66 = Q_1_181 * Q_6_181;
+            const auto C_179_68 = Q_2_179 * Q_6_179;
+            const auto C_177_70 = C_177_6 * Q_6_177;
+            const auto C_167_80 = Q_4_167 * Q_6_167;
+            const auto C_165_82 = C_165_18 * Q_6_165;
+            const auto C_163_84 = C_163_20 * Q_6_163;
+            const auto C_161_86 = C_161_22 * Q_6_161;
+            const auto C_151_96 = Q_5_151 * Q_6_151;
+            const auto C_149_98 = C_149_34 * Q_6_149;
+            const auto C_147_100 = C_147_36 * Q_6_147;
+            const auto C_145_102 = C_145_38 * Q_6_145;
+            const auto C_135_112 = C_135_48 * Q_6_135;
+            const auto C_133_114 = C_133_50 * Q_6_133;
+            const auto C_131_116 = C_131_52 * Q_6_131;
+            const auto C_129_118 = C_129_54 * Q_6_129;
+            const auto C_113_6 = Q_1_113 * Q_2_113;
+            const auto C_101_18 = Q_1_101 * Q_4_101;
+            const auto C_99_20 = Q_2_99 * Q_4_99;
+            const auto C_97_22 = C_97_6 * Q_4_97;
+            const auto C_85_34 = Q_1_85 * Q_5_85;
+            const auto C_83_36 = Q_2_83 * Q_5_83;
+            const auto C_81_38 = C_81_6 * Q_5_81;
+            const auto C_71_48 = Q_4_71 * Q_5_71;
+            const auto C_69_50 = C_69_18 * Q_5_69;
+            const auto C_67_52 = C_67_20 * Q_5_67;
+            const auto C_65_54 = C_65_22 * Q_5_65;
+            const auto C_53_66 = Q_1_53 * Q_6_53;
+            const auto C_51_68 = Q_2_51 * Q_6_51;
+            const auto C_49_70 = C_49_6 * Q_6_49;
+            const auto C_39_80 = Q_4_39 * Q_6_39;
+            const auto C_37_82 = C_37_18 * Q_6_37;
+            const auto C_35_84 = C_35_20 * Q_6_35;
+            const auto C_33_86 = C_33_22 * Q_6_33;
+            const auto C_23_96 = Q_5_23 * Q_6_23;
+            const auto C_21_98 = C_21_34 * Q_6_21;
+            const auto C_19_100 = C_19_36 * Q_6_19;
+            const auto C_17_102 = C_17_38 * Q_6_17;
+            const auto C_7_112 = C_7_48 * Q_6_7;
+            const auto C_5_114 = C_5_50 * Q_6_5;
+            const auto C_3_116 = C_3_52 * Q_6_3;
+            const auto C_1_118 = C_1_54 * q_0_6;
+            const auto R_119 = 1 - (R_117 * Q_1_117 + R_115 * Q_2_115 + R_113 * C_113_6 + R_103 * Q_4_103
+                    + R_101 * C_101_18 + R_99 * C_99_20 + R_97 * C_97_22 + R_87 * Q_5_87
+                    + R_85 * C_85_34 + R_83 * C_83_36 + R_81 * C_81_38 + R_71 * C_71_48
+                    + R_69 * C_69_50 + R_67 * C_67_52 + R_65 * C_65_54 + R_55 * Q_6_55
+                    + R_53 * C_53_66 + R_51 * C_51_68 + R_49 * C_49_70 + R_39 * C_39_80
+                    + R_37 * C_37_82 + R_35 * C_35_84 + R_33 * C_33_86 + R_23 * C_23_96
+                    + R_21 * C_21_98 + R_19 * C_19_100 + R_17 * C_17_102 + R_7 * C_7_112
+                    + R_5 * C_5_114 + R_3 * C_3_116 + C_1_118);
+            const auto Q_7_119 = Q_7_55 * q_6_7;
+            const auto C_117_130 = Q_1_117 * Q_7_117;
+            const auto C_115_132 = Q_2_115 * Q_7_115;
+            const auto C_113_134 = C_113_6 * Q_7_113;
+            const auto C_103_144 = Q_4_103 * Q_7_103;
+            const auto C_101_146 = C_101_18 * Q_7_101;
+            const auto C_99_148 = C_99_20 * Q_7_99;
+            const auto C_97_150 = C_97_22 * Q_7_97;
+            const auto C_87_160 = Q_5_87 * Q_7_87;
+            const auto C_85_162 = C_85_34 * Q_7_85;
+            const auto C_83_164 = C_83_36 * Q_7_83;
+            const auto C_81_166 = C_81_38 * Q_7_81;
+            const auto C_71_176 = C_71_48 * Q_7_71;
+            const auto C_69_178 = C_69_50 * Q_7_69;
+            const auto C_67_180 = C_67_52 * Q_7_67;
+            const auto C_65_182 = C_65_54 * Q_7_65;
+            const auto C_55_192 = Q_6_55 * Q_7_55;
+            const auto C_53_194 = C_53_66 * Q_7_53;
+            const auto C_51_196 = C_51_68 * Q_7_51;
+            const auto C_49_198 = C_49_70 * Q_7_49;
+            const auto C_39_208 = C_39_80 * Q_7_39;
+            const auto C_37_210 = C_37_82 * Q_7_37;
+            const auto C_35_212 = C_35_84 * Q_7_35;
+            const auto C_33_214 = C_33_86 * Q_7_33;
+            const auto C_23_224 = C_23_96 * Q_7_23;
+            const auto C_21_226 = C_21_98 * Q_7_21;
+            const auto C_19_228 = C_19_100 * Q_7_19;
+            const auto C_17_230 = C_17_102 * Q_7_17;
+            const auto C_7_240 = C_7_112 * Q_7_7;
+            const auto C_5_242 = C_5_114 * Q_7_5;
+            const auto C_3_244 = C_3_116 * Q_7_3;
+            const auto C_1_246 = C_1_118 * q_0_7;
+            const auto R_247 = 1 - (R_245 * Q_1_245 + R_243 * Q_2_243 + R_241 * C_241_6 + R_231 * Q_4_231
+                    + R_229 * C_229_18 + R_227 * C_227_20 + R_225 * C_225_22 + R_215 * Q_5_215
+                    + R_213 * C_213_34 + R_211 * C_211_36 + R_209 * C_209_38 + R_199 * C_199_48
+                    + R_197 * C_197_50 + R_195 * C_195_52 + R_193 * C_193_54 + R_183 * Q_6_183
+                    + R_181 * C_181_66 + R_179 * C_179_68 + R_177 * C_177_70 + R_167 * C_167_80
+                    + R_165 * C_165_82 + R_163 * C_163_84 + R_161 * C_161_86 + R_151 * C_151_96
+                    + R_149 * C_149_98 + R_147 * C_147_100 + R_145 * C_145_102 + R_135 * C_135_112
+                    + R_133 * C_133_114 + R_131 * C_131_116 + R_129 * C_129_118 + R_119 * Q_7_119
+                    + R_117 * C_117_130 + R_115 * C_115_132 + R_113 * C_113_134 + R_103 * C_103_144
+                    + R_101 * C_101_146 + R_99 * C_99_148 + R_97 * C_97_150 + R_87 * C_87_160
+                    + R_85 * C_85_162 + R_83 * C_83_164 + R_81 * C_81_166 + R_71 * C_71_176
+                    + R_69 * C_69_178 + R_67 * C_67_180 + R_65 * C_65_182 + R_55 * C_55_192
+                    + R_53 * C_53_194 + R_51 * C_51_196 + R_49 * C_49_198 + R_39 * C_39_208
+                    + R_37 * C_37_210 + R_35 * C_35_212 + R_33 * C_33_214 + R_23 * C_23_224
+                    + R_21 * C_21_226 + R_19 * C_19_228 + R_17 * C_17_230 + R_7 * C_7_240
+                    + R_5 * C_5_242 + R_3 * C_3_244 + C_1_246);
+            const auto Q_3_7 = Q_3_3 * q_2_3;
+            const auto Q_3_23 = Q_3_7 * q_3_4;
+            const auto Q_3_55 = Q_3_23 * q_3_5;
+            const auto Q_3_119 = Q_3_55 * q_3_6;
+            const auto Q_3_247 = Q_3_119 * q_3_7;
+            const auto C_245_10 = Q_1_245 * Q_3_245;
+            const auto C_243_12 = Q_2_243 * Q_3_243;
+            const auto C_241_14 = C_241_6 * Q_3_241;
+            const auto Q_1_45 = Q_1_13 * q_1_5;
+            const auto Q_1_109 = Q_1_45 * q_1_6;
+            const auto Q_1_237 = Q_1_109 * q_1_7;
+            const auto Q_2_43 = Q_2_11 * q_2_5;
+            const auto Q_2_107 = Q_2_43 * q_2_6;
+            const auto Q_2_235 = Q_2_107 * q_2_7;
+            const auto C_233_6 = Q_1_233 * Q_2_233;
+            const auto Q_3_39 = Q_3_7 * q_3_5;
+            const auto Q_3_103 = Q_3_39 * q_3_6;
+            const auto Q_3_231 = Q_3_103 * q_3_7;
+            const auto C_229_10 = Q_1_229 * Q_3_229;
+            const auto C_227_12 = Q_2_227 * Q_3_227;
+            const auto C_225_14 = C_225_6 * Q_3_225;
+            const auto Q_1_77 = Q_1_13 * q_1_6;
+            const auto Q_1_205 = Q_1_77 * q_1_7;
+            const auto Q_2_75 = Q_2_11 * q_2_6;
+            const auto Q_2_203 = Q_2_75 * q_2_7;
+            const auto C_201_6 = Q_1_201 * Q_2_201;
+            const auto Q_3_71 = Q_3_7 * q_3_6;
+            const auto Q_3_199 = Q_3_71 * q_3_7;
+            const auto C_197_10 = Q_1_197 * Q_3_197;
+            const auto C_195_12 = Q_2_195 * Q_3_195;
+            const auto C_193_14 = C_193_6 * Q_3_193;
+            const auto Q_1_141 = Q_1_13 * q_1_7;
+            const auto Q_2_139 = Q_2_11 * q_2_7;
+            const auto C_137_6 = Q_1_137 * Q_2_137;
+            const auto Q_3_135 = Q_3_7 * q_3_7;
+            const auto C_133_10 = Q_1_133 * Q_3_133;
+            const auto C_131_12 = Q_2_131 * Q_3_131;
+            const auto C_129_14 = C_129_6 * Q_3_129;
+            const auto C_9_6 = Q_1_9 * Q_2_9;
+            const auto C_5_10 = Q_1_5 * Q_3_5;
+            const auto C_3_12 = Q_2_3 * Q_3_3;
+            const auto C_1_14 = C_1_6 * q_0_3;
+            const auto R_15 = 1 - (R_13 * Q_1_13 + R_11 * Q_2_11 + R_9 * C_9_6 + R_7 * Q_3_7
+                    + R_5 * C_5_10 + R_3 * C_3_12 + C_1_14);
+            const auto Q_7_15 = Q_7_7 * q_3_7;
+            const auto C_13_130 = Q_1_13 * Q_7_13;
+            const auto C_11_132 = Q_2_11 * Q_7_11;
+            const auto C_9_134 = C_9_6 * Q_7_9;
+            const auto C_7_136 = Q_3_7 * Q_7_7;
+            const auto C_5_138 = C_5_10 * Q_7_5;
+            const auto C_3_140 = C_3_12 * Q_7_3;
+            const auto C_1_142 = C_1_14 * q_0_7;
+            const auto R_143 = 1 - (R_141 * Q_1_141 + R_139 * Q_2_139 + R_137 * C_137_6 + R_135 * Q_3_135
+                    + R_133 * C_133_10 + R_131 * C_131_12 + R_129 * C_129_14 + R_15 * Q_7_15
+                    + R_13 * C_13_130 + R_11 * C_11_132 + R_9 * C_9_134 + R_7 * C_7_136
+                    + R_5 * C_5_138 + R_3 * C_3_140 + C_1_142);
+            const auto Q_6_15 = Q_6_7 * q_3_6;
+            const auto Q_6_143 = Q_6_15 * q_6_7;
+            const auto C_141_66 = Q_1_141 * Q_6_141;
+            const auto C_139_68 = Q_2_139 * Q_6_139;
+            const auto C_137_70 = C_137_6 * Q_6_137;
+            const auto C_135_72 = Q_3_135 * Q_6_135;
+            const auto C_133_74 = C_133_10 * Q_6_133;
+            const auto C_131_76 = C_131_12 * Q_6_131;
+            const auto C_129_78 = C_129_14 * Q_6_129;
+            const auto C_73_6 = Q_1_73 * Q_2_73;
+            const auto C_69_10 = Q_1_69 * Q_3_69;
+            const auto C_67_12 = Q_2_67 * Q_3_67;
+            const auto C_65_14 = C_65_6 * Q_3_65;
+            const auto C_13_66 = Q_1_13 * Q_6_13;
+            const auto C_11_68 = Q_2_11 * Q_6_11;
+            const auto C_9_70 = C_9_6 * Q_6_9;
+            const auto C_7_72 = Q_3_7 * Q_6_7;
+            const auto C_5_74 = C_5_10 * Q_6_5;
+            const auto C_3_76 = C_3_12 * Q_6_3;
+            const auto C_1_78 = C_1_14 * q_0_6;
+            const auto R_79 = 1 - (R_77 * Q_1_77 + R_75 * Q_2_75 + R_73 * C_73_6 + R_71 * Q_3_71
+                    + R_69 * C_69_10 + R_67 * C_67_12 + R_65 * C_65_14 + R_15 * Q_6_15
+                    + R_13 * C_13_66 + R_11 * C_11_68 + R_9 * C_9_70 + R_7 * C_7_72
+                    + R_5 * C_5_74 + R_3 * C_3_76 + C_1_78);
+            const auto Q_7_79 = Q_7_15 * q_6_7;
+            const auto C_77_130 = Q_1_77 * Q_7_77;
+            const auto C_75_132 = Q_2_75 * Q_7_75;
+            const auto C_73_134 = C_73_6 * Q_7_73;
+            const auto C_71_136 = Q_3_71 * Q_7_71;
+            const auto C_69_138 = C_69_10 * Q_7_69;
+            const auto C_67_140 = C_67_12 * Q_7_67;
+            const auto C_65_142 = C_65_14 * Q_7_65;
+            const auto C_15_192 = Q_6_15 * Q_7_15;
+            const auto C_13_194 = C_13_66 * Q_7_13;
+            const auto C_11_196 = C_11_68 * Q_7_11;
+            const auto C_9_198 = C_9_70 * Q_7_9;
+            const auto C_7_200 = C_7_72 * Q_7_7;
+            const auto C_5_202 = C_5_74 * Q_7_5;
+            const auto C_3_204 = C_3_76 * Q_7_3;
+            const auto C_1_206 = C_1_78 * q_0_7;
+            const auto R_207 = 1 - (R_205 * Q_1_205 + R_203 * Q_2_203 + R_201 * C_201_6 + R_199 * Q_3_199
+                    + R_197 * C_197_10 + R_195 * C_195_12 + R_193 * C_193_14 + R_143 * Q_6_143
+                    + R_141 * C_141_66 + R_139 * C_139_68 + R_137 * C_137_70 + R_135 * C_135_72
+                    + R_133 * C_133_74 + R_131 * C_131_76 + R_129 * C_129_78 + R_79 * Q_7_79
+                    + R_77 * C_77_130 + R_75 * C_75_132 + R_73 * C_73_134 + R_71 * C_71_136
+                    + R_69 * C_69_138 + R_67 * C_67_140 + R_65 * C_65_142 + R_15 * C_15_192
+                    + R_13 * C_13_194 + R_11 * C_11_196 + R_9 * C_9_198 + R_7 * C_7_200
+                    + R_5 * C_5_202 + R_3 * C_3_204 + C_1_206);
+            const auto Q_5_15 = Q_5_7 * q_3_5;
+            const auto Q_5_79 = Q_5_15 * q_5_6;
+            const auto Q_5_207 = Q_5_79 * q_5_7;
+            const auto C_205_34 = Q_1_205 * Q_5_205;
+            const auto C_203_36 = Q_2_203 * Q_5_203;
+            const auto C_201_38 = C_201_6 * Q_5_201;
+            const auto C_199_40 = Q_3_199 * Q_5_199;
+            const auto C_197_42 = C_197_10 * Q_5_197;
+            const auto C_195_44 = C_195_12 * Q_5_195;
+            const auto C_193_46 = C_193_14 * Q_5_193;
+            const auto Q_1_173 = Q_1_45 * q_1_7;
+            const auto Q_2_171 = Q_2_43 * q_2_7;
+            const auto C_169_6 = Q_1_169 * Q_2_169;
+            const auto Q_3_167 = Q_3_39 * q_3_7;
+            const auto C_165_10 = Q_1_165 * Q_3_165;
+            const auto C_163_12 = Q_2_163 * Q_3_163;
+            const auto C_161_14 = C_161_6 * Q_3_161;
+            const auto Q_5_143 = Q_5_15 * q_5_7;
+            const auto C_141_34 = Q_1_141 * Q_5_141;
+            const auto C_139_36 = Q_2_139 * Q_5_139;
+            const auto C_137_38 = C_137_6 * Q_5_137;
+            const auto C_135_40 = Q_3_135 * Q_5_135;
+            const auto C_133_42 = C_133_10 * Q_5_133;
+            const auto C_131_44 = C_131_12 * Q_5_131;
+            const auto C_129_46 = C_129_14 * Q_5_129;
+            const auto C_41_6 = Q_1_41 * Q_2_41;
+            const auto C_37_10 = Q_1_37 * Q_3_37;
+            const auto C_35_12 = Q_2_35 * Q_3_35;
+            const auto C_33_14 = C_33_6 * Q_3_33;
+            const auto C_13_34 = Q_1_13 * Q_5_13;
+            const auto C_11_36 = Q_2_11 * Q_5_11;
+            const auto C_9_38 = C_9_6 * Q_5_9;
+            const auto C_7_40 = Q_3_7 * Q_5_7;
+            const auto C_5_42 = C_5_10 * Q_5_5;
+            const auto C_3_44 = C_3_12 * Q_5_3;
+            const auto C_1_46 = C_1_14 * q_0_5;
+            const auto R_47 = 1 - (R_45 * Q_1_45 + R_43 * Q_2_43 + R_41 * C_41_6 + R_39 * Q_3_39
+                    + R_37 * C_37_10 + R_35 * C_35_12 + R_33 * C_33_14 + R_15 * Q_5_15
+                    + R_13 * C_13_34 + R_11 * C_11_36 + R_9 * C_9_38 + R_7 * C_7_40
+                    + R_5 * C_5_42 + R_3 * C_3_44 + C_1_46);
+            const auto Q_7_47 = Q_7_15 * q_5_7;
+            const auto C_45_130 = Q_1_45 * Q_7_45;
+            const auto C_43_132 = Q_2_43 * Q_7_43;
+            const auto C_41_134 = C_41_6 * Q_7_41;
+            const auto C_39_136 = Q_3_39 * Q_7_39;
+            const auto C_37_138 = C_37_10 * Q_7_37;
+            const auto C_35_140 = C_35_12 * Q_7_35;
+            const auto C_33_142 = C_33_14 * Q_7_33;
+            const auto C_15_160 = Q_5_15 * Q_7_15;
+            const auto C_13_162 = C_13_34 * Q_7_13;
+            const auto C_11_164 = C_11_36 * Q_7_11;
+            const auto C_9_166 = C_9_38 * Q_7_9;
+            const auto C_7_168 = C_7_40 * Q_7_7;
+            const auto C_5_170 = C_5_42 * Q_7_5;
+            const auto C_3_172 = C_3_44 * Q_7_3;
+            const auto C_1_174 = C_1_46 * q_0_7;
+            const auto R_175 = 1 - (R_173 * Q_1_173 + R_171 * Q_2_171 + R_169 * C_169_6 + R_167 * Q_3_167
+                    + R_165 * C_165_10 + R_163 * C_163_12 + R_161 * C_161_14 + R_143 * Q_5_143
+                    + R_141 * C_141_34 + R_139 * C_139_36 + R_137 * C_137_38 + R_135 * C_135_40
+                    + R_133 * C_133_42 + R_131 * C_131_44 + R_129 * C_129_46 + R_47 * Q_7_47
+                    + R_45 * C_45_130 + R_43 * C_43_132 + R_41 * C_41_134 + R_39 * C_39_136
+                    + R_37 * C_37_138 + R_35 * C_35_140 + R_33 * C_33_142 + R_15 * C_15_160
+                    + R_13 * C_13_162 + R_11 * C_11_164 + R_9 * C_9_166 + R_7 * C_7_168
+                    + R_5 * C_5_170 + R_3 * C_3_172 + C_1_174);
+            const auto Q_6_47 = Q_6_15 * q_5_6;
+            const auto Q_6_175 = Q_6_47 * q_6_7;
+            const auto C_173_66 = Q_1_173 * Q_6_173;
+            const auto C_171_68 = Q_2_171 * Q_6_171;
+            const auto C_169_70 = C_169_6 * Q_6_169;
+            const auto C_167_72 = Q_3_167 * Q_6_167;
+            const auto C_165_74 = C_165_10 * Q_6_165;
+            const auto C_163_76 = C_163_12 * Q_6_163;
+            const auto C_161_78 = C_161_14 * Q_6_161;
+            const auto C_143_96 = Q_5_143 * Q_6_143;
+            const auto C_141_98 = C_141_34 * Q_6_141;
+            const auto C_139_100 = C_139_36 * Q_6_139;
+            const auto C_137_102 = C_137_38 * Q_6_137;
+            const auto C_135_104 = C_135_40 * Q_6_135;
+            const auto C_133_106 = C_133_42 * Q_6_133;
+            const auto C_131_108 = C_131_44 * Q_6_131;
+            const auto C_129_110 = C_129_46 * Q_6_129;
+            const auto C_105_6 = Q_1_105 * Q_2_105;
+            const auto C_101_10 = Q_1_101 * Q_3_101;
+            const auto C_99_12 = Q_2_99 * Q_3_99;
+            const auto C_97_14 = C_97_6 * Q_3_97;
+            const auto C_77_34 = Q_1_77 * Q_5_77;
+            const auto C_75_36 = Q_2_75 * Q_5_75;
+            const auto C_73_38 = C_73_6 * Q_5_73;
+            const auto C_71_40 = Q_3_71 * Q_5_71;
+            const auto C_69_42 = C_69_10 * Q_5_69;
+            const auto C_67_44 = C_67_12 * Q_5_67;
+            const auto C_65_46 = C_65_14 * Q_5_65;
+            const auto C_45_66 = Q_1_45 * Q_6_45;
+            const auto C_43_68 = Q_2_43 * Q_6_43;
+            const auto C_41_70 = C_41_6 * Q_6_41;
+            const auto C_39_72 = Q_3_39 * Q_6_39;
+            const auto C_37_74 = C_37_10 * Q_6_37;
+            const auto C_35_76 = C_35_12 * Q_6_35;
+            const auto C_33_78 = C_33_14 * Q_6_33;
+            const auto C_15_96 = Q_5_15 * Q_6_15;
+            const auto C_13_98 = C_13_34 * Q_6_13;
+            const auto C_11_100 = C_11_36 * Q_6_11;
+            const auto C_9_102 = C_9_38 * Q_6_9;
+            const auto C_7_104 = C_7_40 * Q_6_7;
+            const auto C_5_106 = C_5_42 * Q_6_5;
+            const auto C_3_108 = C_3_44 * Q_6_3;
+            const auto C_1_110 = C_1_46 * q_0_6;
+            const auto R_111 = 1 - (R_109 * Q_1_109 + R_107 * Q_2_107 + R_105 * C_105_6 + R_103 * Q_3_103
+                    + R_101 * C_101_10 + R_99 * C_99_12 + R_97 * C_97_14 + R_79 * Q_5_79
+                    + R_77 * C_77_34 + R_75 * C_75_36 + R_73 * C_73_38 + R_71 * C_71_40
+                    + R_69 * C_69_42 + R_67 * C_67_44 + R_65 * C_65_46 + R_47 * Q_6_47
+                    + R_45 * C_45_66 + R_43 * C_43_68 + R_41 * C_41_70 + R_39 * C_39_72
+                    + R_37 * C_37_74 + R_35 * C_35_76 + R_33 * C_33_78 + R_15 * C_15_96
+                    + R_13 * C_13_98 + R_11 * C_11_100 + R_9 * C_9_102 + R_7 * C_7_104
+                    + R_5 * C_5_106 + R_3 * C_3_108 + C_1_110);
+            const auto Q_7_111 = Q_7_47 * q_6_7;
+            const auto C_109_130 = Q_1_109 * Q_7_109;
+            const auto C_107_132 = Q_2_107 * Q_7_107;
+            const auto C_105_134 = C_105_6 * Q_7_105;
+            const auto C_103_136 = Q_3_103 * Q_7_103;
+            const auto C_101_138 = C_101_10 * Q_7_101;
+            const auto C_99_140 = C_99_12 * Q_7_99;
+            const auto C_97_142 = C_97_14 * Q_7_97;
+            const auto C_79_160 = Q_5_79 * Q_7_79;
+            const auto C_77_162 = C_77_34 * Q_7_77;
+            const auto C_75_164 = C_75_36 * Q_7_75;
+            const auto C_73_166 = C_73_38 * Q_7_73;
+            const auto C_71_168 = C_71_40 * Q_7_71;
+            const auto C_69_170 = C_69_42 * Q_7_69;
+            const auto C_67_172 = C_67_44 * Q_7_67;
+            const auto C_65_174 = C_65_46 * Q_7_65;
+            const auto C_47_192 = Q_6_47 * Q_7_47;
+            const auto C_45_194 = C_45_66 * Q_7_45;
+            const auto C_43_196 = C_43_68 * Q_7_43;
+            const auto C_41_198 = C_41_70 * Q_7_41;
+            const auto C_39_200 = C_39_72 * Q_7_39;
+            const auto C_37_202 = C_37_74 * Q_7_37;
+            const auto C_35_204 = C_35_76 * Q_7_35;
+            const auto C_33_206 = C_33_78 * Q_7_33;
+            const auto C_15_224 = C_15_96 * Q_7_15;
+            const auto C_13_226 = C_13_98 * Q_7_13;
+            const auto C_11_228 = C_11_100 * Q_7_11;
+            const auto C_9_230 = C_9_102 * Q_7_9;
+            const auto C_7_232 = C_7_104 * Q_7_7;
+            const auto C_5_234 = C_5_106 * Q_7_5;
+            const auto C_3_236 = C_3_108 * Q_7_3;
+            const auto C_1_238 = C_1_110 * q_0_7;
+            const auto R_239 = 1 - (R_237 * Q_1_237 + R_235 * Q_2_235 + R_233 * C_233_6 + R_231 * Q_3_231
+                    + R_229 * C_229_10 + R_227 * C_227_12 + R_225 * C_225_14 + R_207 * Q_5_207
+                    + R_205 * C_205_34 + R_203 * C_203_36 + R_201 * C_201_38 + R_199 * C_199_40
+                    + R_197 * C_197_42 + R_195 * C_195_44 + R_193 * C_193_46 + R_175 * Q_6_175
+                    + R_173 * C_173_66 + R_171 * C_171_68 + R_169 * C_169_70 + R_167 * C_167_72
+                    + R_165 * C_165_74 + R_163 * C_163_76 + R_161 * C_161_78 + R_143 * C_143_96
+                    + R_141 * C_141_98 + R_139 * C_139_100 + R_137 * C_137_102 + R_135 * C_135_104
+                    + R_133 * C_133_106 + R_131 * C_131_108 + R_129 * C_129_110 + R_111 * Q_7_111
+                    + R_109 * C_109_130 + R_107 * C_107_132 + R_105 * C_105_134 + R_103 * C_103_136
+                    + R_101 * C_101_138 + R_99 * C_99_140 + R_97 * C_97_142 + R_79 * C_79_160
+                    + R_77 * C_77_162 + R_75 * C_75_164 + R_73 * C_73_166 + R_71 * C_71_168
+                    + R_69 * C_69_170 + R_67 * C_67_172 + R_65 * C_65_174 + R_47 * C_47_192
+                    + R_45 * C_45_194 + R_43 * C_43_196 + R_41 * C_41_198 + R_39 * C_39_200
+                    + R_37 * C_37_202 + R_35 * C_35_204 + R_33 * C_33_206 + R_15 * C_15_224
+                    + R_13 * C_13_226 + R_11 * C_11_228 + R_9 * C_9_230 + R_7 * C_7_232
+                    + R_5 * C_5_234 + R_3 * C_3_236 + C_1_238);
+            const auto Q_4_15 = Q_4_7 * q_3_4;
+            const auto Q_4_47 = Q_4_15 * q_4_5;
+            const auto Q_4_111 = Q_4_47 * q_4_6;
+            const auto Q_4_239 = Q_4_111 * q_4_7;
+            const auto C_237_18 = Q_1_237 * Q_4_237;
+            const auto C_235_20 = Q_2_235 * Q_4_235;
+            const auto C_233_22 = C_233_6 * Q_4_233;
+            const auto C_231_24 = Q_3_231 * Q_4_231;
+            const auto C_229_26 = C_229_10 * Q_4_229;
+            const auto C_227_28 = C_227_12 * Q_4_227;
+            const auto C_225_30 = C_225_14 * Q_4_225;
+            const auto Q_1_93 = Q_1_29 * q_1_6;
+            const auto Q_1_221 = Q_1_93 * q_1_7;
+            const auto Q_2_91 = Q_2_27 * q_2_6;
+            const auto Q_2_219 = Q_2_91 * q_2_7;
+            const auto C_217_6 = Q_1_217 * Q_2_217;
+            const auto Q_3_87 = Q_3_23 * q_3_6;
+            const auto Q_3_215 = Q_3_87 * q_3_7;
+            const auto C_213_10 = Q_1_213 * Q_3_213;
+            const auto C_211_12 = Q_2_211 * Q_3_211;
+            const auto C_209_14 = C_209_6 * Q_3_209;
+            const auto Q_4_79 = Q_4_15 * q_4_6;
+            const auto Q_4_207 = Q_4_79 * q_4_7;
+            const auto C_205_18 = Q_1_205 * Q_4_205;
+            const auto C_203_20 = Q_2_203 * Q_4_203;
+            const auto C_201_22 = C_201_6 * Q_4_201;
+            const auto C_199_24 = Q_3_199 * Q_4_199;
+            const auto C_197_26 = C_197_10 * Q_4_197;
+            const auto C_195_28 = C_195_12 * Q_4_195;
+            const auto C_193_30 = C_193_14 * Q_4_193;
+            const auto Q_1_157 = Q_1_29 * q_1_7;
+            const auto Q_2_155 = Q_2_27 * q_2_7;
+            const auto C_153_6 = Q_1_153 * Q_2_153;
+            const auto Q_3_151 = Q_3_23 * q_3_7;
+            const auto C_149_10 = Q_1_149 * Q_3_149;
+            const auto C_147_12 = Q_2_147 * Q_3_147;
+            const auto C_145_14 = C_145_6 * Q_3_145;
+            const auto Q_4_143 = Q_4_15 * q_4_7;
+            const auto C_141_18 = Q_1_141 * Q_4_141;
+            const auto C_139_20 = Q_2_139 * Q_4_139;
+            const auto C_137_22 = C_137_6 * Q_4_137;
+            const auto C_135_24 = Q_3_135 * Q_4_135;
+            const auto C_133_26 = C_133_10 * Q_4_133;
+            const auto C_131_28 = C_131_12 * Q_4_131;
+            const auto C_129_30 = C_129_14 * Q_4_129;
+            const auto C_25_6 = Q_1_25 * Q_2_25;
+            const auto C_21_10 = Q_1_21 * Q_3_21;
+            const auto C_19_12 = Q_2_19 * Q_3_19;
+            const auto C_17_14 = C_17_6 * Q_3_17;
+            const auto C_13_18 = Q_1_13 * Q_4_13;
+            const auto C_11_20 = Q_2_11 * Q_4_11;
+            const auto C_9_22 = C_9_6 * Q_4_9;
+            const auto C_7_24 = Q_3_7 * Q_4_7;
+            const auto C_5_26 = C_5_10 * Q_4_5;
+            const auto C_3_28 = C_3_12 * Q_4_3;
+            const auto C_1_30 = C_1_14 * q_0_4;
+            const auto R_31 = 1 - (R_29 * Q_1_29 + R_27 * Q_2_27 + R_25 * C_25_6 + R_23 * Q_3_23
+                    + R_21 * C_21_10 + R_19 * C_19_12 + R_17 * C_17_14 + R_15 * Q_4_15
+                    + R_13 * C_13_18 + R_11 * C_11_20 + R_9 * C_9_22 + R_7 * C_7_24
+                    + R_5 * C_5_26 + R_3 * C_3_28 + C_1_30);
+            const auto Q_7_31 = Q_7_15 * q_4_7;
+            const auto C_29_130 = Q_1_29 * Q_7_29;
+            const auto C_27_132 = Q_2_27 * Q_7_27;
+            const auto C_25_134 = C_25_6 * Q_7_25;
+            const auto C_23_136 = Q_3_23 * Q_7_23;
+            const auto C_21_138 = C_21_10 * Q_7_21;
+            const auto C_19_140 = C_19_12 * Q_7_19;
+            const auto C_17_142 = C_17_14 * Q_7_17;
+            const auto C_15_144 = Q_4_15 * Q_7_15;
+            const auto C_13_146 = C_13_18 * Q_7_13;
+            const auto C_11_148 = C_11_20 * Q_7_11;
+            const auto C_9_150 = C_9_22 * Q_7_9;
+            const auto C_7_152 = C_7_24 * Q_7_7;
+            const auto C_5_154 = C_5_26 * Q_7_5;
+            const auto C_3_156 = C_3_28 * Q_7_3;
+            const auto C_1_158 = C_1_30 * q_0_7;
+            const auto R_159 = 1 - (R_157 * Q_1_157 + R_155 * Q_2_155 + R_153 * C_153_6 + R_151 * Q_3_151
+                    + R_149 * C_149_10 + R_147 * C_147_12 + R_145 * C_145_14 + R_143 * Q_4_143
+                    + R_141 * C_141_18 + R_139 * C_139_20 + R_137 * C_137_22 + R_135 * C_135_24
+                    + R_133 * C_133_26 + R_131 * C_131_28 + R_129 * C_129_30 + R_31 * Q_7_31
+                    + R_29 * C_29_130 + R_27 * C_27_132 + R_25 * C_25_134 + R_23 * C_23_136
+                    + R_21 * C_21_138 + R_19 * C_19_140 + R_17 * C_17_142 + R_15 * C_15_144
+                    + R_13 * C_13_146 + R_11 * C_11_148 + R_9 * C_9_150 + R_7 * C_7_152
+                    + R_5 * C_5_154 + R_3 * C_3_156 + C_1_158);
+            const auto Q_6_31 = Q_6_15 * q_4_6;
+            const auto Q_6_159 = Q_6_31 * q_6_7;
+            const auto C_157_66 = Q_1_157 * Q_6_157;
+            const auto C_155_68 = Q_2_155 * Q_6_155;
+            const auto C_153_70 = C_153_6 * Q_6_153;
+            const auto C_151_72 = Q_3_151 * Q_6_151;
+            const auto C_149_74 = C_149_10 * Q_6_149;
+            const auto C_147_76 = C_147_12 * Q_6_147;
+            const auto C_145_78 = C_145_14 * Q_6_145;
+            const auto C_143_80 = Q_4_143 * Q_6_143;
+            const auto C_141_82 = C_141_18 * Q_6_141;
+            const auto C_139_84 = C_139_20 * Q_6_139;
+            const auto C_137_86 = C_137_22 * Q_6_137;
+            const auto C_135_88 = C_135_24 * Q_6_135;
+            const auto C_133_90 = C_133_26 * Q_6_133;
+            const auto C_131_92 = C_131_28 * Q_6_131;
+            const auto C_129_94 = C_129_30 * Q_6_129;
+            const auto C_89_6 = Q_1_89 * Q_2_89;
+            const auto C_85_10 = Q_1_85 * Q_3_85;
+            const auto C_83_12 = Q_2_83 * Q_3_83;
+            const auto C_81_14 = C_81_6 * Q_3_81;
+            const auto C_77_18 = Q_1_77 * Q_4_77;
+            const auto C_75_20 = Q_2_75 * Q_4_75;
+            const auto C_73_22 = C_73_6 * Q_4_73;
+            const auto C_71_24 = Q_3_71 * Q_4_71;
+            const auto C_69_26 = C_69_10 * Q_4_69;
+            const auto C_67_28 = C_67_12 * Q_4_67;
+            const auto C_65_30 = C_65_14 * Q_4_65;
+            const auto C_29_66 = Q_1_29 * Q_6_29;
+            const auto C_27_68 = Q_2_27 * Q_6_27;
+            const auto C_25_70 = C_25_6 * Q_6_25;
+            const auto C_23_72 = Q_3_23 * Q_6_23;
+            const auto C_21_74 = C_21_10 * Q_6_21;
+            const auto C_19_76 = C_19_12 * Q_6_19;
+            const auto C_17_78 = C_17_14 * Q_6_17;
+            const auto C_15_80 = Q_4_15 * Q_6_15;
+            const auto C_13_82 = C_13_18 * Q_6_13;
+            const auto C_11_84 = C_11_20 * Q_6_11;
+            const auto C_9_86 = C_9_22 * Q_6_9;
+            const auto C_7_88 = C_7_24 * Q_6_7;
+            const auto C_5_90 = C_5_26 * Q_6_5;
+            const auto C_3_92 = C_3_28 * Q_6_3;
+            const auto C_1_94 = C_1_30 * q_0_6;
+            const auto R_95 = 1 - (R_93 * Q_1_93 + R_91 * Q_2_91 + R_89 * C_89_6 + R_87 * Q_3_87
+                    + R_85 * C_85_10 + R_83 * C_83_12 + R_81 * C_81_14 + R_79 * Q_4_79
+                    + R_77 * C_77_18 + R_75 * C_75_20 + R_73 * C_73_22 + R_71 * C_71_24
+                    + R_69 * C_69_26 + R_67 * C_67_28 + R_65 * C_65_30 + R_31 * Q_6_31
+                    + R_29 * C_29_66 + R_27 * C_27_68 + R_25 * C_25_70 + R_23 * C_23_72
+                    + R_21 * C_21_74 + R_19 * C_19_76 + R_17 * C_17_78 + R_15 * C_15_80
+                    + R_13 * C_13_82 + R_11 * C_11_84 + R_9 * C_9_86 + R_7 * C_7_88
+                    + R_5 * C_5_90 + R_3 * C_3_92 + C_1_94);
+            const auto Q_7_95 = Q_7_31 * q_6_7;
+            const auto C_93_130 = Q_1_93 * Q_7_93;
+            const auto C_91_132 = Q_2_91 * Q_7_91;
+            const auto C_89_134 = C_89_6 * Q_7_89;
+            const auto C_87_136 = Q_3_87 * Q_7_87;
+            const auto C_85_138 = C_85_10 * Q_7_85;
+            const auto C_83_140 = C_83_12 * Q_7_83;
+            const auto C_81_142 = C_81_14 * Q_7_81;
+            const auto C_79_144 = Q_4_79 * Q_7_79;
+            const auto C_77_146 = C_77_18 * Q_7_77;
+            const auto C_75_148 = C_75_20 * Q_7_75;
+            const auto C_73_150 = C_73_22 * Q_7_73;
+            const auto C_71_152 = C_71_24 * Q_7_71;
+            const auto C_69_154 = C_69_26 * Q_7_69;
+            const auto C_67_156 = C_67_28 * Q_7_67;
+            const auto C_65_158 = C_65_30 * Q_7_65;
+            const auto C_31_192 = Q_6_31 * Q_7_31;
+            const auto C_29_194 = C_29_66 * Q_7_29;
+            const auto C_27_196 = C_27_68 * Q_7_27;
+            const auto C_25_198 = C_25_70 * Q_7_25;
+            const auto C_23_200 = C_23_72 * Q_7_23;
+            const auto C_21_202 = C_21_74 * Q_7_21;
+            const auto C_19_204 = C_19_76 * Q_7_19;
+            const auto C_17_206 = C_17_78 * Q_7_17;
+            const auto C_15_208 = C_15_80 * Q_7_15;
+            const auto C_13_210 = C_13_82 * Q_7_13;
+            const auto C_11_212 = C_11_84 * Q_7_11;
+            const auto C_9_214 = C_9_86 * Q_7_9;
+            const auto C_7_216 = C_7_88 * Q_7_7;
+            const auto C_5_218 = C_5_90 * Q_7_5;
+            const auto C_3_220 = C_3_92 * Q_7_3;
+            const auto C_1_222 = C_1_94 * q_0_7;
+            const auto R_223 = 1 - (R_221 * Q_1_221 + R_219 * Q_2_219 + R_217 * C_217_6 + R_215 * Q_3_215
+                    + R_213 * C_213_10 + R_211 * C_211_12 + R_209 * C_209_14 + R_207 * Q_4_207
+                    + R_205 * C_205_18 + R_203 * C_203_20 + R_201 * C_201_22 + R_199 * C_199_24
+                    + R_197 * C_197_26 + R_195 * C_195_28 + R_193 * C_193_30 + R_159 * Q_6_159
+                    + R_157 * C_157_66 + R_155 * C_155_68 + R_153 * C_153_70 + R_151 * C_151_72
+                    + R_149 * C_149_74 + R_147 * C_147_76 + R_145 * C_145_78 + R_143 * C_143_80
+                    + R_141 * C_141_82 + R_139 * C_139_84 + R_137 * C_137_86 + R_135 * C_135_88
+                    + R_133 * C_133_90 + R_131 * C_131_92 + R_129 * C_129_94 + R_95 * Q_7_95
+                    + R_93 * C_93_130 + R_91 * C_91_132 + R_89 * C_89_134 + R_87 * C_87_136
+                    + R_85 * C_85_138 + R_83 * C_83_140 + R_81 * C_81_142 + R_79 * C_79_144
+                    + R_77 * C_77_146 + R_75 * C_75_148 + R_73 * C_73_150 + R_71 * C_71_152
+                    + R_69 * C_69_154 + R_67 * C_67_156 + R_65 * C_65_158 + R_31 * C_31_192
+                    + R_29 * C_29_194 + R_27 * C_27_196 + R_25 * C_25_198 + R_23 * C_23_200
+                    + R_21 * C_21_202 + R_19 * C_19_204 + R_17 * C_17_206 + R_15 * C_15_208
+                    + R_13 * C_13_210 + R_11 * C_11_212 + R_9 * C_9_214 + R_7 * C_7_216
+                    + R_5 * C_5_218 + R_3 * C_3_220 + C_1_222);
+            const auto Q_5_31 = Q_5_15 * q_4_5;
+            const auto Q_5_95 = Q_5_31 * q_5_6;
+            const auto Q_5_223 = Q_5_95 * q_5_7;
+            const auto C_221_34 = Q_1_221 * Q_5_221;
+            const auto C_219_36 = Q_2_219 * Q_5_219;
+            const auto C_217_38 = C_217_6 * Q_5_217;
+            const auto C_215_40 = Q_3_215 * Q_5_215;
+            const auto C_213_42 = C_213_10 * Q_5_213;
+            const auto C_211_44 = C_211_12 * Q_5_211;
+            const auto C_209_46 = C_209_14 * Q_5_209;
+            const auto C_207_48 = Q_4_207 * Q_5_207;
+            const auto C_205_50 = C_205_18 * Q_5_205;
+            const auto C_203_52 = C_203_20 * Q_5_203;
+            const auto C_201_54 = C_201_22 * Q_5_201;
+            const auto C_199_56 = C_199_24 * Q_5_199;
+            const auto C_197_58 = C_197_26 * Q_5_197;
+            const auto C_195_60 = C_195_28 * Q_5_195;
+            const auto C_193_62 = C_193_30 * Q_5_193;
+            const auto Q_1_189 = Q_1_61 * q_1_7;
+            const auto Q_2_187 = Q_2_59 * q_2_7;
+            const auto C_185_6 = Q_1_185 * Q_2_185;
+            const auto Q_3_183 = Q_3_55 * q_3_7;
+            const auto C_181_10 = Q_1_181 * Q_3_181;
+            const auto C_179_12 = Q_2_179 * Q_3_179;
+            const auto C_177_14 = C_177_6 * Q_3_177;
+            const auto Q_4_175 = Q_4_47 * q_4_7;
+            const auto C_173_18 = Q_1_173 * Q_4_173;
+            const auto C_171_20 = Q_2_171 * Q_4_171;
+            const auto C_169_22 = C_169_6 * Q_4_169;
+            const auto C_167_24 = Q_3_167 * Q_4_167;
+            const auto C_165_26 = C_165_10 * Q_4_165;
+            const auto C_163_28 = C_163_12 * Q_4_163;
+            const auto C_161_30 = C_161_14 * Q_4_161;
+            const auto Q_5_159 = Q_5_31 * q_5_7;
+            const auto C_157_34 = Q_1_157 * Q_5_157;
+            const auto C_155_36 = Q_2_155 * Q_5_155;
+            const auto C_153_38 = C_153_6 * Q_5_153;
+            const auto C_151_40 = Q_3_151 * Q_5_151;
+            const auto C_149_42 = C_149_10 * Q_5_149;
+            const auto C_147_44 = C_147_12 * Q_5_147;
+            const auto C_145_46 = C_145_14 * Q_5_145;
+            const auto C_143_48 = Q_4_143 * Q_5_143;
+            const auto C_141_50 = C_141_18 * Q_5_141;
+            const auto C_139_52 = C_139_20 * Q_5_139;
+            const auto C_137_54 = C_137_22 * Q_5_137;
+            const auto C_135_56 = C_135_24 * Q_5_135;
+            const auto C_133_58 = C_133_26 * Q_5_133;
+            const auto C_131_60 = C_131_28 * Q_5_131;
+            const auto C_129_62 = C_129_30 * Q_5_129;
+            const auto C_57_6 = Q_1_57 * Q_2_57;
+            const auto C_53_10 = Q_1_53 * Q_3_53;
+            const auto C_51_12 = Q_2_51 * Q_3_51;
+            const auto C_49_14 = C_49_6 * Q_3_49;
+            const auto C_45_18 = Q_1_45 * Q_4_45;
+            const auto C_43_20 = Q_2_43 * Q_4_43;
+            const auto C_41_22 = C_41_6 * Q_4_41;
+            const auto C_39_24 = Q_3_39 * Q_4_39;
+            const auto C_37_26 = C_37_10 * Q_4_37;
+            const auto C_35_28 = C_35_12 * Q_4_35;
+            const auto C_33_30 = C_33_14 * Q_4_33;
+            const auto C_29_34 = Q_1_29 * Q_5_29;
+            const auto C_27_36 = Q_2_27 * Q_5_27;
+            const auto C_25_38 = C_25_6 * Q_5_25;
+            const auto C_23_40 = Q_3_23 * Q_5_23;
+            const auto C_21_42 = C_21_10 * Q_5_21;
+            const auto C_19_44 = C_19_12 * Q_5_19;
+            const auto C_17_46 = C_17_14 * Q_5_17;
+            const auto C_15_48 = Q_4_15 * Q_5_15;
+            const auto C_13_50 = C_13_18 * Q_5_13;
+            const auto C_11_52 = C_11_20 * Q_5_11;
+            const auto C_9_54 = C_9_22 * Q_5_9;
+            const auto C_7_56 = C_7_24 * Q_5_7;
+            const auto C_5_58 = C_5_26 * Q_5_5;
+            const auto C_3_60 = C_3_28 * Q_5_3;
+            const auto C_1_62 = C_1_30 * q_0_5;
+            const auto R_63 = 1 - (R_61 * Q_1_61 + R_59 * Q_2_59 + R_57 * C_57_6 + R_55 * Q_3_55
+                    + R_53 * C_53_10 + R_51 * C_51_12 + R_49 * C_49_14 + R_47 * Q_4_47
+                    + R_45 * C_45_18 + R_43 * C_43_20 + R_41 * C_41_22 + R_39 * C_39_24
+                    + R_37 * C_37_26 + R_35 * C_35_28 + R_33 * C_33_30 + R_31 * Q_5_31
+                    + R_29 * C_29_34 + R_27 * C_27_36 + R_25 * C_25_38 + R_23 * C_23_40
+                    + R_21 * C_21_42 + R_19 * C_19_44 + R_17 * C_17_46 + R_15 * C_15_48
+                    + R_13 * C_13_50 + R_11 * C_11_52 + R_9 * C_9_54 + R_7 * C_7_56
+                    + R_5 * C_5_58 + R_3 * C_3_60 + C_1_62);
+            const auto Q_7_63 = Q_7_31 * q_5_7;
+            const auto C_61_130 = Q_1_61 * Q_7_61;
+            const auto C_59_132 = Q_2_59 * Q_7_59;
+            const auto C_57_134 = C_57_6 * Q_7_57;
+            const auto C_55_136 = Q_3_55 * Q_7_55;
+            const auto C_53_138 = C_53_10 * Q_7_53;
+            const auto C_51_140 = C_51_12 * Q_7_51;
+            const auto C_49_142 = C_49_14 * Q_7_49;
+            const auto C_47_144 = Q_4_47 * Q_7_47;
+            const auto C_45_146 = C_45_18 * Q_7_45;
+            const auto C_43_148 = C_43_20 * Q_7_43;
+            const auto C_41_150 = C_41_22 * Q_7_41;
+            const auto C_39_152 = C_39_24 * Q_7_39;
+            const auto C_37_154 = C_37_26 * Q_7_37;
+            const auto C_35_156 = C_35_28 * Q_7_35;
+            const auto C_33_158 = C_33_30 * Q_7_33;
+            const auto C_31_160 = Q_5_31 * Q_7_31;
+            const auto C_29_162 = C_29_34 * Q_7_29;
+            const auto C_27_164 = C_27_36 * Q_7_27;
+            const auto C_25_166 = C_25_38 * Q_7_25;
+            const auto C_23_168 = C_23_40 * Q_7_23;
+            const auto C_21_170 = C_21_42 * Q_7_21;
+            const auto C_19_172 = C_19_44 * Q_7_19;
+            const auto C_17_174 = C_17_46 * Q_7_17;
+            const auto C_15_176 = C_15_48 * Q_7_15;
+            const auto C_13_178 = C_13_50 * Q_7_13;
+            const auto C_11_180 = C_11_52 * Q_7_11;
+            const auto C_9_182 = C_9_54 * Q_7_9;
+            const auto C_7_184 = C_7_56 * Q_7_7;
+            const auto C_5_186 = C_5_58 * Q_7_5;
+            const auto C_3_188 = C_3_60 * Q_7_3;
+            const auto C_1_190 = C_1_62 * q_0_7;
+            const auto R_191 = 1 - (R_189 * Q_1_189 + R_187 * Q_2_187 + R_185 * C_185_6 + R_183 * Q_3_183
+                    + R_181 * C_181_10 + R_179 * C_179_12 + R_177 * C_177_14 + R_175 * Q_4_175
+                    + R_173 * C_173_18 + R_171 * C_171_20 + R_169 * C_169_22 + R_167 * C_167_24
+                    + R_165 * C_165_26 + R_163 * C_163_28 + R_161 * C_161_30 + R_159 * Q_5_159
+                    + R_157 * C_157_34 + R_155 * C_155_36 + R_153 * C_153_38 + R_151 * C_151_40
+                    + R_149 * C_149_42 + R_147 * C_147_44 + R_145 * C_145_46 + R_143 * C_143_48
+                    + R_141 * C_141_50 + R_139 * C_139_52 + R_137 * C_137_54 + R_135 * C_135_56
+                    + R_133 * C_133_58 + R_131 * C_131_60 + R_129 * C_129_62 + R_63 * Q_7_63
+                    + R_61 * C_61_130 + R_59 * C_59_132 + R_57 * C_57_134 + R_55 * C_55_136
+                    + R_53 * C_53_138 + R_51 * C_51_140 + R_49 * C_49_142 + R_47 * C_47_144
+                    + R_45 * C_45_146 + R_43 * C_43_148 + R_41 * C_41_150 + R_39 * C_39_152
+                    + R_37 * C_37_154 + R_35 * C_35_156 + R_33 * C_33_158 + R_31 * C_31_160
+                    + R_29 * C_29_162 + R_27 * C_27_164 + R_25 * C_25_166 + R_23 * C_23_168
+                    + R_21 * C_21_170 + R_19 * C_19_172 + R_17 * C_17_174 + R_15 * C_15_176
+                    + R_13 * C_13_178 + R_11 * C_11_180 + R_9 * C_9_182 + R_7 * C_7_184
+                    + R_5 * C_5_186 + R_3 * C_3_188 + C_1_190);
+            const auto Q_6_63 = Q_6_31 * q_5_6;
+            const auto Q_6_191 = Q_6_63 * q_6_7;
+            const auto C_189_66 = Q_1_189 * Q_6_189;
+            const auto C_187_68 = Q_2_187 * Q_6_187;
+            const auto C_185_70 = C_185_6 * Q_6_185;
+            const auto C_183_72 = Q_3_183 * Q_6_183;
+            const auto C_181_74 = C_181_10 * Q_6_181;
+            const auto C_179_76 = C_179_12 * Q_6_179;
+            const auto C_177_78 = C_177_14 * Q_6_177;
+            const auto C_175_80 = Q_4_175 * Q_6_175;
+            const auto C_173_82 = C_173_18 * Q_6_173;
+            const auto C_171_84 = C_171_20 * Q_6_171;
+            const auto C_169_86 = C_169_22 * Q_6_169;
+            const auto C_167_88 = C_167_24 * Q_6_167;
+            const auto C_165_90 = C_165_26 * Q_6_165;
+            const auto C_163_92 = C_163_28 * Q_6_163;
+            const auto C_161_94 = C_161_30 * Q_6_161;
+            const auto C_159_96 = Q_5_159 * Q_6_159;
+            const auto C_157_98 = C_157_34 * Q_6_157;
+            const auto C_155_100 = C_155_36 * Q_6_155;
+            const auto C_153_102 = C_153_38 * Q_6_153;
+            const auto C_151_104 = C_151_40 * Q_6_151;
+            const auto C_149_106 = C_149_42 * Q_6_149;
+            const auto C_147_108 = C_147_44 * Q_6_147;
+            const auto C_145_110 = C_145_46 * Q_6_145;
+            const auto C_143_112 = C_143_48 * Q_6_143;
+            const auto C_141_114 = C_141_50 * Q_6_141;
+            const auto C_139_116 = C_139_52 * Q_6_139;
+            const auto C_137_118 = C_137_54 * Q_6_137;
+            const auto C_135_120 = C_135_56 * Q_6_135;
+            const auto C_133_122 = C_133_58 * Q_6_133;
+            const auto C_131_124 = C_131_60 * Q_6_131;
+            const auto C_129_126 = C_129_62 * Q_6_129;
+            const auto C_121_6 = Q_1_121 * Q_2_121;
+            const auto C_117_10 = Q_1_117 * Q_3_117;
+            const auto C_115_12 = Q_2_115 * Q_3_115;
+            const auto C_113_14 = C_113_6 * Q_3_113;
+            const auto C_109_18 = Q_1_109 * Q_4_109;
+            const auto C_107_20 = Q_2_107 * Q_4_107;
+            const auto C_105_22 = C_105_6 * Q_4_105;
+            const auto C_103_24 = Q_3_103 * Q_4_103;
+            const auto C_101_26 = C_101_10 * Q_4_101;
+            const auto C_99_28 = C_99_12 * Q_4_99;
+            const auto C_97_30 = C_97_14 * Q_4_97;
+            const auto C_93_34 = Q_1_93 * Q_5_93;
+            const auto C_91_36 = Q_2_91 * Q_5_91;
+            const auto C_89_38 = C_89_6 * Q_5_89;
+            const auto C_87_40 = Q_3_87 * Q_5_87;
+            const auto C_85_42 = C_85_10 * Q_5_85;
+            const auto C_83_44 = C_83_12 * Q_5_83;
+            const auto C_81_46 = C_81_14 * Q_5_81;
+            const auto C_79_48 = Q_4_79 * Q_5_79;
+            const auto C_77_50 = C_77_18 * Q_5_77;
+            const auto C_75_52 = C_75_20 * Q_5_75;
+            const auto C_73_54 = C_73_22 * Q_5_73;
+            const auto C_71_56 = C_71_24 * Q_5_71;
+            const auto C_69_58 = C_69_26 * Q_5_69;
+            const auto C_67_60 = C_67_28 * Q_5_67;
+            const auto C_65_62 = C_65_30 * Q_5_65;
+            const auto C_61_66 = Q_1_61 * Q_6_61;
+            const auto C_59_68 = Q_2_59 * Q_6_59;
+            const auto C_57_70 = C_57_6 * Q_6_57;
+            const auto C_55_72 = Q_3_55 * Q_6_55;
+            const auto C_53_74 = C_53_10 * Q_6_53;
+            const auto C_51_76 = C_51_12 * Q_6_51;
+            const auto C_49_78 = C_49_14 * Q_6_49;
+            const auto C_47_80 = Q_4_47 * Q_6_47;
+            const auto C_45_82 = C_45_18 * Q_6_45;
+            const auto C_43_84 = C_43_20 * Q_6_43;
+            const auto C_41_86 = C_41_22 * Q_6_41;
+            const auto C_39_88 = C_39_24 * Q_6_39;
+            const auto C_37_90 = C_37_26 * Q_6_37;
+            const auto C_35_92 = C_35_28 * Q_6_35;
+            const auto C_33_94 = C_33_30 * Q_6_33;
+            const auto C_31_96 = Q_5_31 * Q_6_31;
+            const auto C_29_98 = C_29_34 * Q_6_29;
+            const auto C_27_100 = C_27_36 * Q_6_27;
+            const auto C_25_102 = C_25_38 * Q_6_25;
+            const auto C_23_104 = C_23_40 * Q_6_23;
+            const auto C_21_106 = C_21_42 * Q_6_21;
+            const auto C_19_108 = C_19_44 * Q_6_19;
+            const auto C_17_110 = C_17_46 * Q_6_17;
+            const auto C_15_112 = C_15_48 * Q_6_15;
+            const auto C_13_114 = C_13_50 * Q_6_13;
+            const auto C_11_116 = C_11_52 * Q_6_11;
+            const auto C_9_118 = C_9_54 * Q_6_9;
+            const auto C_7_120 = C_7_56 * Q_6_7;
+            const auto C_5_122 = C_5_58 * Q_6_5;
+            const auto C_3_124 = C_3_60 * Q_6_3;
+            const auto C_1_126 = C_1_62 * q_0_6;
+            const auto R_127 = 1 - (R_125 * Q_1_125 + R_123 * Q_2_123 + R_121 * C_121_6 + R_119 * Q_3_119
+                    + R_117 * C_117_10 + R_115 * C_115_12 + R_113 * C_113_14 + R_111 * Q_4_111
+                    + R_109 * C_109_18 + R_107 * C_107_20 + R_105 * C_105_22 + R_103 * C_103_24
+                    + R_101 * C_101_26 + R_99 * C_99_28 + R_97 * C_97_30 + R_95 * Q_5_95
+                    + R_93 * C_93_34 + R_91 * C_91_36 + R_89 * C_89_38 + R_87 * C_87_40
+                    + R_85 * C_85_42 + R_83 * C_83_44 + R_81 * C_81_46 + R_79 * C_79_48
+                    + R_77 * C_77_50 + R_75 * C_75_52 + R_73 * C_73_54 + R_71 * C_71_56
+                    + R_69 * C_69_58 + R_67 * C_67_60 + R_65 * C_65_62 + R_63 * Q_6_63
+                    + R_61 * C_61_66 + R_59 * C_59_68 + R_57 * C_57_70 + R_55 * C_55_72
+                    + R_53 * C_53_74 + R_51 * C_51_76 + R_49 * C_49_78 + R_47 * C_47_80
+                    + R_45 * C_45_82 + R_43 * C_43_84 + R_41 * C_41_86 + R_39 * C_39_88
+                    + R_37 * C_37_90 + R_35 * C_35_92 + R_33 * C_33_94 + R_31 * C_31_96
+                    + R_29 * C_29_98 + R_27 * C_27_100 + R_25 * C_25_102 + R_23 * C_23_104
+                    + R_21 * C_21_106 + R_19 * C_19_108 + R_17 * C_17_110 + R_15 * C_15_112
+                    + R_13 * C_13_114 + R_11 * C_11_116 + R_9 * C_9_118 + R_7 * C_7_120
+                    + R_5 * C_5_122 + R_3 * C_3_124 + C_1_126);
+            const auto Q_7_127 = Q_7_63 * q_6_7;
+            const auto C_125_130 = Q_1_125 * Q_7_125;
+            const auto C_123_132 = Q_2_123 * Q_7_123;
+            const auto C_121_134 = C_121_6 * Q_7_121;
+            const auto C_119_136 = Q_3_119 * Q_7_119;
+            const auto C_117_138 = C_117_10 * Q_7_117;
+            const auto C_115_140 = C_115_12 * Q_7_115;
+            const auto C_113_142 = C_113_14 * Q_7_113;
+            const auto C_111_144 = Q_4_111 * Q_7_111;
+            const auto C_109_146 = C_109_18 * Q_7_109;
+            const auto C_107_148 = C_107_20 * Q_7_107;
+            const auto C_105_150 = C_105_22 * Q_7_105;
+            const auto C_103_152 = C_103_24 * Q_7_103;
+            const auto C_101_154 = C_101_26 * Q_7_101;
+            const auto C_99_156 = C_99_28 * Q_7_99;
+            const auto C_97_158 = C_97_30 * Q_7_97;
+            const auto C_95_160 = Q_5_95 * Q_7_95;
+            const auto C_93_162 = C_93_34 * Q_7_93;
+            const auto C_91_164 = C_91_36 * Q_7_91;
+            const auto C_89_166 = C_89_38 * Q_7_89;
+            const auto C_87_168 = C_87_40 * Q_7_87;
+            const auto C_85_170 = C_85_42 * Q_7_85;
+            const auto C_83_172 = C_83_44 * Q_7_83;
+            const auto C_81_174 = C_81_46 * Q_7_81;
+            const auto C_79_176 = C_79_48 * Q_7_79;
+            const auto C_77_178 = C_77_50 * Q_7_77;
+            const auto C_75_180 = C_75_52 * Q_7_75;
+            const auto C_73_182 = C_73_54 * Q_7_73;
+            const auto C_71_184 = C_71_56 * Q_7_71;
+            const auto C_69_186 = C_69_58 * Q_7_69;
+            const auto C_67_188 = C_67_60 * Q_7_67;
+            const auto C_65_190 = C_65_62 * Q_7_65;
+            const auto C_63_192 = Q_6_63 * Q_7_63;
+            const auto C_61_194 = C_61_66 * Q_7_61;
+            const auto C_59_196 = C_59_68 * Q_7_59;
+            const auto C_57_198 = C_57_70 * Q_7_57;
+            const auto C_55_200 = C_55_72 * Q_7_55;
+            const auto C_53_202 = C_53_74 * Q_7_53;
+            const auto C_51_204 = C_51_76 * Q_7_51;
+            const auto C_49_206 = C_49_78 * Q_7_49;
+            const auto C_47_208 = C_47_80 * Q_7_47;
+            const auto C_45_210 = C_45_82 * Q_7_45;
+            const auto C_43_212 = C_43_84 * Q_7_43;
+            const auto C_41_214 = C_41_86 * Q_7_41;
+            const auto C_39_216 = C_39_88 * Q_7_39;
+            const auto C_37_218 = C_37_90 * Q_7_37;
+            const auto C_35_220 = C_35_92 * Q_7_35;
+            const auto C_33_222 = C_33_94 * Q_7_33;
+            const auto C_31_224 = C_31_96 * Q_7_31;
+            const auto C_29_226 = C_29_98 * Q_7_29;
+            const auto C_27_228 = C_27_100 * Q_7_27;
+            const auto C_25_230 = C_25_102 * Q_7_25;
+            const auto C_23_232 = C_23_104 * Q_7_23;
+            const auto C_21_234 = C_21_106 * Q_7_21;
+            const auto C_19_236 = C_19_108 * Q_7_19;
+            const auto C_17_238 = C_17_110 * Q_7_17;
+            const auto C_15_240 = C_15_112 * Q_7_15;
+            const auto C_13_242 = C_13_114 * Q_7_13;
+            const auto C_11_244 = C_11_116 * Q_7_11;
+            const auto C_9_246 = C_9_118 * Q_7_9;
+            const auto C_7_248 = C_7_120 * Q_7_7;
+            const auto C_5_250 = C_5_122 * Q_7_5;
+            const auto C_3_252 = C_3_124 * Q_7_3;
+            const auto C_1_254 = C_1_126 * q_0_7;
+            const auto R_255 = 1 - (R_253 * Q_1_253 + R_251 * Q_2_251 + R_249 * C_249_6 + R_247 * Q_3_247
+                    + R_245 * C_245_10 + R_243 * C_243_12 + R_241 * C_241_14 + R_239 * Q_4_239
+                    + R_237 * C_237_18 + R_235 * C_235_20 + R_233 * C_233_22 + R_231 * C_231_24
+                    + R_229 * C_229_26 + R_227 * C_227_28 + R_225 * C_225_30 + R_223 * Q_5_223
+                    + R_221 * C_221_34 + R_219 * C_219_36 + R_217 * C_217_38 + R_215 * C_215_40
+                    + R_213 * C_213_42 + R_211 * C_211_44 + R_209 * C_209_46 + R_207 * C_207_48
+                    + R_205 * C_205_50 + R_203 * C_203_52 + R_201 * C_201_54 + R_199 * C_199_56
+                    + R_197 * C_197_58 + R_195 * C_195_60 + R_193 * C_193_62 + R_191 * Q_6_191
+                    + R_189 * C_189_66 + R_187 * C_187_68 + R_185 * C_185_70 + R_183 * C_183_72
+                    + R_181 * C_181_74 + R_179 * C_179_76 + R_177 * C_177_78 + R_175 * C_175_80
+                    + R_173 * C_173_82 + R_171 * C_171_84 + R_169 * C_169_86 + R_167 * C_167_88
+                    + R_165 * C_165_90 + R_163 * C_163_92 + R_161 * C_161_94 + R_159 * C_159_96
+                    + R_157 * C_157_98 + R_155 * C_155_100 + R_153 * C_153_102 + R_151 * C_151_104
+                    + R_149 * C_149_106 + R_147 * C_147_108 + R_145 * C_145_110 + R_143 * C_143_112
+                    + R_141 * C_141_114 + R_139 * C_139_116 + R_137 * C_137_118 + R_135 * C_135_120
+                    + R_133 * C_133_122 + R_131 * C_131_124 + R_129 * C_129_126 + R_127 * Q_7_127
+                    + R_125 * C_125_130 + R_123 * C_123_132 + R_121 * C_121_134 + R_119 * C_119_136
+                    + R_117 * C_117_138 + R_115 * C_115_140 + R_113 * C_113_142 + R_111 * C_111_144
+                    + R_109 * C_109_146 + R_107 * C_107_148 + R_105 * C_105_150 + R_103 * C_103_152
+                    + R_101 * C_101_154 + R_99 * C_99_156 + R_97 * C_97_158 + R_95 * C_95_160
+                    + R_93 * C_93_162 + R_91 * C_91_164 + R_89 * C_89_166 + R_87 * C_87_168
+                    + R_85 * C_85_170 + R_83 * C_83_172 + R_81 * C_81_174 + R_79 * C_79_176
+                    + R_77 * C_77_178 + R_75 * C_75_180 + R_73 * C_73_182 + R_71 * C_71_184
+                    + R_69 * C_69_186 + R_67 * C_67_188 + R_65 * C_65_190 + R_63 * C_63_192
+                    + R_61 * C_61_194 + R_59 * C_59_196 + R_57 * C_57_198 + R_55 * C_55_200
+                    + R_53 * C_53_202 + R_51 * C_51_204 + R_49 * C_49_206 + R_47 * C_47_208
+                    + R_45 * C_45_210 + R_43 * C_43_212 + R_41 * C_41_214 + R_39 * C_39_216
+                    + R_37 * C_37_218 + R_35 * C_35_220 + R_33 * C_33_222 + R_31 * C_31_224
+                    + R_29 * C_29_226 + R_27 * C_27_228 + R_25 * C_25_230 + R_23 * C_23_232
+                    + R_21 * C_21_234 + R_19 * C_19_236 + R_17 * C_17_238 + R_15 * C_15_240
+                    + R_13 * C_13_242 + R_11 * C_11_244 + R_9 * C_9_246 + R_7 * C_7_248
+                    + R_5 * C_5_250 + R_3 * C_3_252 + C_1_254);
+            return R_255;
+        }
+    };
+
+}
+
+#endif //GRPH_CLOSEDFORMS_HPP
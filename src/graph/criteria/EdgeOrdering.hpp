@@ -0,0 +1,182 @@
+#ifndef GRPH_EDGEORDERING_HPP
+#define GRPH_EDGEORDERING_HPP
+
+#include <algorithm>
+#include <queue>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+
+namespace grph::graph::random {
+
+    /// how the edges are ordered for the engines that process them one by one; the edges come in the order
+    /// of their later ends in a vertex ordering, so a narrow ordering keeps the frontier small
+    enum class EdgeOrdering {
+        BFS, // breadth-first search from the vertex 0
+        DEGREE, // Cuthill-McKee: breadth-first search from a vertex with the lowest degree, neighbors by degree
+        PATH_DECOMPOSITION // greedy vertex separation: the next vertex leaves the fewest frontier vertexes
+    };
+
+    class EdgeOrderer {
+    public:
+        static std::vector<Edge> orderEdges(const AdjacencyMatrix<EdgeProbability> &matrix, EdgeOrdering edgeOrdering) {
+            const auto neighbors = findNeighbors(matrix);
+            const auto vertexOrder = orderVertexes(neighbors, edgeOrdering);
+            std::vector<int> positions(matrix.getDimension());
+            for (int position = 0; position < static_cast<int>(vertexOrder.size()); ++position) {
+                positions[vertexOrder[position]] = position;
+            }
+
+            std::vector<Edge> edges;
+            for (int vertex: vertexOrder) {
+                std::vector<int> earlierPositions;
+                for (int neighbor: neighbors[vertex]) {
+                    if (positions[neighbor] < positions[vertex]) {
+                        earlierPositions.push_back(positions[neighbor]);
+                    }
+                }
+                std::sort(earlierPositions.begin(), earlierPositions.end());
+                for (int earlierPosition: earlierPositions) {
+                    edges.emplace_back(vertexOrder[earlierPosition], vertex);
+                }
+            }
+            return edges;
+        }
+
+        static std::vector<int> orderVertexes(const AdjacencyMatrix<EdgeProbability> &matrix, EdgeOrdering edgeOrdering) {
+            return orderVertexes(findNeighbors(matrix), edgeOrdering);
+        }
+
+    private:
+        static std::vector<std::vector<int>> findNeighbors(const AdjacencyMatrix<EdgeProbability> &matrix) {
+            std::vector<std::vector<int>> neighbors(matrix.getDimension());
+            for (int vertex1 = 0; vertex1 < matrix.getDimension(); ++vertex1) {
+                for (int vertex2 = vertex1 + 1; vertex2 < matrix.getDimension(); ++vertex2) {
+                    if (matrix.isConnected(vertex1, vertex2)) {
+                        neighbors[vertex1].push_back(vertex2);
+                        neighbors[vertex2].push_back(vertex1);
+                    }
+                }
+            }
+            return neighbors;
+        }
+
+        static std::vector<int> orderVertexes(const std::vector<std::vector<int>> &neighbors, EdgeOrdering edgeOrdering) {
+            switch (edgeOrdering) {
+                case EdgeOrdering::BFS:
+                    return orderBreadthFirst(neighbors, false);
+                case EdgeOrdering::DEGREE:
+                    return orderBreadthFirst(neighbors, true);
+                default:
+                    return orderByVertexSeparation(neighbors);
+            }
+        }
+
+        static std::vector<int> orderBreadthFirst(const std::vector<std::vector<int>> &neighbors, bool byDegree) {
+            const int dimension = static_cast<int>(neighbors.size());
+            std::vector<int> vertexOrder;
+            std::vector<bool> visited(dimension, false);
+            while (static_cast<int>(vertexOrder.size()) < dimension) {
+                int root = 0;
+                while (visited[root]) {
+                    ++root;
+                }
+                for (int vertex = root; byDegree && vertex < dimension; ++vertex) {
+                    if (!visited[vertex] && neighbors[vertex].size() < neighbors[root].size()) {
+                        root = vertex;
+                    }
+                }
+
+                std::queue<int> queue;
+                queue.push(root);
+                visited[root] = true;
+                while (!queue.empty()) {
+                    const int vertex = queue.front();
+                    queue.pop();
+                    vertexOrder.push_back(vertex);
+                    std::vector<int> unvisitedNeighbors;
+                    for (int neighbor: neighbors[vertex]) {
+                        if (!visited[neighbor]) {
+                            unvisitedNeighbors.push_back(neighbor);
+                        }
+                    }
+                    if (byDegree) {
+                        std::stable_sort(unvisitedNeighbors.begin(), unvisitedNeighbors.end(),
+                                         [&neighbors](int vertex1, int vertex2) {
+                                             return neighbors[vertex1].size() < neighbors[vertex2].size();
+                                         });
+                    }
+                    for (int neighbor: unvisitedNeighbors) {
+                        visited[neighbor] = true;
+                        queue.push(neighbor);
+                    }
+                }
+            }
+            return vertexOrder;
+        }
+
+        /// a vertex is on the frontier while it has neighbors out of the order; the candidates are the unordered
+        /// neighbors of the ordered vertexes, ties go to the one with more ordered neighbors, so the order sweeps
+        /// along strips, then with fewer unordered ones
+        static std::vector<int> orderByVertexSeparation(const std::vector<std::vector<int>> &neighbors) {
+            const int dimension = static_cast<int>(neighbors.size());
+            std::vector<int> unorderedNeighbors(dimension);
+            for (int vertex = 0; vertex < dimension; ++vertex) {
+                unorderedNeighbors[vertex] = static_cast<int>(neighbors[vertex].size());
+            }
+            std::vector<int> vertexOrder;
+            std::vector<bool> ordered(dimension, false);
+            std::vector<int> candidates;
+            std::vector<bool> isCandidate(dimension, false);
+            while (static_cast<int>(vertexOrder.size()) < dimension) {
+                int bestVertex = VERTEX_NOT_FOUND;
+                if (candidates.empty()) { // the first vertex of a component
+                    for (int vertex = 0; vertex < dimension; ++vertex) {
+                        if (!ordered[vertex] && (bestVertex == VERTEX_NOT_FOUND
+                                                 || unorderedNeighbors[vertex] < unorderedNeighbors[bestVertex])) {
+                            bestVertex = vertex;
+                        }
+                    }
+                }
+
+                int bestFrontierGrowth = 0;
+                int bestOrderedNeighbors = 0;
+                for (int vertex: candidates) {
+                    // the ordered neighbors whose last unordered neighbor is the vertex leave the frontier
+                    int frontierGrowth = unorderedNeighbors[vertex] > 0 ? 1 : 0;
+                    int orderedNeighbors = 0;
+                    for (int neighbor: neighbors[vertex]) {
+                        if (ordered[neighbor]) {
+                            ++orderedNeighbors;
+                            frontierGrowth -= unorderedNeighbors[neighbor] == 1;
+                        }
+                    }
+                    if (bestVertex == VERTEX_NOT_FOUND || frontierGrowth < bestFrontierGrowth
+                        || (frontierGrowth == bestFrontierGrowth && orderedNeighbors > bestOrderedNeighbors)
+                        || (frontierGrowth == bestFrontierGrowth && orderedNeighbors == bestOrderedNeighbors
+                            && unorderedNeighbors[vertex] < unorderedNeighbors[bestVertex])) {
+                        bestVertex = vertex;
+                        bestFrontierGrowth = frontierGrowth;
+                        bestOrderedNeighbors = orderedNeighbors;
+                    }
+                }
+
+                ordered[bestVertex] = true;
+                vertexOrder.push_back(bestVertex);
+                std::erase(candidates, bestVertex);
+                for (int neighbor: neighbors[bestVertex]) {
+                    --unorderedNeighbors[neighbor];
+                    if (!ordered[neighbor] && !isCandidate[neighbor]) {
+                        isCandidate[neighbor] = true;
+                        candidates.push_back(neighbor);
+                    }
+                }
+            }
+            return vertexOrder;
+        }
+    };
+
+}
+
+#endif //GRPH_EDGEORDERING_HPP
@@ -0,0 +1,78 @@
+#ifndef GRPH_EXECUTIONPOLICY_HPP
+#define GRPH_EXECUTIONPOLICY_HPP
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <thread>
+
+#include "TranspositionTable.hpp"
+#include "PivotStrategy.hpp"
+#include "EdgeOrdering.hpp"
+#include "TreeDecomposition.hpp"
+
+namespace grph::graph::random {
+
+    /// size of the factoring tree, shared by all threads
+    struct FactoringStatistics {
+        std::atomic<long long> factoringSteps{0}; // pivot edges factored on
+        std::atomic<long long> reductions{0}; // series-parallel passes that changed the graph
+        std::atomic<long long> blockSplits{0};
+        std::atomic<long long> separations{0}; // graphs split on a pair of vertexes
+        std::atomic<long long> leaves{0}; // graphs calculated by the closed forms
+        std::atomic<long long> prunedBranches{0}; // left to the bounds by ATR::calculateApproximateATR
+        std::atomic<long long> maxDepth{0}; // frames of the serial factoring stack
+        std::atomic<long long> peakStackBytes{0}; // of the stack of a serial factoring, see ATR::IterativeFactoring
+    };
+
+    /// how ATR of the graph left after the reductions is calculated
+    enum class ReliabilityEngine {
+        FACTORING, // factoring on the pivot edges
+        BDD, // binary decision diagram over the edges in the edgeOrdering, see BinaryDecisionDiagram
+        FRONTIER, // probability mass of the frontier partitions over the edges in the edgeOrdering,
+                  // see FrontierDynamicProgramming
+        TREE_DECOMPOSITION // partitions of the bags of the eliminationHeuristic decomposition,
+                           // see TreeDecompositionDynamicProgramming
+    };
+
+    struct ExecutionPolicy {
+        /// 0 - all hardware threads, 1 - serial factoring
+        int threads = 1;
+
+        /// factoring tree levels split into tasks; 0 - chosen from the number of threads
+        int splitDepth = 0;
+
+        /// memo of sub-graph reliabilities shared by all threads, nullptr - no memoization
+        std::shared_ptr<TranspositionTable> transpositionTable = nullptr;
+
+        PivotStrategy pivotStrategy = PivotStrategy::LOWEST_DEGREE;
+
+        ReliabilityEngine engine = ReliabilityEngine::FACTORING;
+
+        EdgeOrdering edgeOrdering = EdgeOrdering::PATH_DECOMPOSITION;
+
+        EliminationHeuristic eliminationHeuristic = EliminationHeuristic::MIN_FILL;
+
+        /// nullptr - not counted
+        std::shared_ptr<FactoringStatistics> statistics = nullptr;
+
+        int numThreads() const {
+            if (threads > 0) {
+                return threads;
+            }
+            const auto hardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+            return hardwareThreads > 0 ? hardwareThreads : 1;
+        }
+
+        /// ~64 tasks per thread is enough for the stealing to even out unbalanced subtrees
+        int numSplitLevels() const {
+            if (splitDepth > 0) {
+                return splitDepth;
+            }
+            return static_cast<int>(std::ceil(std::log2(numThreads()))) + 6;
+        }
+    };
+
+}
+
+#endif //GRPH_EXECUTIONPOLICY_HPP
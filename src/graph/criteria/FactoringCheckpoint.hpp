@@ -0,0 +1,336 @@
+#ifndef GRPH_FACTORINGCHECKPOINT_HPP
+#define GRPH_FACTORINGCHECKPOINT_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#define CHECKPOINT_FSYNC 1
+#endif
+
+#define CHECKPOINT_MAGIC 0x4b435052 // "RPCK"
+#define CHECKPOINT_VERSION 2 // 1 - the edges of the tasks with the padding of TaskEdge
+
+namespace grph::graph::random {
+
+    struct CheckpointPolicy {
+        /// the checkpoint is written to path + ".tmp", then renamed over the path
+        std::string path;
+
+        /// checked between the tasks
+        double intervalSeconds = 600.;
+
+        /// the calculation writes a checkpoint and stops after it, INFINITY - runs to the end
+        double timeBudgetSeconds = INFINITY;
+
+        /// factoring levels split into the checkpointed tasks, a deeper subtree is one task
+        int splitDepth = 16;
+    };
+
+    /// Factoring split into tasks as a file: a join waits for the results of its tasks and keeps those of
+    /// the finished ones, a task is the graph of a subproblem as a list of its edges. The tasks are a stack,
+    /// the last one is taken first, so there are few of them at a time. See ATR::CheckpointedFactoring.
+    struct FactoringCheckpoint {
+        enum class JoinKind : uint8_t {
+            ROOT, BLOCKS, EDGE_FACTORING
+        };
+
+        struct Join {
+            JoinKind kind = JoinKind::ROOT;
+            double edgeProbability = 0.;
+            std::vector<double> chainFactors{}; // of the reductions made before the step
+            std::vector<double> results{};
+            int numPending = 0; // 0 - the join is finished, its slot is free
+            int parent = -1;
+            int parentSlot = 0;
+
+            /// as ParallelFactoring combines, so the result is the same as the one of the serial factoring
+            double combine() const {
+                double R = 0.;
+                switch (kind) {
+                    case JoinKind::ROOT:
+                        R = results[0];
+                        break;
+                    case JoinKind::BLOCKS:
+                        R = 1.;
+                        for (const auto blockR: results) {
+                            R *= blockR;
+                        }
+                        break;
+                    case JoinKind::EDGE_FACTORING:
+                        R = (1 - edgeProbability) * results[0];
+                        R += edgeProbability * results[1];
+                        break;
+                }
+                for (auto factor = chainFactors.rbegin(); factor != chainFactors.rend(); ++factor) {
+                    R = *factor * R;
+                }
+                return R;
+            }
+        };
+
+        struct TaskEdge {
+            uint16_t vertex1;
+            uint16_t vertex2;
+            double p;
+        };
+
+        struct Task {
+            int numVertexes = 0;
+            std::vector<TaskEdge> edges;
+            int join = 0;
+            int slot = 0;
+            int depth = 0;
+        };
+
+        std::vector<Join> joins; // the root is at 0
+        std::vector<Task> tasks;
+        double R = NAN; // of the root when it is finished
+
+        static Task makeTask(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix, int join, int slot, int depth) {
+            Task task{adjacencyMatrix.getDimension(), {}, join, slot, depth};
+            for (int vertex1 = 0; vertex1 < task.numVertexes; ++vertex1) {
+                for (int vertex2 = vertex1 + 1; vertex2 < task.numVertexes; ++vertex2) {
+                    if (adjacencyMatrix.isConnected(vertex1, vertex2)) {
+                        task.edges.push_back(TaskEdge{static_cast<uint16_t>(vertex1), static_cast<uint16_t>(vertex2),
+                                                      adjacencyMatrix.at(vertex1, vertex2)});
+                    }
+                }
+            }
+            return task;
+        }
+
+        static std::shared_ptr<AdjacencyMatrix<EdgeProbability>> makeMatrix(const Task &task) {
+            auto matrix = std::make_shared<AdjacencyMatrix<EdgeProbability>>(task.numVertexes);
+            for (const auto &edge: task.edges) {
+                matrix->addEdge(edge.vertex1, edge.vertex2, edge.p);
+            }
+            return matrix;
+        }
+
+        /// the file and its directory are synced before and after the rename, so after a crash the path holds
+        /// either the previous checkpoint or this one, complete
+        void write(const std::string &path) const {
+            const std::string temporaryPath = path + ".tmp";
+            {
+                std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+                writeValue(stream, static_cast<uint32_t>(CHECKPOINT_MAGIC));
+                writeValue(stream, static_cast<uint32_t>(CHECKPOINT_VERSION));
+                writeValue(stream, R);
+                writeValue(stream, static_cast<uint32_t>(joins.size()));
+                for (const auto &join: joins) {
+                    writeValue(stream, join.kind);
+                    writeValue(stream, join.edgeProbability);
+                    writeVector(stream, join.chainFactors);
+                    writeVector(stream, join.results);
+                    writeValue(stream, join.numPending);
+                    writeValue(stream, join.parent);
+                    writeValue(stream, join.parentSlot);
+                }
+                writeValue(stream, static_cast<uint32_t>(tasks.size()));
+                for (const auto &task: tasks) {
+                    writeValue(stream, task.numVertexes);
+                    writeValue(stream, static_cast<uint32_t>(task.edges.size()));
+                    for (const auto &edge: task.edges) {
+                        writeValue(stream, edge.vertex1);
+                        writeValue(stream, edge.vertex2);
+                        writeValue(stream, edge.p);
+                    }
+                    writeValue(stream, task.join);
+                    writeValue(stream, task.slot);
+                    writeValue(stream, task.depth);
+                }
+                stream.flush();
+                if (!stream) {
+                    throw std::runtime_error("ERROR(FactoringCheckpoint): can't write " + temporaryPath);
+                }
+            }
+            const auto directory = std::filesystem::path(path).parent_path();
+            const std::string directoryPath = directory.empty() ? "." : directory.string();
+            sync(temporaryPath);
+            sync(directoryPath);
+            std::filesystem::rename(temporaryPath, path);
+            sync(directoryPath);
+        }
+
+        /// any file that write could not have made is not a checkpoint, the sizes are checked before the
+        /// vectors are allocated
+        static FactoringCheckpoint read(const std::string &path) {
+            std::ifstream stream(path, std::ios::binary | std::ios::ate);
+            if (!stream) {
+                throw std::runtime_error("ERROR(FactoringCheckpoint): can't read " + path);
+            }
+            const std::streamoff end = stream.tellg();
+            stream.seekg(0);
+            const std::runtime_error notCheckpoint("ERROR(FactoringCheckpoint): " + path + " is not a checkpoint");
+            if (readValue<uint32_t>(stream) != CHECKPOINT_MAGIC || readValue<uint32_t>(stream) != CHECKPOINT_VERSION) {
+                throw notCheckpoint;
+            }
+            FactoringCheckpoint checkpoint;
+            checkpoint.R = readValue<double>(stream);
+            checkpoint.joins.resize(readSize(stream, end, JOIN_RECORD_SIZE, notCheckpoint));
+            for (auto &join: checkpoint.joins) {
+                join.kind = readValue<JoinKind>(stream);
+                join.edgeProbability = readValue<double>(stream);
+                join.chainFactors = readVector<double>(stream, end, notCheckpoint);
+                join.results = readVector<double>(stream, end, notCheckpoint);
+                join.numPending = readValue<int>(stream);
+                join.parent = readValue<int>(stream);
+                join.parentSlot = readValue<int>(stream);
+            }
+            checkpoint.tasks.resize(readSize(stream, end, TASK_RECORD_SIZE, notCheckpoint));
+            for (auto &task: checkpoint.tasks) {
+                task.numVertexes = readValue<int>(stream);
+                task.edges.resize(readSize(stream, end, TASK_EDGE_RECORD_SIZE, notCheckpoint));
+                for (auto &edge: task.edges) {
+                    edge.vertex1 = readValue<uint16_t>(stream);
+                    edge.vertex2 = readValue<uint16_t>(stream);
+                    edge.p = readValue<double>(stream);
+                }
+                task.join = readValue<int>(stream);
+                task.slot = readValue<int>(stream);
+                task.depth = readValue<int>(stream);
+            }
+            if (!stream || static_cast<std::streamoff>(stream.tellg()) != end || !checkpoint.isConsistent()) {
+                throw notCheckpoint;
+            }
+            return checkpoint;
+        }
+
+    private:
+        // the smallest records of a join and a task in the file, with empty vectors
+        static constexpr std::streamoff JOIN_RECORD_SIZE = sizeof(JoinKind) + sizeof(double) + 2 * sizeof(uint32_t)
+                                                           + 3 * sizeof(int);
+        static constexpr std::streamoff TASK_RECORD_SIZE = sizeof(uint32_t) + 4 * sizeof(int);
+        static constexpr std::streamoff TASK_EDGE_RECORD_SIZE = 2 * sizeof(uint16_t) + sizeof(double);
+
+        /// fsync of a file or a directory, a no-op where there is none
+        static void sync(const std::string &path) {
+#ifdef CHECKPOINT_FSYNC
+            const int descriptor = ::open(path.c_str(), O_RDONLY);
+            const bool isSynced = descriptor >= 0 && ::fsync(descriptor) == 0;
+            if (descriptor >= 0) {
+                ::close(descriptor);
+            }
+            if (!isSynced) {
+                throw std::runtime_error("ERROR(FactoringCheckpoint): can't sync " + path);
+            }
+#endif
+        }
+
+        /// the indexes of the joins and the tasks point to the slots of pending joins, a pending join is
+        /// waited for by its parent up to the root at 0
+        bool isConsistent() const {
+            if (joins.empty()) {
+                return tasks.empty();
+            }
+            const int numJoins = static_cast<int>(joins.size());
+            for (int joinIdx = 0; joinIdx < numJoins; ++joinIdx) {
+                const auto &join = joins[joinIdx];
+                const int numResults = static_cast<int>(join.results.size());
+                if (join.kind > JoinKind::EDGE_FACTORING || (join.kind == JoinKind::ROOT) != (joinIdx == 0)
+                    || join.numPending < 0 || join.numPending > numResults) {
+                    return false;
+                }
+                if (join.numPending == 0) {
+                    continue; // a free slot, cleared by the factoring
+                }
+                if ((join.kind == JoinKind::ROOT && numResults != 1)
+                    || (join.kind == JoinKind::EDGE_FACTORING && numResults != 2)) {
+                    return false;
+                }
+                if (joinIdx > 0 && !isPendingSlot(join.parent, join.parentSlot)) {
+                    return false;
+                }
+            }
+            // the parents of a pending join reach the root, a cycle would never report its result
+            std::vector<bool> reachesRoot(numJoins, false);
+            reachesRoot[0] = joins[0].numPending > 0;
+            for (int joinIdx = 1; joinIdx < numJoins; ++joinIdx) {
+                std::vector<int> path;
+                int ancestor = joinIdx;
+                while (joins[ancestor].numPending > 0 && !reachesRoot[ancestor]
+                       && static_cast<int>(path.size()) < numJoins) {
+                    path.push_back(ancestor);
+                    ancestor = joins[ancestor].parent;
+                }
+                if (joins[ancestor].numPending > 0 && !reachesRoot[ancestor]) {
+                    return false;
+                }
+                for (const int pathJoin: path) {
+                    reachesRoot[pathJoin] = true;
+                }
+            }
+
+            for (const auto &task: tasks) {
+                if (!isPendingSlot(task.join, task.slot) || task.numVertexes < 0
+                    || task.numVertexes > UINT16_MAX + 1 || task.depth < 0) {
+                    return false;
+                }
+                for (const auto &edge: task.edges) {
+                    if (edge.vertex1 >= task.numVertexes || edge.vertex2 >= task.numVertexes
+                        || edge.vertex1 == edge.vertex2) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        bool isPendingSlot(int joinIdx, int slot) const {
+            return joinIdx >= 0 && joinIdx < static_cast<int>(joins.size()) && joins[joinIdx].numPending > 0
+                   && slot >= 0 && slot < static_cast<int>(joins[joinIdx].results.size());
+        }
+
+        template<typename T>
+        static void writeValue(std::ofstream &stream, const T &value) {
+            stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        template<typename T>
+        static void writeVector(std::ofstream &stream, const std::vector<T> &values) {
+            writeValue(stream, static_cast<uint32_t>(values.size()));
+            stream.write(reinterpret_cast<const char *>(values.data()),
+                         static_cast<std::streamsize>(values.size() * sizeof(T)));
+        }
+
+        template<typename T>
+        static T readValue(std::ifstream &stream) {
+            T value{};
+            stream.read(reinterpret_cast<char *>(&value), sizeof(T));
+            return value;
+        }
+
+        /// a number of records, each of at least recordSize bytes, that fit into the rest of the file
+        static uint32_t readSize(std::ifstream &stream, std::streamoff end, std::streamoff recordSize,
+                                 const std::runtime_error &notCheckpoint) {
+            const auto size = readValue<uint32_t>(stream);
+            if (!stream || size > (end - static_cast<std::streamoff>(stream.tellg())) / recordSize) {
+                throw notCheckpoint;
+            }
+            return size;
+        }
+
+        template<typename T>
+        static std::vector<T> readVector(std::ifstream &stream, std::streamoff end,
+                                         const std::runtime_error &notCheckpoint) {
+            std::vector<T> values(readSize(stream, end, sizeof(T), notCheckpoint));
+            stream.read(reinterpret_cast<char *>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+            return values;
+        }
+    };
+
+}
+
+#endif //GRPH_FACTORINGCHECKPOINT_HPP
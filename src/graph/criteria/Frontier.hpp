@@ -0,0 +1,237 @@
+#ifndef GRPH_FRONTIER_HPP
+#define GRPH_FRONTIER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../common/types.hpp"
+
+#define MAX_FRONTIER_WIDTH 255
+
+namespace grph::graph::random {
+
+    /// Vertexes touched by the edges of an order one by one. The frontier of a level (before its edge) is the
+    /// vertexes with an edge before or at the level and an edge at or after it. A state of a level is the
+    /// connectivity partition of its frontier by the up edges before the level: a label of each frontier
+    /// vertex, the labels numbered by the first occurrence, so equal partitions are equal arrays.
+    class Frontier {
+    public:
+        enum class Outcome {
+            OPEN, // the next state is written
+            CONNECTED, // all vertexes are connected whatever the rest of the edges are
+            DISCONNECTED // a component left the frontier and will never be connected to the rest
+        };
+
+        Frontier(int numVertexes, const std::vector<Edge> &edges) : _levels(edges.size() + 1) {
+            const int numLevels = static_cast<int>(edges.size());
+            std::vector<int> firstLevels(numVertexes, numLevels);
+            std::vector<int> lastLevels(numVertexes, -1);
+            for (int level = 0; level < numLevels; ++level) {
+                for (int vertex: {edges[level].minVertex(), edges[level].maxVertex()}) {
+                    firstLevels[vertex] = std::min(firstLevels[vertex], level);
+                    lastLevels[vertex] = level;
+                }
+            }
+
+            std::vector<std::vector<int>> newVertexes(numLevels + 1);
+            for (int vertex = 0; vertex < numVertexes; ++vertex) {
+                newVertexes[firstLevels[vertex]].push_back(vertex);
+            }
+            std::vector<std::vector<int>> frontiers(numLevels + 1);
+            int numTouched = 0;
+            for (int level = 0; level <= numLevels; ++level) {
+                auto &frontier = frontiers[level];
+                if (level > 0) {
+                    for (int vertex: frontiers[level - 1]) {
+                        if (lastLevels[vertex] >= level) {
+                            frontier.push_back(vertex);
+                        }
+                    }
+                }
+                if (level < numLevels) {
+                    frontier.insert(frontier.end(), newVertexes[level].begin(), newVertexes[level].end());
+                    std::sort(frontier.begin(), frontier.end());
+                    numTouched += static_cast<int>(newVertexes[level].size());
+                }
+                if (frontier.size() > MAX_FRONTIER_WIDTH) {
+                    throw std::runtime_error("ERROR(Frontier): frontier of " + std::to_string(frontier.size())
+                                             + " vertexes");
+                }
+                _levels[level]._width = static_cast<int>(frontier.size());
+                _levels[level]._numUntouched = numVertexes - numTouched;
+            }
+
+            for (int level = 0; level < numLevels; ++level) {
+                auto &levelInfo = _levels[level];
+                const auto &frontier = frontiers[level];
+                const auto position = [&frontier](int vertex) {
+                    return static_cast<int>(std::lower_bound(frontier.begin(), frontier.end(), vertex) - frontier.begin());
+                };
+                levelInfo._position1 = position(edges[level].minVertex());
+                levelInfo._position2 = position(edges[level].maxVertex());
+                for (int vertex: frontier) {
+                    if (lastLevels[vertex] == level) {
+                        levelInfo._dropped.push_back(position(vertex));
+                    }
+                }
+                for (int vertex: frontiers[level + 1]) {
+                    levelInfo._sources.push_back(firstLevels[vertex] == level + 1 ? -1 : position(vertex));
+                }
+            }
+        }
+
+        int getNumLevels() const {
+            return static_cast<int>(_levels.size()) - 1;
+        }
+
+        int getWidth(int level) const {
+            return _levels[level]._width;
+        }
+
+        /// no edge is up: every frontier vertex of the level 0 is its own component
+        void writeInitialState(uint8_t *labels) const {
+            for (int position = 0; position < getWidth(0); ++position) {
+                labels[position] = position;
+            }
+        }
+
+        Outcome transition(int level, const uint8_t *labels, bool isUp, uint8_t *nextLabels) const {
+            const auto &levelInfo = _levels[level];
+            std::array<uint8_t, MAX_FRONTIER_WIDTH> merged;
+            std::copy_n(labels, levelInfo._width, merged.begin());
+            if (isUp) {
+                const uint8_t label1 = merged[levelInfo._position1];
+                const uint8_t label2 = merged[levelInfo._position2];
+                if (label1 != label2) {
+                    std::replace(merged.begin(), merged.begin() + levelInfo._width, label2, label1);
+                }
+            }
+
+            // a component of the dropped vertexes without kept ones is closed
+            std::array<bool, MAX_FRONTIER_WIDTH> isKept{};
+            int numKept = 0;
+            for (int source: levelInfo._sources) {
+                if (source >= 0) {
+                    isKept[merged[source]] = true;
+                    ++numKept;
+                }
+            }
+            int closedLabel = -1;
+            for (int position: levelInfo._dropped) {
+                const uint8_t label = merged[position];
+                if (isKept[label] || label == closedLabel) {
+                    continue;
+                }
+                if (closedLabel >= 0 || numKept > 0 || _levels[level]._numUntouched > 0) {
+                    return Outcome::DISCONNECTED;
+                }
+                closedLabel = label;
+            }
+            if (closedLabel >= 0) {
+                return Outcome::CONNECTED;
+            }
+
+            // new vertexes get new components, then the labels are renumbered
+            std::array<int, 2 * MAX_FRONTIER_WIDTH> renumbered;
+            std::fill_n(renumbered.begin(), levelInfo._width + levelInfo._sources.size(), -1);
+            int numLabels = 0;
+            for (int position = 0; position < static_cast<int>(levelInfo._sources.size()); ++position) {
+                const int source = levelInfo._sources[position];
+                const int label = source >= 0 ? merged[source] : levelInfo._width + position;
+                if (renumbered[label] < 0) {
+                    renumbered[label] = numLabels++;
+                }
+                nextLabels[position] = renumbered[label];
+            }
+            return Outcome::OPEN;
+        }
+
+    private:
+        struct Level {
+            int _width = 0;
+            int _numUntouched = 0; // vertexes without edges up to the level
+            int _position1 = 0; // ends of the edge in the frontier
+            int _position2 = 0;
+            std::vector<int> _dropped; // frontier positions of the vertexes without later edges
+            std::vector<int> _sources; // for each vertex of the next frontier its position or -1 for a new one
+        };
+
+        std::vector<Level> _levels;
+    };
+
+    /// states of a level (or a bag): labels in one array, an open-addressing index over them; reset keeps
+    /// the memory, so a level after level needs no allocations
+    class FrontierStates {
+    public:
+        void reset(int width) {
+            _width = width;
+            _labels.clear();
+            std::fill(_index.begin(), _index.end(), -1);
+            _numStates = 0;
+        }
+
+        /// state number and whether it is new
+        std::pair<int, bool> insert(const uint8_t *labels) {
+            if (2 * (_numStates + 1) > static_cast<int>(_index.size())) {
+                rehash(std::max<size_t>(64, 2 * _index.size()));
+            }
+            size_t slot = findSlot(labels, hash(labels));
+            if (_index[slot] >= 0) {
+                return {_index[slot], false};
+            }
+            _index[slot] = _numStates;
+            _labels.insert(_labels.end(), labels, labels + _width);
+            return {_numStates++, true};
+        }
+
+        const uint8_t *at(int state) const {
+            return _labels.data() + static_cast<size_t>(state) * _width;
+        }
+
+        int size() const {
+            return _numStates;
+        }
+
+        int getWidth() const {
+            return _width;
+        }
+
+    private:
+        size_t hash(const uint8_t *labels) const {
+            uint64_t hash = 14695981039346656037ULL; // FNV-1a
+            for (int position = 0; position < _width; ++position) {
+                hash = (hash ^ labels[position]) * 1099511628211ULL;
+            }
+            return static_cast<size_t>(hash ^ (hash >> 29));
+        }
+
+        size_t findSlot(const uint8_t *labels, size_t hash) const {
+            const size_t mask = _index.size() - 1;
+            for (size_t slot = hash & mask; ; slot = (slot + 1) & mask) {
+                if (_index[slot] < 0 || std::equal(labels, labels + _width, at(_index[slot]))) {
+                    return slot;
+                }
+            }
+        }
+
+        void rehash(size_t numSlots) {
+            _index.assign(numSlots, -1);
+            for (int state = 0; state < _numStates; ++state) {
+                _index[findSlot(at(state), hash(at(state)))] = state;
+            }
+        }
+
+        int _width = 0;
+        int _numStates = 0;
+        std::vector<uint8_t> _labels;
+        std::vector<int> _index; // size is a power of 2, -1 - free slot
+    };
+
+}
+
+#endif //GRPH_FRONTIER_HPP
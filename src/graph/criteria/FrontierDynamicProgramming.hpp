@@ -0,0 +1,75 @@
+#ifndef GRPH_FRONTIERDYNAMICPROGRAMMING_HPP
+#define GRPH_FRONTIERDYNAMICPROGRAMMING_HPP
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+#include "EdgeOrdering.hpp"
+#include "Frontier.hpp"
+
+namespace grph::graph::random {
+
+    /// ATR by the frontier method of Hardy, Lucet and Limnios: the edges are processed in the order, the
+    /// probability mass of each connectivity partition of the frontier is kept, equal partitions are merged
+    /// as soon as they appear. Unlike BinaryDecisionDiagram only two levels live at a time, so the memory is
+    /// the widest level; the time is linear in the number of edges and exponential in the frontier width.
+    class FrontierDynamicProgramming {
+    public:
+        static double calculate(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix, EdgeOrdering edgeOrdering) {
+            return calculate(adjacencyMatrix, EdgeOrderer::orderEdges(adjacencyMatrix, edgeOrdering));
+        }
+
+        static double calculate(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix, const std::vector<Edge> &edges) {
+            if (edges.empty()) {
+                return adjacencyMatrix.getDimension() <= 1 ? 1. : 0.;
+            }
+
+            const Frontier frontier(adjacencyMatrix.getDimension(), edges);
+            FrontierStates states;
+            FrontierStates nextStates;
+            std::vector<double> masses{1.};
+            std::vector<double> nextMasses;
+            std::vector<uint8_t> labels(MAX_FRONTIER_WIDTH);
+            states.reset(frontier.getWidth(0));
+            frontier.writeInitialState(labels.data());
+            states.insert(labels.data());
+
+            double R = 0.;
+            for (int level = 0; level < frontier.getNumLevels(); ++level) {
+                const auto &edge = edges[level];
+                const double p = adjacencyMatrix.at(edge.minVertex(), edge.maxVertex());
+                nextStates.reset(frontier.getWidth(level + 1));
+                nextMasses.clear();
+                for (int state = 0; state < states.size(); ++state) {
+                    for (const bool isUp: {false, true}) {
+                        const double mass = masses[state] * (isUp ? p : 1 - p);
+                        switch (frontier.transition(level, states.at(state), isUp, labels.data())) {
+                            case Frontier::Outcome::CONNECTED:
+                                R += mass;
+                                break;
+                            case Frontier::Outcome::DISCONNECTED:
+                                break;
+                            default: {
+                                const auto [nextState, isNew] = nextStates.insert(labels.data());
+                                if (isNew) {
+                                    nextMasses.push_back(mass);
+                                } else {
+                                    nextMasses[nextState] += mass;
+                                }
+                            }
+                        }
+                    }
+                }
+                std::swap(states, nextStates);
+                std::swap(masses, nextMasses);
+            }
+            return R;
+        }
+    };
+
+}
+
+#endif //GRPH_FRONTIERDYNAMICPROGRAMMING_HPP
@@ -0,0 +1,254 @@
+#ifndef GRPH_LEAFBATCH_HPP
+#define GRPH_LEAFBATCH_HPP
+
+#include <array>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+#include "ClosedForms.hpp"
+
+#define MIN_BATCHED_DIMENSION 6
+#define MAX_BATCHED_DIMENSION 8
+#define LEAF_BATCH_SIZE 8
+
+#if defined(__AVX512F__)
+#define LEAF_LANES 8
+#elif defined(__AVX__)
+#define LEAF_LANES 4
+#else
+#define LEAF_LANES 2 // SSE2, NEON
+#endif
+
+namespace grph::graph::random {
+
+#if defined(__GNUC__)
+    typedef double LeafLanes __attribute__((vector_size(LEAF_LANES * sizeof(double))));
+#else
+    struct LeafLanes {
+        double lanes[LEAF_LANES];
+
+        double &operator[](int lane) { return lanes[lane]; }
+
+        double operator[](int lane) const { return lanes[lane]; }
+
+        friend LeafLanes operator+(const LeafLanes &lanes1, const LeafLanes &lanes2) {
+            LeafLanes result;
+            for (int lane = 0; lane < LEAF_LANES; ++lane) {
+                result[lane] = lanes1[lane] + lanes2[lane];
+            }
+            return result;
+        }
+
+        friend LeafLanes operator*(const LeafLanes &lanes1, const LeafLanes &lanes2) {
+            LeafLanes result;
+            for (int lane = 0; lane < LEAF_LANES; ++lane) {
+                result[lane] = lanes1[lane] * lanes2[lane];
+            }
+            return result;
+        }
+
+        friend LeafLanes operator-(double value, const LeafLanes &lanes) {
+            LeafLanes result;
+            for (int lane = 0; lane < LEAF_LANES; ++lane) {
+                result[lane] = value - lanes[lane];
+            }
+            return result;
+        }
+    };
+#endif
+
+    /// Postfix expression of a factoring subtree whose leaves with 6..8 vertexes are queued and evaluated
+    /// by the closed forms LEAF_LANES graphs at a time. A step of the factoring pushes its operands, then
+    /// itself; the step is calculated as soon as its operands are values, in the same order as the scalar
+    /// factoring does, so the result is the same to the last bit.
+    class LeafBatch {
+    public:
+        void pushValue(double R) {
+            _entries.push_back(Entry{Kind::VALUE, R, 0, 0});
+        }
+
+        /// the values are copied, the matrix can be changed after the call
+        void pushLeaf(const AdjacencyMatrix<EdgeProbability> &matrix) {
+            const int dimension = matrix.getDimension();
+            if (dimension < MIN_BATCHED_DIMENSION || dimension > MAX_BATCHED_DIMENSION) {
+                throw std::runtime_error("ERROR(LeafBatch): leaf of " + std::to_string(dimension) + " vertexes");
+            }
+            auto &queue = _queues[dimension - MIN_BATCHED_DIMENSION];
+            auto &probabilities = queue._probabilities[queue._numLeaves];
+            for (int lineIdx = 0; lineIdx < dimension; ++lineIdx) {
+                for (int columnIdx = lineIdx + 1; columnIdx < dimension; ++columnIdx) {
+                    probabilities[lineIdx * MAX_BATCHED_DIMENSION + columnIdx] = matrix.at(lineIdx, columnIdx);
+                }
+            }
+            _entries.push_back(Entry{Kind::LEAF, 0., dimension, queue._numLeaves++});
+            if (queue._numLeaves == LEAF_BATCH_SIZE) {
+                flush(dimension);
+            }
+        }
+
+        /// factor * R
+        void pushScale(double factor) {
+            push(Entry{Kind::SCALE, factor, 1, 0});
+        }
+
+        /// (1 - p) * R(removed) + p * R(pulled), R(removed) is pushed first
+        void pushEdgeFactoring(double p) {
+            push(Entry{Kind::EDGE_FACTORING, p, 2, 0});
+        }
+
+        /// 1 * R(first) * ... * R(last)
+        void pushProduct(int numOperands) {
+            push(Entry{Kind::PRODUCT, 1., numOperands, 0});
+        }
+
+        /// R unchanged; once R is a value, the pair (tag, R) goes to the tagged values
+        void pushTag(int tag) {
+            push(Entry{Kind::TAG, 0., 1, tag});
+        }
+
+        /// pairs (tag, R) of the tags whose values were calculated since the last call
+        std::vector<std::pair<int, double>> takeTaggedValues() {
+            return std::exchange(_taggedValues, {});
+        }
+
+        /// evaluates the queued leaves, the expression on the top must be complete
+        double popValue() {
+            for (int dimension = MIN_BATCHED_DIMENSION; dimension <= MAX_BATCHED_DIMENSION; ++dimension) {
+                flush(dimension);
+            }
+            if (_entries.empty() || _entries.back()._kind != Kind::VALUE) {
+                throw std::runtime_error("ERROR(LeafBatch): incomplete expression");
+            }
+            const double R = _entries.back()._value;
+            _entries.pop_back();
+            return R;
+        }
+
+    private:
+        enum class Kind {
+            VALUE, LEAF, SCALE, EDGE_FACTORING, PRODUCT, TAG
+        };
+
+        struct Entry {
+            Kind _kind;
+            double _value; // R of a value, factor or probability of a step
+            int _operand1; // dimension of a leaf, number of operands of a step
+            int _operand2; // slot of a leaf in its queue, tag of a tag
+        };
+
+        struct LeafQueue {
+            std::array<std::array<double, MAX_BATCHED_DIMENSION * MAX_BATCHED_DIMENSION>, LEAF_BATCH_SIZE> _probabilities;
+            int _numLeaves = 0;
+        };
+
+        /// lanes of a batch of matrices for the closed forms
+        struct LanesMatrix {
+            const std::array<LeafLanes, MAX_BATCHED_DIMENSION * MAX_BATCHED_DIMENSION> &_lanes;
+
+            LeafLanes at(int lineIdx, int columnIdx) const {
+                return _lanes[lineIdx * MAX_BATCHED_DIMENSION + columnIdx];
+            }
+        };
+
+        void push(const Entry &step) {
+            const int numOperands = step._operand1;
+            const int numEntries = static_cast<int>(_entries.size());
+            const int firstOperand = numEntries - numOperands;
+            if (firstOperand < 0) {
+                throw std::runtime_error("ERROR(LeafBatch): not enough operands");
+            }
+            for (int entryIdx = firstOperand; entryIdx < numEntries; ++entryIdx) {
+                if (_entries[entryIdx]._kind != Kind::VALUE) {
+                    _entries.push_back(step);
+                    return;
+                }
+            }
+
+            double R = 0.;
+            switch (step._kind) {
+                case Kind::SCALE:
+                    R = step._value * _entries[firstOperand]._value;
+                    break;
+                case Kind::EDGE_FACTORING:
+                    R = (1 - step._value) * _entries[firstOperand]._value;
+                    R += step._value * _entries[firstOperand + 1]._value;
+                    break;
+                case Kind::PRODUCT:
+                    R = step._value;
+                    for (int entryIdx = firstOperand; entryIdx < numEntries; ++entryIdx) {
+                        R *= _entries[entryIdx]._value;
+                    }
+                    break;
+                case Kind::TAG:
+                    R = _entries[firstOperand]._value;
+                    _taggedValues.emplace_back(step._operand2, R);
+                    break;
+                default:
+                    throw std::runtime_error("ERROR(LeafBatch): not a step");
+            }
+            _entries.resize(firstOperand);
+            pushValue(R);
+        }
+
+        void flush(int dimension) {
+            auto &queue = _queues[dimension - MIN_BATCHED_DIMENSION];
+            if (queue._numLeaves == 0) {
+                return;
+            }
+
+            std::array<double, LEAF_BATCH_SIZE> R{};
+            for (int firstLeaf = 0; firstLeaf < queue._numLeaves; firstLeaf += LEAF_LANES) {
+                std::array<LeafLanes, MAX_BATCHED_DIMENSION * MAX_BATCHED_DIMENSION> lanes{};
+                for (int lineIdx = 0; lineIdx < dimension; ++lineIdx) {
+                    for (int columnIdx = lineIdx + 1; columnIdx < dimension; ++columnIdx) {
+                        const int entryIdx = lineIdx * MAX_BATCHED_DIMENSION + columnIdx;
+                        for (int lane = 0; lane < LEAF_LANES && firstLeaf + lane < queue._numLeaves; ++lane) {
+                            lanes[entryIdx][lane] = queue._probabilities[firstLeaf + lane][entryIdx];
+                        }
+                    }
+                }
+                const auto laneR = calculateLanes(dimension, LanesMatrix{lanes});
+                for (int lane = 0; lane < LEAF_LANES && firstLeaf + lane < queue._numLeaves; ++lane) {
+                    R[firstLeaf + lane] = laneR[lane];
+                }
+            }
+            queue._numLeaves = 0;
+
+            // the steps waiting for these leaves are calculated now
+            auto entries = std::move(_entries);
+            _entries.clear();
+            for (const auto &entry: entries) {
+                if (entry._kind == Kind::VALUE || entry._kind == Kind::LEAF) {
+                    if (entry._kind == Kind::LEAF && entry._operand1 == dimension) {
+                        pushValue(R[entry._operand2]);
+                    } else {
+                        _entries.push_back(entry);
+                    }
+                } else {
+                    push(entry);
+                }
+            }
+        }
+
+        static LeafLanes calculateLanes(int dimension, const LanesMatrix &matrix) {
+            switch (dimension) {
+                case 6:
+                    return ClosedForms::calculateCompleteGraph6ATR(matrix);
+                case 7:
+                    return ClosedForms::calculateCompleteGraph7ATR(matrix);
+                default:
+                    return ClosedForms::calculateCompleteGraph8ATR(matrix);
+            }
+        }
+
+        std::vector<Entry> _entries;
+        std::vector<std::pair<int, double>> _taggedValues;
+        std::array<LeafQueue, MAX_BATCHED_DIMENSION - MIN_BATCHED_DIMENSION + 1> _queues;
+    };
+
+}
+
+#endif //GRPH_LEAFBATCH_HPP
@@ -0,0 +1,234 @@
+#ifndef GRPH_MONTECARLOATR_HPP
+#define GRPH_MONTECARLOATR_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/UnionFind.hpp"
+#include "../common/types.hpp"
+#include "../../utils/concurrency/WorkStealingPool.hpp"
+#include "../../utils/random/Philox.hpp"
+#include "ExecutionPolicy.hpp"
+#include "PermutationSampler.hpp"
+
+#define SAMPLING_BATCH_SIZE 256
+#define SAMPLING_ROUND_BATCHES 64 // the stop rule is checked after each round
+
+namespace grph::graph::random {
+
+    enum class SamplingMethod {
+        CRUDE, // share of the connected samples of the edge states
+        PERMUTATION // mean of the exact conditional ATR of the sampled merge processes, see PermutationSampler
+    };
+
+    struct SamplingPolicy {
+        SamplingMethod method = SamplingMethod::CRUDE;
+
+        uint64_t seed = 0;
+
+        /// half-width of the confidence interval / the rarer of R and 1 - R: for a reliable network
+        /// the unreliability gets this relative error
+        double targetRelativeError = 0.01;
+
+        double confidenceLevel = 0.95;
+
+        /// checked between the rounds, so the samples of a round are always taken
+        double timeBudgetSeconds = 10.;
+
+        long long maxSamples = std::numeric_limits<long long>::max();
+    };
+
+    struct ATREstimate {
+        double R = 0.;
+        double standardError = INFINITY;
+        double lowerBound = 0.; // at SamplingPolicy::confidenceLevel: Wilson score interval for the crude samples,
+        double upperBound = 1.; // R -+ z * standardError for the permutations
+        double relativeError = INFINITY;
+        long long numSamples = 0;
+        long long numConnectedSamples = 0; // of the crude samples
+    };
+
+    /// ATR as the mean of the samples of SamplingPolicy::method: the crude sample is whether the sampled edge
+    /// states leave the graph connected, the permutation one is the ATR given a merge process. The sample
+    /// number and the index of the edge are the counter of Philox, so each sample is the same whatever thread
+    /// takes it; the rounds are fixed sets of samples, so for a seed the estimate depends on the number of
+    /// rounds only, not on the number of threads.
+    class MonteCarloATR {
+    public:
+        static ATREstimate estimate(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix,
+                                    const SamplingPolicy &samplingPolicy, const ExecutionPolicy &executionPolicy) {
+            MonteCarloATR monteCarloATR(adjacencyMatrix, samplingPolicy, executionPolicy.numThreads());
+            return monteCarloATR.estimate();
+        }
+
+        /// the normal quantile of the two-sided confidence level
+        static double calculateZ(double confidenceLevel) {
+            double low = 0.;
+            double high = 40.;
+            for (int iteration = 0; iteration < 100; ++iteration) {
+                const double z = (low + high) / 2;
+                if (std::erfc(z / std::sqrt(2.)) > 1 - confidenceLevel) {
+                    low = z;
+                } else {
+                    high = z;
+                }
+            }
+            return (low + high) / 2;
+        }
+
+    private:
+        struct SampledEdge {
+            int vertex1;
+            int vertex2;
+            uint64_t threshold; // the edge is up if the 32-bit number is below
+        };
+
+        struct SamplingBatch {
+            long long batchIdx = -1; // -1 - the root task of a round
+        };
+
+        /// of the unreliability of the samples, the mean of a reliable network keeps its precision
+        struct BatchSums {
+            double sum = 0.;
+            double squaresSum = 0.;
+        };
+
+        MonteCarloATR(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix, const SamplingPolicy &samplingPolicy,
+                      int numThreads)
+                : _numVertexes(adjacencyMatrix.getDimension()),
+                  _samplingPolicy(samplingPolicy),
+                  _philox(samplingPolicy.seed),
+                  _pool(numThreads),
+                  _unionFinds(_pool.getNumWorkers()),
+                  _batchSums(SAMPLING_ROUND_BATCHES) {
+            for (int vertex1 = 0; vertex1 < _numVertexes; ++vertex1) {
+                for (int vertex2 = vertex1 + 1; vertex2 < _numVertexes; ++vertex2) {
+                    if (adjacencyMatrix.isConnected(vertex1, vertex2)) {
+                        const double p = std::clamp(adjacencyMatrix.at(vertex1, vertex2), 0., 1.);
+                        _edges.push_back(SampledEdge{vertex1, vertex2, static_cast<uint64_t>(std::ldexp(p, 32))});
+                    }
+                }
+            }
+            if (samplingPolicy.method == SamplingMethod::PERMUTATION) {
+                _permutationSamplers.assign(_pool.getNumWorkers(), PermutationSampler(adjacencyMatrix));
+            }
+        }
+
+        ATREstimate estimate() {
+            const auto start = std::chrono::steady_clock::now();
+            const double z = calculateZ(_samplingPolicy.confidenceLevel);
+            ATREstimate estimate;
+            BatchSums sums;
+            for (long long round = 0; estimate.numSamples < _samplingPolicy.maxSamples; ++round) {
+                _firstBatch = round * SAMPLING_ROUND_BATCHES;
+                _pool.run(SamplingBatch{}, [this](SamplingBatch &batch, int workerId) {
+                    if (batch.batchIdx < 0) {
+                        for (int batchIdx = 0; batchIdx < SAMPLING_ROUND_BATCHES; ++batchIdx) {
+                            _pool.push(workerId, SamplingBatch{_firstBatch + batchIdx});
+                        }
+                    } else {
+                        _batchSums[batch.batchIdx - _firstBatch] = sampleBatch(batch.batchIdx, workerId);
+                    }
+                });
+                for (const auto &batchSums: _batchSums) {
+                    sums.sum += batchSums.sum;
+                    sums.squaresSum += batchSums.squaresSum;
+                }
+                estimate.numSamples += SAMPLING_ROUND_BATCHES * SAMPLING_BATCH_SIZE;
+                if (_samplingPolicy.method == SamplingMethod::PERMUTATION) {
+                    updateNormalInterval(estimate, sums, z);
+                } else {
+                    estimate.numConnectedSamples = estimate.numSamples - static_cast<long long>(sums.sum);
+                    updateWilsonInterval(estimate, z);
+                }
+
+                const double elapsedSeconds = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start).count();
+                if (estimate.relativeError <= _samplingPolicy.targetRelativeError
+                    || elapsedSeconds >= _samplingPolicy.timeBudgetSeconds) {
+                    break;
+                }
+            }
+            return estimate;
+        }
+
+        BatchSums sampleBatch(long long batchIdx, int workerId) {
+            BatchSums batchSums;
+            if (_samplingPolicy.method == SamplingMethod::PERMUTATION) {
+                auto &permutationSampler = _permutationSamplers[workerId];
+                for (long long sample = batchIdx * SAMPLING_BATCH_SIZE; sample < (batchIdx + 1) * SAMPLING_BATCH_SIZE;
+                     ++sample) {
+                    const double unreliability = permutationSampler.sampleUnreliability(_philox, sample);
+                    batchSums.sum += unreliability;
+                    batchSums.squaresSum += unreliability * unreliability;
+                }
+                return batchSums;
+            }
+
+            auto &unionFind = _unionFinds[workerId];
+            for (long long sample = batchIdx * SAMPLING_BATCH_SIZE; sample < (batchIdx + 1) * SAMPLING_BATCH_SIZE; ++sample) {
+                unionFind.reset(_numVertexes);
+                for (int firstEdge = 0; firstEdge < static_cast<int>(_edges.size()) && unionFind.getNumSets() > 1; firstEdge += 4) {
+                    const auto numbers = _philox({static_cast<uint32_t>(sample), static_cast<uint32_t>(sample >> 32),
+                                                  static_cast<uint32_t>(firstEdge / 4), 0});
+                    const int lastEdge = std::min(firstEdge + 4, static_cast<int>(_edges.size()));
+                    for (int edgeIdx = firstEdge; edgeIdx < lastEdge; ++edgeIdx) {
+                        const auto &edge = _edges[edgeIdx];
+                        if (numbers[edgeIdx - firstEdge] < edge.threshold) {
+                            unionFind.unite(edge.vertex1, edge.vertex2);
+                        }
+                    }
+                }
+                batchSums.sum += unionFind.getNumSets() > 1;
+            }
+            batchSums.squaresSum = batchSums.sum;
+            return batchSums;
+        }
+
+        static void updateWilsonInterval(ATREstimate &estimate, double z) {
+            const auto numSamples = static_cast<double>(estimate.numSamples);
+            const auto numConnected = static_cast<double>(estimate.numConnectedSamples);
+            estimate.R = numConnected / numSamples;
+            estimate.standardError = std::sqrt(estimate.R * (1 - estimate.R) / numSamples);
+            const double squaredZ = z * z;
+            const double center = (numConnected + squaredZ / 2) / (numSamples + squaredZ);
+            const double halfWidth = z / (numSamples + squaredZ)
+                                     * std::sqrt(numConnected * (numSamples - numConnected) / numSamples + squaredZ / 4);
+            estimate.lowerBound = std::max(0., center - halfWidth);
+            estimate.upperBound = std::min(1., center + halfWidth);
+            const double rarerShare = std::min(estimate.R, 1 - estimate.R);
+            estimate.relativeError = rarerShare > 0 ? halfWidth / rarerShare : INFINITY;
+        }
+
+        static void updateNormalInterval(ATREstimate &estimate, const BatchSums &sums, double z) {
+            const auto numSamples = static_cast<double>(estimate.numSamples);
+            const double unreliability = sums.sum / numSamples;
+            const double variance = std::max(0., sums.squaresSum / numSamples - unreliability * unreliability);
+            estimate.R = 1 - unreliability;
+            estimate.standardError = std::sqrt(variance / (numSamples - 1));
+            const double halfWidth = z * estimate.standardError;
+            estimate.lowerBound = std::max(0., estimate.R - halfWidth);
+            estimate.upperBound = std::min(1., estimate.R + halfWidth);
+            const double rarerShare = std::min(estimate.R, unreliability);
+            estimate.relativeError = rarerShare > 0 ? halfWidth / rarerShare : INFINITY;
+        }
+
+        const int _numVertexes;
+        const SamplingPolicy _samplingPolicy;
+        const utils::Philox _philox;
+        std::vector<SampledEdge> _edges;
+        utils::WorkStealingPool<SamplingBatch> _pool;
+        std::vector<UnionFind> _unionFinds; // of each worker
+        std::vector<PermutationSampler> _permutationSamplers; // of each worker, for SamplingMethod::PERMUTATION
+        std::vector<BatchSums> _batchSums; // of each batch of the round
+        long long _firstBatch = 0;
+    };
+
+}
+
+#endif //GRPH_MONTECARLOATR_HPP
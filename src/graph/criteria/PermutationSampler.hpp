@@ -0,0 +1,203 @@
+#ifndef GRPH_PERMUTATIONSAMPLER_HPP
+#define GRPH_PERMUTATIONSAMPLER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/UnionFind.hpp"
+#include "../common/types.hpp"
+#include "../../utils/random/Philox.hpp"
+
+#define MAX_BIRTH_PROBABILITY (1 - 0x1p-53) // an edge up for sure would be born at once, its rate infinite
+#define TAIL_PRECISION 1e-15 // relative bound of the dropped Poisson terms of the tail
+#define NEGLIGIBLE_STAGE_MASS 1e-30 // of the mass of all stages, a stage left behind is dropped
+
+namespace grph::graph::random {
+
+    /// Sample of the permutation Monte Carlo of Elperin, Gertsbakh and Lomonosov with the turnip. Each edge is
+    /// born at an exponential time of the rate -ln(1 - p), so it is up at the time 1 with the probability p.
+    /// The order of the births is a merge process of the components; an edge inside a component will never
+    /// change it, so when two components merge the edges between them leave the rate. The time to connect the
+    /// graph is then a sum of exponential holding times with the rates of the stages, and the sample is its
+    /// tail at 1: the exact unreliability given the process, not an indicator of a rare event, so the relative
+    /// error stays bounded for a highly reliable network. Holds the memory of one worker.
+    class PermutationSampler {
+    public:
+        explicit PermutationSampler(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix)
+                : _numVertexes(adjacencyMatrix.getDimension()),
+                  _firstSlots(_numVertexes),
+                  _lastSlots(_numVertexes),
+                  _numSlots(_numVertexes) {
+            for (int vertex1 = 0; vertex1 < _numVertexes; ++vertex1) {
+                for (int vertex2 = vertex1 + 1; vertex2 < _numVertexes; ++vertex2) {
+                    if (adjacencyMatrix.isConnected(vertex1, vertex2)) {
+                        const double p = std::clamp(adjacencyMatrix.at(vertex1, vertex2), 0., MAX_BIRTH_PROBABILITY);
+                        if (p > 0) {
+                            _edges.push_back(BornEdge{vertex1, vertex2, -std::log1p(-p)});
+                        }
+                    }
+                }
+            }
+            _births.resize(_edges.size());
+            _order.resize(_edges.size());
+            _isInside.resize(_edges.size());
+            _nextSlots.resize(2 * _edges.size());
+        }
+
+        /// the conditional unreliability of the sample, the counter of Philox as in MonteCarloATR
+        double sampleUnreliability(const utils::Philox &philox, long long sample) {
+            const int numEdges = static_cast<int>(_edges.size());
+            for (int firstEdge = 0; firstEdge < numEdges; firstEdge += 4) {
+                const auto numbers = philox({static_cast<uint32_t>(sample), static_cast<uint32_t>(sample >> 32),
+                                             static_cast<uint32_t>(firstEdge / 4), 0});
+                const int lastEdge = std::min(firstEdge + 4, numEdges);
+                for (int edgeIdx = firstEdge; edgeIdx < lastEdge; ++edgeIdx) {
+                    const double uniform = (numbers[edgeIdx - firstEdge] + 0.5) * 0x1p-32;
+                    _births[edgeIdx] = -std::log(uniform) / _edges[edgeIdx].rate;
+                }
+            }
+            std::iota(_order.begin(), _order.end(), 0);
+            std::sort(_order.begin(), _order.end(), [this](int edgeIdx1, int edgeIdx2) {
+                return _births[edgeIdx1] < _births[edgeIdx2];
+            });
+
+            // a component keeps the ends of its edges in a list, the lists are joined on a merge
+            _unionFind.reset(_numVertexes);
+            std::fill(_isInside.begin(), _isInside.end(), false);
+            std::fill(_firstSlots.begin(), _firstSlots.end(), -1);
+            std::fill(_numSlots.begin(), _numSlots.end(), 0);
+            double rate = 0.;
+            for (int edgeIdx = 0; edgeIdx < numEdges; ++edgeIdx) {
+                appendSlot(_edges[edgeIdx].vertex1, 2 * edgeIdx);
+                appendSlot(_edges[edgeIdx].vertex2, 2 * edgeIdx + 1);
+                rate += _edges[edgeIdx].rate;
+            }
+
+            _stageRates.clear();
+            for (int edgeIdx: _order) {
+                if (_unionFind.getNumSets() <= 1) {
+                    break;
+                }
+                if (_isInside[edgeIdx]) {
+                    continue;
+                }
+                _stageRates.push_back(rate);
+                int root1 = _unionFind.find(_edges[edgeIdx].vertex1);
+                int root2 = _unionFind.find(_edges[edgeIdx].vertex2);
+                if (_numSlots[root1] > _numSlots[root2]) {
+                    std::swap(root1, root2);
+                }
+                for (int slot = _firstSlots[root1]; slot >= 0; slot = _nextSlots[slot]) {
+                    const auto &edge = _edges[slot / 2];
+                    if (!_isInside[slot / 2] && _unionFind.find(slot % 2 ? edge.vertex1 : edge.vertex2) == root2) {
+                        _isInside[slot / 2] = true;
+                        rate -= edge.rate;
+                    }
+                }
+                _unionFind.unite(root1, root2);
+                const int root = _unionFind.find(root1);
+                const int other = root == root1 ? root2 : root1;
+                const int first = _firstSlots[root1];
+                _nextSlots[_lastSlots[root1]] = _firstSlots[root2];
+                _lastSlots[root] = _lastSlots[root2];
+                _firstSlots[root] = first;
+                _numSlots[root] = _numSlots[root1] + _numSlots[root2];
+                _firstSlots[other] = -1;
+            }
+            if (_unionFind.getNumSets() > 1) {
+                return 1.;
+            }
+            return _stageRates.empty() ? 0. : calculateTail();
+        }
+
+    private:
+        struct BornEdge {
+            int vertex1;
+            int vertex2;
+            double rate;
+        };
+
+        void appendSlot(int vertex, int slot) {
+            _nextSlots[slot] = -1;
+            if (_firstSlots[vertex] < 0) {
+                _firstSlots[vertex] = slot;
+            } else {
+                _nextSlots[_lastSlots[vertex]] = slot;
+            }
+            _lastSlots[vertex] = slot;
+            ++_numSlots[vertex];
+        }
+
+        /// P(sum of the holding times of the stages > 1) by uniformization: the stages are left at the jumps of
+        /// a Poisson process of the biggest rate, a jump leaves a stage with the share of its rate. Only positive
+        /// terms are summed, so a tiny tail keeps its relative precision.
+        double calculateTail() {
+            const int numStages = static_cast<int>(_stageRates.size());
+            const double uniformRate = _stageRates[0];
+            _leaveShares.resize(numStages);
+            _stayShares.resize(numStages);
+            for (int stage = 0; stage < numStages; ++stage) {
+                _leaveShares[stage] = _stageRates[stage] / uniformRate;
+                _stayShares[stage] = (uniformRate - _stageRates[stage]) / uniformRate;
+            }
+            _masses.assign(numStages, 0.);
+            _masses[0] = 1.;
+            int first = 0; // stages with a mass
+            int last = 0;
+            double survival = 1.;
+            double tail = 0.;
+            const double logRate = std::log(uniformRate);
+            double logPoisson = -uniformRate;
+            for (long long numJumps = 0; ; ++numJumps) {
+                tail += std::exp(logPoisson) * survival;
+                logPoisson += logRate - std::log(numJumps + 1.);
+                // after the mode the rest of the Poisson terms is below a geometric series
+                if (survival <= 0 || (numJumps + 2 > uniformRate && std::exp(logPoisson) * survival
+                                      <= TAIL_PRECISION * tail * (1 - uniformRate / (numJumps + 2)))) {
+                    break;
+                }
+
+                for (int stage = last; stage >= first; --stage) {
+                    const double leaving = _masses[stage] * _leaveShares[stage];
+                    _masses[stage] *= _stayShares[stage];
+                    if (stage + 1 < numStages) {
+                        _masses[stage + 1] += leaving;
+                    }
+                }
+                if (last + 1 < numStages) {
+                    ++last;
+                }
+                while (first < last && _masses[first] < NEGLIGIBLE_STAGE_MASS * survival) {
+                    _masses[first++] = 0.;
+                }
+                survival = 0.;
+                for (int stage = first; stage <= last; ++stage) {
+                    survival += _masses[stage];
+                }
+            }
+            return std::min(tail, 1.);
+        }
+
+        int _numVertexes;
+        std::vector<BornEdge> _edges;
+        std::vector<double> _births;
+        std::vector<int> _order;
+        std::vector<bool> _isInside; // of a component
+        UnionFind _unionFind;
+        std::vector<int> _nextSlots; // 2 * edge + end, -1 - the last one
+        std::vector<int> _firstSlots; // of each root
+        std::vector<int> _lastSlots;
+        std::vector<int> _numSlots;
+        std::vector<double> _stageRates; // decreasing
+        std::vector<double> _leaveShares; // of the mass of a stage at a jump
+        std::vector<double> _stayShares;
+        std::vector<double> _masses;
+    };
+
+}
+
+#endif //GRPH_PERMUTATIONSAMPLER_HPP
@@ -0,0 +1,107 @@
+#ifndef GRPH_PIVOTSTRATEGY_HPP
+#define GRPH_PIVOTSTRATEGY_HPP
+
+#include <cmath>
+
+#include "../common/types.hpp"
+#include "../random/IRandomGraph.hpp"
+
+namespace grph::graph::random {
+
+    /// how the edge to factor on is chosen
+    enum class PivotStrategy {
+        LOWEST_DEGREE, // vertex with the lowest degree and its neighbor with the biggest number
+        MAX_DEGREE, // biggest sum of the degrees of the ends
+        MOST_CHAINS, // most vertexes of degree two after the deletion and the contraction
+        EXTREME_PROBABILITY, // probability farthest from 0.5
+        LOOKAHEAD // edge of a vertex with the lowest degree that leaves the fewest vertexes, then edges,
+                  // in both branches after their series-parallel reduction
+    };
+
+    class PivotSelector {
+    public:
+        /// graph is biconnected, so every edge can be a pivot; graph is restored before return
+        static Edge selectPivot(IRandomGraph &graph, PivotStrategy pivotStrategy) {
+            if (pivotStrategy == PivotStrategy::LOWEST_DEGREE) {
+                const auto vertexWithLowestDegree = graph.getDegreesVector()->getVertexWithLowestDegree();
+                return Edge{vertexWithLowestDegree,
+                            graph.getAdjacencyMatrix()->findNeighborWithBiggestNumFor(vertexWithLowestDegree)};
+            }
+
+            const int lowestDegree = graph.getVertexDegree(graph.getDegreesVector()->getVertexWithLowestDegree());
+            Edge pivot{0, 1};
+            double bestScore = -INFINITY;
+            for (int vertex1 = 0; vertex1 < graph.getNumVertexes(); ++vertex1) {
+                for (int vertex2 = vertex1 + 1; vertex2 < graph.getNumVertexes(); ++vertex2) {
+                    if (graph.at(vertex1, vertex2) == EMPTY) {
+                        continue;
+                    }
+                    if (pivotStrategy == PivotStrategy::LOOKAHEAD
+                        && graph.getVertexDegree(vertex1) != lowestDegree
+                        && graph.getVertexDegree(vertex2) != lowestDegree) {
+                        continue; // each lookahead costs two reductions
+                    }
+                    const double score = calculateScore(graph, Edge{vertex1, vertex2}, pivotStrategy);
+                    if (score > bestScore) {
+                        bestScore = score;
+                        pivot = Edge{vertex1, vertex2};
+                    }
+                }
+            }
+            return pivot;
+        }
+
+    private:
+        static double calculateScore(IRandomGraph &graph, const Edge &edge, PivotStrategy pivotStrategy) {
+            const int degree1 = graph.getVertexDegree(edge.minVertex());
+            const int degree2 = graph.getVertexDegree(edge.maxVertex());
+            switch (pivotStrategy) {
+                case PivotStrategy::MAX_DEGREE:
+                    return degree1 + degree2;
+                case PivotStrategy::MOST_CHAINS: {
+                    // deletion leaves the ends of degree three with degree two, contraction merges
+                    // the edges to common neighbors
+                    int numChains = (degree1 == 3) + (degree2 == 3);
+                    for (int vertex = 0; vertex < graph.getNumVertexes(); ++vertex) {
+                        if (graph.at(vertex, edge.minVertex()) != EMPTY
+                            && graph.at(vertex, edge.maxVertex()) != EMPTY
+                            && graph.getVertexDegree(vertex) == 3) {
+                            ++numChains;
+                        }
+                    }
+                    return numChains;
+                }
+                case PivotStrategy::EXTREME_PROBABILITY:
+                    return std::abs(graph.at(edge.minVertex(), edge.maxVertex()) - 0.5);
+                case PivotStrategy::LOOKAHEAD:
+                    return -calculateBranchesSize(graph, edge);
+                default:
+                    return 0.;
+            }
+        }
+
+        static double calculateBranchesSize(IRandomGraph &graph, const Edge &edge) {
+            const auto &removeEdgeAction = graph.removeEdge(edge);
+
+            const auto &deletionReduceAction = graph.reduceSeriesParallel();
+            double branchesSize = calculateSize(graph);
+            deletionReduceAction->rollback();
+
+            const auto &pullAction = graph.pullEdge(edge.minVertex(), edge.maxVertex());
+            const auto &contractionReduceAction = graph.reduceSeriesParallel();
+            branchesSize += calculateSize(graph);
+            contractionReduceAction->rollback();
+            pullAction->rollback();
+
+            removeEdgeAction->rollback();
+            return branchesSize;
+        }
+
+        static double calculateSize(const IRandomGraph &graph) {
+            return graph.getNumVertexes() * static_cast<double>(graph.getNumVertexes()) + graph.getNumEdges();
+        }
+    };
+
+}
+
+#endif //GRPH_PIVOTSTRATEGY_HPP
@@ -0,0 +1,79 @@
+#ifndef GRPH_RELIABILITYBOUNDS_HPP
+#define GRPH_RELIABILITYBOUNDS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+
+namespace grph::graph::random {
+
+    /// when ATR::calculateATRBounds stops; with the defaults it runs to the exact ATR
+    struct AnytimePolicy {
+        /// checked at every factoring step, the first pass (bounds of the whole graph) is always made
+        double timeBudgetSeconds = INFINITY;
+
+        /// upper bound - lower bound
+        double targetGap = 0.;
+    };
+
+    struct ATRBounds {
+        double lowerBound = 0.;
+        double upperBound = 1.;
+        double exploredFraction = 0.; // of the probability mass of the factoring tree, the rest is bounded
+    };
+
+    /// cheap bounds of the ATR of a connected graph for the branches the factoring does not explore
+    class ReliabilityBounds {
+    public:
+        /// probability of the most reliable spanning tree to be up, by Prim
+        static double calculateLowerBound(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) {
+            const int dimension = adjacencyMatrix.getDimension();
+            if (dimension <= 1) {
+                return 1.;
+            }
+            std::vector<double> bestProbabilities(dimension, 0.);
+            std::vector<bool> isInTree(dimension, false);
+            double R = 1.;
+            int vertex = 0;
+            for (int numInTree = 1; numInTree < dimension; ++numInTree) {
+                isInTree[vertex] = true;
+                for (int neighbor = 0; neighbor < dimension; ++neighbor) {
+                    if (!isInTree[neighbor] && adjacencyMatrix.isConnected(vertex, neighbor)) {
+                        bestProbabilities[neighbor] = std::max(bestProbabilities[neighbor],
+                                                               adjacencyMatrix.at(vertex, neighbor));
+                    }
+                }
+                vertex = -1;
+                for (int candidate = 0; candidate < dimension; ++candidate) {
+                    if (!isInTree[candidate] && (vertex < 0 || bestProbabilities[candidate] > bestProbabilities[vertex])) {
+                        vertex = candidate;
+                    }
+                }
+                R *= bestProbabilities[vertex];
+            }
+            return R;
+        }
+
+        /// probability that the least reliable vertex is not isolated
+        static double calculateUpperBound(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) {
+            const int dimension = adjacencyMatrix.getDimension();
+            double R = 1.;
+            for (int vertex = 0; dimension > 1 && vertex < dimension; ++vertex) {
+                double isolation = 1.;
+                for (int neighbor = 0; neighbor < dimension; ++neighbor) {
+                    if (neighbor != vertex && adjacencyMatrix.isConnected(vertex, neighbor)) {
+                        isolation *= 1 - adjacencyMatrix.at(vertex, neighbor);
+                    }
+                }
+                R = std::min(R, 1 - isolation);
+            }
+            return R;
+        }
+    };
+
+}
+
+#endif //GRPH_RELIABILITYBOUNDS_HPP
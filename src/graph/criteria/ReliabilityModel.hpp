@@ -0,0 +1,175 @@
+#ifndef GRPH_RELIABILITYMODEL_HPP
+#define GRPH_RELIABILITYMODEL_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+#include "ArithmeticCircuit.hpp"
+
+namespace grph::graph::random {
+
+    /// ATR of a fixed topology under changing probabilities of the edges: the ArithmeticCircuit of the
+    /// topology keeps the value of each instruction, an update recomputes only the instructions that depend
+    /// on the edge, in the order of the program: they are bits of a mask scanned a word at a time. An
+    /// instruction whose value stays the same does not pass the update on. The values are those of a full
+    /// evaluation of the circuit, bit for bit.
+    class ReliabilityModel {
+    public:
+        explicit ReliabilityModel(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix)
+                : _circuit(ArithmeticCircuit::compile(adjacencyMatrix)) {
+            const auto &instructions = _circuit.getInstructions();
+            const auto &sources = _circuit.getSources();
+            const int numInstructions = static_cast<int>(instructions.size());
+            const int numEdges = static_cast<int>(_circuit.getEdges().size());
+
+            // users of each instruction as compressed rows
+            _firstUsers.assign(numInstructions + 1, 0);
+            // the same operand twice is one use
+            for (const auto &[source1, source2]: sources) {
+                for (int source: {source1, source2 == source1 ? -1 : source2}) {
+                    if (source >= 0) {
+                        ++_firstUsers[source + 1];
+                    }
+                }
+            }
+            for (int instructionIdx = 0; instructionIdx < numInstructions; ++instructionIdx) {
+                _firstUsers[instructionIdx + 1] += _firstUsers[instructionIdx];
+            }
+            _users.resize(_firstUsers.back());
+            std::vector<int> nextUsers(_firstUsers.begin(), _firstUsers.end() - 1);
+            for (int instructionIdx = 0; instructionIdx < numInstructions; ++instructionIdx) {
+                const auto [source1, source2] = sources[instructionIdx];
+                for (int source: {source1, source2 == source1 ? -1 : source2}) {
+                    if (source >= 0) {
+                        _users[nextUsers[source]++] = instructionIdx;
+                    }
+                }
+            }
+
+            _probabilities.resize(numEdges);
+            for (int edgeIdx = 0; edgeIdx < numEdges; ++edgeIdx) {
+                const auto &edge = _circuit.getEdges()[edgeIdx];
+                _probabilities[edgeIdx] = adjacencyMatrix.at(edge.minVertex(), edge.maxVertex());
+            }
+            _inputs.assign(numEdges, -1);
+            _values.resize(numInstructions);
+            _isQueued.assign((numInstructions + 63) / 64, 0);
+            for (int instructionIdx = 0; instructionIdx < numInstructions; ++instructionIdx) {
+                if (instructions[instructionIdx].operation == ArithmeticCircuit::Operation::INPUT) {
+                    _inputs[instructions[instructionIdx].operand1] = instructionIdx;
+                }
+                _values[instructionIdx] = calculateValue(instructionIdx);
+            }
+        }
+
+        double getATR() const {
+            return _values.empty() ? 0. : _values.back();
+        }
+
+        EdgeProbability getProbability(int vertex1, int vertex2) const {
+            return _probabilities[findEdge(vertex1, vertex2)];
+        }
+
+        /// the new ATR; the edge must be in the topology of the model
+        double updateProbability(int vertex1, int vertex2, EdgeProbability p) {
+            const int edgeIdx = findEdge(vertex1, vertex2);
+            _probabilities[edgeIdx] = p;
+            const int input = _inputs[edgeIdx];
+            if (input < 0 || _values[input] == p) {
+                return getATR(); // the ATR does not depend on the edge
+            }
+            _values[input] = p;
+            _lastQueued = input;
+            queueUsers(input);
+            // a user comes after its operands, so its bit is ahead of the scan
+            for (int wordIdx = input / 64; wordIdx <= _lastQueued / 64; ++wordIdx) {
+                while (_isQueued[wordIdx] != 0) {
+                    const int instructionIdx = wordIdx * 64 + std::countr_zero(_isQueued[wordIdx]);
+                    _isQueued[wordIdx] &= _isQueued[wordIdx] - 1;
+                    const double value = calculateValue(instructionIdx);
+                    if (value != _values[instructionIdx]) {
+                        _values[instructionIdx] = value;
+                        queueUsers(instructionIdx);
+                    }
+                }
+            }
+            return getATR();
+        }
+
+        /// number of instructions recomputed by all updates so far
+        long long getNumRecomputed() const {
+            return _numRecomputed;
+        }
+
+        const ArithmeticCircuit &getCircuit() const {
+            return _circuit;
+        }
+
+    private:
+        int findEdge(int vertex1, int vertex2) const {
+            const auto &edges = _circuit.getEdges();
+            const int minVertex = std::min(vertex1, vertex2);
+            const int maxVertex = std::max(vertex1, vertex2);
+            // compile takes the edges line by line, so they are sorted
+            const auto edge = std::lower_bound(edges.begin(), edges.end(), std::make_pair(minVertex, maxVertex),
+                                               [](const Edge &edge, const std::pair<int, int> &vertexes) {
+                                                   return std::make_pair(edge.minVertex(), edge.maxVertex())
+                                                          < vertexes;
+                                               });
+            if (edge == edges.end() || edge->minVertex() != minVertex || edge->maxVertex() != maxVertex) {
+                throw std::runtime_error("ERROR(ReliabilityModel): no edge " + std::to_string(vertex1) + " - "
+                                         + std::to_string(vertex2) + " in the topology");
+            }
+            return static_cast<int>(edge - edges.begin());
+        }
+
+        void queueUsers(int instructionIdx) {
+            for (int userIdx = _firstUsers[instructionIdx]; userIdx < _firstUsers[instructionIdx + 1]; ++userIdx) {
+                const int user = _users[userIdx];
+                const uint64_t bit = uint64_t{1} << (user % 64);
+                if ((_isQueued[user / 64] & bit) == 0) {
+                    _isQueued[user / 64] |= bit;
+                    _lastQueued = std::max(_lastQueued, user);
+                    ++_numRecomputed;
+                }
+            }
+        }
+
+        double calculateValue(int instructionIdx) const {
+            const auto &instruction = _circuit.getInstructions()[instructionIdx];
+            const auto [source1, source2] = _circuit.getSources()[instructionIdx];
+            switch (instruction.operation) {
+                case ArithmeticCircuit::Operation::CONSTANT:
+                    return instruction.operand1;
+                case ArithmeticCircuit::Operation::INPUT:
+                    return _probabilities[instruction.operand1];
+                case ArithmeticCircuit::Operation::COMPLEMENT:
+                    return 1 - _values[source1];
+                case ArithmeticCircuit::Operation::ADD:
+                    return _values[source1] + _values[source2];
+                case ArithmeticCircuit::Operation::MULTIPLY:
+                    return _values[source1] * _values[source2];
+            }
+            return 0.;
+        }
+
+        ArithmeticCircuit _circuit;
+        std::vector<EdgeProbability> _probabilities; // of the edges of the circuit
+        std::vector<int> _inputs; // instruction of each edge, -1 - the ATR does not depend on the edge
+        std::vector<double> _values; // of each instruction, the ATR is the last one
+        std::vector<int> _firstUsers; // of each instruction in _users
+        std::vector<int> _users;
+        std::vector<uint64_t> _isQueued; // bits of the instructions to recompute by the update
+        int _lastQueued = 0;
+        long long _numRecomputed = 0;
+    };
+
+}
+
+#endif //GRPH_RELIABILITYMODEL_HPP
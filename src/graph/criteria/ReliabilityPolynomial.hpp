@@ -0,0 +1,137 @@
+#ifndef GRPH_RELIABILITYPOLYNOMIAL_HPP
+#define GRPH_RELIABILITYPOLYNOMIAL_HPP
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+#include "AlgebraicFactoring.hpp"
+
+namespace grph::graph::random {
+
+    /// sum of coefficients[i] * p^i * (1 - p)^(degree - i); for the ATR of a graph with E edges
+    /// coefficients[i] is the number of its connected spanning subgraphs with i edges
+    class ReliabilityPolynomial {
+    public:
+        ReliabilityPolynomial() = default; // zero
+
+        explicit ReliabilityPolynomial(std::vector<double> coefficients) : _coefficients(std::move(coefficients)) {}
+
+        static ReliabilityPolynomial one() {
+            return ReliabilityPolynomial({1.});
+        }
+
+        /// p
+        static ReliabilityPolynomial up() {
+            return ReliabilityPolynomial({0., 1.});
+        }
+
+        /// 1 - p
+        static ReliabilityPolynomial down() {
+            return ReliabilityPolynomial({1., 0.});
+        }
+
+        bool isZero() const {
+            return _coefficients.empty();
+        }
+
+        int getDegree() const {
+            return static_cast<int>(_coefficients.size()) - 1;
+        }
+
+        const std::vector<double> &getCoefficients() const {
+            return _coefficients;
+        }
+
+        double evaluate(double p) const {
+            double R = 0.;
+            double pPower = 1.;
+            for (int idx = 0; idx <= getDegree(); ++idx) {
+                R += _coefficients[idx] * pPower * std::pow(1 - p, getDegree() - idx);
+                pPower *= p;
+            }
+            return R;
+        }
+
+        ReliabilityPolynomial operator+(const ReliabilityPolynomial &other) const {
+            if (isZero()) {
+                return other;
+            } else if (other.isZero()) {
+                return *this;
+            } else if (getDegree() != other.getDegree()) {
+                throw std::runtime_error("ERROR(ReliabilityPolynomial): sum of different degrees");
+            }
+            auto coefficients = _coefficients;
+            for (int idx = 0; idx <= getDegree(); ++idx) {
+                coefficients[idx] += other._coefficients[idx];
+            }
+            return ReliabilityPolynomial(std::move(coefficients));
+        }
+
+        /// p^i (1 - p)^(n - i) * p^j (1 - p)^(m - j) = p^(i + j) (1 - p)^(n + m - i - j)
+        ReliabilityPolynomial operator*(const ReliabilityPolynomial &other) const {
+            if (isZero() || other.isZero()) {
+                return {};
+            }
+            std::vector<double> coefficients(_coefficients.size() + other._coefficients.size() - 1, 0.);
+            for (int idx = 0; idx <= getDegree(); ++idx) {
+                for (int otherIdx = 0; otherIdx <= other.getDegree(); ++otherIdx) {
+                    coefficients[idx + otherIdx] += _coefficients[idx] * other._coefficients[otherIdx];
+                }
+            }
+            return ReliabilityPolynomial(std::move(coefficients));
+        }
+
+        bool operator==(const ReliabilityPolynomial &other) const = default;
+
+    private:
+        std::vector<double> _coefficients;
+    };
+
+    struct PolynomialAlgebra {
+        using Value = ReliabilityPolynomial;
+
+        Value zero() const {
+            return {};
+        }
+
+        Value one() const {
+            return ReliabilityPolynomial::one();
+        }
+
+        Value add(const Value &value1, const Value &value2) const {
+            return value1 + value2;
+        }
+
+        Value multiply(const Value &value1, const Value &value2) const {
+            return value1 * value2;
+        }
+    };
+
+    using EdgePolynomial = EdgeWeights<ReliabilityPolynomial>;
+
+    class ReliabilityPolynomialFactoring {
+    public:
+        /// values of the matrix are ignored, only its edges are used
+        static ReliabilityPolynomial calculate(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix) {
+            const int dimension = adjacencyMatrix.getDimension();
+            auto matrix = std::make_shared<AdjacencyMatrix<EdgePolynomial>>(dimension);
+            for (int lineIdx = 0; lineIdx < dimension; ++lineIdx) {
+                for (int columnIdx = lineIdx + 1; columnIdx < dimension; ++columnIdx) {
+                    if (adjacencyMatrix.isConnected(lineIdx, columnIdx)) {
+                        matrix->addEdge(lineIdx, columnIdx, EdgePolynomial{ReliabilityPolynomial::up(),
+                                                                           ReliabilityPolynomial::down()});
+                    }
+                }
+            }
+            PolynomialAlgebra algebra;
+            return AlgebraicFactoring<PolynomialAlgebra>(algebra).calculate(matrix);
+        }
+    };
+
+}
+
+#endif //GRPH_RELIABILITYPOLYNOMIAL_HPP
@@ -0,0 +1,245 @@
+#ifndef GRPH_TRANSPOSITIONTABLE_HPP
+#define GRPH_TRANSPOSITIONTABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+
+#define TRANSPOSITION_TABLE_SHARDS 16
+#define PROBABILITY_QUANTUM 1e-12
+
+namespace grph::graph::random {
+
+    /// Memo of sub-graph reliabilities met in the factoring tree. Sub-graphs are stored in a canonical
+    /// vertex order (colour refinement by degrees and probabilities of incident edges), so the same
+    /// sub-graph reached with another numbering hits the same entry. The hash uses quantized
+    /// probabilities, the hit is verified against the exact edge list.
+    class TranspositionTable {
+    public:
+        class Key {
+        public:
+            bool operator==(const Key &other) const {
+                return _hash == other._hash
+                       && _dimension == other._dimension
+                       && _edges == other._edges;
+            }
+
+            uint64_t getHash() const {
+                return _hash;
+            }
+
+            size_t getSizeInBytes() const {
+                return sizeof(Key) + _edges.capacity() * sizeof(std::pair<int, EdgeProbability>);
+            }
+
+        private:
+            friend class TranspositionTable;
+
+            uint64_t _hash = 0;
+            int _dimension = 0;
+            std::vector<std::pair<int, EdgeProbability>> _edges; // (line * dimension + column, p), line < column
+        };
+
+        struct Statistics {
+            unsigned long hits = 0;
+            unsigned long misses = 0;
+            unsigned long insertions = 0;
+            unsigned long evictions = 0;
+            unsigned long entries = 0;
+            size_t memoryUsage = 0;
+        };
+
+        explicit TranspositionTable(size_t memoryBudgetBytes)
+                : _shardMemoryBudget(memoryBudgetBytes / TRANSPOSITION_TABLE_SHARDS) {}
+
+        static Key makeKey(const AdjacencyMatrix<EdgeProbability> &matrix) {
+            const int dimension = matrix.getDimension();
+            const auto order = findCanonicalOrder(matrix);
+            std::vector<int> position(dimension);
+            for (int idx = 0; idx < dimension; ++idx) {
+                position[order[idx]] = idx;
+            }
+
+            Key key;
+            key._dimension = dimension;
+            for (int lineIdx = 0; lineIdx < dimension; ++lineIdx) {
+                for (int columnIdx = lineIdx + 1; columnIdx < dimension; ++columnIdx) {
+                    if (matrix.isConnected(lineIdx, columnIdx)) {
+                        const int from = std::min(position[lineIdx], position[columnIdx]);
+                        const int to = std::max(position[lineIdx], position[columnIdx]);
+                        key._edges.emplace_back(from * dimension + to, matrix.at(lineIdx, columnIdx));
+                    }
+                }
+            }
+            std::sort(key._edges.begin(), key._edges.end());
+
+            uint64_t hash = mix(dimension);
+            for (const auto &[edgeIdx, p]: key._edges) {
+                hash = mix(hash ^ mix(edgeIdx) ^ mix(quantize(p)));
+            }
+            key._hash = hash;
+            return key;
+        }
+
+        bool find(const Key &key, double &R) {
+            auto &shard = getShard(key);
+            std::lock_guard<std::mutex> lock(shard._mutex);
+            const auto found = shard._entries.find(key._hash);
+            if (found == shard._entries.end() || !(found->second._key == key)) {
+                _misses.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            _hits.fetch_add(1, std::memory_order_relaxed);
+            R = found->second._R;
+            return true;
+        }
+
+        void insert(Key &&key, double R) {
+            const auto entrySize = key.getSizeInBytes() + ENTRY_OVERHEAD_BYTES;
+            if (entrySize > _shardMemoryBudget) {
+                return;
+            }
+
+            auto &shard = getShard(key);
+            std::lock_guard<std::mutex> lock(shard._mutex);
+            const auto hash = key._hash;
+            auto found = shard._entries.find(hash);
+            if (found != shard._entries.end()) { // hash collision or parallel insertion: keep the latest
+                shard._memoryUsage -= found->second._key.getSizeInBytes() + ENTRY_OVERHEAD_BYTES;
+                found->second = Entry{std::move(key), R};
+            } else {
+                shard._entries.emplace(hash, Entry{std::move(key), R});
+                shard._insertionOrder.push_back(hash);
+            }
+            shard._memoryUsage += entrySize;
+            _insertions.fetch_add(1, std::memory_order_relaxed);
+
+            while (shard._memoryUsage > _shardMemoryBudget && !shard._insertionOrder.empty()) {
+                const auto oldestHash = shard._insertionOrder.front();
+                shard._insertionOrder.pop_front();
+                const auto oldest = shard._entries.find(oldestHash);
+                if (oldest != shard._entries.end()) {
+                    shard._memoryUsage -= oldest->second._key.getSizeInBytes() + ENTRY_OVERHEAD_BYTES;
+                    shard._entries.erase(oldest);
+                    _evictions.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void clear() {
+            for (auto &shard: _shards) {
+                std::lock_guard<std::mutex> lock(shard._mutex);
+                shard._entries.clear();
+                shard._insertionOrder.clear();
+                shard._memoryUsage = 0;
+            }
+        }
+
+        Statistics getStatistics() {
+            Statistics statistics;
+            statistics.hits = _hits.load();
+            statistics.misses = _misses.load();
+            statistics.insertions = _insertions.load();
+            statistics.evictions = _evictions.load();
+            for (auto &shard: _shards) {
+                std::lock_guard<std::mutex> lock(shard._mutex);
+                statistics.entries += shard._entries.size();
+                statistics.memoryUsage += shard._memoryUsage;
+            }
+            return statistics;
+        }
+
+    private:
+        /// hash map node, bucket and insertion order slot
+        static constexpr size_t ENTRY_OVERHEAD_BYTES = 64;
+
+        /// enough to separate vertexes by their 3-neighbourhoods, further rounds rarely pay off
+        static constexpr int REFINEMENT_ROUNDS = 3;
+
+        struct Entry {
+            Key _key;
+            double _R;
+        };
+
+        struct Shard {
+            std::mutex _mutex;
+            std::unordered_map<uint64_t, Entry> _entries;
+            std::deque<uint64_t> _insertionOrder;
+            size_t _memoryUsage = 0;
+        };
+
+        static uint64_t mix(uint64_t value) { // splitmix64 finalizer
+            value += 0x9e3779b97f4a7c15ULL;
+            value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+            return value ^ (value >> 31);
+        }
+
+        static uint64_t quantize(EdgeProbability p) {
+            return static_cast<uint64_t>(std::llround(p / PROBABILITY_QUANTUM));
+        }
+
+        /// vertexes sorted by colours refined for a few rounds, ties are left in the current numbering
+        static std::vector<int> findCanonicalOrder(const AdjacencyMatrix<EdgeProbability> &matrix) {
+            const int dimension = matrix.getDimension();
+            std::vector<std::vector<std::pair<int, uint64_t>>> neighbors(dimension);
+            for (int vertex = 0; vertex < dimension; ++vertex) {
+                for (int neighbor = 0; neighbor < dimension; ++neighbor) {
+                    if (matrix.isConnected(vertex, neighbor)) {
+                        neighbors[vertex].emplace_back(neighbor, mix(quantize(matrix.at(vertex, neighbor))));
+                    }
+                }
+            }
+
+            std::vector<uint64_t> colors(dimension, 0);
+            std::vector<uint64_t> nextColors(dimension);
+            std::vector<uint64_t> neighborhood;
+            for (int round = 0; round < REFINEMENT_ROUNDS; ++round) {
+                for (int vertex = 0; vertex < dimension; ++vertex) {
+                    neighborhood.clear();
+                    for (const auto &[neighbor, edgeColor]: neighbors[vertex]) {
+                        neighborhood.push_back(mix(colors[neighbor] ^ edgeColor));
+                    }
+                    std::sort(neighborhood.begin(), neighborhood.end());
+                    uint64_t color = mix(colors[vertex] + neighborhood.size());
+                    for (const auto neighborColor: neighborhood) {
+                        color = mix(color ^ neighborColor);
+                    }
+                    nextColors[vertex] = color;
+                }
+                colors.swap(nextColors);
+            }
+
+            std::vector<int> order(dimension);
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&colors](int v1, int v2) {
+                return colors[v1] < colors[v2];
+            });
+            return order;
+        }
+
+        Shard &getShard(const Key &key) {
+            return _shards[key._hash % TRANSPOSITION_TABLE_SHARDS];
+        }
+
+        const size_t _shardMemoryBudget;
+        std::array<Shard, TRANSPOSITION_TABLE_SHARDS> _shards;
+        std::atomic<unsigned long> _hits{0};
+        std::atomic<unsigned long> _misses{0};
+        std::atomic<unsigned long> _insertions{0};
+        std::atomic<unsigned long> _evictions{0};
+    };
+
+}
+
+#endif //GRPH_TRANSPOSITIONTABLE_HPP
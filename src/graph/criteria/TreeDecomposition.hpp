@@ -0,0 +1,159 @@
+#ifndef GRPH_TREEDECOMPOSITION_HPP
+#define GRPH_TREEDECOMPOSITION_HPP
+
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+
+namespace grph::graph::random {
+
+    /// which vertex is eliminated next
+    enum class EliminationHeuristic {
+        MIN_DEGREE, // fewest neighbors
+        MIN_FILL // fewest pairs of neighbors to connect
+    };
+
+    /// Tree decomposition by a vertex elimination order: the neighbors of a vertex when it is eliminated are
+    /// its separator, they become a clique; the bag of the vertex is the vertex and its separator. The parent
+    /// of the bag is the bag of the first eliminated vertex of the separator, it contains the whole separator.
+    /// The last vertex of each connected component is a root with an empty separator.
+    class TreeDecomposition {
+    public:
+        static TreeDecomposition build(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix,
+                                       EliminationHeuristic eliminationHeuristic) {
+            const int dimension = adjacencyMatrix.getDimension();
+            TreeDecomposition treeDecomposition;
+            treeDecomposition._separators.resize(dimension);
+            treeDecomposition._parents.assign(dimension, VERTEX_NOT_FOUND);
+            std::vector<std::vector<int>> neighbors(dimension); // sorted, with the fill edges
+            for (int vertex1 = 0; vertex1 < dimension; ++vertex1) {
+                for (int vertex2 = 0; vertex2 < dimension; ++vertex2) {
+                    if (vertex1 != vertex2 && adjacencyMatrix.isConnected(vertex1, vertex2)) {
+                        neighbors[vertex1].push_back(vertex2);
+                    }
+                }
+            }
+
+            std::vector<int> scores(dimension);
+            std::set<std::pair<int, int>> queue; // score, vertex
+            for (int vertex = 0; vertex < dimension; ++vertex) {
+                scores[vertex] = calculateScore(neighbors, vertex, eliminationHeuristic);
+                queue.emplace(scores[vertex], vertex);
+            }
+
+            std::vector<int> positions(dimension);
+            std::vector<int> touched;
+            while (!queue.empty()) {
+                const int vertex = queue.begin()->second;
+                queue.erase(queue.begin());
+                positions[vertex] = static_cast<int>(treeDecomposition._eliminationOrder.size());
+                treeDecomposition._eliminationOrder.push_back(vertex);
+
+                auto separator = std::move(neighbors[vertex]);
+                for (int neighbor: separator) {
+                    eraseSorted(neighbors[neighbor], vertex);
+                }
+                for (int neighbor1: separator) {
+                    for (int neighbor2: separator) {
+                        if (neighbor1 != neighbor2) {
+                            insertSorted(neighbors[neighbor1], neighbor2);
+                        }
+                    }
+                }
+
+                // the fill changes for the separator and its neighbors, the degree for the separator only
+                touched = separator;
+                if (eliminationHeuristic == EliminationHeuristic::MIN_FILL) {
+                    for (int neighbor: separator) {
+                        touched.insert(touched.end(), neighbors[neighbor].begin(), neighbors[neighbor].end());
+                    }
+                    std::sort(touched.begin(), touched.end());
+                    touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+                }
+                for (int touchedVertex: touched) {
+                    queue.erase({scores[touchedVertex], touchedVertex});
+                    scores[touchedVertex] = calculateScore(neighbors, touchedVertex, eliminationHeuristic);
+                    queue.emplace(scores[touchedVertex], touchedVertex);
+                }
+
+                treeDecomposition._width = std::max(treeDecomposition._width, static_cast<int>(separator.size()));
+                treeDecomposition._separators[vertex] = std::move(separator);
+            }
+
+            for (int vertex = 0; vertex < dimension; ++vertex) {
+                const auto &separator = treeDecomposition._separators[vertex];
+                if (!separator.empty()) {
+                    treeDecomposition._parents[vertex] = *std::min_element(
+                            separator.begin(), separator.end(), [&positions](int vertex1, int vertex2) {
+                                return positions[vertex1] < positions[vertex2];
+                            });
+                }
+            }
+            return treeDecomposition;
+        }
+
+        /// children before parents
+        const std::vector<int> &getEliminationOrder() const {
+            return _eliminationOrder;
+        }
+
+        /// sorted
+        const std::vector<int> &getSeparator(int vertex) const {
+            return _separators[vertex];
+        }
+
+        /// VERTEX_NOT_FOUND for a root
+        int getParent(int vertex) const {
+            return _parents[vertex];
+        }
+
+        /// size of the biggest bag - 1
+        int getWidth() const {
+            return _width;
+        }
+
+    private:
+        static int calculateScore(const std::vector<std::vector<int>> &neighbors, int vertex,
+                                  EliminationHeuristic eliminationHeuristic) {
+            const auto &vertexNeighbors = neighbors[vertex];
+            const int degree = static_cast<int>(vertexNeighbors.size());
+            if (eliminationHeuristic == EliminationHeuristic::MIN_DEGREE) {
+                return degree;
+            }
+            int fill = 0;
+            for (int neighborIdx1 = 0; neighborIdx1 < degree; ++neighborIdx1) {
+                const auto &neighbors1 = neighbors[vertexNeighbors[neighborIdx1]];
+                for (int neighborIdx2 = neighborIdx1 + 1; neighborIdx2 < degree; ++neighborIdx2) {
+                    fill += !std::binary_search(neighbors1.begin(), neighbors1.end(), vertexNeighbors[neighborIdx2]);
+                }
+            }
+            return fill;
+        }
+
+        static void insertSorted(std::vector<int> &vertexes, int vertex) {
+            const auto position = std::lower_bound(vertexes.begin(), vertexes.end(), vertex);
+            if (position == vertexes.end() || *position != vertex) {
+                vertexes.insert(position, vertex);
+            }
+        }
+
+        static void eraseSorted(std::vector<int> &vertexes, int vertex) {
+            const auto position = std::lower_bound(vertexes.begin(), vertexes.end(), vertex);
+            if (position != vertexes.end() && *position == vertex) {
+                vertexes.erase(position);
+            }
+        }
+
+        std::vector<int> _eliminationOrder;
+        std::vector<std::vector<int>> _separators;
+        std::vector<int> _parents;
+        int _width = 0;
+    };
+
+}
+
+#endif //GRPH_TREEDECOMPOSITION_HPP
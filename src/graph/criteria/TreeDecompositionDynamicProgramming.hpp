@@ -0,0 +1,188 @@
+#ifndef GRPH_TREEDECOMPOSITIONDYNAMICPROGRAMMING_HPP
+#define GRPH_TREEDECOMPOSITIONDYNAMICPROGRAMMING_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../common/AdjacencyMatrix.hpp"
+#include "../common/types.hpp"
+#include "Frontier.hpp"
+#include "TreeDecomposition.hpp"
+
+namespace grph::graph::random {
+
+    /// ATR by the connectivity partitions of the bags of a TreeDecomposition, children before parents. The
+    /// table of a vertex is the probability mass of each partition of its separator by the edges of its
+    /// subtree, every eliminated vertex of the subtree being connected to the separator. For the bag the
+    /// table starts with all vertexes apart, takes the edges from the vertex to its separator, then the
+    /// tables of the children; the vertex is forgotten last. The time is linear in the number of vertexes
+    /// and exponential in the width of the decomposition.
+    class TreeDecompositionDynamicProgramming {
+    public:
+        static double calculate(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix,
+                                EliminationHeuristic eliminationHeuristic) {
+            return calculate(adjacencyMatrix, TreeDecomposition::build(adjacencyMatrix, eliminationHeuristic));
+        }
+
+        static double calculate(const AdjacencyMatrix<EdgeProbability> &adjacencyMatrix,
+                                const TreeDecomposition &treeDecomposition) {
+            const int dimension = adjacencyMatrix.getDimension();
+            if (dimension <= 1) {
+                return 1.;
+            }
+            if (treeDecomposition.getWidth() >= MAX_FRONTIER_WIDTH) {
+                throw std::runtime_error("ERROR(TreeDecompositionDynamicProgramming): width "
+                                         + std::to_string(treeDecomposition.getWidth()));
+            }
+            std::vector<std::vector<int>> children(dimension);
+            int numRoots = 0;
+            for (int vertex: treeDecomposition.getEliminationOrder()) {
+                const int parent = treeDecomposition.getParent(vertex);
+                if (parent == VERTEX_NOT_FOUND) {
+                    ++numRoots;
+                } else {
+                    children[parent].push_back(vertex);
+                }
+            }
+            if (numRoots > 1) {
+                return 0.;
+            }
+
+            std::vector<Table> tables(dimension);
+            Table table;
+            Table nextTable;
+            std::array<uint8_t, MAX_FRONTIER_WIDTH> labels;
+            double R = 0.;
+            for (int vertex: treeDecomposition.getEliminationOrder()) {
+                const auto &separator = treeDecomposition.getSeparator(vertex);
+                const int bagWidth = static_cast<int>(separator.size()) + 1; // the vertex is at 0
+                table.reset(bagWidth);
+                std::iota(labels.begin(), labels.begin() + bagWidth, 0);
+                table.add(labels.data(), 1.);
+
+                for (int position = 1; position < bagWidth; ++position) {
+                    if (adjacencyMatrix.isConnected(vertex, separator[position - 1])) {
+                        addEdge(table, position, adjacencyMatrix.at(vertex, separator[position - 1]), nextTable);
+                        std::swap(table, nextTable);
+                    }
+                }
+
+                for (int child: children[vertex]) {
+                    std::vector<int> childPositions;
+                    for (int separatorVertex: treeDecomposition.getSeparator(child)) {
+                        childPositions.push_back(separatorVertex == vertex ? 0 : 1 + static_cast<int>(
+                                std::lower_bound(separator.begin(), separator.end(), separatorVertex)
+                                - separator.begin()));
+                    }
+                    join(table, tables[child], childPositions, nextTable);
+                    std::swap(table, nextTable);
+                    tables[child] = Table();
+                }
+
+                // the vertex is forgotten: its component must go on through the separator
+                auto &vertexTable = tables[vertex];
+                vertexTable.reset(bagWidth - 1);
+                for (int state = 0; state < table.states.size(); ++state) {
+                    const uint8_t *bagLabels = table.states.at(state);
+                    if (std::find(bagLabels + 1, bagLabels + bagWidth, bagLabels[0]) == bagLabels + bagWidth) {
+                        if (bagWidth == 1) {
+                            R += table.masses[state];
+                        }
+                        continue;
+                    }
+                    std::copy_n(bagLabels + 1, bagWidth - 1, labels.begin());
+                    normalize(labels.data(), bagWidth - 1);
+                    vertexTable.add(labels.data(), table.masses[state]);
+                }
+            }
+            return R;
+        }
+
+    private:
+        struct Table {
+            FrontierStates states;
+            std::vector<double> masses;
+
+            void reset(int width) {
+                states.reset(width);
+                masses.clear();
+            }
+
+            void add(const uint8_t *labels, double mass) {
+                const auto [state, isNew] = states.insert(labels);
+                if (isNew) {
+                    masses.push_back(mass);
+                } else {
+                    masses[state] += mass;
+                }
+            }
+        };
+
+        /// edge from the vertex of the bag to the vertex at the position
+        static void addEdge(const Table &table, int position, double p, Table &nextTable) {
+            const int width = table.states.getWidth();
+            nextTable.reset(width);
+            std::array<uint8_t, MAX_FRONTIER_WIDTH> labels;
+            for (int state = 0; state < table.states.size(); ++state) {
+                const uint8_t *stateLabels = table.states.at(state);
+                nextTable.add(stateLabels, table.masses[state] * (1 - p));
+                std::copy_n(stateLabels, width, labels.begin());
+                std::replace(labels.begin(), labels.begin() + width, stateLabels[position], stateLabels[0]);
+                normalize(labels.data(), width);
+                nextTable.add(labels.data(), table.masses[state] * p);
+            }
+        }
+
+        /// the partition of the bag joined with the partition of the separator of a child at its positions
+        static void join(const Table &table, const Table &childTable, const std::vector<int> &childPositions,
+                         Table &nextTable) {
+            const int width = table.states.getWidth();
+            const int childWidth = static_cast<int>(childPositions.size());
+            nextTable.reset(width);
+            std::array<uint8_t, MAX_FRONTIER_WIDTH> labels;
+            std::array<int, MAX_FRONTIER_WIDTH> firstPositions; // of each component of the child
+            for (int state = 0; state < table.states.size(); ++state) {
+                const uint8_t *stateLabels = table.states.at(state);
+                for (int childState = 0; childState < childTable.states.size(); ++childState) {
+                    const uint8_t *childLabels = childTable.states.at(childState);
+                    std::copy_n(stateLabels, width, labels.begin());
+                    std::fill_n(firstPositions.begin(), childWidth, -1);
+                    for (int childPosition = 0; childPosition < childWidth; ++childPosition) {
+                        const int position = childPositions[childPosition];
+                        auto &firstPosition = firstPositions[childLabels[childPosition]];
+                        if (firstPosition < 0) {
+                            firstPosition = position;
+                        } else if (labels[firstPosition] != labels[position]) {
+                            const uint8_t label = labels[position];
+                            std::replace(labels.begin(), labels.begin() + width, label, labels[firstPosition]);
+                        }
+                    }
+                    normalize(labels.data(), width);
+                    nextTable.add(labels.data(), table.masses[state] * childTable.masses[childState]);
+                }
+            }
+        }
+
+        /// labels numbered by the first occurrence
+        static void normalize(uint8_t *labels, int width) {
+            std::array<int, MAX_FRONTIER_WIDTH + 1> renumbered;
+            std::fill_n(renumbered.begin(), width + 1, -1);
+            int numLabels = 0;
+            for (int position = 0; position < width; ++position) {
+                auto &label = renumbered[labels[position]];
+                if (label < 0) {
+                    label = numLabels++;
+                }
+                labels[position] = label;
+            }
+        }
+    };
+
+}
+
+#endif //GRPH_TREEDECOMPOSITIONDYNAMICPROGRAMMING_HPP
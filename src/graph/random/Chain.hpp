@@ -41,7 +41,7 @@ namespace grph::graph::random {
         }
 
         bool isTrivialChain() const {
-            return this->size() <= TRIVIAL_CHAIN_VERTEX_LENGTH;
+            return !this->isCycle() && this->size() <= TRIVIAL_CHAIN_VERTEX_LENGTH;
         }
 
         bool empty() const {
@@ -36,10 +36,16 @@ namespace grph::graph::random {
 
         virtual std::shared_ptr<RemoveRandomEdgeAction> removeRandomEdge() = 0;
 
+        virtual std::shared_ptr<RemoveRandomEdgeAction> removeEdge(const Edge &edgeToRemove) = 0;
+
         virtual std::shared_ptr<PullEdgeAction> pullEdge(int remainingVertexNum, int vertexToRemoveNum) = 0;
 
         virtual std::shared_ptr<RemoveTrivialChainAction> removeTrivialChain(const Chain &trivialChain) = 0;
 
+        /// series, parallel, degree-1 reductions and contractions of perfect edges up to a fixed point,
+        /// all undone by one rollback
+        virtual std::shared_ptr<ReduceSeriesParallelAction> reduceSeriesParallel() = 0;
+
         virtual bool isTree() const = 0;
 
         virtual bool isCycle() const = 0;
@@ -65,6 +71,17 @@ namespace grph::graph::random {
                 const std::unordered_set<int> &connectivityComponent
         ) const = 0;
 
+        /// true if the edge (present or already removed) separates the ends of a connected graph; then
+        /// minVertexSide is a mask of the vertexes, 1 on the side of edge.minVertex(), 0 on the other side
+        virtual bool isBridge(const Edge &edge, std::vector<char> &minVertexSide) const = 0;
+
+        /// biconnected components (blocks) of a connected graph, empty if the graph itself is biconnected
+        virtual std::vector<std::unordered_set<int>> findBlocks() const = 0;
+
+        /// a pair of vertexes that splits a biconnected graph into two parts of at least two vertexes, the most
+        /// balanced one; then side receives the smaller part without the pair. False if there is none
+        virtual bool findSeparationPair(std::pair<int, int> &separationPair, std::unordered_set<int> &side) const = 0;
+
     };
 
 }
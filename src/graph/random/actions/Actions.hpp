@@ -58,6 +58,22 @@ namespace grph::graph::random {
         ~RemoveTrivialChainAction() override = default;
     };
 
+    class ReduceSeriesParallelAction : public RollbackAction {
+    public:
+        explicit ReduceSeriesParallelAction(
+                const std::shared_ptr<DegreesVector> &degreesVectorBeforeAction
+        ) : RollbackAction(degreesVectorBeforeAction) {};
+
+        void rollback() override = 0;
+
+        /// product of the factors of all reductions made
+        virtual double getReductionFactor() const = 0;
+
+        virtual int getNumReductions() const = 0;
+
+        ~ReduceSeriesParallelAction() override = default;
+    };
+
 }
 
 #endif //GRPH_ACTIONS_HPP
@@ -105,11 +105,13 @@ double UndirectedRandomGraph::calculateCycleATR() const {
 }
 
 std::shared_ptr<RemoveRandomEdgeAction> UndirectedRandomGraph::removeRandomEdge() {
-    auto curDegreesVector = _degreesVector;
-
     auto vertexWithLowestDegree = _degreesVector->getVertexWithLowestDegree();
     auto neighborWithBiggestNum = _adjacencyMatrix->findNeighborWithBiggestNumFor(vertexWithLowestDegree);
-    auto edgeToRemove = Edge{vertexWithLowestDegree, neighborWithBiggestNum};
+    return removeEdge(Edge{vertexWithLowestDegree, neighborWithBiggestNum});
+}
+
+std::shared_ptr<RemoveRandomEdgeAction> UndirectedRandomGraph::removeEdge(const Edge &edgeToRemove) {
+    auto curDegreesVector = _degreesVector;
 
     auto ratioValue = _adjacencyMatrix->removeEdge(edgeToRemove);
     _degreesVector->removeEdge(edgeToRemove._from, edgeToRemove._to);
@@ -133,7 +135,8 @@ std::shared_ptr<PullEdgeAction> UndirectedRandomGraph::pullEdge(int remainingVer
 
     auto remainingVertexSnapshot = _adjacencyMatrix->getOutgoingEdges(remainingVertexNum);
     if (vertexToRemoveNum != getLastVertexNum()) {
-        this->renumberPairVertexes(vertexToRemoveNum, getLastVertexNum());
+        // matrix only: the degrees vector is rebuilt below, the one before the action is kept for rollback
+        _adjacencyMatrix->renumberPairOfVertices(vertexToRemoveNum, getLastVertexNum());
     }
 
     this->enrichWithEdges(getLastVertexNum(),
@@ -192,6 +195,107 @@ std::shared_ptr<RemoveTrivialChainAction> UndirectedRandomGraph::removeTrivialCh
     );
 }
 
+std::shared_ptr<ReduceSeriesParallelAction> UndirectedRandomGraph::reduceSeriesParallel() {
+    auto curDegreesVector = _degreesVector;
+    std::vector<ReduceSeriesParallelActionURG::Reduction> reductions;
+    double reductionFactor = 1.;
+
+    if (getNumVertexes() > 2) {
+        // the degrees vector is rebuilt once at the end, the one before the action is kept for rollback
+        std::vector<int> degrees(getNumVertexes());
+        for (int vertex = 0; vertex < getNumVertexes(); ++vertex) {
+            degrees[vertex] = getVertexDegree(vertex);
+        }
+
+        int vertex = 0;
+        while (getNumVertexes() > 2) {
+            while (vertex < getNumVertexes() && degrees[vertex] > 2) {
+                ++vertex;
+            }
+            int remainingVertex = VERTEX_NOT_FOUND;
+            if (vertex == getNumVertexes()) {
+                // the end of a perfect edge with the bigger number is removed, so the other one keeps its number
+                for (int from = 0; from < getNumVertexes() && remainingVertex == VERTEX_NOT_FOUND; ++from) {
+                    for (int to = from + 1; to < getNumVertexes(); ++to) {
+                        if (at(from, to) == PERFECT_EDGE) {
+                            remainingVertex = from;
+                            vertex = to;
+                            break;
+                        }
+                    }
+                }
+                if (remainingVertex == VERTEX_NOT_FOUND) {
+                    break;
+                }
+            }
+
+            ReduceSeriesParallelActionURG::Reduction reduction{vertex, VERTEX_NOT_FOUND, VERTEX_NOT_FOUND, EMPTY, {}};
+            if (remainingVertex != VERTEX_NOT_FOUND) {
+                // a perfect edge never fails, so its ends are one vertex for all-terminal reliability
+                reduction._neighbor1 = remainingVertex;
+                reduction._remainingVertexSnapshot = _adjacencyMatrix->getOutgoingEdges(remainingVertex);
+
+                removeEdgeInternal(remainingVertex, vertex);
+                --degrees[remainingVertex];
+                const auto removedVertexEdges = _adjacencyMatrix->getOutgoingEdges(vertex);
+                for (const auto &edgeNode: removedVertexEdges) {
+                    if (at(remainingVertex, edgeNode.oppositeEnd(vertex)) != EMPTY) {
+                        --degrees[edgeNode.oppositeEnd(vertex)];
+                    } else {
+                        ++degrees[remainingVertex];
+                    }
+                }
+                enrichWithEdges(vertex, remainingVertex, removedVertexEdges);
+            } else if (degrees[vertex] == 0) {
+                reductionFactor = 0.;
+            } else if (degrees[vertex] == 1) {
+                reduction._neighbor1 = _adjacencyMatrix->findNeighborWithLowestNumFor(vertex);
+                reductionFactor *= at(vertex, reduction._neighbor1);
+                --degrees[reduction._neighbor1];
+            } else {
+                reduction._neighbor1 = _adjacencyMatrix->findNeighborWithLowestNumFor(vertex);
+                reduction._neighbor2 = _adjacencyMatrix->findNeighborWithBiggestNumFor(vertex);
+                reduction._prevEdgeValue = at(reduction._neighbor1, reduction._neighbor2);
+
+                const auto p1 = at(vertex, reduction._neighbor1);
+                const auto p2 = at(vertex, reduction._neighbor2);
+                const auto chainFactor = p1 + p2 - p1 * p2;
+                const auto chainValue = p1 * p2 / chainFactor;
+                reductionFactor *= chainFactor;
+
+                if (reduction._prevEdgeValue != EMPTY) {
+                    addEdgeInternal(reduction._neighbor1, reduction._neighbor2,
+                                    reduction._prevEdgeValue + chainValue - reduction._prevEdgeValue * chainValue);
+                    --degrees[reduction._neighbor1];
+                    --degrees[reduction._neighbor2];
+                } else {
+                    addEdgeInternal(reduction._neighbor1, reduction._neighbor2, chainValue);
+                }
+            }
+            reductions.push_back(std::move(reduction));
+
+            _adjacencyMatrix->renumberPairOfVertices(vertex, getLastVertexNum());
+            std::swap(degrees[vertex], degrees[getLastVertexNum()]);
+            removeLastVertex();
+
+            // neighbors of the removed vertex may have got degree <= 2
+            vertex = 0;
+        }
+        if (!reductions.empty()) {
+            _degreesVector = DegreesVector::make(_adjacencyMatrix);
+        }
+    }
+
+    return std::shared_ptr<ReduceSeriesParallelAction>(
+            new ReduceSeriesParallelActionURG(
+                    *this,
+                    curDegreesVector,
+                    std::move(reductions),
+                    reductionFactor
+            )
+    );
+}
+
 std::shared_ptr<grph::graph::AdjacencyMatrix<EdgeProbability>> UndirectedRandomGraph::getSubgraphAdjacencyMatrix(
         const std::unordered_set<int> &subgraphVertexes
 ) const {
@@ -236,6 +340,237 @@ std::unordered_set<int> UndirectedRandomGraph::getInverseComponent(
     return inverseComponent;
 }
 
+bool UndirectedRandomGraph::isBridge(const Edge &edge, std::vector<char> &minVertexSide) const {
+    const int numVertexes = getNumVertexes();
+    const int from = edge.minVertex();
+    const int to = edge.maxVertex();
+
+    auto &visited = minVertexSide;
+    visited.assign(numVertexes, false);
+    std::vector<int> dfsStack;
+    dfsStack.reserve(numVertexes);
+    visited[from] = true;
+    dfsStack.push_back(from);
+    while (!dfsStack.empty()) {
+        const int vertex = dfsStack.back();
+        dfsStack.pop_back();
+        for (int neighbor = 0; neighbor < numVertexes; ++neighbor) {
+            if (visited[neighbor] || !isConnected(vertex, neighbor)) {
+                continue;
+            }
+            if (neighbor == to) {
+                if (vertex != from) {
+                    return false;
+                }
+                continue; // the edge itself
+            }
+            visited[neighbor] = true;
+            dfsStack.push_back(neighbor);
+        }
+    }
+    return true;
+}
+
+std::vector<std::unordered_set<int>> UndirectedRandomGraph::findBlocks() const {
+    const int numVertexes = getNumVertexes();
+    if (numVertexes <= 2) {
+        return {};
+    }
+
+    // discovery time, low, next neighbor to scan and parent of every vertex
+    std::vector<int> dfsState(4 * numVertexes, VERTEX_NOT_FOUND);
+    int *discoveryTime = dfsState.data();
+    int *low = discoveryTime + numVertexes;
+    int *nextNeighbor = low + numVertexes;
+    int *parent = nextNeighbor + numVertexes;
+    std::fill(nextNeighbor, nextNeighbor + numVertexes, 0);
+
+    std::vector<int> dfsStack;
+    std::vector<std::pair<int, int>> edgesStack;
+    std::vector<std::pair<int, int>> blocksEdges; // edges of the found blocks one after another
+    std::vector<size_t> blocksEnds;
+    dfsStack.reserve(numVertexes);
+    edgesStack.reserve(numVertexes);
+
+    int time = 0;
+    discoveryTime[0] = low[0] = time++;
+    dfsStack.push_back(0);
+    while (!dfsStack.empty()) {
+        const int vertex = dfsStack.back();
+        int &neighbor = nextNeighbor[vertex];
+        while (neighbor < numVertexes && !isConnected(vertex, neighbor)) {
+            ++neighbor;
+        }
+
+        if (neighbor < numVertexes) {
+            const int child = neighbor++;
+            if (discoveryTime[child] == VERTEX_NOT_FOUND) {
+                parent[child] = vertex;
+                discoveryTime[child] = low[child] = time++;
+                edgesStack.emplace_back(vertex, child);
+                dfsStack.push_back(child);
+            } else if (child != parent[vertex] && discoveryTime[child] < discoveryTime[vertex]) {
+                low[vertex] = std::min(low[vertex], discoveryTime[child]);
+                edgesStack.emplace_back(vertex, child);
+            }
+            continue;
+        }
+
+        dfsStack.pop_back();
+        const int vertexParent = parent[vertex];
+        if (vertexParent == VERTEX_NOT_FOUND) {
+            continue;
+        }
+        low[vertexParent] = std::min(low[vertexParent], low[vertex]);
+        if (low[vertex] >= discoveryTime[vertexParent]) { // vertexParent separates the block of vertex
+            std::pair<int, int> edge;
+            do {
+                edge = edgesStack.back();
+                edgesStack.pop_back();
+                blocksEdges.push_back(edge);
+            } while (edge.first != vertexParent || edge.second != vertex);
+            blocksEnds.push_back(blocksEdges.size());
+        }
+    }
+
+    if (blocksEnds.size() <= 1) { // biconnected graph, the common case inside the factoring
+        return {};
+    }
+
+    std::vector<std::unordered_set<int>> blocks(blocksEnds.size());
+    size_t blockBegin = 0;
+    for (size_t blockIdx = 0; blockIdx < blocksEnds.size(); ++blockIdx) {
+        for (size_t edgeIdx = blockBegin; edgeIdx < blocksEnds[blockIdx]; ++edgeIdx) {
+            blocks[blockIdx].insert(blocksEdges[edgeIdx].first);
+            blocks[blockIdx].insert(blocksEdges[edgeIdx].second);
+        }
+        blockBegin = blocksEnds[blockIdx];
+    }
+    return blocks;
+}
+
+bool UndirectedRandomGraph::findSeparationPair(std::pair<int, int> &separationPair,
+                                               std::unordered_set<int> &side) const {
+    const int numVertexes = getNumVertexes();
+    if (numVertexes < 6) {
+        return false;
+    }
+
+    // neighbors of every vertex one after another, the DFS runs once for each removed vertex
+    std::vector<int> firstNeighbors(numVertexes + 1, 0);
+    std::vector<int> neighbors;
+    for (int vertex = 0; vertex < numVertexes; ++vertex) {
+        for (int neighbor = 0; neighbor < numVertexes; ++neighbor) {
+            if (isConnected(vertex, neighbor)) {
+                neighbors.push_back(neighbor);
+            }
+        }
+        firstNeighbors[vertex + 1] = static_cast<int>(neighbors.size());
+    }
+
+    // discovery time, low, subtree size, next neighbor to scan and parent of every vertex
+    std::vector<int> dfsState(5 * numVertexes);
+    int *discoveryTime = dfsState.data();
+    int *low = discoveryTime + numVertexes;
+    int *subtreeSize = low + numVertexes;
+    int *nextNeighbor = subtreeSize + numVertexes;
+    int *parent = nextNeighbor + numVertexes;
+    std::vector<int> dfsStack;
+    dfsStack.reserve(numVertexes);
+
+    int bestBalance = 1; // size of the smaller part
+    int bestRemoved = VERTEX_NOT_FOUND;
+    int bestSeparating = VERTEX_NOT_FOUND;
+    int bestChild = VERTEX_NOT_FOUND; // the root of the part in the DFS tree
+    const auto updateBest = [&](int removed, int separating, int child) {
+        const int balance = std::min(subtreeSize[child], numVertexes - 2 - subtreeSize[child]);
+        if (balance > bestBalance) {
+            bestBalance = balance;
+            bestRemoved = removed;
+            bestSeparating = separating;
+            bestChild = child;
+        }
+    };
+    for (int removed = 0; removed < numVertexes && bestBalance < (numVertexes - 2) / 2; ++removed) {
+        std::fill(discoveryTime, discoveryTime + numVertexes, VERTEX_NOT_FOUND);
+        const int root = removed == 0 ? 1 : 0;
+        int firstRootChild = VERTEX_NOT_FOUND;
+        int numRootChildren = 0;
+        int time = 0;
+        discoveryTime[root] = low[root] = time++;
+        subtreeSize[root] = 1;
+        nextNeighbor[root] = firstNeighbors[root];
+        parent[root] = VERTEX_NOT_FOUND;
+        dfsStack.push_back(root);
+        while (!dfsStack.empty()) {
+            const int vertex = dfsStack.back();
+            if (nextNeighbor[vertex] < firstNeighbors[vertex + 1]) {
+                const int neighbor = neighbors[nextNeighbor[vertex]++];
+                if (neighbor == removed) {
+                    continue;
+                }
+                if (discoveryTime[neighbor] == VERTEX_NOT_FOUND) {
+                    parent[neighbor] = vertex;
+                    discoveryTime[neighbor] = low[neighbor] = time++;
+                    subtreeSize[neighbor] = 1;
+                    nextNeighbor[neighbor] = firstNeighbors[neighbor];
+                    dfsStack.push_back(neighbor);
+                    if (vertex == root && numRootChildren++ == 0) {
+                        firstRootChild = neighbor;
+                    }
+                } else if (neighbor != parent[vertex]) {
+                    low[vertex] = std::min(low[vertex], discoveryTime[neighbor]);
+                }
+                continue;
+            }
+
+            dfsStack.pop_back();
+            const int vertexParent = parent[vertex];
+            if (vertexParent == VERTEX_NOT_FOUND) {
+                continue;
+            }
+            low[vertexParent] = std::min(low[vertexParent], low[vertex]);
+            subtreeSize[vertexParent] += subtreeSize[vertex];
+            if (vertexParent != root && low[vertex] >= discoveryTime[vertexParent]) {
+                updateBest(removed, vertexParent, vertex); // the subtree of vertex hangs on vertexParent only
+            }
+        }
+        if (numRootChildren > 1) {
+            updateBest(removed, root, firstRootChild);
+        }
+    }
+    if (bestRemoved == VERTEX_NOT_FOUND) {
+        return false;
+    }
+
+    // the part of the subtree of bestChild, the smaller one is given
+    std::vector<char> isInPart(numVertexes, false);
+    isInPart[bestChild] = true;
+    dfsStack.push_back(bestChild);
+    int partSize = 1;
+    while (!dfsStack.empty()) {
+        const int vertex = dfsStack.back();
+        dfsStack.pop_back();
+        for (int neighborIdx = firstNeighbors[vertex]; neighborIdx < firstNeighbors[vertex + 1]; ++neighborIdx) {
+            const int neighbor = neighbors[neighborIdx];
+            if (!isInPart[neighbor] && neighbor != bestRemoved && neighbor != bestSeparating) {
+                isInPart[neighbor] = true;
+                dfsStack.push_back(neighbor);
+                ++partSize;
+            }
+        }
+    }
+    const bool isSmaller = 2 * partSize <= numVertexes - 2;
+    side.clear();
+    for (int vertex = 0; vertex < numVertexes; ++vertex) {
+        if (vertex != bestRemoved && vertex != bestSeparating && isInPart[vertex] == isSmaller) {
+            side.insert(vertex);
+        }
+    }
+    separationPair = {std::min(bestRemoved, bestSeparating), std::max(bestRemoved, bestSeparating)};
+    return true;
+}
+
 void UndirectedRandomGraph::replaceMultiEdge(int fromVertex, int toVertex, const EdgeProbability &parallelEdgeValue) {
     _adjacencyMatrix->replaceMultiEdge(fromVertex, toVertex, parallelEdgeValue);
 }
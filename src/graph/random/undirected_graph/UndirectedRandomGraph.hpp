@@ -63,8 +63,11 @@ namespace grph::graph::random {
 
         double calculateCycleATR() const override;
 
+        /// the edge between the vertex with the lowest degree and its neighbor with the biggest number
         std::shared_ptr<RemoveRandomEdgeAction> removeRandomEdge() override;
 
+        std::shared_ptr<RemoveRandomEdgeAction> removeEdge(const Edge &edgeToRemove) override;
+
         // TODO: проверить правильность работы, если вершина с наибольшим номером
         // является частью окружения или одной из стягиваемых
         // TODO: а что происходит с удаляемым ребром?
@@ -74,6 +77,16 @@ namespace grph::graph::random {
         // является частью цепи
         std::shared_ptr<RemoveTrivialChainAction> removeTrivialChain(const Chain &trivialChain) override;
 
+        /// removes vertexes of degree <= 2 (the first one by number each time) while more than two are left:
+        /// a hanging vertex gives the factor p, a vertex of degree two is replaced with the edge
+        /// p1 * p2 / (p1 + p2 - p1 * p2) merged into a parallel one and gives p1 + p2 - p1 * p2,
+        /// an isolated vertex gives 0. For all-terminal reliability every vertex is a terminal, so the
+        /// Satyanarayana-Wood polygons (two chains with common ends) collapse to parallel edges here.
+        /// When no such vertex is left, an edge with p = 1 is contracted whatever the degrees of its ends:
+        /// it never fails, so the contraction gives the factor 1 and the edges of the removed end are merged
+        /// into parallel ones 1 - (1 - p) * (1 - q)
+        std::shared_ptr<ReduceSeriesParallelAction> reduceSeriesParallel() override;
+
         std::shared_ptr<AdjacencyMatrix<EdgeProbability>> getSubgraphAdjacencyMatrix(
                 const std::unordered_set<int> &subgraphVertexes
         ) const override;
@@ -87,6 +100,19 @@ namespace grph::graph::random {
                 const std::unordered_set<int> &connectivityComponent
         ) const override;
 
+        /// DFS from edge.minVertex() that stops as soon as edge.maxVertex() is reached, the mask is its
+        /// visited vertexes; O(V^2) on the adjacency matrix, nothing is kept between the queries. The exact
+        /// factoring never asks, its block pass leaves no bridges; ATR::AnytimeFactoring has no such pass
+        bool isBridge(const Edge &edge, std::vector<char> &minVertexSide) const override;
+
+        /// Tarjan's articulation points search, O(V^2) on the adjacency matrix;
+        /// empty if the graph is biconnected
+        std::vector<std::unordered_set<int>> findBlocks() const override;
+
+        /// articulation points of the graph without each vertex, O(V * E) on the lists of neighbors;
+        /// a part of one vertex would be a vertex of degree two, so the parts have at least two
+        bool findSeparationPair(std::pair<int, int> &separationPair, std::unordered_set<int> &side) const override;
+
     private:
         std::shared_ptr<AdjacencyMatrix<EdgeProbability>> _adjacencyMatrix;
         std::shared_ptr<DegreesVector> _degreesVector;
@@ -213,6 +239,39 @@ namespace grph::graph::random {
             double _chainFactor;
             int _middleVertexNum;
         };
+
+        class ReduceSeriesParallelActionURG : public ReduceSeriesParallelAction {
+        public:
+            struct Reduction {
+                int _removedVertexNum;
+                int _neighbor1; // VERTEX_NOT_FOUND for an isolated vertex
+                int _neighbor2; // VERTEX_NOT_FOUND for a hanging vertex
+                EdgeProbability _prevEdgeValue; // between the neighbors before a series reduction
+                // edges of _neighbor1 before a perfect edge to it was contracted, empty for the other reductions
+                std::vector<EdgeNode<EdgeProbability>> _remainingVertexSnapshot;
+            };
+
+            explicit ReduceSeriesParallelActionURG(
+                    UndirectedRandomGraph &graph,
+                    const std::shared_ptr<DegreesVector> &degreesVectorBeforeAction,
+                    std::vector<Reduction> &&reductions,
+                    double reductionFactor
+            ) : ReduceSeriesParallelAction(degreesVectorBeforeAction),
+                _graph(graph),
+                _reductions(std::move(reductions)),
+                _reductionFactor(reductionFactor) {};
+
+            void rollback() override;
+
+            double getReductionFactor() const override;
+
+            int getNumReductions() const override;
+
+        private:
+            UndirectedRandomGraph &_graph;
+            const std::vector<Reduction> _reductions;
+            double _reductionFactor;
+        };
     };
 
 }
@@ -3,13 +3,14 @@
 using namespace grph::graph::random;
 
 void UndirectedRandomGraph::PullEdgeActionURG::rollback() {
-    this->removeAllEdgesForRemainingVertex();
-    this->restoreEdgesFromSnapshot();
-
     _graph.restoreLastVertex();
     auto lastVertexNum = _graph._adjacencyMatrix->getDimension() - 1;
     _graph._adjacencyMatrix->renumberPairOfVertices(_prevRemovedVertexNum,
                                                     lastVertexNum);
+
+    // snapshot was taken before renumbering, so it is restored in the original numbering
+    this->removeAllEdgesForRemainingVertex();
+    this->restoreEdgesFromSnapshot();
     _graph.addEdgeInternal(_prevRemovedVertexNum, _remainingVertexNum, _removedEdgeValue);
 
     _graph._degreesVector = RollbackAction::_degreesVectorBeforeAction;
@@ -0,0 +1,33 @@
+#include "../UndirectedRandomGraph.hpp"
+
+using namespace grph::graph::random;
+
+void UndirectedRandomGraph::ReduceSeriesParallelActionURG::rollback() {
+    _graph._degreesVector = RollbackAction::_degreesVectorBeforeAction;
+
+    for (auto reduction = _reductions.rbegin(); reduction != _reductions.rend(); ++reduction) {
+        _graph.restoreLastVertex();
+        _graph._adjacencyMatrix->renumberPairOfVertices(_graph.getLastVertexNum(), reduction->_removedVertexNum);
+
+        if (!reduction->_remainingVertexSnapshot.empty()) {
+            // the snapshot holds the perfect edge too, it was taken before the contraction
+            _graph._adjacencyMatrix->zeroLine(reduction->_neighbor1);
+            _graph._adjacencyMatrix->zeroColumn(reduction->_neighbor1);
+            for (const auto &edgeSnapshot: reduction->_remainingVertexSnapshot) {
+                _graph.addEdgeInternal(reduction->_neighbor1,
+                                       edgeSnapshot.oppositeEnd(reduction->_neighbor1),
+                                       edgeSnapshot.value());
+            }
+        } else if (reduction->_neighbor2 != VERTEX_NOT_FOUND) {
+            _graph.addEdgeInternal(reduction->_neighbor1, reduction->_neighbor2, reduction->_prevEdgeValue);
+        }
+    }
+}
+
+double UndirectedRandomGraph::ReduceSeriesParallelActionURG::getReductionFactor() const {
+    return _reductionFactor;
+}
+
+int UndirectedRandomGraph::ReduceSeriesParallelActionURG::getNumReductions() const {
+    return static_cast<int>(_reductions.size());
+}
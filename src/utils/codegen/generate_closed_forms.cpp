@@ -0,0 +1,230 @@
+/// Generates src/graph/criteria/ClosedForms.hpp:
+///     ./generate_closed_forms > ../src/graph/criteria/ClosedForms.hpp
+///
+/// ATR of the complete graph on n vertexes (a missing edge has p = 0) as straight-line code.
+/// For a vertex set S with the vertex 0 the probability that S is connected is
+///     R(S) = 1 - sum over T, 0 in T, T != S: R(T) * C(T, S \ T),
+/// C(T, U) - probability that no edge between T and U is up. The products are shared:
+///     C(T, U) = C(T, U \ {u}) * Q(u, T),   Q(u, T) = Q(u, T \ {t}) * q(u, t),
+/// so the code has ~3^(n-1) multiplications and no branches.
+/// The overload with the gradient (up to MAX_GRADIENT_VERTEXES, the one for 8 vertexes compiles for minutes)
+/// adds the reverse pass over the same statements: dR / dp of every edge for ~2 times the multiplications.
+
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#define MAX_GRADIENT_VERTEXES 7
+
+namespace {
+
+    class ClosedFormGenerator {
+    public:
+        ClosedFormGenerator(int numVertexes, std::ostream &out) : _numVertexes(numVertexes), _out(out) {}
+
+        void generate() {
+            for (int vertex1 = 0; vertex1 < _numVertexes; ++vertex1) {
+                for (int vertex2 = vertex1 + 1; vertex2 < _numVertexes; ++vertex2) {
+                    _statements.push_back(Statement{q(vertex1, vertex2), {}, vertex1, vertex2});
+                }
+            }
+            const int allVertexes = (1 << _numVertexes) - 1;
+            const auto allConnected = connected(allVertexes);
+
+            _out << "        template<typename Matrix>\n"
+                 << "        static auto calculateCompleteGraph" << _numVertexes << "ATR(const Matrix &matrix) {\n";
+            emitStatements("auto");
+            _out << "            return " << allConnected << ";\n";
+            _out << "        }\n";
+
+            if (_numVertexes > MAX_GRADIENT_VERTEXES) {
+                return;
+            }
+            _out << "\n"
+                 << "        /// gradient[line * " << _numVertexes << " + column], line < column: dR / dp of the edge\n"
+                 << "        template<typename Matrix>\n"
+                 << "        static double calculateCompleteGraph" << _numVertexes
+                 << "ATR(const Matrix &matrix, double *gradient) {\n";
+            emitStatements("double");
+            _adjoints.insert(allConnected);
+            _out << "            double d_" << allConnected << " = 1.;\n";
+            for (auto statement = _statements.rbegin(); statement != _statements.rend(); ++statement) {
+                emitAdjoint(*statement);
+            }
+            _out << "            return " << allConnected << ";\n";
+            _out << "        }\n";
+        }
+
+    private:
+        static int highestBit(int mask) {
+            int bit = 0;
+            while (mask >> (bit + 1)) {
+                ++bit;
+            }
+            return bit;
+        }
+
+        /// name = 1 - p of the edge, name = product of the terms or name = 1 - sum of the products of the terms
+        struct Statement {
+            std::string name;
+            std::vector<std::vector<std::string>> terms;
+            int vertex1 = -1;
+            int vertex2 = -1;
+        };
+
+        void emitStatements(const std::string &type) {
+            for (const auto &statement: _statements) {
+                _out << "            const " << type << " " << statement.name << " = ";
+                if (statement.vertex1 >= 0) {
+                    _out << "1 - matrix.at(" << statement.vertex1 << ", " << statement.vertex2 << ")";
+                } else if (statement.name[0] != 'R') {
+                    _out << product(statement.terms[0]);
+                } else {
+                    std::string expression = product(statement.terms[0]);
+                    for (size_t termIdx = 1; termIdx < statement.terms.size(); ++termIdx) {
+                        expression += (termIdx % 4 == 0 ? "\n                    + " : " + ") +
+                                      product(statement.terms[termIdx]);
+                    }
+                    _out << (statement.terms.size() == 1 ? "1 - " + expression : "1 - (" + expression + ")");
+                }
+                _out << ";\n";
+            }
+        }
+
+        /// adds the derivatives of the statement to the adjoints of its operands
+        void emitAdjoint(const Statement &statement) {
+            const std::string adjoint = "d_" + statement.name;
+            if (!_adjoints.contains(statement.name)) {
+                if (statement.vertex1 >= 0) {
+                    _out << "            gradient[" << statement.vertex1 * _numVertexes + statement.vertex2 << "] = 0.;\n";
+                }
+                return;
+            }
+            if (statement.vertex1 >= 0) {
+                _out << "            gradient[" << statement.vertex1 * _numVertexes + statement.vertex2 << "] = -"
+                     << adjoint << ";\n";
+                return;
+            }
+            const std::string sign = statement.name[0] == 'R' ? "-" : "";
+            for (const auto &term: statement.terms) {
+                if (term.size() == 1) {
+                    accumulate(term[0], sign + adjoint);
+                } else {
+                    accumulate(term[0], sign + adjoint + " * " + term[1]);
+                    accumulate(term[1], sign + adjoint + " * " + term[0]);
+                }
+            }
+        }
+
+        void accumulate(const std::string &name, const std::string &expression) {
+            if (_adjoints.insert(name).second) {
+                _out << "            double d_" << name << " = " << expression << ";\n";
+            } else {
+                _out << "            d_" << name << " += " << expression << ";\n";
+            }
+        }
+
+        static std::string product(const std::vector<std::string> &factors) {
+            return factors.size() == 1 ? factors[0] : factors[0] + " * " + factors[1];
+        }
+
+        std::string q(int vertex1, int vertex2) const {
+            if (vertex1 > vertex2) {
+                std::swap(vertex1, vertex2);
+            }
+            return "q_" + std::to_string(vertex1) + "_" + std::to_string(vertex2);
+        }
+
+        /// no edge between the vertex and the set is up
+        std::string vertexCut(int vertex, int mask) {
+            const int top = highestBit(mask);
+            if (mask == (1 << top)) {
+                return q(vertex, top);
+            }
+            const std::string name = "Q_" + std::to_string(vertex) + "_" + std::to_string(mask);
+            if (_defined.insert(name).second) {
+                const auto rest = vertexCut(vertex, mask & ~(1 << top));
+                _statements.push_back(Statement{name, {{rest, q(vertex, top)}}});
+            }
+            return name;
+        }
+
+        /// no edge between the sets is up
+        std::string cut(int mask1, int mask2) {
+            const int top = highestBit(mask2);
+            if (mask2 == (1 << top)) {
+                return vertexCut(top, mask1);
+            }
+            const std::string name = "C_" + std::to_string(mask1) + "_" + std::to_string(mask2);
+            if (_defined.insert(name).second) {
+                const auto rest = cut(mask1, mask2 & ~(1 << top));
+                const auto last = vertexCut(top, mask1);
+                _statements.push_back(Statement{name, {{rest, last}}});
+            }
+            return name;
+        }
+
+        /// the vertexes of the set (with the vertex 0) are connected
+        std::string connected(int mask) {
+            if (mask == 1) {
+                return "1.";
+            }
+            const std::string name = "R_" + std::to_string(mask);
+            if (_defined.contains(name)) {
+                return name;
+            }
+
+            // T = {0} + any proper subset of the other vertexes of the set
+            std::vector<std::vector<std::string>> terms;
+            const int others = mask & ~1;
+            for (int subset = (others - 1) & others; ; subset = (subset - 1) & others) {
+                const int part = subset | 1;
+                const auto partR = connected(part);
+                const auto partCut = cut(part, mask & ~part);
+                terms.push_back(partR == "1." ? std::vector{partCut} : std::vector{partR, partCut});
+                if (subset == 0) {
+                    break;
+                }
+            }
+            _defined.insert(name);
+            _statements.push_back(Statement{name, terms});
+            return name;
+        }
+
+        const int _numVertexes;
+        std::ostream &_out;
+        std::set<std::string> _defined;
+        std::set<std::string> _adjoints;
+        std::vector<Statement> _statements;
+    };
+
+}
+
+int main() {
+    std::cout << "// Generated by src/utils/codegen/generate_closed_forms.cpp, do not edit.\n"
+                 "\n"
+                 "#ifndef GRPH_CLOSEDFORMS_HPP\n"
+                 "#define GRPH_CLOSEDFORMS_HPP\n"
+                 "\n"
+                 "#include \"../common/AdjacencyMatrix.hpp\"\n"
+                 "#include \"../common/types.hpp\"\n"
+                 "\n"
+                 "namespace grph::graph::random {\n"
+                 "\n"
+                 "    /// Matrix::at(line, column), line < column, is the probability of the edge: EdgeProbability\n"
+                 "    /// or a vector of them for a batch of graphs\n"
+                 "    class ClosedForms {\n"
+                 "    public:\n";
+    for (int numVertexes: {6, 7, 8}) {
+        if (numVertexes != 6) {
+            std::cout << "\n";
+        }
+        ClosedFormGenerator(numVertexes, std::cout).generate();
+    }
+    std::cout << "    };\n"
+                 "\n"
+                 "}\n"
+                 "\n"
+                 "#endif //GRPH_CLOSEDFORMS_HPP\n";
+}
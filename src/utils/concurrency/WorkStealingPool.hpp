@@ -0,0 +1,157 @@
+#ifndef GRPH_WORKSTEALINGPOOL_HPP
+#define GRPH_WORKSTEALINGPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace grph::utils {
+
+    /// Fork-join pool: every worker owns a deque, pops its own tasks LIFO and steals the oldest
+    /// (usually the biggest) tasks of other workers FIFO. run() returns when all tasks are processed.
+    template<typename TaskType>
+    class WorkStealingPool {
+    public:
+        using Handler = std::function<void(TaskType &task, int workerId)>;
+
+        explicit WorkStealingPool(int numWorkers)
+                : _numWorkers(numWorkers < 1 ? 1 : numWorkers),
+                  _queues(_numWorkers) {}
+
+        int getNumWorkers() const {
+            return _numWorkers;
+        }
+
+        /// may be called from a handler only
+        void push(int workerId, TaskType &&task) {
+            _pendingTasks.fetch_add(1, std::memory_order_relaxed);
+            {
+                std::lock_guard<std::mutex> lock(_queues[workerId]._mutex);
+                _queues[workerId]._tasks.push_back(std::move(task));
+            }
+            {
+                std::lock_guard<std::mutex> lock(_idleMutex);
+                ++_queuedTasks;
+            }
+            _idleCondition.notify_one();
+        }
+
+        size_t getQueueSize(int workerId) {
+            std::lock_guard<std::mutex> lock(_queues[workerId]._mutex);
+            return _queues[workerId]._tasks.size();
+        }
+
+        void run(TaskType &&rootTask, const Handler &handler) {
+            _pendingTasks = 1;
+            _queuedTasks = 1;
+            _stopped = false;
+            _error = nullptr;
+            _queues[0]._tasks.push_back(std::move(rootTask));
+
+            std::vector<std::thread> workers;
+            workers.reserve(_numWorkers);
+            for (int workerId = 0; workerId < _numWorkers; ++workerId) {
+                workers.emplace_back([this, workerId, &handler]() { workerLoop(workerId, handler); });
+            }
+            for (auto &worker: workers) {
+                worker.join();
+            }
+
+            for (auto &queue: _queues) {
+                queue._tasks.clear();
+            }
+            if (_error) {
+                std::rethrow_exception(_error);
+            }
+        }
+
+    private:
+        struct WorkerQueue {
+            std::mutex _mutex;
+            std::deque<TaskType> _tasks;
+        };
+
+        void workerLoop(int workerId, const Handler &handler) {
+            TaskType task;
+            while (!_stopped.load(std::memory_order_acquire)) {
+                if (!popOwn(workerId, task) && !steal(workerId, task)) {
+                    std::unique_lock<std::mutex> lock(_idleMutex);
+                    _idleCondition.wait(lock, [this]() {
+                        return _queuedTasks > 0 || _stopped.load(std::memory_order_acquire);
+                    });
+                    continue;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(_idleMutex);
+                    --_queuedTasks;
+                }
+
+                try {
+                    handler(task, workerId);
+                } catch (...) {
+                    {
+                        std::lock_guard<std::mutex> lock(_idleMutex);
+                        if (!_error) {
+                            _error = std::current_exception();
+                        }
+                    }
+                    stop();
+                }
+                task = TaskType();
+
+                if (_pendingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    stop();
+                }
+            }
+        }
+
+        void stop() {
+            {
+                std::lock_guard<std::mutex> lock(_idleMutex);
+                _stopped.store(true, std::memory_order_release);
+            }
+            _idleCondition.notify_all();
+        }
+
+        bool popOwn(int workerId, TaskType &task) {
+            std::lock_guard<std::mutex> lock(_queues[workerId]._mutex);
+            if (_queues[workerId]._tasks.empty()) {
+                return false;
+            }
+            task = std::move(_queues[workerId]._tasks.back());
+            _queues[workerId]._tasks.pop_back();
+            return true;
+        }
+
+        bool steal(int workerId, TaskType &task) {
+            for (int shift = 1; shift < _numWorkers; ++shift) {
+                auto &victim = _queues[(workerId + shift) % _numWorkers];
+                std::lock_guard<std::mutex> lock(victim._mutex);
+                if (!victim._tasks.empty()) {
+                    task = std::move(victim._tasks.front());
+                    victim._tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        const int _numWorkers;
+        std::vector<WorkerQueue> _queues;
+        std::atomic<long> _pendingTasks{0};
+        std::atomic<bool> _stopped{false};
+        std::exception_ptr _error;
+        long _queuedTasks = 0; // in the deques, guarded by _idleMutex
+        std::mutex _idleMutex;
+        std::condition_variable _idleCondition;
+    };
+
+}
+
+#endif //GRPH_WORKSTEALINGPOOL_HPP
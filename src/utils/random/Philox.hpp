@@ -0,0 +1,36 @@
+#ifndef GRPH_PHILOX_HPP
+#define GRPH_PHILOX_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace grph::utils {
+
+    /// Philox4x32-10 of Salmon et al.: a counter-based generator, the numbers of a counter depend on the key
+    /// and the counter only, so any sample can be drawn in any thread in any order
+    class Philox {
+    public:
+        using Counter = std::array<uint32_t, 4>;
+
+        explicit Philox(uint64_t seed) : _key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)} {}
+
+        Counter operator()(Counter counter) const {
+            auto key = _key;
+            for (int round = 0; round < 10; ++round) {
+                const uint64_t product0 = static_cast<uint64_t>(0xD2511F53) * counter[0];
+                const uint64_t product1 = static_cast<uint64_t>(0xCD9E8D57) * counter[2];
+                counter = {static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0], static_cast<uint32_t>(product1),
+                           static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1], static_cast<uint32_t>(product0)};
+                key[0] += 0x9E3779B9;
+                key[1] += 0xBB67AE85;
+            }
+            return counter;
+        }
+
+    private:
+        std::array<uint32_t, 2> _key;
+    };
+
+}
+
+#endif //GRPH_PHILOX_HPP